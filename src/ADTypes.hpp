@@ -1,6 +1,8 @@
 #ifndef __AD_TYPES__
 #define __AD_TYPES__
 
+#include <type_traits>
+
 #include <Sacado.hpp>
 #include <CoDiPack/include/codi.hpp>
 #include <deal.II/differentiation/ad/sacado_math.h>
@@ -26,6 +28,16 @@ using codi_HessianComputationType  = codi::RealReversePrimalIndexGen< codi::Real
 //using RadFadType = codi_JacobianComputationType; ///< Reverse only mode that only allows Jacobian computation.
 using RadType = codi_JacobianComputationType; ///< CoDiPaco reverse-AD type for first derivatives.
 using RadFadType = codi_HessianComputationType ; ///< Nested reverse-forward mode type for Jacobian and Hessian computation using TapeHelper.
+
+/// Static-size forward type of the primal values of RadFadType.
+/** Evaluating RadFadType while its tape is not recording only computes those primal values, which
+ *  propagates dimForwardAD tangents without recording nor allocating any derivative array on the heap,
+ *  unlike FadType. Used for the directional derivatives of the residual, which therefore reuse the
+ *  RadFadType physics instead of requiring another instantiation of every physics and numerical flux.
+ */
+using codi_TangentType = codi::RealForwardVec<dimForwardAD>;
+static_assert(std::is_same<RadFadType::Real, codi_TangentType>::value,
+              "The primal values of RadFadType must be the static-size forward type.");
 } // PHiLiP namespace
 
 #endif
@@ -0,0 +1,95 @@
+#ifndef PHILIP_CODI_TAPE_CACHE_HPP
+#define PHILIP_CODI_TAPE_CACHE_HPP
+
+#include <map>
+#include <utility>
+
+#include "ADTypes.hpp"
+
+namespace PHiLiP {
+
+/// CoDiPack tape helper and derivative storage reused by the taped cell derivatives.
+/** A single TapeHelper records every cell, its startRecording() resetting the global tape while
+ *  keeping its memory. The dense Jacobian and Hessian it fills are kept per number of outputs and
+ *  inputs, which identify the cell type: polynomial degree, grid degree, and whether the term is a
+ *  volume, boundary or face term. Cells of the same type therefore reuse the same storage instead
+ *  of allocating and freeing it for every cell.
+ *
+ *  The tapes themselves are re-recorded for every cell. Re-evaluating a stored primal-value tape
+ *  with new inputs would reuse the passive data recorded with it, such as the dual, the penalty
+ *  and the branches taken by the numerical fluxes and boundary conditions, which all vary from
+ *  one cell to another.
+ */
+template <typename adtype>
+class CoDiTapeCache
+{
+public:
+    /// Tape helper recording the cells.
+    using TapeHelper = codi::TapeHelper<adtype>;
+    /// Dense Jacobian filled by TapeHelper::evalJacobian().
+    using JacobianType = typename TapeHelper::JacobianType;
+    /// Dense Hessian filled by TapeHelper::evalHessian().
+    using HessianType = typename TapeHelper::HessianType;
+
+    /// Constructor.
+    CoDiTapeCache() = default;
+    /// The stored derivatives belong to the tape helper, hence no copies.
+    CoDiTapeCache(const CoDiTapeCache &) = delete;
+    /// The stored derivatives belong to the tape helper, hence no copies.
+    CoDiTapeCache & operator=(const CoDiTapeCache &) = delete;
+
+    /// Destructor releasing the stored derivatives.
+    ~CoDiTapeCache()
+    {
+        for (auto &size_and_jacobian : jacobians) tape_helper.deleteJacobian(*(size_and_jacobian.second));
+        for (auto &size_and_hessian : hessians) tape_helper.deleteHessian(*(size_and_hessian.second));
+    }
+
+    /// Jacobian sized for the inputs and outputs of the current recording.
+    /** Every entry is overwritten by TapeHelper::evalJacobian().
+     */
+    JacobianType & jacobian()
+    {
+        const std::pair<int,int> size(tape_helper.getOutputSize(), tape_helper.getInputSize());
+        auto stored = jacobians.find(size);
+        if (stored == jacobians.end()) {
+            ++allocation_count;
+            stored = jacobians.emplace(size, &(tape_helper.createJacobian())).first;
+        }
+        return *(stored->second);
+    }
+
+    /// Hessian sized for the inputs and outputs of the current recording.
+    /** Every entry is overwritten by TapeHelper::evalHessian().
+     */
+    HessianType & hessian()
+    {
+        const std::pair<int,int> size(tape_helper.getOutputSize(), tape_helper.getInputSize());
+        auto stored = hessians.find(size);
+        if (stored == hessians.end()) {
+            ++allocation_count;
+            stored = hessians.emplace(size, &(tape_helper.createHessian())).first;
+        }
+        return *(stored->second);
+    }
+
+    /// Number of Jacobians and Hessians created since construction.
+    /** Once every cell type has been visited, this stays constant.
+     */
+    unsigned int n_allocations() const { return allocation_count; }
+
+    /// Tape helper recording the cells.
+    TapeHelper tape_helper;
+
+private:
+    /// Jacobians per number of outputs and inputs.
+    std::map<std::pair<int,int>, JacobianType*> jacobians;
+    /// Hessians per number of outputs and inputs.
+    std::map<std::pair<int,int>, HessianType*> hessians;
+    /// Counter returned by n_allocations().
+    unsigned int allocation_count = 0;
+};
+
+} // PHiLiP namespace
+
+#endif
@@ -1,11 +1,18 @@
 #include<limits>
 #include<fstream>
+#include <algorithm>
+#include <exception>
+#include <mutex>
 #include <deal.II/base/parameter_handler.h>
 #include <deal.II/base/tensor.h>
 
 #include <deal.II/base/qprojector.h>
+#include <deal.II/base/graph_coloring.h>
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/thread_management.h>
 
 #include <deal.II/grid/tria.h>
+#include <deal.II/grid/filtered_iterator.h>
 #include <deal.II/distributed/shared_tria.h>
 #include <deal.II/distributed/tria.h>
 
@@ -63,8 +70,9 @@ DGBase<dim,real,MeshType>::DGBase(
     const unsigned int degree,
     const unsigned int max_degree_input,
     const unsigned int grid_degree_input,
-    const std::shared_ptr<Triangulation> triangulation_input)
-    : DGBase<dim,real,MeshType>(nstate_input, parameters_input, degree, max_degree_input, grid_degree_input, triangulation_input, this->create_collection_tuple(max_degree_input, nstate_input, parameters_input))
+    const std::shared_ptr<Triangulation> triangulation_input,
+    const MPI_Comm mpi_communicator_input)
+    : DGBase<dim,real,MeshType>(nstate_input, parameters_input, degree, max_degree_input, grid_degree_input, triangulation_input, this->create_collection_tuple(max_degree_input, nstate_input, parameters_input), mpi_communicator_input)
 { }
 
 template <int dim, typename real, typename MeshType>
@@ -75,7 +83,8 @@ DGBase<dim,real,MeshType>::DGBase(
     const unsigned int max_degree_input,
     const unsigned int grid_degree_input,
     const std::shared_ptr<Triangulation> triangulation_input,
-    const MassiveCollectionTuple collection_tuple)
+    const MassiveCollectionTuple collection_tuple,
+    const MPI_Comm mpi_communicator_input)
     : all_parameters(parameters_input)
     , nstate(nstate_input)
     , initial_degree(degree)
@@ -92,12 +101,13 @@ DGBase<dim,real,MeshType>::DGBase(
     , oneD_quadrature_collection(std::get<7>(collection_tuple))
     , oneD_face_quadrature(max_degree)
     , dof_handler(*triangulation, true)
-    , high_order_grid(std::make_shared<HighOrderGrid<dim,real,MeshType>>(grid_degree_input, triangulation, all_parameters->check_valid_metric_Jacobian, all_parameters->do_renumber_dofs, all_parameters->output_high_order_grid))
+    , high_order_grid(std::make_shared<HighOrderGrid<dim,real,MeshType>>(grid_degree_input, triangulation, all_parameters->check_valid_metric_Jacobian, all_parameters->do_renumber_dofs, all_parameters->output_high_order_grid, mpi_communicator_input))
     , fe_q_artificial_dissipation(1)
     , dof_handler_artificial_dissipation(*triangulation, false)
-    , mpi_communicator(MPI_COMM_WORLD)
+    , mpi_communicator(mpi_communicator_input)
     , pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_communicator)==0)
     , freeze_artificial_dissipation(false)
+    , use_cell_batched_residual(all_parameters->use_cell_batched_residual)
     , max_artificial_dissipation_coeff(0.0)
 {
 
@@ -310,7 +320,7 @@ unsigned int DGBase<dim,real,MeshType>::get_max_fe_degree()
         if(cell->is_locally_owned() && cell->active_fe_index() > max_fe_degree)
             max_fe_degree = cell->active_fe_index();
 
-    return dealii::Utilities::MPI::max(max_fe_degree, MPI_COMM_WORLD);
+    return dealii::Utilities::MPI::max(max_fe_degree, mpi_communicator);
 }
 
 template <int dim, typename real, typename MeshType>
@@ -322,7 +332,7 @@ unsigned int DGBase<dim,real,MeshType>::get_min_fe_degree()
         if(cell->is_locally_owned() && cell->active_fe_index() < min_fe_degree)
             min_fe_degree = cell->active_fe_index();
 
-    return dealii::Utilities::MPI::min(min_fe_degree, MPI_COMM_WORLD);
+    return dealii::Utilities::MPI::min(min_fe_degree, mpi_communicator);
 }
 
 template <int dim, typename real, typename MeshType>
@@ -398,7 +408,7 @@ template<typename DoFCellAccessorType>
 real DGBase<dim,real,MeshType>::evaluate_penalty_scaling (
     const DoFCellAccessorType &cell,
     const int iface,
-    const dealii::hp::FECollection<dim> fe_collection) const
+    const dealii::hp::FECollection<dim> &fe_collection) const
 {
 
     const unsigned int fe_index = cell->active_fe_index();
@@ -413,6 +423,51 @@ real DGBase<dim,real,MeshType>::evaluate_penalty_scaling (
     return penalty;
 }
 
+template <int dim, typename real, typename MeshType>
+template<typename DoFCellAccessorType, typename Visitor>
+void DGBase<dim,real,MeshType>::for_each_face_neighbor_cell (const DoFCellAccessorType &cell, const Visitor &visit) const
+{
+    for (unsigned int iface=0; iface < dealii::GeometryInfo<dim>::faces_per_cell; ++iface) {
+        const bool is_periodic = cell->face(iface)->at_boundary() && cell->has_periodic_neighbor(iface);
+        if (cell->face(iface)->at_boundary() && !is_periodic) continue;
+
+        auto neighbor_cell = cell->neighbor_or_periodic_neighbor(iface);
+        if (!neighbor_cell->has_children()) {
+            visit(neighbor_cell);
+            continue;
+        }
+        const unsigned int neighbor_iface = is_periodic ? cell->periodic_neighbor_face_no(iface) : cell->neighbor_face_no(iface);
+        if constexpr (dim == 1) {
+            // Faces have no children in 1D, the finer neighbor is the descendant on the neighbor's face towards the cell.
+            const unsigned int child_on_face = dealii::GeometryInfo<dim>::child_cell_on_face(dealii::RefinementCase<dim>::isotropic_refinement, neighbor_iface, 0);
+            while (neighbor_cell->has_children()) neighbor_cell = neighbor_cell->child(child_on_face);
+            visit(neighbor_cell);
+        } else {
+            for (unsigned int isubface=0; isubface < neighbor_cell->face(neighbor_iface)->n_children(); ++isubface) {
+                if (is_periodic) {
+                    visit(cell->periodic_neighbor_child_on_subface(iface, isubface));
+                } else {
+                    visit(cell->neighbor_child_on_subface(iface, isubface));
+                }
+            }
+        }
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+template<typename DoFCellAccessorType>
+bool DGBase<dim,real,MeshType>::cell_has_terms_of_active_time_level (const DoFCellAccessorType &cell) const
+{
+    if (time_level_is_active(cell->active_cell_index())) return true;
+
+    // Faces with a neighbor of the active level
+    bool has_terms = false;
+    for_each_face_neighbor_cell(cell, [&](const auto &neighbor_cell) {
+        has_terms = has_terms || time_level_is_active(neighbor_cell->active_cell_index());
+    });
+    return has_terms;
+}
+
 template <int dim, typename real, typename MeshType>
 template<typename DoFCellAccessorType1, typename DoFCellAccessorType2>
 bool DGBase<dim,real,MeshType>::current_cell_should_do_the_work (
@@ -468,12 +523,20 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
     OPERATOR::vol_projection_operator<dim,2*dim,real> &soln_basis_projection_oper_int,
     OPERATOR::vol_projection_operator<dim,2*dim,real> &soln_basis_projection_oper_ext,
     OPERATOR::mapping_shape_functions<dim,2*dim,real> &mapping_basis,
+    ScratchArena                                      &scratch_arena,
     const bool compute_auxiliary_right_hand_side,
     dealii::LinearAlgebra::distributed::Vector<double> &rhs,
     std::array<dealii::LinearAlgebra::distributed::Vector<double>,dim> &rhs_aux)
 {
-    std::vector<dealii::types::global_dof_index> current_dofs_indices;
-    std::vector<dealii::types::global_dof_index> neighbor_dofs_indices;
+    // With local time stepping, only the terms of the active time level are assembled, see set_active_time_level()
+    const bool restricts_time_level = (active_time_level >= 0) && !compute_auxiliary_right_hand_side;
+    if (restricts_time_level && !cell_has_terms_of_active_time_level(current_cell)) return;
+
+    // The local containers below are kept in the scratch arena across cells.
+    Assert(dynamic_cast<CellScratchArena<dim,real>*>(&scratch_arena) != nullptr,
+           dealii::ExcMessage("The scratch arena was not created by create_scratch_arena()."));
+    CellScratchArena<dim,real> &cell_arena = static_cast<CellScratchArena<dim,real>&>(scratch_arena);
+    using Side = typename CellScratchArena<dim,real>::Side;
 
     // Current reference element related to this physical cell
     const int i_fele = current_cell->active_fe_index();
@@ -482,43 +545,33 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
     const unsigned int n_dofs_curr_cell = current_fe_ref.n_dofs_per_cell();
 
     // Local vector contribution from each cell
-    dealii::Vector<real> current_cell_rhs (n_dofs_curr_cell); // Defaults to 0.0 initialization
+    dealii::Vector<real> &current_cell_rhs = cell_arena.cell_rhs(Side::interior, n_dofs_curr_cell); // Defaults to 0.0 initialization
     // Local vector contribution from each cell for Auxiliary equations
-    std::vector<dealii::Tensor<1,dim,double>> current_cell_rhs_aux (n_dofs_curr_cell);// Defaults to 0.0 initialization
+    std::vector<dealii::Tensor<1,dim,double>> &current_cell_rhs_aux = cell_arena.cell_rhs_aux(Side::interior, n_dofs_curr_cell);// Defaults to 0.0 initialization
 
     // Obtain the mapping from local dof indices to global dof indices
-    current_dofs_indices.resize(n_dofs_curr_cell);
+    std::vector<dealii::types::global_dof_index> &current_dofs_indices = cell_arena.cell_dof_indices(Side::interior, n_dofs_curr_cell);
     current_cell->get_dof_indices (current_dofs_indices);
 
     const unsigned int grid_degree = this->high_order_grid->fe_system.tensor_degree();
     const unsigned int poly_degree = i_fele;
 
     const unsigned int n_metric_dofs_cell = high_order_grid->fe_system.dofs_per_cell;
-    std::vector<dealii::types::global_dof_index> current_metric_dofs_indices(n_metric_dofs_cell);
-    std::vector<dealii::types::global_dof_index> neighbor_metric_dofs_indices(n_metric_dofs_cell);
+    std::vector<dealii::types::global_dof_index> &current_metric_dofs_indices = cell_arena.metric_dof_indices(Side::interior, n_metric_dofs_cell);
+    std::vector<dealii::types::global_dof_index> &neighbor_metric_dofs_indices = cell_arena.metric_dof_indices(Side::exterior, n_metric_dofs_cell);
     current_metric_cell->get_dof_indices (current_metric_dofs_indices);
 
     const dealii::types::global_dof_index current_cell_index = current_cell->active_cell_index();
 
-    std::array<std::vector<real>,dim> mapping_support_points;
+    std::array<std::vector<real>,dim> &mapping_support_points = cell_arena.mapping_support_points();
     //if have source term need to store vol flux nodes.
     const bool store_vol_flux_nodes = all_parameters->manufactured_convergence_study_param.manufactured_solution_param.use_manufactured_source_term;
     //for boundary conditions not periodic we need surface flux nodes
     //should change this flag to something like if have face on boundary not periodic in the future
     const bool store_surf_flux_nodes = (all_parameters->use_periodic_bc) ? false : true;
-    OPERATOR::metric_operators<real,dim,2*dim> metric_oper_int(nstate, poly_degree, grid_degree,
-                                                               store_vol_flux_nodes,
-                                                               store_surf_flux_nodes);
-
-    //flag to terminate if strong form and implicit
-    if((this->all_parameters->use_weak_form==false) 
-       && (this->all_parameters->ode_solver_param.ode_solver_type
-                    == Parameters::ODESolverParam::ODESolverEnum::implicit_solver))
-    {
-        pcout<<"ERROR: Implicit does not currently work for strong form. Aborting..."<<std::endl;
-        std::abort();
-    }
-
+    OPERATOR::metric_operators<real,dim,2*dim> &metric_oper_int = cell_arena.metric_operators(Side::interior, nstate, poly_degree, grid_degree,
+                                                                                             store_vol_flux_nodes,
+                                                                                             store_surf_flux_nodes);
 
     assemble_volume_term_and_build_operators(
         current_cell,
@@ -535,6 +588,7 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
         metric_oper_int,
         mapping_basis,
         mapping_support_points,
+        scratch_arena,
         fe_values_collection_volume,
         fe_values_collection_volume_lagrange,
         current_fe_ref,
@@ -553,6 +607,9 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
         // CASE 1: FACE AT BOUNDARY
         if ((current_face->at_boundary() && !current_cell->has_periodic_neighbor(iface)))
         {
+            // Boundary terms belong to the level of the cell
+            if (restricts_time_level && !time_level_is_active(current_cell_index)) continue;
+
             const real penalty = evaluate_penalty_scaling (current_cell, iface, fe_collection);
 
             const unsigned int boundary_id = current_face->boundary_id();
@@ -575,6 +632,7 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
                 metric_oper_int,
                 mapping_basis,
                 mapping_support_points,
+                scratch_arena,
                 fe_values_collection_face_int,
                 current_fe_ref,
                 current_cell_rhs,
@@ -590,15 +648,19 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
 
             const auto neighbor_cell = current_cell->periodic_neighbor(iface);
 
-            if (!current_cell->periodic_neighbor_is_coarser(iface) && current_cell_should_do_the_work(current_cell, neighbor_cell)) 
+            const bool face_has_terms_of_active_level = !restricts_time_level
+                                                        || time_level_is_active(current_cell_index)
+                                                        || time_level_is_active(neighbor_cell->active_cell_index());
+            if (!current_cell->periodic_neighbor_is_coarser(iface) && current_cell_should_do_the_work(current_cell, neighbor_cell)
+                && face_has_terms_of_active_level) 
             {
                 Assert (current_cell->periodic_neighbor(iface).state() == dealii::IteratorState::valid, dealii::ExcInternalError());
 
                 const unsigned int n_dofs_neigh_cell = fe_collection[neighbor_cell->active_fe_index()].n_dofs_per_cell();
-                dealii::Vector<real> neighbor_cell_rhs (n_dofs_neigh_cell); // Defaults to 0.0 initialization
+                dealii::Vector<real> &neighbor_cell_rhs = cell_arena.cell_rhs(Side::exterior, n_dofs_neigh_cell); // Defaults to 0.0 initialization
 
                 // Obtain the mapping from local dof indices to global dof indices for neighbor cell
-                neighbor_dofs_indices.resize(n_dofs_neigh_cell);
+                std::vector<dealii::types::global_dof_index> &neighbor_dofs_indices = cell_arena.cell_dof_indices(Side::exterior, n_dofs_neigh_cell);
                 neighbor_cell->get_dof_indices (neighbor_dofs_indices);
 
                 // Corresponding face of the neighbor.
@@ -617,10 +679,10 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
 
                 const unsigned int poly_degree_ext = i_fele_n;
                 const unsigned int grid_degree_ext = this->high_order_grid->fe_system.tensor_degree();    
-                //constructor doesn't build anything
-                OPERATOR::metric_operators<real,dim,2*dim> metric_oper_ext(nstate, poly_degree_ext, grid_degree_ext,
-                                                                           store_vol_flux_nodes,
-                                                                           store_surf_flux_nodes);
+                //built by the face term
+                OPERATOR::metric_operators<real,dim,2*dim> &metric_oper_ext = cell_arena.metric_operators(Side::exterior, nstate, poly_degree_ext, grid_degree_ext,
+                                                                                                             store_vol_flux_nodes,
+                                                                                                             store_surf_flux_nodes);
 
                 assemble_face_term_and_build_operators(
                     current_cell,
@@ -649,6 +711,7 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
                     metric_oper_ext,
                     mapping_basis,
                     mapping_support_points,
+                    scratch_arena,
                     fe_values_collection_face_int,
                     fe_values_collection_face_ext,
                     current_cell_rhs,
@@ -678,6 +741,9 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
             const auto neighbor_cell = current_cell->neighbor(iface);
             const unsigned int neighbor_iface = current_cell->neighbor_face_no(iface);
 
+            if (restricts_time_level && !time_level_is_active(current_cell_index)
+                && !time_level_is_active(neighbor_cell->active_cell_index())) continue;
+
             // Find corresponding subface
             unsigned int neighbor_i_subface = 0;
             unsigned int n_subface = dealii::GeometryInfo<dim>::n_subfaces(neighbor_cell->subface_case(neighbor_iface));
@@ -692,10 +758,10 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
             const int i_fele_n = neighbor_cell->active_fe_index();//, i_quad_n = i_fele_n, i_mapp_n = 0;
 
             const unsigned int n_dofs_neigh_cell = fe_collection[i_fele_n].n_dofs_per_cell();
-            dealii::Vector<real> neighbor_cell_rhs (n_dofs_neigh_cell); // Defaults to 0.0 initialization
+            dealii::Vector<real> &neighbor_cell_rhs = cell_arena.cell_rhs(Side::exterior, n_dofs_neigh_cell); // Defaults to 0.0 initialization
 
             // Obtain the mapping from local dof indices to global dof indices for neighbor cell
-            neighbor_dofs_indices.resize(n_dofs_neigh_cell);
+            std::vector<dealii::types::global_dof_index> &neighbor_dofs_indices = cell_arena.cell_dof_indices(Side::exterior, n_dofs_neigh_cell);
             neighbor_cell->get_dof_indices (neighbor_dofs_indices);
 
             const real penalty1 = evaluate_penalty_scaling (current_cell, iface, fe_collection);
@@ -709,9 +775,9 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
             const unsigned int poly_degree_ext = i_fele_n;
             const unsigned int grid_degree_ext = this->high_order_grid->fe_system.tensor_degree();
             //Check if the poly degree or mapping changed order, in which case, then we re-compute the corresponding basis
-            OPERATOR::metric_operators<real,dim,2*dim> metric_oper_ext(nstate, poly_degree_ext, grid_degree_ext,
-                                                               store_vol_flux_nodes,
-                                                               store_surf_flux_nodes);
+            OPERATOR::metric_operators<real,dim,2*dim> &metric_oper_ext = cell_arena.metric_operators(Side::exterior, nstate, poly_degree_ext, grid_degree_ext,
+                                                                                                         store_vol_flux_nodes,
+                                                                                                         store_surf_flux_nodes);
 
             assemble_subface_term_and_build_operators(
                 current_cell,
@@ -741,6 +807,7 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
                 metric_oper_ext,
                 mapping_basis,
                 mapping_support_points,
+                scratch_arena,
                 fe_values_collection_face_int,
                 fe_values_collection_subface,
                 current_cell_rhs,
@@ -753,7 +820,10 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
         }
         // CASE 5: NEIGHBOR CELL HAS SAME COARSENESS
         // Therefore, we need to choose one of them to do the work
-        else if (current_cell_should_do_the_work(current_cell, current_cell->neighbor(iface))) 
+        else if (current_cell_should_do_the_work(current_cell, current_cell->neighbor(iface))
+                 && (!restricts_time_level
+                     || time_level_is_active(current_cell_index)
+                     || time_level_is_active(current_cell->neighbor_or_periodic_neighbor(iface)->active_cell_index()))) 
         {
             Assert (current_cell->neighbor(iface).state() == dealii::IteratorState::valid, dealii::ExcInternalError());
 
@@ -766,10 +836,10 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
             const unsigned int n_dofs_neigh_cell = fe_collection[neighbor_cell->active_fe_index()].n_dofs_per_cell();
 
             // Local rhs contribution from neighbor
-            dealii::Vector<real> neighbor_cell_rhs (n_dofs_neigh_cell); // Defaults to 0.0 initialization
+            dealii::Vector<real> &neighbor_cell_rhs = cell_arena.cell_rhs(Side::exterior, n_dofs_neigh_cell); // Defaults to 0.0 initialization
 
             // Obtain the mapping from local dof indices to global dof indices for neighbor cell
-            neighbor_dofs_indices.resize(n_dofs_neigh_cell);
+            std::vector<dealii::types::global_dof_index> &neighbor_dofs_indices = cell_arena.cell_dof_indices(Side::exterior, n_dofs_neigh_cell);
             neighbor_cell->get_dof_indices (neighbor_dofs_indices);
 
             const int i_fele_n = neighbor_cell->active_fe_index();
@@ -788,9 +858,9 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
             // For now high_order_grid only handles all cells of same grid degree.
             const unsigned int grid_degree_ext = this->high_order_grid->fe_system.tensor_degree();
             //Check if the poly degree or mapping changed order, in which case, then we re-compute the corresponding basis
-            OPERATOR::metric_operators<real,dim,2*dim> metric_oper_ext(nstate, poly_degree_ext, grid_degree_ext,
-                                                               store_vol_flux_nodes,
-                                                               store_surf_flux_nodes);
+            OPERATOR::metric_operators<real,dim,2*dim> &metric_oper_ext = cell_arena.metric_operators(Side::exterior, nstate, poly_degree_ext, grid_degree_ext,
+                                                                                                         store_vol_flux_nodes,
+                                                                                                         store_surf_flux_nodes);
 
             assemble_face_term_and_build_operators(
                 current_cell,
@@ -819,6 +889,7 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
                 metric_oper_ext,
                 mapping_basis,
                 mapping_support_points,
+                scratch_arena,
                 fe_values_collection_face_int,
                 fe_values_collection_face_ext,
                 current_cell_rhs,
@@ -1075,6 +1146,12 @@ void DGBase<dim,real,MeshType>::reinit_operators_for_cell_residual_loop(
     flux_basis_ext.build_1D_surface_operator(oneD_fe_collection_flux[poly_degree_ext], oneD_face_quadrature);
     flux_basis_ext.build_1D_surface_gradient_operator(oneD_fe_collection_flux[poly_degree_ext], oneD_face_quadrature);
 
+    //surface operators in the "sum-factorized" Hadamard product form for split forms
+    if(all_parameters->use_split_form || all_parameters->use_curvilinear_split_form){
+        flux_basis_int.build_surface_Hadamard_operators(oneD_quadrature_collection[poly_degree_int]);
+        flux_basis_ext.build_surface_Hadamard_operators(oneD_quadrature_collection[poly_degree_ext]);
+    }
+
     //flux basis stiffness operator for skew-symmetric form
     flux_basis_stiffness.build_1D_volume_operator(oneD_fe_collection_flux[poly_degree_int], oneD_quadrature_collection[poly_degree_int]);
 
@@ -1087,6 +1164,283 @@ void DGBase<dim,real,MeshType>::reinit_operators_for_cell_residual_loop(
     mapping_basis.build_1D_shape_functions_at_flux_nodes(high_order_grid->oneD_fe_system, oneD_quadrature_collection[poly_degree_ext], oneD_face_quadrature);
 }
 
+template <int dim, typename real, typename MeshType>
+DGBase<dim,real,MeshType>::CellResidualScratchData::CellResidualScratchData(
+    DGBase<dim,real,MeshType>                &dg,
+    const dealii::hp::MappingCollection<dim> &mapping_collection,
+    ScratchArena                             &scratch_arena_input)
+    : fe_values_collection_volume (mapping_collection, dg.fe_collection, dg.volume_quadrature_collection, dg.volume_update_flags)
+    , fe_values_collection_face_int (mapping_collection, dg.fe_collection, dg.face_quadrature_collection, dg.face_update_flags)
+    , fe_values_collection_face_ext (mapping_collection, dg.fe_collection, dg.face_quadrature_collection, dg.neighbor_face_update_flags)
+    , fe_values_collection_subface (mapping_collection, dg.fe_collection, dg.face_quadrature_collection, dg.face_update_flags)
+    , fe_values_collection_volume_lagrange (mapping_collection, dg.fe_collection_lagrange, dg.volume_quadrature_collection, dg.volume_update_flags)
+    , soln_basis_int(1, dg.max_degree, dg.high_order_grid->fe_system.tensor_degree())
+    , soln_basis_ext(1, dg.max_degree, dg.high_order_grid->fe_system.tensor_degree())
+    , flux_basis_int(1, dg.max_degree, dg.high_order_grid->fe_system.tensor_degree())
+    , flux_basis_ext(1, dg.max_degree, dg.high_order_grid->fe_system.tensor_degree())
+    , flux_basis_stiffness(1, dg.max_degree, dg.high_order_grid->fe_system.tensor_degree(), true)
+    , soln_basis_projection_oper_int(1, dg.max_degree, dg.high_order_grid->fe_system.tensor_degree())
+    , soln_basis_projection_oper_ext(1, dg.max_degree, dg.high_order_grid->fe_system.tensor_degree())
+    , mapping_basis(1, dg.high_order_grid->fe_system.tensor_degree(), dg.high_order_grid->fe_system.tensor_degree())
+    , scratch_arena(scratch_arena_input)
+{
+    dg.reinit_operators_for_cell_residual_loop(
+        dg.max_degree, dg.max_degree, dg.high_order_grid->fe_system.tensor_degree(),
+        soln_basis_int, soln_basis_ext,
+        flux_basis_int, flux_basis_ext,
+        flux_basis_stiffness,
+        soln_basis_projection_oper_int, soln_basis_projection_oper_ext,
+        mapping_basis);
+}
+
+template <int dim, typename real, typename MeshType>
+std::unique_ptr<ScratchArena> DGBase<dim,real,MeshType>::create_scratch_arena() const
+{
+    return std::make_unique<CellScratchArena<dim,real>>();
+}
+
+template <int dim, typename real, typename MeshType>
+bool DGBase<dim,real,MeshType>::prepare_cell_batches()
+{
+    return false;
+}
+
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::assemble_cell_batched_residual(std::vector<std::unique_ptr<CellResidualScratchData>> &/*scratch_data*/)
+{
+    pcout << "ERROR: The discretization has no residual assembled in batches of cells. Aborting..." << std::endl;
+    std::abort();
+}
+
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::allocate_scratch_arenas(const unsigned int n_arenas)
+{
+    while (scratch_arenas.size() < n_arenas) {
+        scratch_arenas.push_back(create_scratch_arena());
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+unsigned int DGBase<dim,real,MeshType>::n_scratch_arena_allocations() const
+{
+    unsigned int n_allocations = 0;
+    for (const auto &scratch_arena : scratch_arenas) {
+        n_allocations += scratch_arena->n_allocations();
+    }
+    return n_allocations;
+}
+
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::assemble_cell_residual_range (
+    const std::vector<typename dealii::DoFHandler<dim>::active_cell_iterator> &cells,
+    const unsigned int first,
+    const unsigned int last,
+    CellResidualScratchData &scratch_data,
+    const bool compute_dRdW, const bool compute_dRdX, const bool compute_d2R)
+{
+    for (unsigned int icell = first; icell < last; ++icell) {
+        const auto &soln_cell = cells[icell];
+        const typename dealii::DoFHandler<dim>::active_cell_iterator metric_cell(
+            triangulation.get(), soln_cell->level(), soln_cell->index(), &(high_order_grid->dof_handler_grid));
+
+        assemble_cell_residual (
+            soln_cell,
+            metric_cell,
+            compute_dRdW, compute_dRdX, compute_d2R,
+            scratch_data.fe_values_collection_volume,
+            scratch_data.fe_values_collection_face_int,
+            scratch_data.fe_values_collection_face_ext,
+            scratch_data.fe_values_collection_subface,
+            scratch_data.fe_values_collection_volume_lagrange,
+            scratch_data.soln_basis_int,
+            scratch_data.soln_basis_ext,
+            scratch_data.flux_basis_int,
+            scratch_data.flux_basis_ext,
+            scratch_data.flux_basis_stiffness,
+            scratch_data.soln_basis_projection_oper_int,
+            scratch_data.soln_basis_projection_oper_ext,
+            scratch_data.mapping_basis,
+            scratch_data.scratch_arena,
+            false,
+            right_hand_side,
+            auxiliary_right_hand_side);
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::color_locally_owned_cells ()
+{
+    using ActiveCellIterator = typename dealii::DoFHandler<dim>::active_cell_iterator;
+    using LocallyOwnedCellIterator = dealii::FilteredIterator<ActiveCellIterator>;
+
+    const std::function<std::vector<dealii::types::global_dof_index>(const LocallyOwnedCellIterator &)> get_conflict_indices
+        = [] (const LocallyOwnedCellIterator &cell)
+    {
+        std::vector<dealii::types::global_dof_index> conflict_indices(cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_indices(conflict_indices);
+
+        std::vector<dealii::types::global_dof_index> neighbor_dofs_indices;
+        for (unsigned int iface=0; iface < dealii::GeometryInfo<dim>::faces_per_cell; ++iface) {
+            const bool is_periodic = cell->face(iface)->at_boundary() && cell->has_periodic_neighbor(iface);
+            if (cell->face(iface)->at_boundary() && !is_periodic) continue;
+
+            const auto neighbor_cell = cell->neighbor_or_periodic_neighbor(iface);
+            // Finer neighbors write into this cell's residual and list it in their own conflicts.
+            if (neighbor_cell->has_children()) continue;
+
+            neighbor_dofs_indices.resize(neighbor_cell->get_fe().n_dofs_per_cell());
+            neighbor_cell->get_dof_indices(neighbor_dofs_indices);
+            conflict_indices.insert(conflict_indices.end(), neighbor_dofs_indices.begin(), neighbor_dofs_indices.end());
+        }
+        return conflict_indices;
+    };
+
+    const auto colored_cells = dealii::GraphColoring::make_graph_coloring(
+        LocallyOwnedCellIterator(dealii::IteratorFilters::LocallyOwnedCell(), dof_handler.begin_active()),
+        LocallyOwnedCellIterator(dealii::IteratorFilters::LocallyOwnedCell(), dof_handler.end()),
+        get_conflict_indices);
+
+    colored_locally_owned_cells.clear();
+    colored_locally_owned_cells.resize(colored_cells.size());
+    for (unsigned int icolor = 0; icolor < colored_cells.size(); ++icolor) {
+        for (const auto &cell : colored_cells[icolor]) {
+            colored_locally_owned_cells[icolor].push_back(cell);
+        }
+    }
+    pcout << "Colored the locally owned cells into " << colored_locally_owned_cells.size() << " colors for threaded assembly." << std::endl;
+}
+
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::split_locally_owned_cells_by_ghost_neighbors ()
+{
+    for (auto cell = dof_handler.begin_active(); cell != dof_handler.end(); ++cell) {
+        if (!cell->is_locally_owned()) continue;
+
+        bool has_ghost_neighbor = false;
+        for (unsigned int iface=0; iface < dealii::GeometryInfo<dim>::faces_per_cell; ++iface) {
+            const bool is_periodic = cell->face(iface)->at_boundary() && cell->has_periodic_neighbor(iface);
+            if (cell->face(iface)->at_boundary() && !is_periodic) continue;
+
+            // Finer neighbors are not inspected, the cell is conservatively treated as touching the ghost layer.
+            const auto neighbor_cell = cell->neighbor_or_periodic_neighbor(iface);
+            if (neighbor_cell->has_children() || !neighbor_cell->is_locally_owned()) {
+                has_ghost_neighbor = true;
+                break;
+            }
+        }
+        if (has_ghost_neighbor) {
+            ghost_adjacent_locally_owned_cells.push_back(cell);
+        } else {
+            interior_locally_owned_cells.push_back(cell);
+        }
+    }
+    const unsigned int n_ghost_adjacent_cells = dealii::Utilities::MPI::sum(static_cast<unsigned int>(ghost_adjacent_locally_owned_cells.size()), mpi_communicator);
+    pcout << n_ghost_adjacent_cells << " of the " << triangulation->n_global_active_cells()
+          << " cells have face neighbors on other processors and are assembled after the ghost exchange." << std::endl;
+}
+
+template <int dim, typename real, typename MeshType>
+bool DGBase<dim,real,MeshType>::jacobian_uses_block_storage () const
+{
+    using LinearSolverParam = Parameters::LinearSolverParam;
+    return all_parameters->linear_solver_param.linear_solver_type == LinearSolverParam::LinearSolverEnum::gmres
+           && all_parameters->linear_solver_param.jacobian_storage == LinearSolverParam::JacobianStorageEnum::block_csr;
+}
+
+template <int dim, typename real, typename MeshType>
+bool DGBase<dim,real,MeshType>::jacobian_is_matrix_free () const
+{
+    using LinearSolverParam = Parameters::LinearSolverParam;
+    return all_parameters->linear_solver_param.linear_solver_type == LinearSolverParam::LinearSolverEnum::gmres
+           && all_parameters->linear_solver_param.jacobian_storage == LinearSolverParam::JacobianStorageEnum::matrix_free;
+}
+
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::add_to_system_matrix (
+    const dealii::types::global_dof_index row,
+    const std::vector<dealii::types::global_dof_index> &columns,
+    const std::vector<double> &values,
+    const bool elide_zero_values)
+{
+    // Rows are added by every thread of the cell loop.
+    std::lock_guard<std::mutex> lock(system_matrix_mutex);
+    if (cell_diagonal_blocks != nullptr) {
+        // The rows of the ghost cells belong to the blocks of other processors.
+        if (!locally_owned_dofs.is_element(row)) return;
+        const std::pair<unsigned int, unsigned int> row_position = cell_diagonal_block_positions[locally_owned_dofs.index_within_set(row)];
+        dealii::FullMatrix<double> &block = (*cell_diagonal_blocks)[row_position.first];
+        for (unsigned int icol = 0; icol < columns.size(); ++icol) {
+            if (!locally_owned_dofs.is_element(columns[icol])) continue;
+            const std::pair<unsigned int, unsigned int> column_position = cell_diagonal_block_positions[locally_owned_dofs.index_within_set(columns[icol])];
+            if (column_position.first != row_position.first) continue;
+            block(row_position.second, column_position.second) += values[icol];
+        }
+        return;
+    }
+    if (jacobian_uses_block_storage()) {
+        block_system_matrix.add(row, columns, values, elide_zero_values);
+    } else {
+        system_matrix.add(row, columns, values, elide_zero_values);
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::get_face_neighbor_cells (
+    const typename dealii::DoFHandler<dim>::active_cell_iterator &cell,
+    std::vector<typename dealii::DoFHandler<dim>::active_cell_iterator> &neighbor_cells) const
+{
+    neighbor_cells.clear();
+    for_each_face_neighbor_cell(cell, [&](const auto &neighbor_cell) {
+        neighbor_cells.push_back(neighbor_cell);
+    });
+}
+
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::allocate_block_system_matrix ()
+{
+    std::vector<unsigned int> cell_block(triangulation->n_active_cells(), dealii::numbers::invalid_unsigned_int);
+    std::vector<std::vector<dealii::types::global_dof_index>> block_dofs;
+    std::vector<unsigned int> block_owners;
+    std::vector<std::vector<unsigned int>> block_couplings;
+
+    const auto add_block = [&](const typename dealii::DoFHandler<dim>::active_cell_iterator &cell) {
+        cell_block[cell->active_cell_index()] = block_dofs.size();
+        block_dofs.emplace_back(cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_indices(block_dofs.back());
+        block_owners.push_back(cell->subdomain_id());
+        block_couplings.emplace_back();
+    };
+
+    // The locally owned blocks come first.
+    for (const auto &cell : dof_handler.active_cell_iterators()) {
+        if (cell->is_locally_owned()) add_block(cell);
+    }
+
+    std::vector<typename dealii::DoFHandler<dim>::active_cell_iterator> neighbor_cells;
+    for (const auto &cell : dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned()) continue;
+
+        get_face_neighbor_cells(cell, neighbor_cells);
+
+        const unsigned int iblock = cell_block[cell->active_cell_index()];
+        for (const auto &neighbor_cell : neighbor_cells) {
+            if (cell_block[neighbor_cell->active_cell_index()] == dealii::numbers::invalid_unsigned_int) {
+                Assert(neighbor_cell->is_ghost(), dealii::ExcInternalError());
+                add_block(neighbor_cell);
+            }
+            const unsigned int jblock = cell_block[neighbor_cell->active_cell_index()];
+            block_couplings[iblock].push_back(jblock);
+            block_couplings[jblock].push_back(iblock);
+        }
+    }
+
+    block_system_matrix.reinit(solution.get_partitioner(), block_dofs, block_owners, block_couplings);
+
+    const double block_system_matrix_MB = dealii::Utilities::MPI::sum(
+        static_cast<double>(block_system_matrix.memory_consumption()), mpi_communicator) / 1.0e6;
+    pcout << "Allocated the block_csr Jacobian using " << block_system_matrix_MB << " MB over all processors." << std::endl;
+}
+
 template <int dim, typename real, typename MeshType>
 void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, const bool compute_dRdX, const bool compute_d2R, const double CFL_mass)
 {
@@ -1097,26 +1451,22 @@ void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, cons
             , dealii::ExcMessage("Can only do one at a time compute_dRdW or compute_dRdX or compute_d2R"));
 
     max_artificial_dissipation_coeff = 0.0;
+    // The derivatives are kept in the cell_diagonal_blocks instead of the dRdW storage, see assemble_cell_diagonal_blocks().
+    const bool assemble_diagonal_blocks = compute_dRdW && (cell_diagonal_blocks != nullptr);
     //pcout << "Assembling DG residual...";
-    if (compute_dRdW) {
+    if (assemble_diagonal_blocks) {
+        pcout << " with the cell diagonal blocks of dRdW...";
+    } else if (compute_dRdW) {
         pcout << " with dRdW...";
 
-        auto diff_sol = solution;
-        diff_sol -= solution_dRdW;
-        const double l2_norm_sol = diff_sol.l2_norm();
-
-        if (l2_norm_sol == 0.0) {
-
-            auto diff_node = high_order_grid->volume_nodes;
-            diff_node -= volume_nodes_dRdW;
-            const double l2_norm_node = diff_node.l2_norm();
-
-            if (l2_norm_node == 0.0) {
-                if (CFL_mass_dRdW == CFL_mass) {
-                    pcout << " which is already assembled..." << std::endl;
-                    return;
-                }
-            }
+        const VectorFingerprint solution_fingerprint(solution);
+        const VectorFingerprint volume_nodes_fingerprint(high_order_grid->volume_nodes);
+        const bool locally_up_to_date = (solution_fingerprint == solution_dRdW)
+                                        && (volume_nodes_fingerprint == volume_nodes_dRdW)
+                                        && (CFL_mass_dRdW == CFL_mass);
+        if (VectorFingerprint::up_to_date_on_all_processors(locally_up_to_date, mpi_communicator)) {
+            pcout << " which is already assembled..." << std::endl;
+            return;
         }
         {
             int n_stencil = 1 + std::pow(2,dim);
@@ -1124,32 +1474,33 @@ void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, cons
             n_vmult += n_stencil*n_dofs_cell;
             dRdW_form += 1;
         }
-        solution_dRdW = solution;
-        volume_nodes_dRdW = high_order_grid->volume_nodes;
+        solution_dRdW = solution_fingerprint;
+        volume_nodes_dRdW = volume_nodes_fingerprint;
         CFL_mass_dRdW = CFL_mass;
 
-        system_matrix = 0;
+        if (jacobian_uses_block_storage()) {
+            block_system_matrix = 0;
+        } else {
+            if (system_matrix.m() != solution.size()) {
+                // Not allocated up front with the matrix_free storage.
+                system_matrix.reinit(locally_owned_dofs, sparsity_pattern, mpi_communicator);
+            }
+            system_matrix = 0;
+        }
     }
     if (compute_dRdX) {
         pcout << " with dRdX...";
 
-        auto diff_sol = solution;
-        diff_sol -= solution_dRdX;
-        const double l2_norm_sol = diff_sol.l2_norm();
-
-        if (l2_norm_sol == 0.0) {
-
-            auto diff_node = high_order_grid->volume_nodes;
-            diff_node -= volume_nodes_dRdX;
-            const double l2_norm_node = diff_node.l2_norm();
-
-            if (l2_norm_node == 0.0) {
-                pcout << " which is already assembled..." << std::endl;
-                return;
-            }
+        const VectorFingerprint solution_fingerprint(solution);
+        const VectorFingerprint volume_nodes_fingerprint(high_order_grid->volume_nodes);
+        const bool locally_up_to_date = (solution_fingerprint == solution_dRdX)
+                                        && (volume_nodes_fingerprint == volume_nodes_dRdX);
+        if (VectorFingerprint::up_to_date_on_all_processors(locally_up_to_date, mpi_communicator)) {
+            pcout << " which is already assembled..." << std::endl;
+            return;
         }
-        solution_dRdX = solution;
-        volume_nodes_dRdX = high_order_grid->volume_nodes;
+        solution_dRdX = solution_fingerprint;
+        volume_nodes_dRdX = volume_nodes_fingerprint;
 
         if (   dRdXv.m() != solution.size() || dRdXv.n() != high_order_grid->volume_nodes.size()) {
 
@@ -1159,30 +1510,19 @@ void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, cons
     }
     if (compute_d2R) {
         pcout << " with d2RdWdW, d2RdWdX, d2RdXdX...";
-        auto diff_sol = solution;
-        diff_sol -= solution_d2R;
-        const double l2_norm_sol = diff_sol.l2_norm();
-
-        if (l2_norm_sol == 0.0) {
-
-            auto diff_node = high_order_grid->volume_nodes;
-            diff_node -= volume_nodes_d2R;
-            const double l2_norm_node = diff_node.l2_norm();
-
-            if (l2_norm_node == 0.0) {
-
-                auto diff_dual = dual;
-                diff_dual -= dual_d2R;
-                const double l2_norm_dual = diff_dual.l2_norm();
-                if (l2_norm_dual == 0.0) {
-                    pcout << " which is already assembled..." << std::endl;
-                    return;
-                }
-            }
-        }
-        solution_d2R = solution;
-        volume_nodes_d2R = high_order_grid->volume_nodes;
-        dual_d2R = dual;
+        const VectorFingerprint solution_fingerprint(solution);
+        const VectorFingerprint volume_nodes_fingerprint(high_order_grid->volume_nodes);
+        const VectorFingerprint dual_fingerprint(dual);
+        const bool locally_up_to_date = (solution_fingerprint == solution_d2R)
+                                        && (volume_nodes_fingerprint == volume_nodes_d2R)
+                                        && (dual_fingerprint == dual_d2R);
+        if (VectorFingerprint::up_to_date_on_all_processors(locally_up_to_date, mpi_communicator)) {
+            pcout << " which is already assembled..." << std::endl;
+            return;
+        }
+        solution_d2R = solution_fingerprint;
+        volume_nodes_d2R = volume_nodes_fingerprint;
+        dual_d2R = dual_fingerprint;
 
         if (   d2RdWdW.m() != solution.size()
             || d2RdWdX.m() != solution.size()
@@ -1206,35 +1546,61 @@ void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, cons
 
     dealii::hp::MappingCollection<dim> mapping_collection(mapping);
 
-    dealii::hp::FEValues<dim,dim>        fe_values_collection_volume (mapping_collection, fe_collection, volume_quadrature_collection, this->volume_update_flags); ///< FEValues of volume.
-    dealii::hp::FEFaceValues<dim,dim>    fe_values_collection_face_int (mapping_collection, fe_collection, face_quadrature_collection, this->face_update_flags); ///< FEValues of interior face.
-    dealii::hp::FEFaceValues<dim,dim>    fe_values_collection_face_ext (mapping_collection, fe_collection, face_quadrature_collection, this->neighbor_face_update_flags); ///< FEValues of exterior face.
-    dealii::hp::FESubfaceValues<dim,dim> fe_values_collection_subface (mapping_collection, fe_collection, face_quadrature_collection, this->face_update_flags); ///< FEValues of subface.
-
-    dealii::hp::FEValues<dim,dim>        fe_values_collection_volume_lagrange (mapping_collection, fe_collection_lagrange, volume_quadrature_collection, this->volume_update_flags);
-
-    const unsigned int init_grid_degree = high_order_grid->fe_system.tensor_degree();
-    OPERATOR::basis_functions<dim,2*dim,real> soln_basis_int(1, max_degree, init_grid_degree); 
-    OPERATOR::basis_functions<dim,2*dim,real> soln_basis_ext(1, max_degree, init_grid_degree); 
-    OPERATOR::basis_functions<dim,2*dim,real> flux_basis_int(1, max_degree, init_grid_degree); 
-    OPERATOR::basis_functions<dim,2*dim,real> flux_basis_ext(1, max_degree, init_grid_degree); 
-    OPERATOR::local_basis_stiffness<dim,2*dim,real> flux_basis_stiffness(1, max_degree, init_grid_degree, true); 
-    OPERATOR::vol_projection_operator<dim,2*dim,real> soln_basis_projection_oper_int(1, max_degree, init_grid_degree); 
-    OPERATOR::vol_projection_operator<dim,2*dim,real> soln_basis_projection_oper_ext(1, max_degree, init_grid_degree); 
-    OPERATOR::mapping_shape_functions<dim,2*dim,real> mapping_basis(1, init_grid_degree, init_grid_degree);
-
-    reinit_operators_for_cell_residual_loop(
-        max_degree, max_degree, init_grid_degree, 
-        soln_basis_int, soln_basis_ext, 
-        flux_basis_int, flux_basis_ext, 
-        flux_basis_stiffness, 
-        soln_basis_projection_oper_int, soln_basis_projection_oper_ext,
-        mapping_basis);
-
-    solution.update_ghost_values();
-
+    // The forward AD derivatives are also assembled with threads, their additions to the Trilinos matrices
+    // being serialized through system_matrix_mutex, see add_to_system_matrix(). The derivatives recorded
+    // on the global CoDiPack tape are assembled by a single thread.
+    const bool uses_global_tape = (compute_dRdW || compute_dRdX || compute_d2R) && derivatives_use_global_tape();
+    const bool use_threaded_cell_loop = !colored_locally_owned_cells.empty() && !uses_global_tape
+                                        && dealii::MultithreadInfo::n_threads() > 1;
+    const unsigned int n_threads = use_threaded_cell_loop ? dealii::MultithreadInfo::n_threads() : 1;
+
+    // The explicit residual of some meshes can be assembled in batches of cells instead of cell by cell.
+    // The batches may use the same threads as the colored cell loop. They always assemble the full residual.
+    const bool use_cell_batched_loop = use_cell_batched_residual
+                                       && (residual_part == ResidualPart::full) && (active_time_level < 0)
+                                       && !compute_dRdW && !compute_dRdX && !compute_d2R && (dRdW_direction == nullptr)
+                                       && prepare_cell_batches();
+
+    // The ghost exchanges are overlapped with the cells whose face neighbors are all locally owned.
+    // The residual terms computed before the cell loop need the ghost values, so they are not supported.
+    const bool use_overlapped_ghost_exchange = all_parameters->overlap_ghost_exchange
+                                               && !compute_dRdW && !compute_dRdX && !compute_d2R && (dRdW_direction == nullptr)
+                                               && !use_threaded_cell_loop && !use_cell_batched_loop
+                                               && !all_parameters->artificial_dissipation_param.add_artificial_dissipation
+                                               && (all_parameters->pde_type != Parameters::AllParameters::PartialDifferentialEquation::physics_model);
+
+    // Clear the metric terms cache if the grid changed. The cell loop below refills it.
+    const bool refill_metric_terms_cache = all_parameters->use_metric_terms_cache && high_order_grid->update_metric_terms_cache();
+
+    allocate_scratch_arenas(n_threads);
+    std::vector<std::unique_ptr<CellResidualScratchData>> scratch_data(n_threads);
+    for (unsigned int ithread = 0; ithread < n_threads; ++ithread) {
+        scratch_data[ithread] = std::make_unique<CellResidualScratchData>(*this, mapping_collection, *(scratch_arenas[ithread]));
+    }
+
+    // With the auxiliary equation, the solution ghost values are needed before the cell loop
+    // and the exchange of the auxiliary solution ghost values is overlapped instead.
+    bool ghost_exchange_pending = false;
+    if (use_overlapped_ghost_exchange && !use_auxiliary_eq) {
+        solution.update_ghost_values_start();
+        ghost_exchange_pending = true;
+    } else {
+        solution.update_ghost_values();
+    }
+    const auto finish_ghost_exchange = [&] () {
+        if (ghost_exchange_pending) {
+            solution.update_ghost_values_finish();
+            ghost_exchange_pending = false;
+        }
+        if (auxiliary_ghost_exchange_pending) {
+            for (int idim=0; idim<dim; idim++) {
+                auxiliary_solution[idim].update_ghost_values_finish();
+            }
+            auxiliary_ghost_exchange_pending = false;
+        }
+    };
 
-    int assembly_error = 0;
+    std::exception_ptr assembly_exception;
     try {
 
         // update artificial dissipation discontinuity sensor only if using artificial dissipation
@@ -1244,60 +1610,129 @@ void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, cons
         if(all_parameters->pde_type == Parameters::AllParameters::PartialDifferentialEquation::physics_model) update_model_variables();
 
         // assembles and solves for auxiliary variable if necessary.
-        assemble_auxiliary_residual();
+        defer_auxiliary_ghost_exchange = use_overlapped_ghost_exchange;
+        assemble_auxiliary_residual(compute_dRdW && !assemble_diagonal_blocks);
+        defer_auxiliary_ghost_exchange = false;
 
         dealii::Timer timer;
         if(all_parameters->store_residual_cpu_time){
             timer.start();
         }
 
-        auto metric_cell = high_order_grid->dof_handler_grid.begin_active();
-        for (auto soln_cell = dof_handler.begin_active(); soln_cell != dof_handler.end(); ++soln_cell, ++metric_cell) {
-            if (!soln_cell->is_locally_owned()) continue;
-
-            // Add right-hand side contributions this cell can compute
-            assemble_cell_residual (
-                soln_cell,
-                metric_cell,
-                compute_dRdW, compute_dRdX, compute_d2R,
-                fe_values_collection_volume,
-                fe_values_collection_face_int,
-                fe_values_collection_face_ext,
-                fe_values_collection_subface,
-                fe_values_collection_volume_lagrange,
-                soln_basis_int,
-                soln_basis_ext,
-                flux_basis_int,
-                flux_basis_ext,
-                flux_basis_stiffness,
-                soln_basis_projection_oper_int,
-                soln_basis_projection_oper_ext,
-                mapping_basis,
-                false,
-                right_hand_side,
-                auxiliary_right_hand_side);
-        } // end of cell loop
+        if (use_cell_batched_loop) {
+            assemble_cell_batched_residual(scratch_data);
+        } else if (use_overlapped_ghost_exchange) {
+            CellResidualScratchData &scratch = *(scratch_data[0]);
+            assemble_cell_residual_range (interior_locally_owned_cells, 0, interior_locally_owned_cells.size(), scratch, compute_dRdW, compute_dRdX, compute_d2R);
+            finish_ghost_exchange();
+            assemble_cell_residual_range (ghost_adjacent_locally_owned_cells, 0, ghost_adjacent_locally_owned_cells.size(), scratch, compute_dRdW, compute_dRdX, compute_d2R);
+        } else if (use_threaded_cell_loop) {
+            // Cells of the same color do not write into the same residual entries.
+            // Each color is split into one contiguous range per thread and the colors are processed one after the other.
+            for (const auto &color_cells : colored_locally_owned_cells) {
+                const unsigned int n_cells_color = color_cells.size();
+                // An exception thrown by a task is stored and rethrown here, on the main thread.
+                std::vector<std::exception_ptr> task_exception(n_threads);
+                dealii::Threads::TaskGroup<void> task_group;
+                for (unsigned int ithread = 0; ithread < n_threads; ++ithread) {
+                    const unsigned int first = (ithread * n_cells_color) / n_threads;
+                    const unsigned int last = ((ithread+1) * n_cells_color) / n_threads;
+                    if (first == last) continue;
+                    task_group += dealii::Threads::new_task([&, ithread, first, last] () {
+                        try {
+                            assemble_cell_residual_range (color_cells, first, last, *(scratch_data[ithread]), compute_dRdW, compute_dRdX, compute_d2R);
+                        } catch(...) {
+                            task_exception[ithread] = std::current_exception();
+                        }
+                    });
+                }
+                task_group.join_all();
+                for (const std::exception_ptr &exception : task_exception) {
+                    if (exception) std::rethrow_exception(exception);
+                }
+            }
+        } else {
+            CellResidualScratchData &scratch = *(scratch_data[0]);
+            auto metric_cell = high_order_grid->dof_handler_grid.begin_active();
+            for (auto soln_cell = dof_handler.begin_active(); soln_cell != dof_handler.end(); ++soln_cell, ++metric_cell) {
+                if (!soln_cell->is_locally_owned()) continue;
+
+                // Add right-hand side contributions this cell can compute
+                assemble_cell_residual (
+                    soln_cell,
+                    metric_cell,
+                    compute_dRdW, compute_dRdX, compute_d2R,
+                    scratch.fe_values_collection_volume,
+                    scratch.fe_values_collection_face_int,
+                    scratch.fe_values_collection_face_ext,
+                    scratch.fe_values_collection_subface,
+                    scratch.fe_values_collection_volume_lagrange,
+                    scratch.soln_basis_int,
+                    scratch.soln_basis_ext,
+                    scratch.flux_basis_int,
+                    scratch.flux_basis_ext,
+                    scratch.flux_basis_stiffness,
+                    scratch.soln_basis_projection_oper_int,
+                    scratch.soln_basis_projection_oper_ext,
+                    scratch.mapping_basis,
+                    scratch.scratch_arena,
+                    false,
+                    right_hand_side,
+                    auxiliary_right_hand_side);
+            } // end of cell loop
+        }
 
         if(all_parameters->store_residual_cpu_time){
             timer.stop();
             assemble_residual_time += timer.cpu_time();
         }
+
+        if (compute_dRdW && use_auxiliary_eq && !assemble_diagonal_blocks) add_auxiliary_dRdW();
     } catch(...) {
+        assembly_exception = std::current_exception();
+    }
+    // Outstanding requests must complete even if the assembly failed.
+    defer_auxiliary_ghost_exchange = false;
+    finish_ghost_exchange();
+
+    // The deal.II exceptions, such as negative Jacobians, flag an invalid residual which is filled up below.
+    // Any other exception is rethrown on every processor.
+    int assembly_error = 0;
+    int unrecoverable_error = 0;
+    std::string assembly_error_message;
+    if (assembly_exception) {
         assembly_error = 1;
+        try {
+            std::rethrow_exception(assembly_exception);
+        } catch (const dealii::ExceptionBase &exception) {
+            assembly_error_message = exception.what();
+        } catch (...) {
+            unrecoverable_error = 1;
+        }
+    }
+    if (dealii::Utilities::MPI::sum(unrecoverable_error, mpi_communicator) != 0) {
+        if (unrecoverable_error != 0) std::rethrow_exception(assembly_exception);
+        throw dealii::ExcMessage("The residual assembly failed on another processor.");
     }
     const int mpi_assembly_error = dealii::Utilities::MPI::sum(assembly_error, mpi_communicator);
 
 
     if (mpi_assembly_error != 0) {
+        if (assembly_error != 0) std::cout << assembly_error_message << std::endl;
         std::cout << "Invalid residual assembly encountered..."
                   << " Filling up RHS with 1s. " << std::endl;
         right_hand_side *= 0.0;
         right_hand_side.add(1.0);
-        if (compute_dRdW) {
+        if (compute_dRdW && !assemble_diagonal_blocks) {
             std::cout << " Filling up Jacobian with mass matrix. " << std::endl;
             const bool do_inverse_mass_matrix = false;
             evaluate_mass_matrices (do_inverse_mass_matrix);
-            system_matrix.copy_from(global_mass_matrix);
+            if (jacobian_uses_block_storage()) {
+                block_system_matrix = 0;
+                block_system_matrix.add(1.0, global_mass_matrix);
+            } else {
+                system_matrix.copy_from(global_mass_matrix);
+            }
         }
         //if (compute_dRdX) {
         //    dRdXv.trilinos_matrix().
@@ -1309,12 +1744,27 @@ void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, cons
         //}
     }
 
-    right_hand_side.compress(dealii::VectorOperation::add);
-    right_hand_side.update_ghost_values();
-    if ( compute_dRdW ) {
-        system_matrix.compress(dealii::VectorOperation::add);
+    if (use_overlapped_ghost_exchange && defer_right_hand_side_compress) {
+        // Finished by apply_inverse_global_mass_matrix().
+        right_hand_side.compress_start(0, dealii::VectorOperation::add);
+        right_hand_side_compress_pending = true;
+    } else {
+        right_hand_side.compress(dealii::VectorOperation::add);
+        right_hand_side.update_ghost_values();
+    }
+    if (refill_metric_terms_cache && !use_cell_batched_loop) {
+        const double metric_terms_cache_MB = dealii::Utilities::MPI::sum(
+            static_cast<double>(high_order_grid->metric_terms_cache.memory_consumption()), mpi_communicator) / 1.0e6;
+        pcout << "Filled the metric terms cache using " << metric_terms_cache_MB << " MB over all processors." << std::endl;
+    }
+    if ( compute_dRdW && !assemble_diagonal_blocks ) {
+        if (jacobian_uses_block_storage()) {
+            block_system_matrix.compress();
+        } else {
+            system_matrix.compress(dealii::VectorOperation::add);
+        }
 
-        if (global_mass_matrix.m() != system_matrix.m()) {
+        if (global_mass_matrix.m() != dof_handler.n_dofs()) {
             const bool do_inverse_mass_matrix = false;
             evaluate_mass_matrices (do_inverse_mass_matrix);
         }
@@ -1323,11 +1773,38 @@ void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, cons
             add_time_scaled_mass_matrices();
         }
 
+        // The transpose is only formed when requested through get_system_matrix_transpose().
+        system_matrix_transpose_is_current = false;
+        block_system_matrix_transpose_is_current = false;
+    }
+    if ( compute_dRdX ) dRdXv.compress(dealii::VectorOperation::add);
+    if ( compute_d2R ) {
+        d2RdWdW.compress(dealii::VectorOperation::add);
+        d2RdXdX.compress(dealii::VectorOperation::add);
+        d2RdWdX.compress(dealii::VectorOperation::add);
+    }
+    //if ( compute_dRdW ) system_matrix.compress(dealii::VectorOperation::insert);
+    //system_matrix.print(std::cout);
+
+} // end of assemble_system_explicit ()
+
+template <int dim, typename real, typename MeshType>
+dealii::TrilinosWrappers::SparseMatrix & DGBase<dim,real,MeshType>::get_system_matrix_transpose ()
+{
+    if (system_matrix_transpose_is_current) return system_matrix_transpose;
+
+    if (jacobian_uses_block_storage()) {
+        pcout << "The system_matrix is empty with the block_csr Jacobian storage. "
+              << "Use get_block_system_matrix_transpose() instead of get_system_matrix_transpose(). Aborting..." << std::endl;
+        std::abort();
+    }
+
+    if (!system_matrix_transpose_has_structure) {
         Epetra_CrsMatrix *input_matrix  = const_cast<Epetra_CrsMatrix *>(&(system_matrix.trilinos_matrix()));
         Epetra_CrsMatrix *output_matrix;
-        epetra_rowmatrixtransposer_dRdW = std::make_unique<Epetra_RowMatrixTransposer> ( input_matrix );
+        Epetra_RowMatrixTransposer epetra_rowmatrixtransposer_dRdW(input_matrix);
         const bool make_data_contiguous = true;
-        int error_transpose = epetra_rowmatrixtransposer_dRdW->CreateTranspose( make_data_contiguous, output_matrix);
+        int error_transpose = epetra_rowmatrixtransposer_dRdW.CreateTranspose( make_data_contiguous, output_matrix);
         if (error_transpose) {
             std::cout << "Failed to create dRdW transpose... Aborting" << std::endl;
             //std::abort();
@@ -1335,18 +1812,43 @@ void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, cons
         bool copy_values = true;
         system_matrix_transpose.reinit(*output_matrix, copy_values);
         delete(output_matrix);
+        system_matrix_transpose_has_structure = true;
+    } else {
+        // The structure is unchanged since allocate_system(), so each entry (i,j) of the system_matrix
+        // is summed into the existing entry (j,i). Rows owned by other processors are exchanged by compress().
+        system_matrix_transpose = 0.0;
+        const Epetra_CrsMatrix &matrix = system_matrix.trilinos_matrix();
+        for (int local_row = 0; local_row < matrix.NumMyRows(); ++local_row) {
+            int n_entries;
+            double *values;
+            int *local_columns;
+            matrix.ExtractMyRowView(local_row, n_entries, values, local_columns);
+            const dealii::types::global_dof_index row = matrix.GRID(local_row);
+            for (int ientry = 0; ientry < n_entries; ++ientry) {
+                const dealii::types::global_dof_index column = matrix.GCID(local_columns[ientry]);
+                system_matrix_transpose.add(column, row, values[ientry]);
+            }
+        }
+        system_matrix_transpose.compress(dealii::VectorOperation::add);
+    }
+    system_matrix_transpose_is_current = true;
+    return system_matrix_transpose;
+}
 
+template <int dim, typename real, typename MeshType>
+BlockSparseMatrix & DGBase<dim,real,MeshType>::get_block_system_matrix_transpose ()
+{
+    if (!jacobian_uses_block_storage()) {
+        pcout << "The block_system_matrix is only assembled with the block_csr Jacobian storage. "
+              << "Use get_system_matrix_transpose() instead of get_block_system_matrix_transpose(). Aborting..." << std::endl;
+        std::abort();
     }
-    if ( compute_dRdX ) dRdXv.compress(dealii::VectorOperation::add);
-    if ( compute_d2R ) {
-        d2RdWdW.compress(dealii::VectorOperation::add);
-        d2RdXdX.compress(dealii::VectorOperation::add);
-        d2RdWdX.compress(dealii::VectorOperation::add);
+    if (!block_system_matrix_transpose_is_current) {
+        block_system_matrix_transpose.copy_transpose_from(block_system_matrix);
+        block_system_matrix_transpose_is_current = true;
     }
-    //if ( compute_dRdW ) system_matrix.compress(dealii::VectorOperation::insert);
-    //system_matrix.print(std::cout);
-
-} // end of assemble_system_explicit ()
+    return block_system_matrix_transpose;
+}
 
 template <int dim, typename real, typename MeshType>
 double DGBase<dim,real,MeshType>::get_residual_linfnorm () const
@@ -1896,6 +2398,15 @@ void DGBase<dim,real,MeshType>::allocate_system (
     max_dt_cell.reinit(triangulation->n_active_cells());
     cell_volume.reinit(triangulation->n_active_cells());
 
+    // Color the cells for threaded residual assembly only if requested.
+    colored_locally_owned_cells.clear();
+    if (all_parameters->n_threads_per_process > 1) color_locally_owned_cells();
+
+    // Split the cells for the overlapped ghost exchange only if requested.
+    interior_locally_owned_cells.clear();
+    ghost_adjacent_locally_owned_cells.clear();
+    if (all_parameters->overlap_ghost_exchange) split_locally_owned_cells_by_ghost_neighbors();
+
     // allocates model variables only if there is a model
     if(all_parameters->pde_type == Parameters::AllParameters::PartialDifferentialEquation::physics_model) allocate_model_variables();
 
@@ -1921,46 +2432,76 @@ void DGBase<dim,real,MeshType>::allocate_system (
     if (compute_dRdW || compute_dRdX || compute_d2R) {
         dealii::DynamicSparsityPattern dsp(locally_relevant_dofs);
         dealii::DoFTools::make_flux_sparsity_pattern(dof_handler, dsp);
+
+        // With the auxiliary equations of the strong form, the residual of a cell depends on the solution
+        // of the cells two faces apart through the auxiliary solution, see DGStrong::add_auxiliary_dRdW().
+        // All the cells sharing a face with the same cell are therefore coupled.
+        // The rows of ghost cells are sent to their owner below.
+        const bool couple_auxiliary_neighbors = compute_dRdW && use_auxiliary_eq && !all_parameters->use_weak_form;
+        if (couple_auxiliary_neighbors && jacobian_uses_block_storage()) {
+            pcout << "ERROR: The block_csr Jacobian only couples face neighbors, which is not enough for the strong form with auxiliary equations. Aborting..." << std::endl;
+            std::abort();
+        }
+        if (couple_auxiliary_neighbors) {
+            std::vector<typename dealii::DoFHandler<dim>::active_cell_iterator> patch_cells;
+            std::vector<dealii::types::global_dof_index> patch_dofs;
+            std::vector<dealii::types::global_dof_index> cell_dofs;
+            for (const auto &cell : dof_handler.active_cell_iterators()) {
+                if (!cell->is_locally_owned()) continue;
+
+                get_face_neighbor_cells(cell, patch_cells);
+                patch_cells.push_back(cell);
+                patch_dofs.clear();
+                for (const auto &patch_cell : patch_cells) {
+                    cell_dofs.resize(patch_cell->get_fe().n_dofs_per_cell());
+                    patch_cell->get_dof_indices(cell_dofs);
+                    patch_dofs.insert(patch_dofs.end(), cell_dofs.begin(), cell_dofs.end());
+                }
+                std::sort(patch_dofs.begin(), patch_dofs.end());
+                patch_dofs.erase(std::unique(patch_dofs.begin(), patch_dofs.end()), patch_dofs.end());
+                for (const auto row : patch_dofs) {
+                    dsp.add_entries(row, patch_dofs.begin(), patch_dofs.end(), true);
+                }
+            }
+        }
         dealii::SparsityTools::distribute_sparsity_pattern(dsp, dof_handler.locally_owned_dofs(), mpi_communicator, locally_relevant_dofs);
 
         sparsity_pattern.copy_from(dsp);
-        
-        system_matrix.reinit(locally_owned_dofs, sparsity_pattern, mpi_communicator);
+
+        if (compute_dRdW && jacobian_uses_block_storage()) {
+            system_matrix.clear();
+            allocate_block_system_matrix();
+        } else if (compute_dRdW && jacobian_is_matrix_free()) {
+            system_matrix.clear();
+        } else {
+            system_matrix.reinit(locally_owned_dofs, sparsity_pattern, mpi_communicator);
+        }
     }
 
     // Make sure that derivatives are cleared when reallocating DG objects.
     // The call to assemble the derivatives will reallocate those derivatives
     // if they are ever needed.
     system_matrix_transpose.clear();
+    system_matrix_transpose_has_structure = false;
+    system_matrix_transpose_is_current = false;
+    block_system_matrix_transpose.clear();
+    block_system_matrix_transpose_is_current = false;
     dRdXv.clear();
     d2RdWdX.clear();
     d2RdWdW.clear();
     d2RdXdX.clear();
 
-    if (compute_dRdW) {
-        solution_dRdW.reinit(solution);
-        solution_dRdW *= 0.0;
-        volume_nodes_dRdW.reinit(high_order_grid->volume_nodes);
-        volume_nodes_dRdW *= 0.0;
-    }
-
+    // Reset fingerprints match no vector, such that the derivatives are assembled on their next request.
+    solution_dRdW = VectorFingerprint();
+    volume_nodes_dRdW = VectorFingerprint();
     CFL_mass_dRdW = 0.0;
 
-    if (compute_dRdX) {
-        solution_dRdX.reinit(solution);
-        solution_dRdX *= 0.0;
-        volume_nodes_dRdX.reinit(high_order_grid->volume_nodes);
-        volume_nodes_dRdX *= 0.0;
-    }
+    solution_dRdX = VectorFingerprint();
+    volume_nodes_dRdX = VectorFingerprint();
 
-    if (compute_d2R) {
-        solution_d2R.reinit(solution);
-        solution_d2R *= 0.0;
-        volume_nodes_d2R.reinit(high_order_grid->volume_nodes);
-        volume_nodes_d2R *= 0.0;
-        dual_d2R.reinit(dual);
-        dual_d2R *= 0.0;
-    }
+    solution_d2R = VectorFingerprint();
+    volume_nodes_d2R = VectorFingerprint();
+    dual_d2R = VectorFingerprint();
 }
 
 template <int dim, typename real, typename MeshType>
@@ -2015,7 +2556,7 @@ void DGBase<dim,real,MeshType>::allocate_dRdX ()
     dealii::SparsityPattern dRdXv_sparsity_pattern = get_dRdX_sparsity_pattern ();
     const dealii::IndexSet &row_parallel_partitioning = locally_owned_dofs;
     const dealii::IndexSet &col_parallel_partitioning = high_order_grid->locally_owned_dofs_grid;
-    dRdXv.reinit(row_parallel_partitioning, col_parallel_partitioning, dRdXv_sparsity_pattern, MPI_COMM_WORLD);
+    dRdXv.reinit(row_parallel_partitioning, col_parallel_partitioning, dRdXv_sparsity_pattern, mpi_communicator);
 }
 
 template <int dim, typename real, typename MeshType>
@@ -2469,11 +3010,14 @@ void DGBase<dim,real,MeshType>::apply_inverse_global_mass_matrix(
     const unsigned int grid_degree = this->high_order_grid->fe_system.tensor_degree();
     const dealii::FESystem<dim> &fe_metric = high_order_grid->fe_system;
     const unsigned int n_metric_dofs = high_order_grid->fe_system.dofs_per_cell;
-    auto metric_cell = high_order_grid->dof_handler_grid.begin_active();
 
     auto first_cell = dof_handler.begin_active();
     const bool Cartesian_first_element = (first_cell->manifold_id() == dealii::numbers::flat_manifold_id) ? true : false;
 
+    // The determinant of the metric Jacobian at the volume flux nodes is re-used from the residual assembly if cached.
+    const bool use_metric_terms_cache = all_parameters->use_metric_terms_cache;
+    if(use_metric_terms_cache) high_order_grid->update_metric_terms_cache();
+
     if(Cartesian_first_element){//then we can factor out det of Jac and rapidly simplify
         if(use_auxiliary_eq){
             mass_inv_aux.build_1D_volume_operator(oneD_fe_collection_1state[max_degree], oneD_quadrature_collection[max_degree]);
@@ -2496,9 +3040,10 @@ void DGBase<dim,real,MeshType>::apply_inverse_global_mass_matrix(
         timer.start();
     }
 
-    for (auto soln_cell = dof_handler.begin_active(); soln_cell != dof_handler.end(); ++soln_cell, ++metric_cell) {
-        if (!soln_cell->is_locally_owned()) continue;
-
+    const auto apply_inverse_mass_on_cell = [&] (
+        const typename dealii::DoFHandler<dim>::active_cell_iterator &soln_cell,
+        const typename dealii::DoFHandler<dim>::active_cell_iterator &metric_cell)
+    {
         const unsigned int poly_degree = soln_cell->active_fe_index();
         const unsigned int n_dofs_cell = fe_collection[poly_degree].n_dofs_per_cell();
         std::vector<dealii::types::global_dof_index> current_dofs_indices;
@@ -2526,32 +3071,39 @@ void DGBase<dim,real,MeshType>::apply_inverse_global_mass_matrix(
             }
         }
 
-        // get mapping support points and determinant of Jacobian
-        // setup metric cell
-        std::vector<dealii::types::global_dof_index> metric_dof_indices(n_metric_dofs);
-        metric_cell->get_dof_indices (metric_dof_indices);
-        // get mapping_support points
-        std::array<std::vector<real>,dim> mapping_support_points;
-        for(int idim=0; idim<dim; idim++){
-            mapping_support_points[idim].resize(n_metric_dofs/dim);
-        }
-        const std::vector<unsigned int > &index_renumbering = dealii::FETools::hierarchic_to_lexicographic_numbering<dim>(grid_degree);
-        for (unsigned int idof = 0; idof< n_metric_dofs; ++idof) {
-            const real val = (high_order_grid->volume_nodes[metric_dof_indices[idof]]);
-            const unsigned int istate = fe_metric.system_to_component_index(idof).first; 
-            const unsigned int ishape = fe_metric.system_to_component_index(idof).second; 
-            const unsigned int igrid_node = index_renumbering[ishape];
-            mapping_support_points[istate][igrid_node] = val; 
-        }
-        //get determinant of Jacobian
         const unsigned int n_quad_pts = volume_quadrature_collection[poly_degree].size();
-        const unsigned int n_grid_nodes = n_metric_dofs / dim;
-        //get determinant of Jacobian
         OPERATOR::metric_operators<real, dim, 2*dim> metric_oper(1, poly_degree, grid_degree);
-        metric_oper.build_determinant_volume_metric_Jacobian(
-                        n_quad_pts, n_grid_nodes, 
-                        mapping_support_points,
-                        mapping_basis);
+        const bool det_Jac_is_cached = use_metric_terms_cache
+                                       && high_order_grid->metric_terms_cache[soln_cell->active_cell_index()].volume_is_cached
+                                       && high_order_grid->metric_terms_cache[soln_cell->active_cell_index()].poly_degree == poly_degree;
+        if(det_Jac_is_cached){
+            metric_oper.det_Jac_vol = high_order_grid->metric_terms_cache[soln_cell->active_cell_index()].det_Jac_vol;
+        }
+        else{
+            // get mapping support points and determinant of Jacobian
+            // setup metric cell
+            std::vector<dealii::types::global_dof_index> metric_dof_indices(n_metric_dofs);
+            metric_cell->get_dof_indices (metric_dof_indices);
+            // get mapping_support points
+            std::array<std::vector<real>,dim> mapping_support_points;
+            for(int idim=0; idim<dim; idim++){
+                mapping_support_points[idim].resize(n_metric_dofs/dim);
+            }
+            const std::vector<unsigned int > &index_renumbering = dealii::FETools::hierarchic_to_lexicographic_numbering<dim>(grid_degree);
+            for (unsigned int idof = 0; idof< n_metric_dofs; ++idof) {
+                const real val = (high_order_grid->volume_nodes[metric_dof_indices[idof]]);
+                const unsigned int istate = fe_metric.system_to_component_index(idof).first; 
+                const unsigned int ishape = fe_metric.system_to_component_index(idof).second; 
+                const unsigned int igrid_node = index_renumbering[ishape];
+                mapping_support_points[istate][igrid_node] = val; 
+            }
+            const unsigned int n_grid_nodes = n_metric_dofs / dim;
+            //get determinant of Jacobian
+            metric_oper.build_determinant_volume_metric_Jacobian(
+                            n_quad_pts, n_grid_nodes, 
+                            mapping_support_points,
+                            mapping_basis);
+        }
         //solve mass inverse times input vector for each state independently
         for(int istate=0; istate<nstate; istate++){
             const unsigned int n_shape_fns = n_dofs_cell / nstate;
@@ -2603,13 +3155,40 @@ void DGBase<dim,real,MeshType>::apply_inverse_global_mass_matrix(
                                                      projection_oper.oneD_transpose_vol_operator);
                 }
             }
-             
+         
             for(unsigned int ishape=0; ishape<n_shape_fns; ishape++){
                 const unsigned int idof = istate * n_shape_fns + ishape;
                 output_vector[current_dofs_indices[idof]] = local_output_vector[ishape];
             }
         }//end of state loop
-    }//end of cell loop
+    };
+
+    // The cells that do not receive residual contributions from other processors
+    // are done while the compress of the right-hand side left pending by assemble_residual() completes.
+    const bool finish_right_hand_side_compress = right_hand_side_compress_pending && (&input_vector == &right_hand_side);
+    if(finish_right_hand_side_compress){
+        for (const auto &soln_cell : interior_locally_owned_cells) {
+            const typename dealii::DoFHandler<dim>::active_cell_iterator metric_cell(
+                triangulation.get(), soln_cell->level(), soln_cell->index(), &(high_order_grid->dof_handler_grid));
+            apply_inverse_mass_on_cell(soln_cell, metric_cell);
+        }
+        right_hand_side.compress_finish(dealii::VectorOperation::add);
+        right_hand_side_compress_pending = false;
+        right_hand_side.update_ghost_values_start();
+        for (const auto &soln_cell : ghost_adjacent_locally_owned_cells) {
+            const typename dealii::DoFHandler<dim>::active_cell_iterator metric_cell(
+                triangulation.get(), soln_cell->level(), soln_cell->index(), &(high_order_grid->dof_handler_grid));
+            apply_inverse_mass_on_cell(soln_cell, metric_cell);
+        }
+        right_hand_side.update_ghost_values_finish();
+    }
+    else{
+        auto metric_cell = high_order_grid->dof_handler_grid.begin_active();
+        for (auto soln_cell = dof_handler.begin_active(); soln_cell != dof_handler.end(); ++soln_cell, ++metric_cell) {
+            if (!soln_cell->is_locally_owned()) continue;
+            apply_inverse_mass_on_cell(soln_cell, metric_cell);
+        }
+    }
 
     if(all_parameters->store_residual_cpu_time){
         timer.stop();
@@ -2617,6 +3196,91 @@ void DGBase<dim,real,MeshType>::apply_inverse_global_mass_matrix(
     }
 }
 
+template<int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::assemble_residual_and_apply_inverse_mass_matrix(
+        dealii::LinearAlgebra::distributed::Vector<double> &output_vector)
+{
+    // The compress can only be overlapped with the on-the-fly inverse, which works cell by cell.
+    defer_right_hand_side_compress = all_parameters->use_inverse_mass_on_the_fly;
+    assemble_residual();
+    defer_right_hand_side_compress = false;
+
+    if(all_parameters->use_inverse_mass_on_the_fly){
+        apply_inverse_global_mass_matrix(right_hand_side, output_vector);
+    } else{
+        global_inverse_mass_matrix.vmult(output_vector, right_hand_side);
+    }
+}
+
+template<int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::dRdW_vmult(
+        dealii::LinearAlgebra::distributed::Vector<double> &dst,
+        const dealii::LinearAlgebra::distributed::Vector<double> &src)
+{
+    if (!supports_dRdW_vmult()) {
+        pcout << "The matrix-free dRdW product is only implemented for the weak form. Aborting..." << std::endl;
+        std::abort();
+    }
+    // The faces need the direction on the ghost cells, which src might not store.
+    if (dRdW_direction_ghosted.get_partitioner() != solution.get_partitioner()) {
+        dRdW_direction_ghosted.reinit(solution);
+        dRdW_direction_product.reinit(right_hand_side);
+        dRdW_residual.reinit(right_hand_side);
+    }
+    for (const auto idof : locally_owned_dofs) {
+        dRdW_direction_ghosted[idof] = src[idof];
+    }
+    dRdW_direction_ghosted.update_ghost_values();
+    dRdW_direction_product = 0;
+
+    // The residual evaluated along with the product goes to dRdW_residual, such that right_hand_side is kept.
+    right_hand_side.swap(dRdW_residual);
+    dRdW_direction = &dRdW_direction_ghosted;
+    try {
+        assemble_residual();
+    } catch(...) {
+        dRdW_direction = nullptr;
+        right_hand_side.swap(dRdW_residual);
+        throw;
+    }
+    dRdW_direction = nullptr;
+    right_hand_side.swap(dRdW_residual);
+    dRdW_direction_product.compress(dealii::VectorOperation::add);
+
+    for (const auto idof : locally_owned_dofs) {
+        dst[idof] = dRdW_direction_product[idof];
+    }
+    dRdW_mult += 1;
+}
+
+template<int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::assemble_cell_diagonal_blocks(std::vector<dealii::FullMatrix<double>> &blocks)
+{
+    blocks.clear();
+    cell_diagonal_block_positions.resize(locally_owned_dofs.n_elements());
+    std::vector<dealii::types::global_dof_index> dofs_indices;
+    for (const auto &cell : dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned()) continue;
+        const unsigned int n_dofs_cell = cell->get_fe().n_dofs_per_cell();
+        dofs_indices.resize(n_dofs_cell);
+        cell->get_dof_indices(dofs_indices);
+        for (unsigned int idof = 0; idof < n_dofs_cell; ++idof) {
+            cell_diagonal_block_positions[locally_owned_dofs.index_within_set(dofs_indices[idof])] = std::make_pair(blocks.size(), idof);
+        }
+        blocks.emplace_back(n_dofs_cell, n_dofs_cell);
+    }
+
+    cell_diagonal_blocks = &blocks;
+    try {
+        const bool compute_dRdW = true;
+        assemble_residual(compute_dRdW);
+    } catch(...) {
+        cell_diagonal_blocks = nullptr;
+        throw;
+    }
+    cell_diagonal_blocks = nullptr;
+}
+
 template<int dim, typename real, typename MeshType>
 void DGBase<dim,real,MeshType>::apply_global_mass_matrix(
         const dealii::LinearAlgebra::distributed::Vector<double> &input_vector,
@@ -2797,17 +3461,30 @@ void DGBase<dim,real,MeshType>::apply_global_mass_matrix(
 template<int dim, typename real, typename MeshType>
 void DGBase<dim,real,MeshType>::add_mass_matrices(const real scale)
 {
-    system_matrix.add(scale, global_mass_matrix);
+    if (jacobian_uses_block_storage()) {
+        block_system_matrix.add(scale, global_mass_matrix);
+    } else {
+        system_matrix.add(scale, global_mass_matrix);
+    }
 }
 template<int dim, typename real, typename MeshType>
 void DGBase<dim,real,MeshType>::add_time_scaled_mass_matrices()
 {
-    system_matrix.add(1.0, time_scaled_global_mass_matrix);
+    if (jacobian_uses_block_storage()) {
+        block_system_matrix.add(1.0, time_scaled_global_mass_matrix);
+    } else {
+        system_matrix.add(1.0, time_scaled_global_mass_matrix);
+    }
 }
 template<int dim, typename real, typename MeshType>
 void DGBase<dim,real,MeshType>::time_scaled_mass_matrices(const real dt_scale)
 {
-    time_scaled_global_mass_matrix.reinit(system_matrix);
+    if (jacobian_uses_block_storage() || system_matrix.m() != solution.size()) {
+        // Block diagonal, hence within the structure of the global mass matrix.
+        time_scaled_global_mass_matrix.reinit(global_mass_matrix);
+    } else {
+        time_scaled_global_mass_matrix.reinit(system_matrix);
+    }
     time_scaled_global_mass_matrix = 0.0;
     std::vector<dealii::types::global_dof_index> dofs_indices;
     for (auto cell = dof_handler.begin_active(); cell!=dof_handler.end(); ++cell) {
@@ -3018,6 +3695,28 @@ void DGBase<dim,real,MeshType>::set_current_time(const real current_time_input)
     this->current_time = current_time_input;
 }
 
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::set_residual_part(const ResidualPart part)
+{
+    if (part != ResidualPart::full && !supports_residual_splitting()) {
+        pcout << "Error: this discretization cannot assemble the convective and dissipative parts of its residual separately. "
+              << "Use the strong form (use_weak_form = false). Aborting..." << std::endl;
+        std::abort();
+    }
+    this->residual_part = part;
+}
+
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::set_active_time_level(const int level)
+{
+    if (level >= 0 && !supports_local_time_stepping()) {
+        pcout << "Error: this discretization cannot assemble the residual of a single time level. "
+              << "Use the strong form (use_weak_form = false). Aborting..." << std::endl;
+        std::abort();
+    }
+    this->active_time_level = level;
+}
+
 #if PHILIP_DIM!=1
 template class DGBase <PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>;
 #endif
@@ -3064,6 +3763,7 @@ DGBase<PHILIP_DIM,double,dealii::Triangulation<PHILIP_DIM>>::assemble_cell_resid
     OPERATOR::vol_projection_operator<PHILIP_DIM,2*PHILIP_DIM,double> &soln_basis_projection_oper_int,
     OPERATOR::vol_projection_operator<PHILIP_DIM,2*PHILIP_DIM,double> &soln_basis_projection_oper_ext,
     OPERATOR::mapping_shape_functions<PHILIP_DIM,2*PHILIP_DIM,double> &mapping_basis,
+    ScratchArena &scratch_arena,
     const bool compute_auxiliary_right_hand_side,
     dealii::LinearAlgebra::distributed::Vector<double> &rhs,
     std::array<dealii::LinearAlgebra::distributed::Vector<double>,PHILIP_DIM> &rhs_aux);
@@ -3086,6 +3786,7 @@ DGBase<PHILIP_DIM,double,dealii::parallel::distributed::Triangulation<PHILIP_DIM
     OPERATOR::vol_projection_operator<PHILIP_DIM,2*PHILIP_DIM,double> &soln_basis_projection_oper_int,
     OPERATOR::vol_projection_operator<PHILIP_DIM,2*PHILIP_DIM,double> &soln_basis_projection_oper_ext,
     OPERATOR::mapping_shape_functions<PHILIP_DIM,2*PHILIP_DIM,double> &mapping_basis,
+    ScratchArena &scratch_arena,
     const bool compute_auxiliary_right_hand_side,
     dealii::LinearAlgebra::distributed::Vector<double> &rhs,
     std::array<dealii::LinearAlgebra::distributed::Vector<double>,PHILIP_DIM> &rhs_aux);
@@ -3108,6 +3809,7 @@ DGBase<PHILIP_DIM,double,dealii::parallel::shared::Triangulation<PHILIP_DIM>>::a
     OPERATOR::vol_projection_operator<PHILIP_DIM,2*PHILIP_DIM,double> &soln_basis_projection_oper_int,
     OPERATOR::vol_projection_operator<PHILIP_DIM,2*PHILIP_DIM,double> &soln_basis_projection_oper_ext,
     OPERATOR::mapping_shape_functions<PHILIP_DIM,2*PHILIP_DIM,double> &mapping_basis,
+    ScratchArena &scratch_arena,
     const bool compute_auxiliary_right_hand_side,
     dealii::LinearAlgebra::distributed::Vector<double> &rhs,
     std::array<dealii::LinearAlgebra::distributed::Vector<double>,PHILIP_DIM> &rhs_aux);
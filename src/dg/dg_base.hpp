@@ -1,6 +1,10 @@
 #ifndef PHILIP_DG_BASE_HPP
 #define PHILIP_DG_BASE_HPP
 
+#include <functional>
+#include <mutex>
+#include <utility>
+
 #include <deal.II/base/conditional_ostream.h>
 #include <deal.II/base/parameter_handler.h>
 
@@ -20,6 +24,7 @@
 #include <deal.II/hp/mapping_collection.h>
 #include <deal.II/hp/fe_values.h>
 
+#include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/vector.h>
 #include <deal.II/lac/sparsity_pattern.h>
 #include <deal.II/lac/trilinos_sparse_matrix.h>
@@ -29,6 +34,7 @@
 #include <AztecOO.h>
 
 #include "ADTypes.hpp"
+#include "vector_fingerprint.hpp"
 #include <Sacado.hpp>
 #include <CoDiPack/include/codi.hpp>
 
@@ -41,6 +47,8 @@
 #include "parameters/all_parameters.h"
 #include "operators/operators.h"
 #include "artificial_dissipation_factory.h"
+#include "scratch_arena.hpp"
+#include "linear_solver/block_sparse_matrix.h"
 
 #include <time.h>
 #include <deal.II/base/timer.h>
@@ -117,13 +125,17 @@ public:
      *  finite element values at physical locations.
      *
      *  Passes create_collection_tuple() to the delegated constructor.
+     *
+     *  The vectors, matrices and reductions of the discretization and of its HighOrderGrid are over
+     *  mpi_communicator_input, which must hold the processes of a distributed triangulation_input.
      */
     DGBase(const int nstate_input,
            const Parameters::AllParameters *const parameters_input,
            const unsigned int degree,
            const unsigned int max_degree_input,
            const unsigned int grid_degree_input,
-           const std::shared_ptr<Triangulation> triangulation_input);
+           const std::shared_ptr<Triangulation> triangulation_input,
+           const MPI_Comm mpi_communicator_input = MPI_COMM_WORLD);
 
 
     /// Reinitializes the DG object after a change of triangulation
@@ -155,7 +167,8 @@ public:
             const unsigned int max_degree_input,
             const unsigned int grid_degree_input,
             const std::shared_ptr<Triangulation> triangulation_input,
-            const MassiveCollectionTuple collection_tuple);
+            const MassiveCollectionTuple collection_tuple,
+            const MPI_Comm mpi_communicator_input);
 
     std::shared_ptr<Triangulation> triangulation; ///< Mesh
 
@@ -269,6 +282,16 @@ public:
         dealii::LinearAlgebra::distributed::Vector<double> &output_vector,
         const bool use_auxiliary_eq = false);
 
+    /// Assembles the explicit residual and applies the inverse mass matrix to it.
+    /** Equivalent to assemble_residual() followed by apply_inverse_global_mass_matrix(),
+     *  or by global_inverse_mass_matrix.vmult() if the mass matrix is stored.
+     *  With Parameters::AllParameters::overlap_ghost_exchange and the on-the-fly inverse,
+     *  the compress of the right-hand side is overlapped with the inverse mass matrix
+     *  of the cells that do not receive contributions from other processors.
+     */
+    void assemble_residual_and_apply_inverse_mass_matrix(
+        dealii::LinearAlgebra::distributed::Vector<double> &output_vector);
+
     /// Applies the local metric dependent mass matrices when the global is not stored.
     /** We use matrix-free methods to apply the local mass matrix on-the-fly 
     *   in each cell using sum-factorization techniques.
@@ -342,12 +365,37 @@ public:
     /// respect to the solution
     dealii::TrilinosWrappers::SparseMatrix system_matrix;
 
-    /// System matrix corresponding to the derivative of the right_hand_side with
-    /// respect to the solution TRANSPOSED.
-    dealii::TrilinosWrappers::SparseMatrix system_matrix_transpose;
+    /// Block-sparse storage of the system_matrix, with one dense block per pair of coupled cells.
+    /** Filled by assemble_residual() instead of the system_matrix, which is then left empty,
+     *  when jacobian_uses_block_storage(). Only the implicit ODE solver supports it.
+     */
+    BlockSparseMatrix block_system_matrix;
+
+    /// Whether the residual Jacobian is stored in block_system_matrix instead of system_matrix.
+    /** Parameters::LinearSolverParam::jacobian_storage is block_csr together with the gmres solver.
+     */
+    bool jacobian_uses_block_storage () const;
+
+    /// Whether the implicit solvers apply the residual Jacobian through dRdW_vmult() instead of storing it.
+    /** Parameters::LinearSolverParam::jacobian_storage is matrix_free together with the gmres solver.
+     *  The system_matrix is then only allocated if assemble_residual() is asked for dRdW,
+     *  for example by the adjoint.
+     */
+    bool jacobian_is_matrix_free () const;
 
-    /// Epetra_RowMatrixTransposer used to transpose the system_matrix.
-    std::unique_ptr<Epetra_RowMatrixTransposer> epetra_rowmatrixtransposer_dRdW;
+    /// Transpose of the system_matrix, built or updated on demand.
+    /** Only the adjoint and optimization routines need it, so assemble_residual() does not
+     *  transpose the system_matrix. The first call after allocate_system() builds the transposed
+     *  structure, later calls only copy the values of the newly assembled system_matrix into it.
+     *  The system_matrix must not be modified outside of assemble_residual() in between.
+     */
+    dealii::TrilinosWrappers::SparseMatrix & get_system_matrix_transpose ();
+
+    /// Transpose of the block_system_matrix, built on demand.
+    /** Replaces get_system_matrix_transpose() when jacobian_uses_block_storage().
+     *  The transpose is formed from the blocks, without going through a Trilinos matrix.
+     */
+    BlockSparseMatrix & get_block_system_matrix_transpose ();
 
     //AztecOO dRdW_preconditioner_builder;
 
@@ -414,32 +462,43 @@ public:
     ///The auxiliary equations' solution.
     std::array<dealii::LinearAlgebra::distributed::Vector<double>,dim> auxiliary_solution;
 private:
-    /// Modal coefficients of the solution used to compute dRdW last
+    /// Fingerprint of the solution used to compute dRdW last
     /// Will be used to avoid recomputing dRdW.
-    dealii::LinearAlgebra::distributed::Vector<double> solution_dRdW;
-    /// Modal coefficients of the grid nodes used to compute dRdW last
+    VectorFingerprint solution_dRdW;
+    /// Fingerprint of the grid nodes used to compute dRdW last
     /// Will be used to avoid recomputing dRdW.
-    dealii::LinearAlgebra::distributed::Vector<double> volume_nodes_dRdW;
+    VectorFingerprint volume_nodes_dRdW;
 
     /// CFL used to add mass matrix in the optimization FlowConstraints class
     double CFL_mass_dRdW;
 
-    /// Modal coefficients of the solution used to compute dRdX last
+    /// Fingerprint of the solution used to compute dRdX last
     /// Will be used to avoid recomputing dRdX.
-    dealii::LinearAlgebra::distributed::Vector<double> solution_dRdX;
-    /// Modal coefficients of the grid nodes used to compute dRdX last
+    VectorFingerprint solution_dRdX;
+    /// Fingerprint of the grid nodes used to compute dRdX last
     /// Will be used to avoid recomputing dRdX.
-    dealii::LinearAlgebra::distributed::Vector<double> volume_nodes_dRdX;
+    VectorFingerprint volume_nodes_dRdX;
 
-    /// Modal coefficients of the solution used to compute d2R last
+    /// Fingerprint of the solution used to compute d2R last
     /// Will be used to avoid recomputing d2R.
-    dealii::LinearAlgebra::distributed::Vector<double> solution_d2R;
-    /// Modal coefficients of the grid nodes used to compute d2R last
+    VectorFingerprint solution_d2R;
+    /// Fingerprint of the grid nodes used to compute d2R last
     /// Will be used to avoid recomputing d2R.
-    dealii::LinearAlgebra::distributed::Vector<double> volume_nodes_d2R;
-    /// Dual variables to compute d2R last
+    VectorFingerprint volume_nodes_d2R;
+    /// Fingerprint of the dual variables used to compute d2R last
     /// Will be used to avoid recomputing d2R.
-    dealii::LinearAlgebra::distributed::Vector<double> dual_d2R;
+    VectorFingerprint dual_d2R;
+
+    /// See get_system_matrix_transpose().
+    dealii::TrilinosWrappers::SparseMatrix system_matrix_transpose;
+    /// Whether system_matrix_transpose has the transposed structure of the system_matrix.
+    bool system_matrix_transpose_has_structure = false;
+    /// Whether the values of system_matrix_transpose are those of the last assembled system_matrix.
+    bool system_matrix_transpose_is_current = false;
+    /// See get_block_system_matrix_transpose().
+    BlockSparseMatrix block_system_matrix_transpose;
+    /// Whether the values of block_system_matrix_transpose are those of the last assembled block_system_matrix.
+    bool block_system_matrix_transpose_is_current = false;
 public:
 
     /// Time it takes for the maximum wavespeed to cross the cell domain.
@@ -563,6 +622,103 @@ public:
     //void assemble_residual_dRdW ();
     void assemble_residual (const bool compute_dRdW=false, const bool compute_dRdX=false, const bool compute_d2R=false, const double CFL_mass = 0.0);
 
+    /// Evaluates dst = dRdW src without assembling the system_matrix.
+    /** The residual terms are evaluated with forward AD numbers carrying a single tangent seeded
+     *  with src, such that each cell, face and boundary term also gives its directional derivative.
+     *  This is one residual evaluation over the same cell loop, whose residual is discarded such that
+     *  the right_hand_side is left unchanged. Only available if supports_dRdW_vmult().
+     */
+    void dRdW_vmult (
+        dealii::LinearAlgebra::distributed::Vector<double> &dst,
+        const dealii::LinearAlgebra::distributed::Vector<double> &src);
+
+    /// Whether the discretization implements dRdW_vmult().
+    virtual bool supports_dRdW_vmult () const { return false; }
+
+    /// Whether dRdW, dRdX and d2R are recorded on the global CoDiPack tape, which cannot be shared between threads.
+    /** If so, the assembly of these derivatives uses a single thread, see n_threads_per_process.
+     */
+    virtual bool derivatives_use_global_tape () const { return false; }
+
+    /// Evaluates the derivatives of the residual of each locally owned cell with respect to its own solution.
+    /** The blocks are the derivatives of the local residuals evaluated by the dRdW cell loop,
+     *  which are kept instead of being added to the system_matrix, such that the dRdW storage
+     *  does not need to be allocated. The derivatives with respect to the neighbor solutions,
+     *  and through the auxiliary solution of the strong form, are discarded.
+     *  The blocks are ordered as the locally owned cells of the dof_handler.
+     *  This is one residual evaluation, which also updates the right_hand_side.
+     */
+    void assemble_cell_diagonal_blocks (std::vector<dealii::FullMatrix<double>> &blocks);
+
+    /// FEValues collections and operators reinitialized on every cell of the residual loop.
+    /** Each thread assembling cells concurrently owns one instance such that
+     *  nothing is shared between threads except read-only DG data.
+     */
+    struct CellResidualScratchData
+    {
+        /// Constructor. Builds the FEValues collections and the operators for the maximum degree.
+        CellResidualScratchData(
+            DGBase<dim,real,MeshType>                &dg,
+            const dealii::hp::MappingCollection<dim> &mapping_collection,
+            ScratchArena                             &scratch_arena);
+
+        dealii::hp::FEValues<dim,dim>        fe_values_collection_volume; ///< FEValues of volume.
+        dealii::hp::FEFaceValues<dim,dim>    fe_values_collection_face_int; ///< FEValues of interior face.
+        dealii::hp::FEFaceValues<dim,dim>    fe_values_collection_face_ext; ///< FEValues of exterior face.
+        dealii::hp::FESubfaceValues<dim,dim> fe_values_collection_subface; ///< FEValues of subface.
+        dealii::hp::FEValues<dim,dim>        fe_values_collection_volume_lagrange; ///< FEValues of volume Lagrange basis.
+
+        OPERATOR::basis_functions<dim,2*dim,real>         soln_basis_int; ///< Interior solution basis.
+        OPERATOR::basis_functions<dim,2*dim,real>         soln_basis_ext; ///< Exterior solution basis.
+        OPERATOR::basis_functions<dim,2*dim,real>         flux_basis_int; ///< Interior flux basis.
+        OPERATOR::basis_functions<dim,2*dim,real>         flux_basis_ext; ///< Exterior flux basis.
+        OPERATOR::local_basis_stiffness<dim,2*dim,real>   flux_basis_stiffness; ///< Flux basis stiffness for the skew-symmetric form.
+        OPERATOR::vol_projection_operator<dim,2*dim,real> soln_basis_projection_oper_int; ///< Interior projection operator.
+        OPERATOR::vol_projection_operator<dim,2*dim,real> soln_basis_projection_oper_ext; ///< Exterior projection operator.
+        OPERATOR::mapping_shape_functions<dim,2*dim,real> mapping_basis; ///< Mapping shape functions.
+        ScratchArena                                      &scratch_arena; ///< Workspace of the residual terms, owned by DGBase.
+    };
+
+    /// Scratch arenas of the residual terms, one per thread assembling the residual.
+    /** Unlike CellResidualScratchData, they are kept across residual evaluations, such that
+     *  the buffers sized for each polynomial degree are reused.
+     */
+    std::vector<std::unique_ptr<ScratchArena>> scratch_arenas;
+
+    /// Creates a scratch arena for the residual terms of the discretization.
+    /** The arena must derive from CellScratchArena, which holds the per-cell buffers of assemble_cell_residual().
+     *  Derived classes whose residual terms use the arena override this.
+     */
+    virtual std::unique_ptr<ScratchArena> create_scratch_arena() const;
+
+    /// Makes sure that at least n_arenas scratch arenas exist.
+    void allocate_scratch_arenas(const unsigned int n_arenas);
+
+    /// Assembles the residual contributions of cells [first, last) of the given cells with the given scratch data.
+    void assemble_cell_residual_range (
+        const std::vector<typename dealii::DoFHandler<dim>::active_cell_iterator> &cells,
+        const unsigned int first,
+        const unsigned int last,
+        CellResidualScratchData &scratch_data,
+        const bool compute_dRdW, const bool compute_dRdX, const bool compute_d2R);
+
+    /// Prepares the batches of cells used by assemble_cell_batched_residual() and returns whether they can be used.
+    /** Called by all the processors, such that either all or none of them assemble the residual in batches of cells.
+     *  The base class has no batched residual and returns false.
+     */
+    virtual bool prepare_cell_batches();
+
+    /// Assembles the explicit residual of all the locally owned cells in the batches of cells of prepare_cell_batches().
+    /** One scratch data is given per thread available to assemble the batches.
+     */
+    virtual void assemble_cell_batched_residual(std::vector<std::unique_ptr<CellResidualScratchData>> &scratch_data);
+
+    /// Adds the dependence of the residual on the solution through the auxiliary solution to dRdW.
+    /** Called by assemble_residual() after the cell loop when it computes dRdW with the auxiliary equations.
+     *  The base class adds nothing.
+     */
+    virtual void add_auxiliary_dRdW () {}
+
     /// Used in assemble_residual().
     /** IMPORTANT: This does not fully compute the cell residual since it might not
      *  perform the work on all the faces.
@@ -586,6 +742,7 @@ public:
         OPERATOR::vol_projection_operator<dim,2*dim,real>                  &soln_basis_projection_oper_int,
         OPERATOR::vol_projection_operator<dim,2*dim,real>                  &soln_basis_projection_oper_ext,
         OPERATOR::mapping_shape_functions<dim,2*dim,real>                  &mapping_basis,
+        ScratchArena                                                       &scratch_arena,
         const bool                                                         compute_auxiliary_right_hand_side,//flag on whether computing the Auxiliary variable's equations' residuals
         dealii::LinearAlgebra::distributed::Vector<double>                 &rhs,
         std::array<dealii::LinearAlgebra::distributed::Vector<double>,dim> &rhs_aux);
@@ -655,12 +812,77 @@ public:
     /// Sets the current time within DG to be used for unsteady source terms.
     void set_current_time(const real current_time_input);
 
+    /// Parts of the residual assembled by assemble_residual(), for additive time integrators.
+    enum class ResidualPart {
+        full, ///< All the terms
+        convective, ///< Convective fluxes only
+        dissipative ///< Dissipative fluxes and source terms
+    };
+
+    /// Selects the part of the residual assembled by assemble_residual(), also used for dRdW.
+    /** Parts other than full require supports_residual_splitting(). */
+    void set_residual_part(const ResidualPart part);
+
+    /// Part of the residual assembled by assemble_residual().
+    ResidualPart get_residual_part() const { return residual_part; }
+
+    /// Whether the convective and dissipative parts of the residual can be assembled separately.
+    virtual bool supports_residual_splitting() const { return false; }
+
+    /// Time level of each active cell for local time stepping, level 0 having the largest time step.
+    /** Indexed by active_cell_index, including the ghost cells. Assigned by the ODE solver and only
+     *  used after set_active_time_level().
+     */
+    std::vector<int> cell_time_level;
+
+    /// Restricts assemble_residual() to the terms of one level of cell_time_level, or assembles all of them if negative.
+    /** The volume and boundary terms of a cell, and its own flux on its faces, belong to its level.
+     *  The numerical flux of an interior face belongs to the finer level of its two cells, such that it is
+     *  applied at the same rate on both sides of the face, and the residuals of the levels sum to the full residual.
+     *  Cells without terms of the active level are skipped. Levels other than negative require supports_local_time_stepping().
+     */
+    void set_active_time_level(const int level);
+
+    /// Whether assemble_residual() can be restricted to the terms of one time level.
+    virtual bool supports_local_time_stepping() const { return false; }
+
     /// Computational time for assembling residual.
     double assemble_residual_time;
 
+    /// Number of buffers the scratch arenas had to create or grow, summed over the threads.
+    /** Stays constant once the residual has been assembled for every polynomial degree in use,
+     *  that is once the buffers of the residual terms are only reused.
+     */
+    unsigned int n_scratch_arena_allocations() const;
+
 protected:
     /// The current time set in set_current_time()
     real current_time;
+
+    /// Part of the residual set in set_residual_part()
+    ResidualPart residual_part = ResidualPart::full;
+
+    /// Whether the convective terms are assembled, depending on residual_part.
+    bool assembles_convective_terms() const { return residual_part != ResidualPart::dissipative; }
+
+    /// Whether the dissipative and source terms are assembled, depending on residual_part.
+    bool assembles_dissipative_terms() const { return residual_part != ResidualPart::convective; }
+
+    /// Level of cell_time_level assembled by assemble_residual(), negative for all of them.
+    int active_time_level = -1;
+
+    /// Whether the terms of the cell's level are assembled, see set_active_time_level().
+    bool time_level_is_active(const dealii::types::global_dof_index cell_index) const
+    { return (active_time_level < 0) || (cell_time_level[cell_index] == active_time_level); }
+
+    /// Whether the numerical flux of an interior face is assembled, depending on active_time_level.
+    bool face_time_level_is_active(const dealii::types::global_dof_index cell_index, const dealii::types::global_dof_index neighbor_cell_index) const
+    { return (active_time_level < 0) || (std::max(cell_time_level[cell_index], cell_time_level[neighbor_cell_index]) == active_time_level); }
+
+    /// Whether the cell or one of its faces has terms of the active time level.
+    template<typename DoFCellAccessorType>
+    bool cell_has_terms_of_active_time_level (const DoFCellAccessorType &cell) const;
+
     /// Continuous distribution of artificial dissipation.
     const dealii::FE_Q<dim> fe_q_artificial_dissipation;
 
@@ -686,6 +908,7 @@ protected:
         OPERATOR::metric_operators<real,dim,2*dim>             &metric_oper,
         OPERATOR::mapping_shape_functions<dim,2*dim,real>      &mapping_basis,
         std::array<std::vector<real>,dim>                      &mapping_support_points,
+        ScratchArena                                           &scratch_arena,
         dealii::hp::FEValues<dim,dim>                          &fe_values_collection_volume,
         dealii::hp::FEValues<dim,dim>                          &fe_values_collection_volume_lagrange,
         const dealii::FESystem<dim,dim>                        &current_fe_ref,
@@ -713,6 +936,7 @@ protected:
         OPERATOR::metric_operators<real,dim,2*dim>             &metric_oper,
         OPERATOR::mapping_shape_functions<dim,2*dim,real>      &mapping_basis,
         std::array<std::vector<real>,dim>                      &mapping_support_points,
+        ScratchArena                                           &scratch_arena,
         dealii::hp::FEFaceValues<dim,dim>                      &fe_values_collection_face_int,
         const dealii::FESystem<dim,dim>                        &current_fe_ref,
         dealii::Vector<real>                                   &local_rhs_int_cell,
@@ -748,6 +972,7 @@ protected:
         OPERATOR::metric_operators<real,dim,2*dim>             &metric_oper_ext,
         OPERATOR::mapping_shape_functions<dim,2*dim,real>      &mapping_basis,
         std::array<std::vector<real>,dim>                      &mapping_support_points,
+        ScratchArena                                           &scratch_arena,
         dealii::hp::FEFaceValues<dim,dim>                      &fe_values_collection_face_int,
         dealii::hp::FEFaceValues<dim,dim>                      &fe_values_collection_face_ext,
         dealii::Vector<real>                                   &current_cell_rhs,
@@ -787,6 +1012,7 @@ protected:
         OPERATOR::metric_operators<real,dim,2*dim>             &metric_oper_ext,
         OPERATOR::mapping_shape_functions<dim,2*dim,real>      &mapping_basis,
         std::array<std::vector<real>,dim>                      &mapping_support_points,
+        ScratchArena                                           &scratch_arena,
         dealii::hp::FEFaceValues<dim,dim>                      &fe_values_collection_face_int,
         dealii::hp::FESubfaceValues<dim,dim>                   &fe_values_collection_subface,
         dealii::Vector<real>                                   &current_cell_rhs,
@@ -880,7 +1106,9 @@ public:
     void allocate_auxiliary_equation ();
 
     /// Asembles the auxiliary equations' residuals and solves.
-    virtual void assemble_auxiliary_residual () = 0;
+    /** If compute_dRdW, also prepares the derivatives used by add_auxiliary_dRdW().
+     */
+    virtual void assemble_auxiliary_residual (const bool compute_dRdW) = 0;
 
     /// Allocate the dual vector for optimization.
     /** Currently only used in weak form.
@@ -890,6 +1118,54 @@ public:
 protected:
     MPI_Comm mpi_communicator; ///< MPI communicator
     dealii::ConditionalOStream pcout; ///< Parallel std::cout that only outputs on mpi_rank==0
+
+    /// Set while assemble_auxiliary_residual() may only start the ghost exchange of auxiliary_solution.
+    /** The exchange of each direction idim then uses the communication channel idim, and
+     *  assemble_residual() finishes it after the interior cells.
+     */
+    bool defer_auxiliary_ghost_exchange = false;
+
+    /// Set by assemble_auxiliary_residual() when it started the ghost exchange of auxiliary_solution without finishing it.
+    bool auxiliary_ghost_exchange_pending = false;
+
+    /// Direction of the ongoing dRdW_vmult(), with ghost values, and nullptr otherwise.
+    /** When set, the residual terms accumulate their derivative in this direction into dRdW_direction_product.
+     */
+    const dealii::LinearAlgebra::distributed::Vector<double> *dRdW_direction = nullptr;
+
+    /// Directional derivative of the residual accumulated during dRdW_vmult(), before its compress.
+    dealii::LinearAlgebra::distributed::Vector<double> dRdW_direction_product;
+
+    /// Direction of dRdW_vmult() with ghost values, kept across products.
+    dealii::LinearAlgebra::distributed::Vector<double> dRdW_direction_ghosted;
+
+    /// Residual assembled by dRdW_vmult() in place of right_hand_side, kept across products.
+    dealii::LinearAlgebra::distributed::Vector<double> dRdW_residual;
+
+    /// Blocks of the ongoing assemble_cell_diagonal_blocks(), and nullptr otherwise.
+    /** When set, add_to_system_matrix() only keeps the derivatives of the residual of each cell
+     *  with respect to its own solution, and the system_matrix is not assembled.
+     */
+    std::vector<dealii::FullMatrix<double>> *cell_diagonal_blocks = nullptr;
+
+    /// Block and position within it of each locally owned degree of freedom during assemble_cell_diagonal_blocks().
+    /** Indexed by the position of the degree of freedom within locally_owned_dofs.
+     */
+    std::vector<std::pair<unsigned int, unsigned int>> cell_diagonal_block_positions;
+
+    /// Serializes add_to_system_matrix() between the threads of the cell loop.
+    std::mutex system_matrix_mutex;
+
+    /// Adds the residual derivatives of one row to system_matrix or block_system_matrix.
+    /** Same arguments as dealii::TrilinosWrappers::SparseMatrix::add().
+     *  During assemble_cell_diagonal_blocks(), adds them to the cell_diagonal_blocks instead.
+     *  Thread-safe.
+     */
+    void add_to_system_matrix (
+        const dealii::types::global_dof_index row,
+        const std::vector<dealii::types::global_dof_index> &columns,
+        const std::vector<double> &values,
+        const bool elide_zero_values);
 private:
 
     /** Evaluate the average penalty term at the face.
@@ -901,7 +1177,7 @@ private:
     real evaluate_penalty_scaling (
         const DoFCellAccessorType &cell,
         const int iface,
-        const dealii::hp::FECollection<dim> fe_collection) const;
+        const dealii::hp::FECollection<dim> &fe_collection) const;
 
     /// In the case that two cells have the same coarseness, this function decides if the current cell should perform the work.
     /** In the case the neighbor is a ghost cell, we let the processor with the lower rank do the work on that face.
@@ -914,6 +1190,59 @@ private:
     template<typename DoFCellAccessorType1, typename DoFCellAccessorType2>
     bool current_cell_should_do_the_work (const DoFCellAccessorType1 &current_cell, const DoFCellAccessorType2 &neighbor_cell) const;
 
+    /// Locally owned cells grouped into colors for the threaded residual assembly.
+    /** Cells of the same color neither share a face nor a face neighbor, such that
+     *  no two cells of a color write into the same entries of the global residual.
+     *  Only built in allocate_system() when more than one thread per process is requested.
+     */
+    std::vector<std::vector<typename dealii::DoFHandler<dim>::active_cell_iterator>> colored_locally_owned_cells;
+
+    /// Colors the locally owned cells into colored_locally_owned_cells.
+    /** The conflict indices of a cell are its own degrees of freedom and those of its
+     *  face neighbors, which are the residual entries its cell residual may write into.
+     */
+    void color_locally_owned_cells ();
+
+    /// Locally owned cells whose face neighbors are all locally owned.
+    /** Their residual neither reads ghost values nor writes into ghost entries.
+     *  Only built in allocate_system() when Parameters::AllParameters::overlap_ghost_exchange is set.
+     */
+    std::vector<typename dealii::DoFHandler<dim>::active_cell_iterator> interior_locally_owned_cells;
+
+    /// Locally owned cells with at least one face neighbor owned by another processor, or refined.
+    std::vector<typename dealii::DoFHandler<dim>::active_cell_iterator> ghost_adjacent_locally_owned_cells;
+
+    /// Splits the locally owned cells into interior_locally_owned_cells and ghost_adjacent_locally_owned_cells.
+    void split_locally_owned_cells_by_ghost_neighbors ();
+
+    /// Allocates block_system_matrix with one block per locally owned cell and per ghost cell sharing a face with them.
+    /** Each block couples to itself and to the blocks of its face neighbors, periodic ones included.
+     */
+    void allocate_block_system_matrix ();
+
+    /// Active cells sharing a face with the given cell, periodic ones included.
+    /** Across a refined face, the finer cells touching the face are returned.
+     *  The neighbors of a ghost cell may be artificial.
+     */
+    void get_face_neighbor_cells (
+        const typename dealii::DoFHandler<dim>::active_cell_iterator &cell,
+        std::vector<typename dealii::DoFHandler<dim>::active_cell_iterator> &neighbor_cells) const;
+
+    /// Calls visit() with each active cell sharing a face with the given cell, as returned by get_face_neighbor_cells().
+    /** The children of a finer neighbor are taken from neighbor_child_on_subface() or periodic_neighbor_child_on_subface().
+     *  In 1D, where faces have no children, they are the descendants of the neighbor on its face towards the cell.
+     */
+    template<typename DoFCellAccessorType, typename Visitor>
+    void for_each_face_neighbor_cell (const DoFCellAccessorType &cell, const Visitor &visit) const;
+
+    /// Set while assemble_residual_and_apply_inverse_mass_matrix() lets assemble_residual() leave the compress pending.
+    bool defer_right_hand_side_compress = false;
+
+    /// Set when the compress of right_hand_side has been started but not finished.
+    /** apply_inverse_global_mass_matrix() finishes it after the interior cells.
+     */
+    bool right_hand_side_compress_pending = false;
+
     /// Used in the delegated constructor
     /** The main reason we use this weird function is because all of the above objects
      *  need to be looped with the various p-orders. This function allows us to do this in a
@@ -924,6 +1253,10 @@ private:
 public:
     /// Flag to freeze artificial dissipation.
     bool freeze_artificial_dissipation;
+    /// Flag to assemble the explicit residual in batches of cells when the discretization supports it for the mesh.
+    /** Initialized from Parameters::AllParameters::use_cell_batched_residual.
+     */
+    bool use_cell_batched_residual;
     /// Stores maximum artificial dissipation while assembling the residual.
     double max_artificial_dissipation_coeff;
     /// Update discontinuity sensor.
@@ -11,9 +11,10 @@ template <int dim, int nstate, typename real, typename MeshType>
 DGBaseState<dim, nstate, real, MeshType>::DGBaseState(const Parameters::AllParameters *const parameters_input,
                                                       const unsigned int degree, const unsigned int max_degree_input,
                                                       const unsigned int grid_degree_input,
-                                                      const std::shared_ptr<Triangulation> triangulation_input)
+                                                      const std::shared_ptr<Triangulation> triangulation_input,
+                                                      const MPI_Comm mpi_communicator_input)
     : DGBase<dim, real, MeshType>::DGBase(nstate, parameters_input, degree, max_degree_input, grid_degree_input,
-                                          triangulation_input)  // Use DGBase constructor
+                                          triangulation_input, mpi_communicator_input)  // Use DGBase constructor
 {
     artificial_dissip = ArtificialDissipationFactory<dim, nstate>::create_artificial_dissipation(parameters_input);
 
@@ -184,19 +185,33 @@ void DGBaseState<dim, nstate, real, MeshType>::set_use_auxiliary_eq() {
 }
 
 template <int dim, int nstate, typename real, typename MeshType>
-real DGBaseState<dim, nstate, real, MeshType>::evaluate_CFL(std::vector<std::array<real, nstate> > soln_at_q,
+real DGBaseState<dim, nstate, real, MeshType>::evaluate_CFL(const std::vector<std::array<real, nstate> > &soln_at_q,
                                                             const real artificial_dissipation, const real cell_diameter,
                                                             const unsigned int cell_degree) {
     const unsigned int n_pts = soln_at_q.size();
-    std::vector<real> convective_eigenvalues(n_pts);
-    std::vector<real> viscosities(n_pts);
-    for (unsigned int isol = 0; isol < n_pts; ++isol) {
-        convective_eigenvalues[isol] = pde_physics_double->max_convective_eigenvalue(soln_at_q[isol]);
-        viscosities[isol] = pde_physics_double->max_viscous_eigenvalue(soln_at_q[isol]);
+    // Running maxima, such that no temporary vectors are allocated for every cell.
+    real max_eig = pde_physics_double->max_convective_eigenvalue(soln_at_q[0]);
+    real max_diffusive = pde_physics_double->max_viscous_eigenvalue(soln_at_q[0]);
+    for (unsigned int isol = 1; isol < n_pts; ++isol) {
+        max_eig = std::max(max_eig, pde_physics_double->max_convective_eigenvalue(soln_at_q[isol]));
+        max_diffusive = std::max(max_diffusive, pde_physics_double->max_viscous_eigenvalue(soln_at_q[isol]));
     }
-    const real max_eig = *(std::max_element(convective_eigenvalues.begin(), convective_eigenvalues.end()));
-    const real max_diffusive = *(std::max_element(viscosities.begin(), viscosities.end()));
+    return evaluate_CFL_from_eigenvalues(max_eig, max_diffusive, artificial_dissipation, cell_diameter, cell_degree);
+}
 
+template <int dim, int nstate, typename real, typename MeshType>
+real DGBaseState<dim, nstate, real, MeshType>::evaluate_CFL(const std::array<std::vector<real>, nstate> &soln_at_q,
+                                                            const real artificial_dissipation, const real cell_diameter,
+                                                            const unsigned int cell_degree) {
+    const real max_eig = pde_physics_double->max_convective_eigenvalue_batch(soln_at_q);
+    const real max_diffusive = pde_physics_double->max_viscous_eigenvalue_batch(soln_at_q);
+    return evaluate_CFL_from_eigenvalues(max_eig, max_diffusive, artificial_dissipation, cell_diameter, cell_degree);
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+real DGBaseState<dim, nstate, real, MeshType>::evaluate_CFL_from_eigenvalues(const real max_eig, const real max_diffusive,
+                                                                             const real artificial_dissipation, const real cell_diameter,
+                                                                             const unsigned int cell_degree) const {
     // const real cfl_convective = cell_diameter / max_eig;
     // const real cfl_diffusive  = artificial_dissipation != 0.0 ? 0.5*cell_diameter*cell_diameter /
     // artificial_dissipation : 1e200; real min_cfl = std::min(cfl_convective, cfl_diffusive) / (2*cell_degree + 1.0);
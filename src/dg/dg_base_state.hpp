@@ -30,7 +30,8 @@ class DGBaseState : public DGBase<dim, real, MeshType>
         const unsigned int degree,
         const unsigned int max_degree_input,
         const unsigned int grid_degree_input,
-        const std::shared_ptr<Triangulation> triangulation_input);
+        const std::shared_ptr<Triangulation> triangulation_input,
+        const MPI_Comm mpi_communicator_input = MPI_COMM_WORLD);
 
     /// Contains the physics of the PDE with real type
     std::shared_ptr < Physics::PhysicsBase<dim, nstate, real > > pde_physics_double;
@@ -107,7 +108,13 @@ class DGBaseState : public DGBase<dim, real, MeshType>
      *  Furthermore, a more robust implementation would convert the values to a Bezier basis where
      *  the maximum and minimum values would be bounded by the Bernstein modal coefficients.
      */
-    real evaluate_CFL (std::vector< std::array<real,nstate> > soln_at_q, const real artificial_dissipation, const real cell_diameter, const unsigned int cell_degree);
+    real evaluate_CFL (const std::vector< std::array<real,nstate> > &soln_at_q, const real artificial_dissipation, const real cell_diameter, const unsigned int cell_degree);
+
+    /// Same as above, with the solution stored by state such that the eigenvalues are evaluated in batch.
+    real evaluate_CFL (const std::array< std::vector<real>,nstate > &soln_at_q, const real artificial_dissipation, const real cell_diameter, const unsigned int cell_degree);
+
+    /// Time step of evaluate_CFL() given the maximum convective and viscous eigenvalues of the cell.
+    real evaluate_CFL_from_eigenvalues (const real max_eig, const real max_diffusive, const real artificial_dissipation, const real cell_diameter, const unsigned int cell_degree) const;
 
     /// Reinitializes the numerical fluxes based on the current physics.
     /** Usually called after setting physics.
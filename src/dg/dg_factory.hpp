@@ -22,14 +22,17 @@ class DGFactory
     using Triangulation = MeshType;
 public:
     /// Creates a derived object DG, but returns it as DGBase.
-    /** That way, the caller is agnostic to the number of state variables */
+    /** That way, the caller is agnostic to the number of state variables.
+     *  The DG is distributed over mpi_communicator_input, see DGBase::DGBase().
+     */
     static std::shared_ptr< DGBase<dim,real,MeshType> >
         create_discontinuous_galerkin(
         const Parameters::AllParameters *const parameters_input,
         const unsigned int degree,
         const unsigned int max_degree_input,
         const unsigned int grid_degree_input,
-        const std::shared_ptr<Triangulation> triangulation_input);
+        const std::shared_ptr<Triangulation> triangulation_input,
+        const MPI_Comm mpi_communicator_input = MPI_COMM_WORLD);
 
     /// calls the above dg factory with grid_degree_input = degree + 1
     static std::shared_ptr< DGBase<dim,real,MeshType> >
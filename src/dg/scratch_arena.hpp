@@ -0,0 +1,415 @@
+#ifndef PHILIP_SCRATCH_ARENA_HPP
+#define PHILIP_SCRATCH_ARENA_HPP
+
+#include <array>
+#include <deque>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/types.h>
+#include <deal.II/fe/fe_tools.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "ADTypes.hpp"
+#include "operators/operators.h"
+
+namespace PHiLiP {
+
+/// Reusable workspace for the temporaries of the cell residual terms.
+/** Each thread assembling the residual owns one arena, which is kept by DGBase across
+ *  residual evaluations and passed through DGBase::assemble_cell_residual() down to the
+ *  volume, boundary and face terms. The base class holds no buffers; CellScratchArena adds the
+ *  per-cell buffers of DGBase and discretizations that use the arena derive from it.
+ */
+class ScratchArena
+{
+public:
+    /// Destructor
+    virtual ~ScratchArena() = default;
+
+    /// Makes every buffer of the arena available again.
+    /** Called at the start of each residual term. References obtained before are invalidated.
+     */
+    virtual void rewind() {}
+
+    /// Number of times a buffer had to be created or grown since construction.
+    /** Once every polynomial degree has been visited, this stays constant.
+     */
+    unsigned int n_allocations() const { return allocation_count; }
+
+protected:
+    /// Counter returned by n_allocations().
+    unsigned int allocation_count = 0;
+
+    /// Sets the vector to n_entries copies of value, counting a reallocation if it has to grow.
+    template <typename T>
+    std::vector<T> & assign(std::vector<T> &v, const unsigned int n_entries, const T &value)
+    {
+        if(v.capacity() < n_entries) ++this->allocation_count;
+        v.assign(n_entries, value);
+        return v;
+    }
+};
+
+/// Scratch arena holding the per-cell temporaries of DGBase::assemble_cell_residual().
+/** The local residuals, the dof indices, the mapping support points and the metric operators
+ *  of the current cell and of its face neighbor are kept across cells and residual evaluations.
+ *  They are not affected by rewind(), which is called by the residual terms while the cell is assembled.
+ */
+template <int dim, typename real>
+class CellScratchArena : public ScratchArena
+{
+public:
+    /// Metric operators.
+    using MetricOperators = OPERATOR::metric_operators<real,dim,2*dim>;
+
+    /// Side of a face the buffers belong to.
+    enum Side { interior = 0, exterior = 1 };
+
+    /// Metric operators of the given side for the given degrees.
+    /** Constructed on the first request. The terms they hold are those last built by the residual terms.
+     */
+    MetricOperators & metric_operators(
+        const Side side,
+        const int nstate,
+        const unsigned int poly_degree,
+        const unsigned int grid_degree,
+        const bool store_vol_flux_nodes,
+        const bool store_surf_flux_nodes)
+    {
+        std::unique_ptr<MetricOperators> &stored
+            = metric_operators_pool[side][std::make_tuple(poly_degree, grid_degree, store_vol_flux_nodes, store_surf_flux_nodes)];
+        if(!stored){
+            stored = std::make_unique<MetricOperators>(nstate, poly_degree, grid_degree, store_vol_flux_nodes, store_surf_flux_nodes);
+            ++this->allocation_count;
+        }
+        return *stored;
+    }
+
+    /// Local residual of the given side, of size n_dofs and zero-initialized.
+    dealii::Vector<real> & cell_rhs(const Side side, const unsigned int n_dofs)
+    {
+        VectorSlot &slot = cell_rhs_pool[side];
+        if(slot.capacity < n_dofs){
+            slot.capacity = n_dofs;
+            ++this->allocation_count;
+        }
+        slot.value.reinit(n_dofs);
+        return slot.value;
+    }
+
+    /// Local residual of the auxiliary equations of the given side, of size n_dofs and zero-initialized.
+    std::vector<dealii::Tensor<1,dim,double>> & cell_rhs_aux(const Side side, const unsigned int n_dofs)
+    {
+        return assign(cell_rhs_aux_pool[side], n_dofs, dealii::Tensor<1,dim,double>());
+    }
+
+    /// Global dof indices of the solution on the given side, of size n_dofs.
+    std::vector<dealii::types::global_dof_index> & cell_dof_indices(const Side side, const unsigned int n_dofs)
+    {
+        return assign(cell_dof_indices_pool[side], n_dofs, dealii::types::global_dof_index(0));
+    }
+
+    /// Global dof indices of the grid on the given side, of size n_dofs.
+    std::vector<dealii::types::global_dof_index> & metric_dof_indices(const Side side, const unsigned int n_dofs)
+    {
+        return assign(metric_dof_indices_pool[side], n_dofs, dealii::types::global_dof_index(0));
+    }
+
+    /// Mapping support points of the current cell, filled by the residual terms.
+    std::array<std::vector<real>,dim> & mapping_support_points()
+    {
+        return mapping_support_points_buffer;
+    }
+
+    /// Lexicographic index of each hierarchic grid node, see dealii::FETools::hierarchic_to_lexicographic_numbering().
+    /** Computed on the first request for each grid degree.
+     */
+    const std::vector<unsigned int> & grid_node_renumbering(const unsigned int grid_degree)
+    {
+        std::vector<unsigned int> &renumbering = grid_node_renumbering_pool[grid_degree];
+        if(renumbering.empty()){
+            renumbering = dealii::FETools::hierarchic_to_lexicographic_numbering<dim>(grid_degree);
+            ++this->allocation_count;
+        }
+        return renumbering;
+    }
+
+private:
+    /// dealii::Vector with the number of entries it was last allocated for.
+    struct VectorSlot
+    {
+        dealii::Vector<real> value; ///< Vector.
+        unsigned int capacity = 0; ///< Allocated entries.
+    };
+
+    /// See metric_operators(), per side and per polynomial degree, grid degree and flux nodes storage flags.
+    std::array<std::map<std::tuple<unsigned int,unsigned int,bool,bool>, std::unique_ptr<MetricOperators>>,2> metric_operators_pool;
+    std::array<VectorSlot,2> cell_rhs_pool; ///< See cell_rhs().
+    std::array<std::vector<dealii::Tensor<1,dim,double>>,2> cell_rhs_aux_pool; ///< See cell_rhs_aux().
+    std::array<std::vector<dealii::types::global_dof_index>,2> cell_dof_indices_pool; ///< See cell_dof_indices().
+    std::array<std::vector<dealii::types::global_dof_index>,2> metric_dof_indices_pool; ///< See metric_dof_indices().
+    std::array<std::vector<real>,dim> mapping_support_points_buffer; ///< See mapping_support_points().
+    std::map<unsigned int, std::vector<unsigned int>> grid_node_renumbering_pool; ///< See grid_node_renumbering().
+};
+
+/// Base of StrongDGScratchArena.
+/** The arena of the residual terms evaluated in double also holds the per-cell buffers of DGBase.
+ *  The arena of the terms evaluated with an AD type only holds the temporaries of the terms.
+ */
+template <int dim, typename real>
+using StrongDGScratchArenaBase = typename std::conditional<std::is_same<real,double>::value, CellScratchArena<dim,real>, ScratchArena>::type;
+
+/// Scratch arena for the strong-form DG volume, boundary and face terms.
+/** Buffers are handed out in the order they are requested after rewind(), zero-initialized
+ *  (or set to the given value) and sized as requested, like freshly constructed local
+ *  containers would be. The slots persist, such that the same sequence of requests for the
+ *  same polynomial degrees does not allocate.
+ *  The per-cell buffers of CellScratchArena are not handed out by rewind().
+ */
+template <int dim, int nstate, typename real>
+class StrongDGScratchArena : public StrongDGScratchArenaBase<dim,real>
+{
+public:
+    /// Vectors of each state.
+    using StateVectors = std::array<std::vector<real>,nstate>;
+    /// Vectors of each reference direction.
+    using DimVectors = std::array<std::vector<real>,dim>;
+    /// Vector of each reference direction, stored as a tensor.
+    using TensorVectors = dealii::Tensor<1,dim,std::vector<real>>;
+    /// Vectors of each state and reference direction.
+    using StateTensorVectors = std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate>;
+    /// Matrices of each state.
+    using StateMatrices = std::array<dealii::FullMatrix<real>,nstate>;
+    /// Matrices of each reference direction.
+    using DimMatrices = std::array<dealii::FullMatrix<real>,dim>;
+    /// Matrices of each state and reference direction.
+    using StateDimMatrices = std::array<DimMatrices,nstate>;
+
+    /// See ScratchArena::rewind().
+    void rewind() override
+    {
+        vectors.rewind();
+        dim_vectors_pool.rewind();
+        tensor_vectors_pool.rewind();
+        tensors_pool.rewind();
+        state_vectors_pool.rewind();
+        state_tensor_vectors_pool.rewind();
+        matrices.rewind();
+        state_matrices_pool.rewind();
+        dim_matrices_pool.rewind();
+        state_dim_matrices_pool.rewind();
+        index_vectors.rewind();
+        index_array_vectors.rewind();
+        dof_indices_pool.rewind();
+    }
+
+    /// Vector of size n_entries filled with value.
+    std::vector<real> & vector(const unsigned int n_entries, const real value = 0.0)
+    {
+        std::vector<real> &v = next(vectors);
+        assign(v, n_entries, value);
+        return v;
+    }
+
+    /// Vector of size n_entries for each reference direction.
+    DimVectors & dim_vectors(const unsigned int n_entries)
+    {
+        DimVectors &v = next(dim_vectors_pool);
+        for(int idim=0; idim<dim; idim++){
+            assign(v[idim], n_entries, real(0.0));
+        }
+        return v;
+    }
+
+    /// Vector of size n_entries for each reference direction, stored as a tensor.
+    TensorVectors & tensor_vectors(const unsigned int n_entries)
+    {
+        TensorVectors &v = next(tensor_vectors_pool);
+        for(int idim=0; idim<dim; idim++){
+            assign(v[idim], n_entries, real(0.0));
+        }
+        return v;
+    }
+
+    /// Vector of n_entries zero tensors.
+    std::vector<dealii::Tensor<1,dim,real>> & tensors(const unsigned int n_entries)
+    {
+        std::vector<dealii::Tensor<1,dim,real>> &v = next(tensors_pool);
+        assign(v, n_entries, dealii::Tensor<1,dim,real>());
+        return v;
+    }
+
+    /// Vector of size n_entries for each state.
+    StateVectors & state_vectors(const unsigned int n_entries)
+    {
+        StateVectors &v = next(state_vectors_pool);
+        for(int istate=0; istate<nstate; istate++){
+            assign(v[istate], n_entries, real(0.0));
+        }
+        return v;
+    }
+
+    /// Vector of size n_entries for each state and reference direction.
+    StateTensorVectors & state_tensor_vectors(const unsigned int n_entries)
+    {
+        StateTensorVectors &v = next(state_tensor_vectors_pool);
+        for(int istate=0; istate<nstate; istate++){
+            for(int idim=0; idim<dim; idim++){
+                assign(v[istate][idim], n_entries, real(0.0));
+            }
+        }
+        return v;
+    }
+
+    /// Matrix of size n_rows x n_columns.
+    dealii::FullMatrix<real> & matrix(const unsigned int n_rows, const unsigned int n_columns)
+    {
+        MatrixSlot<dealii::FullMatrix<real>> &slot = next(matrices);
+        reinit(slot.value, slot.capacity[0], n_rows, n_columns);
+        return slot.value;
+    }
+
+    /// Matrix of size n_rows x n_columns for each state.
+    StateMatrices & state_matrices(const unsigned int n_rows, const unsigned int n_columns)
+    {
+        MatrixSlot<StateMatrices> &slot = next(state_matrices_pool);
+        for(int istate=0; istate<nstate; istate++){
+            reinit(slot.value[istate], slot.capacity[istate], n_rows, n_columns);
+        }
+        return slot.value;
+    }
+
+    /// Matrix of size n_rows x n_columns for each reference direction.
+    DimMatrices & dim_matrices(const unsigned int n_rows, const unsigned int n_columns)
+    {
+        MatrixSlot<DimMatrices> &slot = next(dim_matrices_pool);
+        for(int idim=0; idim<dim; idim++){
+            reinit(slot.value[idim], slot.capacity[idim], n_rows, n_columns);
+        }
+        return slot.value;
+    }
+
+    /// Matrix of size n_rows x n_columns for each state and reference direction.
+    StateDimMatrices & state_dim_matrices(const unsigned int n_rows, const unsigned int n_columns)
+    {
+        MatrixSlot<StateDimMatrices> &slot = next(state_dim_matrices_pool);
+        for(int istate=0; istate<nstate; istate++){
+            for(int idim=0; idim<dim; idim++){
+                reinit(slot.value[istate][idim], slot.capacity[istate*dim + idim], n_rows, n_columns);
+            }
+        }
+        return slot.value;
+    }
+
+    /// Vector of n_entries indices.
+    std::vector<unsigned int> & index_vector(const unsigned int n_entries)
+    {
+        std::vector<unsigned int> &v = next(index_vectors);
+        assign(v, n_entries, 0u);
+        return v;
+    }
+
+    /// Vector of n_entries arrays of one index per reference direction.
+    std::vector<std::array<unsigned int,dim>> & index_array_vector(const unsigned int n_entries)
+    {
+        std::vector<std::array<unsigned int,dim>> &v = next(index_array_vectors);
+        assign(v, n_entries, std::array<unsigned int,dim>());
+        return v;
+    }
+
+    /// Vector of n_entries global degree of freedom indices.
+    std::vector<dealii::types::global_dof_index> & dof_indices(const unsigned int n_entries)
+    {
+        std::vector<dealii::types::global_dof_index> &v = next(dof_indices_pool);
+        assign(v, n_entries, dealii::types::global_dof_index(0));
+        return v;
+    }
+
+    /// Arena of the residual terms evaluated with FadType to assemble their derivatives.
+    /** Constructed on the first request and rewound separately, such that the buffers of this arena
+     *  stay valid while the derivatives are evaluated.
+     */
+    StrongDGScratchArena<dim,nstate,FadType> & derivative_arena()
+    {
+        if(!derivative_arena_pointer){
+            derivative_arena_pointer = std::make_unique<StrongDGScratchArena<dim,nstate,FadType>>();
+            ++this->allocation_count;
+        }
+        return *derivative_arena_pointer;
+    }
+
+private:
+    /// Slots of one type of buffer, handed out in order since the last rewind.
+    /** A deque is used such that references to the slots stay valid when it grows.
+     */
+    template <typename T>
+    struct Pool
+    {
+        std::deque<T> slots; ///< Persistent buffers.
+        unsigned int n_used = 0; ///< Number of slots handed out since the last rewind.
+        /// Makes all slots available again.
+        void rewind() { n_used = 0; }
+    };
+
+    /// Matrices with the number of entries each of them was last allocated for.
+    /** dealii::FullMatrix does not expose its capacity, so it is tracked here for the counter.
+     */
+    template <typename T>
+    struct MatrixSlot
+    {
+        T value; ///< Matrix or array of matrices.
+        std::array<unsigned int,nstate*dim> capacity{}; ///< Allocated entries of each matrix.
+    };
+
+    using ScratchArena::assign;
+
+    /// Hands out the next slot of the pool, creating it if needed.
+    template <typename T>
+    T & next(Pool<T> &pool)
+    {
+        if(pool.n_used == pool.slots.size()){
+            pool.slots.emplace_back();
+            ++this->allocation_count;
+        }
+        return pool.slots[pool.n_used++];
+    }
+
+    /// Reinitializes the matrix to zero, counting a reallocation if it has to grow.
+    void reinit(dealii::FullMatrix<real> &mat, unsigned int &capacity, const unsigned int n_rows, const unsigned int n_columns)
+    {
+        if(capacity < n_rows * n_columns){
+            capacity = n_rows * n_columns;
+            ++this->allocation_count;
+        }
+        if(mat.m() == n_rows && mat.n() == n_columns){
+            mat = 0.0;
+        } else {
+            mat.reinit(n_rows, n_columns);
+        }
+    }
+
+    Pool<std::vector<real>>                           vectors; ///< See vector().
+    Pool<DimVectors>                                  dim_vectors_pool; ///< See dim_vectors().
+    Pool<TensorVectors>                               tensor_vectors_pool; ///< See tensor_vectors().
+    Pool<std::vector<dealii::Tensor<1,dim,real>>>     tensors_pool; ///< See tensors().
+    Pool<StateVectors>                                state_vectors_pool; ///< See state_vectors().
+    Pool<StateTensorVectors>                          state_tensor_vectors_pool; ///< See state_tensor_vectors().
+    Pool<MatrixSlot<dealii::FullMatrix<real>>>        matrices; ///< See matrix().
+    Pool<MatrixSlot<StateMatrices>>                   state_matrices_pool; ///< See state_matrices().
+    Pool<MatrixSlot<DimMatrices>>                     dim_matrices_pool; ///< See dim_matrices().
+    Pool<MatrixSlot<StateDimMatrices>>                state_dim_matrices_pool; ///< See state_dim_matrices().
+    Pool<std::vector<unsigned int>>                   index_vectors; ///< See index_vector().
+    Pool<std::vector<std::array<unsigned int,dim>>>   index_array_vectors; ///< See index_array_vector().
+    Pool<std::vector<dealii::types::global_dof_index>> dof_indices_pool; ///< See dof_indices().
+    std::unique_ptr<StrongDGScratchArena<dim,nstate,FadType>> derivative_arena_pointer; ///< See derivative_arena().
+};
+
+} // PHiLiP namespace
+
+#endif
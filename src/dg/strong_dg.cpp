@@ -1,4 +1,12 @@
+#include <algorithm>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <type_traits>
+
 #include <deal.II/base/tensor.h>
+#include <deal.II/base/thread_management.h>
+#include <deal.II/base/vectorization.h>
 
 #include <deal.II/fe/fe_values.h>
 
@@ -9,6 +17,7 @@
 
 #include <deal.II/dofs/dof_accessor.h>
 
+#include <deal.II/lac/full_matrix.templates.h>
 #include <deal.II/lac/vector.h>
 
 #include "ADTypes.hpp"
@@ -19,16 +28,431 @@
 
 namespace PHiLiP {
 
+namespace {
+/// Applies the sum-factorized operators, which only act on double, to the AD types of the residual terms.
+/** The operators are linear in their input. With FadType, they are therefore applied to the values and to
+ *  each derivative of the input separately. With double, the operators are called directly.
+ */
+namespace ADOperator {
+
+/// Container of double with the same layout as T.
+template <typename T> struct Component { using type = T; };
+/// See Component.
+template <> struct Component<std::vector<FadType>> { using type = std::vector<double>; };
+/// See Component.
+template <int dim> struct Component<dealii::Tensor<1,dim,std::vector<FadType>>> { using type = dealii::Tensor<1,dim,std::vector<double>>; };
+
+/// Value of the entry if icomponent is -1, its derivative icomponent otherwise.
+inline double component(const FadType &entry, const int icomponent)
+{
+    if(icomponent < 0) return entry.val();
+    return (icomponent < entry.size()) ? entry.fastAccessDx(icomponent) : 0.0;
+}
+
+/// Largest number of derivatives of the entries.
+inline int n_derivatives(const std::vector<FadType> &v)
+{
+    int n = 0;
+    for(const FadType &entry : v) n = std::max(n, entry.size());
+    return n;
+}
+
+/// See n_derivatives().
+template <int dim>
+int n_derivatives(const dealii::Tensor<1,dim,std::vector<FadType>> &v)
+{
+    int n = 0;
+    for(int idim=0; idim<dim; idim++) n = std::max(n, n_derivatives(v[idim]));
+    return n;
+}
+
+/// Gives every entry n_derivatives derivatives, which are kept if keep_derivatives and zeroed otherwise.
+inline void resize_derivatives(std::vector<FadType> &v, const int n_derivatives, const bool keep_derivatives)
+{
+    for(FadType &entry : v){
+        if(entry.size() == n_derivatives && keep_derivatives) continue;
+        FadType resized(n_derivatives, entry.val());
+        if(keep_derivatives){
+            for(int k=0; k<entry.size(); k++) resized.fastAccessDx(k) = entry.fastAccessDx(k);
+        }
+        entry = resized;
+    }
+}
+
+/// See resize_derivatives().
+template <int dim>
+void resize_derivatives(dealii::Tensor<1,dim,std::vector<FadType>> &v, const int n_derivatives, const bool keep_derivatives)
+{
+    for(int idim=0; idim<dim; idim++) resize_derivatives(v[idim], n_derivatives, keep_derivatives);
+}
+
+/// Copies the values (icomponent = -1) or the derivative icomponent of the entries.
+inline void get_component(const std::vector<FadType> &v, const int icomponent, std::vector<double> &c)
+{
+    c.resize(v.size());
+    for(unsigned int i=0; i<v.size(); i++) c[i] = component(v[i], icomponent);
+}
+
+/// See get_component().
+template <int dim>
+void get_component(const dealii::Tensor<1,dim,std::vector<FadType>> &v, const int icomponent, dealii::Tensor<1,dim,std::vector<double>> &c)
+{
+    for(int idim=0; idim<dim; idim++) get_component(v[idim], icomponent, c[idim]);
+}
+
+/// Sets the values (icomponent = -1) or the derivative icomponent of entries sized by resize_derivatives().
+inline void set_component(const std::vector<double> &c, const int icomponent, std::vector<FadType> &v)
+{
+    for(unsigned int i=0; i<v.size(); i++){
+        if(icomponent < 0) v[i].val() = c[i];
+        else v[i].fastAccessDx(icomponent) = c[i];
+    }
+}
+
+/// See set_component().
+template <int dim>
+void set_component(const dealii::Tensor<1,dim,std::vector<double>> &c, const int icomponent, dealii::Tensor<1,dim,std::vector<FadType>> &v)
+{
+    for(int idim=0; idim<dim; idim++) set_component(c[idim], icomponent, v[idim]);
+}
+
+/// Applies the linear operator apply(input, output, adding) to the values and derivatives of the input.
+template <typename InputType, typename OutputType, typename ApplyType>
+void apply_linear_operator(const InputType &input, OutputType &output, const bool adding, const ApplyType &apply)
+{
+    using InputComponent = typename Component<InputType>::type;
+    using OutputComponent = typename Component<OutputType>::type;
+    if constexpr(std::is_same<InputType,InputComponent>::value && std::is_same<OutputType,OutputComponent>::value) {
+        apply(input, output, adding);
+    } else {
+        const int n = std::max(n_derivatives(input), adding ? n_derivatives(output) : 0);
+        resize_derivatives(output, n, adding);
+        InputComponent input_component;
+        OutputComponent output_component;
+        for(int icomponent=-1; icomponent<n; icomponent++){
+            get_component(input, icomponent, input_component);
+            get_component(output, icomponent, output_component);
+            apply(input_component, output_component, adding);
+            set_component(output_component, icomponent, output);
+        }
+    }
+}
+
+/// Weights of the inner products. The AD weights of the residual terms only hold values.
+inline const std::vector<double> & weight_values(const std::vector<double> &weights, std::vector<double> &/*buffer*/)
+{
+    return weights;
+}
+
+/// See weight_values().
+inline const std::vector<double> & weight_values(const std::vector<FadType> &weights, std::vector<double> &buffer)
+{
+    get_component(weights, -1, buffer);
+    return buffer;
+}
+
+/// See OPERATOR::SumFactorizedOperators::matrix_vector_mult_1D().
+template <typename OperatorType, typename VectorType>
+void matrix_vector_mult_1D(
+    OperatorType &oper, const VectorType &input_vect, VectorType &output_vect,
+    const dealii::FullMatrix<double> &basis_x, const bool adding = false, const double factor = 1.0)
+{
+    apply_linear_operator(input_vect, output_vect, adding,
+        [&] (const auto &input, auto &output, const bool add) {
+            oper.matrix_vector_mult_1D(input, output, basis_x, add, factor);
+        });
+}
+
+/// See OPERATOR::SumFactorizedOperators::matrix_vector_mult_surface_1D().
+template <typename OperatorType, typename VectorType>
+void matrix_vector_mult_surface_1D(
+    OperatorType &oper, const unsigned int face_number, const VectorType &input_vect, VectorType &output_vect,
+    const std::array<dealii::FullMatrix<double>,2> &basis_surf, const dealii::FullMatrix<double> &basis_vol,
+    const bool adding = false, const double factor = 1.0)
+{
+    apply_linear_operator(input_vect, output_vect, adding,
+        [&] (const auto &input, auto &output, const bool add) {
+            oper.matrix_vector_mult_surface_1D(face_number, input, output, basis_surf, basis_vol, add, factor);
+        });
+}
+
+/// See OPERATOR::SumFactorizedOperators::inner_product_1D().
+template <typename OperatorType, typename VectorType, typename WeightType>
+void inner_product_1D(
+    OperatorType &oper, const VectorType &input_vect, const WeightType &weight_vect, VectorType &output_vect,
+    const dealii::FullMatrix<double> &basis_x, const bool adding = false, const double factor = 1.0)
+{
+    std::vector<double> weight_buffer;
+    const std::vector<double> &weights = weight_values(weight_vect, weight_buffer);
+    apply_linear_operator(input_vect, output_vect, adding,
+        [&] (const auto &input, auto &output, const bool add) {
+            oper.inner_product_1D(input, weights, output, basis_x, add, factor);
+        });
+}
+
+/// See OPERATOR::SumFactorizedOperators::inner_product_surface_1D().
+template <typename OperatorType, typename VectorType, typename WeightType>
+void inner_product_surface_1D(
+    OperatorType &oper, const unsigned int face_number, const VectorType &input_vect, const WeightType &weight_vect, VectorType &output_vect,
+    const std::array<dealii::FullMatrix<double>,2> &basis_surf, const dealii::FullMatrix<double> &basis_vol,
+    const bool adding = false, const double factor = 1.0)
+{
+    std::vector<double> weight_buffer;
+    const std::vector<double> &weights = weight_values(weight_vect, weight_buffer);
+    apply_linear_operator(input_vect, output_vect, adding,
+        [&] (const auto &input, auto &output, const bool add) {
+            oper.inner_product_surface_1D(face_number, input, weights, output, basis_surf, basis_vol, add, factor);
+        });
+}
+
+/// See OPERATOR::SumFactorizedOperators::gradient_matrix_vector_mult_1D().
+template <typename OperatorType, typename VectorType, typename TensorType>
+void gradient_matrix_vector_mult_1D(
+    OperatorType &oper, const VectorType &input_vect, TensorType &output_vect,
+    const dealii::FullMatrix<double> &basis, const dealii::FullMatrix<double> &gradient_basis)
+{
+    apply_linear_operator(input_vect, output_vect, false,
+        [&] (const auto &input, auto &output, const bool /*add*/) {
+            oper.gradient_matrix_vector_mult_1D(input, output, basis, gradient_basis);
+        });
+}
+
+/// See OPERATOR::SumFactorizedOperators::divergence_matrix_vector_mult_1D().
+template <typename OperatorType, typename TensorType, typename VectorType>
+void divergence_matrix_vector_mult_1D(
+    OperatorType &oper, const TensorType &input_vect, VectorType &output_vect,
+    const dealii::FullMatrix<double> &basis, const dealii::FullMatrix<double> &gradient_basis)
+{
+    apply_linear_operator(input_vect, output_vect, false,
+        [&] (const auto &input, auto &output, const bool /*add*/) {
+            oper.divergence_matrix_vector_mult_1D(input, output, basis, gradient_basis);
+        });
+}
+
+/// See OPERATOR::SumFactorizedOperators::Hadamard_product(), with a double operator and AD fluxes.
+template <typename OperatorType, typename adtype>
+void Hadamard_product(
+    OperatorType &oper, const dealii::FullMatrix<double> &input_mat1,
+    const dealii::FullMatrix<adtype> &input_mat2, dealii::FullMatrix<adtype> &output_mat)
+{
+    if constexpr(std::is_same<adtype,double>::value) {
+        oper.Hadamard_product(input_mat1, input_mat2, output_mat);
+    } else {
+        for(unsigned int irow=0; irow<input_mat1.m(); irow++){
+            for(unsigned int icol=0; icol<input_mat1.n(); icol++){
+                output_mat[irow][icol] = input_mat1[irow][icol] * input_mat2[irow][icol];
+            }
+        }
+    }
+}
+
+/// See OPERATOR::metric_operators::transform_physical_to_reference(), with a double metric cofactor and AD fluxes.
+template <int dim, typename adtype>
+void transform_physical_to_reference(
+    const dealii::Tensor<1,dim,adtype> &phys,
+    const dealii::Tensor<2,dim,double> &metric_cofactor,
+    dealii::Tensor<1,dim,adtype> &ref)
+{
+    for(int idim=0; idim<dim; idim++){
+        for(int idim2=0; idim2<dim; idim2++){
+            ref[idim] += metric_cofactor[idim2][idim] * phys[idim2];
+        }
+    }
+}
+
+/// Physical flux nodes of the volume, copied to the AD type of the physics.
+template <int dim, typename adtype>
+const dealii::Tensor<1,dim,std::vector<adtype>> & flux_nodes(
+    const dealii::Tensor<1,dim,std::vector<double>> &flux_nodes_vol,
+    dealii::Tensor<1,dim,std::vector<adtype>> &buffer)
+{
+    if constexpr(std::is_same<adtype,double>::value) {
+        return flux_nodes_vol;
+    } else {
+        for(int idim=0; idim<dim; idim++){
+            buffer[idim].assign(flux_nodes_vol[idim].begin(), flux_nodes_vol[idim].end());
+        }
+        return buffer;
+    }
+}
+
+} // ADOperator namespace
+} // anonymous namespace
+
 template <int dim, int nstate, typename real, typename MeshType>
 DGStrong<dim,nstate,real,MeshType>::DGStrong(
     const Parameters::AllParameters *const parameters_input,
     const unsigned int degree,
     const unsigned int max_degree_input,
     const unsigned int grid_degree_input,
-    const std::shared_ptr<Triangulation> triangulation_input)
-    : DGBaseState<dim,nstate,real,MeshType>::DGBaseState(parameters_input, degree, max_degree_input, grid_degree_input, triangulation_input)
+    const std::shared_ptr<Triangulation> triangulation_input,
+    const MPI_Comm mpi_communicator_input)
+    : DGBaseState<dim,nstate,real,MeshType>::DGBaseState(parameters_input, degree, max_degree_input, grid_degree_input, triangulation_input, mpi_communicator_input)
 { }
 
+template <int dim, int nstate, typename real, typename MeshType>
+std::unique_ptr<ScratchArena> DGStrong<dim,nstate,real,MeshType>::create_scratch_arena() const
+{
+    return std::make_unique<StrongDGScratchArena<dim,nstate,real>>();
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+StrongDGScratchArena<dim,nstate,real> & DGStrong<dim,nstate,real,MeshType>::strong_scratch_arena(ScratchArena &scratch_arena) const
+{
+    Assert(dynamic_cast<StrongDGScratchArena<dim,nstate,real>*>(&scratch_arena) != nullptr,
+           dealii::ExcMessage("The scratch arena was not created by DGStrong::create_scratch_arena()."));
+    return static_cast<StrongDGScratchArena<dim,nstate,real>&>(scratch_arena);
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+template <typename adtype>
+void DGStrong<dim,nstate,real,MeshType>::get_solution_coefficients(
+    const std::vector<dealii::types::global_dof_index> &dofs_indices,
+    const unsigned int                                 poly_degree,
+    const unsigned int                                 n_derivatives,
+    const unsigned int                                 first_derivative,
+    std::array<std::vector<adtype>,nstate>             &soln_coeff) const
+{
+    // We immediately separate them by state as to be able to use sum-factorization
+    // in the interpolation operator. If we left it by n_dofs_cell, then the matrix-vector
+    // mult would sum the states at the quadrature point.
+    const unsigned int n_dofs = this->fe_collection[poly_degree].dofs_per_cell;
+    AssertDimension (n_dofs, dofs_indices.size());
+    for(int istate=0; istate<nstate; istate++){
+        soln_coeff[istate].resize(n_dofs / nstate);
+    }
+    for (unsigned int idof = 0; idof < n_dofs; ++idof) {
+        const unsigned int istate = this->fe_collection[poly_degree].system_to_component_index(idof).first;
+        const unsigned int ishape = this->fe_collection[poly_degree].system_to_component_index(idof).second;
+        const real val = DGBase<dim,real,MeshType>::solution(dofs_indices[idof]);
+        if constexpr(std::is_same<adtype,real>::value) {
+            soln_coeff[istate][ishape] = val;
+        } else {
+            soln_coeff[istate][ishape] = adtype(n_derivatives, first_derivative + idof, val);
+        }
+    }
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+template <typename adtype>
+void DGStrong<dim,nstate,real,MeshType>::get_auxiliary_solution_coefficients(
+    const std::vector<dealii::types::global_dof_index>         &dofs_indices,
+    const unsigned int                                         poly_degree,
+    const unsigned int                                         n_derivatives,
+    const unsigned int                                         first_derivative,
+    const unsigned int                                         derivative_stride,
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &aux_soln_coeff) const
+{
+    const unsigned int n_dofs = this->fe_collection[poly_degree].dofs_per_cell;
+    AssertDimension (n_dofs, dofs_indices.size());
+    for(int istate=0; istate<nstate; istate++){
+        for(int idim=0; idim<dim; idim++){
+            aux_soln_coeff[istate][idim].assign(n_dofs / nstate, adtype(0.0));
+        }
+    }
+    if(!this->use_auxiliary_eq) return;
+
+    for (unsigned int idof = 0; idof < n_dofs; ++idof) {
+        const unsigned int istate = this->fe_collection[poly_degree].system_to_component_index(idof).first;
+        const unsigned int ishape = this->fe_collection[poly_degree].system_to_component_index(idof).second;
+        for(int idim=0; idim<dim; idim++){
+            const real val = DGBase<dim,real,MeshType>::auxiliary_solution[idim](dofs_indices[idof]);
+            if constexpr(std::is_same<adtype,real>::value) {
+                aux_soln_coeff[istate][idim][ishape] = val;
+            } else {
+                aux_soln_coeff[istate][idim][ishape] = adtype(n_derivatives, first_derivative + (idim+1)*derivative_stride + idof, val);
+            }
+        }
+    }
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGStrong<dim,nstate,real,MeshType>::add_residual_derivatives(
+    const std::vector<FadType>                         &local_rhs,
+    const std::vector<dealii::types::global_dof_index> &rows,
+    const std::vector<dealii::types::global_dof_index> &columns)
+{
+    AssertDimension (local_rhs.size(), rows.size());
+    const unsigned int n_columns = columns.size();
+    const bool elide_zero_values = false;
+    std::vector<real> residual_derivatives(n_columns);
+    for (unsigned int irow = 0; irow < rows.size(); ++irow) {
+        const FadType &rhs = local_rhs[irow];
+        for (unsigned int icol = 0; icol < n_columns; ++icol) {
+            residual_derivatives[icol] = ADOperator::component(rhs, icol);
+        }
+        this->add_to_system_matrix(rows[irow], columns, residual_derivatives, elide_zero_values);
+    }
+    // The cell diagonal blocks discard the derivatives through the auxiliary solution.
+    if(!this->use_auxiliary_eq || this->cell_diagonal_blocks != nullptr) return;
+
+    // dRdQ is shared by the threads of the cell loop, like the system_matrix.
+    std::lock_guard<std::mutex> lock(this->system_matrix_mutex);
+    for (unsigned int irow = 0; irow < rows.size(); ++irow) {
+        const FadType &rhs = local_rhs[irow];
+        for(int idim=0; idim<dim; idim++){
+            for (unsigned int icol = 0; icol < n_columns; ++icol) {
+                residual_derivatives[icol] = ADOperator::component(rhs, (idim+1)*n_columns + icol);
+            }
+            dRdQ[idim].add(rows[irow], columns, residual_derivatives, elide_zero_values);
+        }
+    }
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGStrong<dim,nstate,real,MeshType>::add_auxiliary_residual_derivatives(
+    const std::vector<dealii::Tensor<1,dim,FadType>>   &local_auxiliary_rhs,
+    const std::vector<dealii::types::global_dof_index> &rows,
+    const std::vector<dealii::types::global_dof_index> &columns)
+{
+    AssertDimension (local_auxiliary_rhs.size(), rows.size());
+    const unsigned int n_columns = columns.size();
+    const bool elide_zero_values = false;
+    std::vector<real> residual_derivatives(n_columns);
+    std::lock_guard<std::mutex> lock(this->system_matrix_mutex);
+    for (unsigned int irow = 0; irow < rows.size(); ++irow) {
+        for(int idim=0; idim<dim; idim++){
+            const FadType &rhs = local_auxiliary_rhs[irow][idim];
+            for (unsigned int icol = 0; icol < n_columns; ++icol) {
+                residual_derivatives[icol] = ADOperator::component(rhs, icol);
+            }
+            dAdW[idim].add(rows[irow], columns, residual_derivatives, elide_zero_values);
+        }
+    }
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGStrong<dim,nstate,real,MeshType>::add_auxiliary_dRdW()
+{
+    for(int idim=0; idim<dim; idim++){
+        dRdQ[idim].compress(dealii::VectorOperation::add);
+    }
+    if (this->global_inverse_mass_matrix_auxiliary.m() != this->dof_handler.n_dofs()) {
+        const bool do_inverse_mass_matrix = true;
+        this->evaluate_mass_matrices (do_inverse_mass_matrix);
+    }
+
+    std::vector<dealii::types::global_dof_index> product_columns;
+    std::vector<double> product_values;
+    for(int idim=0; idim<dim; idim++){
+        dealii::TrilinosWrappers::SparseMatrix dQdW;
+        this->global_inverse_mass_matrix_auxiliary.mmult(dQdW, dAdW[idim]);
+        dealii::TrilinosWrappers::SparseMatrix dRdQ_dQdW;
+        dRdQ[idim].mmult(dRdQ_dQdW, dQdW);
+
+        // Couplings two faces apart were added to the sparsity pattern by DGBase::allocate_system().
+        for (const auto row : this->locally_owned_dofs) {
+            product_columns.clear();
+            product_values.clear();
+            for (auto entry = dRdQ_dQdW.begin(row); entry != dRdQ_dQdW.end(row); ++entry) {
+                product_columns.push_back(entry->column());
+                product_values.push_back(entry->value());
+            }
+            if (!product_columns.empty()) this->add_to_system_matrix(row, product_columns, product_values, false);
+        }
+    }
+}
+
 /***********************************************************
 *
 *       Build operators and solve for RHS
@@ -50,14 +474,18 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_and_build_operator
     OPERATOR::metric_operators<real,dim,2*dim>             &metric_oper,
     OPERATOR::mapping_shape_functions<dim,2*dim,real>           &mapping_basis,
     std::array<std::vector<real>,dim>                      &mapping_support_points,
+    ScratchArena                                           &scratch_arena,
     dealii::hp::FEValues<dim,dim>                          &/*fe_values_collection_volume*/,
     dealii::hp::FEValues<dim,dim>                          &/*fe_values_collection_volume_lagrange*/,
     const dealii::FESystem<dim,dim>                        &/*current_fe_ref*/,
     dealii::Vector<real>                                   &local_rhs_int_cell,
     std::vector<dealii::Tensor<1,dim,real>>                &local_auxiliary_RHS,
     const bool                                             compute_auxiliary_right_hand_side,
-    const bool /*compute_dRdW*/, const bool /*compute_dRdX*/, const bool /*compute_d2R*/)
+    const bool compute_dRdW, const bool /*compute_dRdX*/, const bool /*compute_d2R*/)
 {
+    StrongDGScratchArena<dim,nstate,real> &strong_arena = strong_scratch_arena(scratch_arena);
+    strong_arena.rewind();
+
     // Check if the current cell's poly degree etc is different then previous cell's.
     // If the current cell's poly degree is different, then we recompute the 1D 
     // polynomial basis functions. Otherwise, we use the previous values in reference space.
@@ -81,7 +509,7 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_and_build_operator
     for(int idim=0; idim<dim; idim++){
         mapping_support_points[idim].resize(n_grid_nodes);
     }
-    const std::vector<unsigned int > &index_renumbering = dealii::FETools::hierarchic_to_lexicographic_numbering<dim>(grid_degree);
+    const std::vector<unsigned int > &index_renumbering = strong_arena.grid_node_renumbering(grid_degree);
     for (unsigned int idof = 0; idof< n_metric_dofs; ++idof) {
         const real val = (this->high_order_grid->volume_nodes[metric_dof_indices[idof]]);
         const unsigned int istate = fe_metric.system_to_component_index(idof).first; 
@@ -92,11 +520,16 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_and_build_operator
 
     //build the volume metric cofactor matrix and the determinant of the volume metric Jacobian
     //Also, computes the physical volume flux nodes if needed from flag passed to constructor in dg.cpp
-    metric_oper.build_volume_metric_operators(
-        this->volume_quadrature_collection[poly_degree].size(), n_grid_nodes,
+    build_volume_metric_terms(
+        current_cell_index, poly_degree, n_grid_nodes,
         mapping_support_points,
         mapping_basis,
-        this->all_parameters->use_invariant_curl_form);
+        metric_oper);
+
+    const unsigned int n_dofs = cell_dofs_indices.size();
+    const unsigned int n_shape_fns = n_dofs / nstate;
+    // Derivatives with respect to the solution, followed by the auxiliary solution in each direction.
+    const unsigned int n_derivatives = this->use_auxiliary_eq ? (dim+1)*n_dofs : n_dofs;
 
     if(compute_auxiliary_right_hand_side){
         assemble_volume_term_auxiliary_equation (
@@ -106,19 +539,64 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_and_build_operator
             flux_basis,
             metric_oper,
             local_auxiliary_RHS);
+
+        if(compute_dRdW){
+            StrongDGScratchArena<dim,nstate,FadType> &ad_arena = strong_arena.derivative_arena();
+            ad_arena.rewind();
+            std::array<std::vector<FadType>,nstate> &soln_coeff_ad = ad_arena.state_vectors(n_shape_fns);
+            get_solution_coefficients<FadType>(cell_dofs_indices, poly_degree, n_dofs, 0, soln_coeff_ad);
+            std::vector<dealii::Tensor<1,dim,FadType>> &local_auxiliary_RHS_ad = ad_arena.tensors(n_dofs);
+            assemble_volume_term_auxiliary_equation<FadType>(
+                soln_coeff_ad, poly_degree,
+                soln_basis, flux_basis, metric_oper,
+                local_auxiliary_RHS_ad);
+            add_auxiliary_residual_derivatives(local_auxiliary_RHS_ad, cell_dofs_indices, cell_dofs_indices);
+        }
     }
     else{
-        assemble_volume_term_strong(
+        std::array<std::vector<real>,nstate> &soln_coeff = strong_arena.state_vectors(n_shape_fns);
+        get_solution_coefficients<real>(cell_dofs_indices, poly_degree, 0, 0, soln_coeff);
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &aux_soln_coeff = strong_arena.state_tensor_vectors(n_shape_fns);
+        get_auxiliary_solution_coefficients<real>(cell_dofs_indices, poly_degree, 0, 0, 0, aux_soln_coeff);
+        assemble_volume_term_strong<real>(
             cell,
             current_cell_index,
-            cell_dofs_indices,
+            soln_coeff,
+            aux_soln_coeff,
             poly_degree,
             soln_basis,
             flux_basis,
             flux_basis_stiffness,
             soln_basis_projection_oper_int,
             metric_oper,
+            *(this->pde_physics_double),
+            strong_arena,
             local_rhs_int_cell);
+
+        if(compute_dRdW){
+            StrongDGScratchArena<dim,nstate,FadType> &ad_arena = strong_arena.derivative_arena();
+            ad_arena.rewind();
+            std::array<std::vector<FadType>,nstate> &soln_coeff_ad = ad_arena.state_vectors(n_shape_fns);
+            get_solution_coefficients<FadType>(cell_dofs_indices, poly_degree, n_derivatives, 0, soln_coeff_ad);
+            std::array<dealii::Tensor<1,dim,std::vector<FadType>>,nstate> &aux_soln_coeff_ad = ad_arena.state_tensor_vectors(n_shape_fns);
+            get_auxiliary_solution_coefficients<FadType>(cell_dofs_indices, poly_degree, n_derivatives, 0, n_dofs, aux_soln_coeff_ad);
+            std::vector<FadType> &local_rhs_ad = ad_arena.vector(n_dofs);
+            assemble_volume_term_strong<FadType>(
+                cell,
+                current_cell_index,
+                soln_coeff_ad,
+                aux_soln_coeff_ad,
+                poly_degree,
+                soln_basis,
+                flux_basis,
+                flux_basis_stiffness,
+                soln_basis_projection_oper_int,
+                metric_oper,
+                *(this->pde_physics_fad),
+                ad_arena,
+                local_rhs_ad);
+            add_residual_derivatives(local_rhs_ad, cell_dofs_indices, cell_dofs_indices);
+        }
     }
 }
 template <int dim, int nstate, typename real, typename MeshType>
@@ -140,44 +618,99 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_boundary_term_and_build_operat
     OPERATOR::metric_operators<real,dim,2*dim>             &metric_oper,
     OPERATOR::mapping_shape_functions<dim,2*dim,real>           &mapping_basis,
     std::array<std::vector<real>,dim>                      &mapping_support_points,
+    ScratchArena                                           &scratch_arena,
     dealii::hp::FEFaceValues<dim,dim>                      &/*fe_values_collection_face_int*/,
     const dealii::FESystem<dim,dim>                        &/*current_fe_ref*/,
     dealii::Vector<real>                                   &local_rhs_int_cell,
     std::vector<dealii::Tensor<1,dim,real>>                &local_auxiliary_RHS,
     const bool                                             compute_auxiliary_right_hand_side,
-    const bool /*compute_dRdW*/, const bool /*compute_dRdX*/, const bool /*compute_d2R*/)
+    const bool compute_dRdW, const bool /*compute_dRdX*/, const bool /*compute_d2R*/)
 {
+    StrongDGScratchArena<dim,nstate,real> &strong_arena = strong_scratch_arena(scratch_arena);
+    strong_arena.rewind();
 
     const dealii::FESystem<dim> &fe_metric = this->high_order_grid->fe_system;
     const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
     const unsigned int n_grid_nodes  = n_metric_dofs / dim;
     //build the surface metric operators for interior
-    metric_oper.build_facet_metric_operators(
+    build_facet_metric_terms(
+        current_cell_index,
         iface,
-        this->face_quadrature_collection[poly_degree].size(),
+        poly_degree,
         n_grid_nodes,
         mapping_support_points,
         mapping_basis,
-        this->all_parameters->use_invariant_curl_form);
+        metric_oper);
+
+    const unsigned int n_dofs = cell_dofs_indices.size();
+    const unsigned int n_shape_fns = n_dofs / nstate;
+    // Derivatives with respect to the solution, followed by the auxiliary solution in each direction.
+    const unsigned int n_derivatives = this->use_auxiliary_eq ? (dim+1)*n_dofs : n_dofs;
+
+    std::array<std::vector<real>,nstate> &soln_coeff = strong_arena.state_vectors(n_shape_fns);
+    get_solution_coefficients<real>(cell_dofs_indices, poly_degree, 0, 0, soln_coeff);
 
     if(compute_auxiliary_right_hand_side){
-        assemble_boundary_term_auxiliary_equation (
+        assemble_boundary_term_auxiliary_equation<real> (
             iface, current_cell_index, poly_degree,
-            boundary_id, cell_dofs_indices, 
+            boundary_id, soln_coeff, 
             soln_basis, metric_oper,
+            *(this->pde_physics_double), *(this->diss_num_flux_double),
             local_auxiliary_RHS);
+
+        if(compute_dRdW){
+            StrongDGScratchArena<dim,nstate,FadType> &ad_arena = strong_arena.derivative_arena();
+            ad_arena.rewind();
+            std::array<std::vector<FadType>,nstate> &soln_coeff_ad = ad_arena.state_vectors(n_shape_fns);
+            get_solution_coefficients<FadType>(cell_dofs_indices, poly_degree, n_dofs, 0, soln_coeff_ad);
+            std::vector<dealii::Tensor<1,dim,FadType>> &local_auxiliary_RHS_ad = ad_arena.tensors(n_dofs);
+            assemble_boundary_term_auxiliary_equation<FadType> (
+                iface, current_cell_index, poly_degree,
+                boundary_id, soln_coeff_ad, 
+                soln_basis, metric_oper,
+                *(this->pde_physics_fad), *(this->diss_num_flux_fad),
+                local_auxiliary_RHS_ad);
+            add_auxiliary_residual_derivatives(local_auxiliary_RHS_ad, cell_dofs_indices, cell_dofs_indices);
+        }
     }
     else{
-        assemble_boundary_term_strong (
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &aux_soln_coeff = strong_arena.state_tensor_vectors(n_shape_fns);
+        get_auxiliary_solution_coefficients<real>(cell_dofs_indices, poly_degree, 0, 0, 0, aux_soln_coeff);
+        assemble_boundary_term_strong<real> (
             iface,
             current_cell_index,
             boundary_id, poly_degree, penalty, 
-            cell_dofs_indices, 
+            soln_coeff, aux_soln_coeff, 
             soln_basis,
             flux_basis,
             soln_basis_projection_oper_int,
             metric_oper,
+            *(this->pde_physics_double), *(this->conv_num_flux_double), *(this->diss_num_flux_double),
+            strong_arena,
             local_rhs_int_cell);
+
+        if(compute_dRdW){
+            StrongDGScratchArena<dim,nstate,FadType> &ad_arena = strong_arena.derivative_arena();
+            ad_arena.rewind();
+            std::array<std::vector<FadType>,nstate> &soln_coeff_ad = ad_arena.state_vectors(n_shape_fns);
+            get_solution_coefficients<FadType>(cell_dofs_indices, poly_degree, n_derivatives, 0, soln_coeff_ad);
+            std::array<dealii::Tensor<1,dim,std::vector<FadType>>,nstate> &aux_soln_coeff_ad = ad_arena.state_tensor_vectors(n_shape_fns);
+            get_auxiliary_solution_coefficients<FadType>(cell_dofs_indices, poly_degree, n_derivatives, 0, n_dofs, aux_soln_coeff_ad);
+            std::vector<FadType> &local_rhs_ad = ad_arena.vector(n_dofs);
+            assemble_boundary_term_strong<FadType> (
+                iface,
+                current_cell_index,
+                boundary_id, poly_degree, penalty, 
+                soln_coeff_ad, aux_soln_coeff_ad, 
+                soln_basis,
+                flux_basis,
+                soln_basis_projection_oper_int,
+                metric_oper,
+                *(this->pde_physics_fad), *(this->conv_num_flux_fad), *(this->diss_num_flux_fad),
+                ad_arena,
+                local_rhs_ad);
+            add_residual_derivatives(local_rhs_ad, cell_dofs_indices, cell_dofs_indices);
+        }
     }
 
 }
@@ -210,6 +743,7 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_and_build_operators(
     OPERATOR::metric_operators<real,dim,2*dim>             &metric_oper_ext,
     OPERATOR::mapping_shape_functions<dim,2*dim,real>           &mapping_basis,
     std::array<std::vector<real>,dim>                      &mapping_support_points,
+    ScratchArena                                           &scratch_arena,
     dealii::hp::FEFaceValues<dim,dim>                      &/*fe_values_collection_face_int*/,
     dealii::hp::FEFaceValues<dim,dim>                      &/*fe_values_collection_face_ext*/,
     dealii::Vector<real>                                   &current_cell_rhs,
@@ -218,20 +752,23 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_and_build_operators(
     dealii::LinearAlgebra::distributed::Vector<double>     &rhs,
     std::array<dealii::LinearAlgebra::distributed::Vector<double>,dim> &rhs_aux,
     const bool                                             compute_auxiliary_right_hand_side,
-    const bool /*compute_dRdW*/, const bool /*compute_dRdX*/, const bool /*compute_d2R*/)
+    const bool compute_dRdW, const bool /*compute_dRdX*/, const bool /*compute_d2R*/)
 {
+    StrongDGScratchArena<dim,nstate,real> &strong_arena = strong_scratch_arena(scratch_arena);
+    strong_arena.rewind();
 
     const dealii::FESystem<dim> &fe_metric = this->high_order_grid->fe_system;
     const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
     const unsigned int n_grid_nodes  = n_metric_dofs / dim;
     //build the surface metric operators for interior
-    metric_oper_int.build_facet_metric_operators(
+    build_facet_metric_terms(
+        current_cell_index,
         iface,
-        this->face_quadrature_collection[poly_degree_int].size(),
+        poly_degree_int,
         n_grid_nodes,
         mapping_support_points,
         mapping_basis,
-        this->all_parameters->use_invariant_curl_form);
+        metric_oper_int);
 
     if(poly_degree_ext != soln_basis_ext.current_degree){
         soln_basis_ext.current_degree    = poly_degree_ext; 
@@ -249,11 +786,8 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_and_build_operators(
         //get neighbor metric operator
         //rewrite the high_order_grid->volume_nodes in a way we can use sum-factorization on.
         //that is, splitting up the vector by the dimension.
-        std::array<std::vector<real>,dim> mapping_support_points_neigh;
-        for(int idim=0; idim<dim; idim++){
-            mapping_support_points_neigh[idim].resize(n_grid_nodes);
-        }
-        const std::vector<unsigned int > &index_renumbering = dealii::FETools::hierarchic_to_lexicographic_numbering<dim>(grid_degree_ext);
+        std::array<std::vector<real>,dim> &mapping_support_points_neigh = strong_arena.dim_vectors(n_grid_nodes);
+        const std::vector<unsigned int > &index_renumbering = strong_arena.grid_node_renumbering(grid_degree_ext);
         for (unsigned int idof = 0; idof< n_metric_dofs; ++idof) {
             const real val = (this->high_order_grid->volume_nodes[neighbor_metric_dofs_indices[idof]]);
             const unsigned int istate = fe_metric.system_to_component_index(idof).first; 
@@ -262,16 +796,30 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_and_build_operators(
             mapping_support_points_neigh[istate][igrid_node] = val; 
         }
         //build the metric operators for strong form
-        metric_oper_ext.build_volume_metric_operators(
-            this->volume_quadrature_collection[poly_degree_ext].size(), n_grid_nodes,
+        build_volume_metric_terms(
+            neighbor_cell_index, poly_degree_ext, n_grid_nodes,
             mapping_support_points_neigh,
             mapping_basis,
-            this->all_parameters->use_invariant_curl_form);
+            metric_oper_ext);
+    }
+
+    const unsigned int n_dofs_int = current_dofs_indices.size();
+    const unsigned int n_dofs_ext = neighbor_dofs_indices.size();
+    const unsigned int n_shape_fns_int = n_dofs_int / nstate;
+    const unsigned int n_shape_fns_ext = n_dofs_ext / nstate;
+    // Derivatives with respect to the solution of both cells, followed by their auxiliary solution in each direction.
+    const unsigned int derivative_stride = n_dofs_int + n_dofs_ext;
+    const unsigned int n_derivatives = this->use_auxiliary_eq ? (dim+1)*derivative_stride : derivative_stride;
+    std::vector<dealii::types::global_dof_index> &face_dofs_indices = strong_arena.dof_indices(derivative_stride);
+    if(compute_dRdW){
+        std::copy(current_dofs_indices.begin(), current_dofs_indices.end(), face_dofs_indices.begin());
+        std::copy(neighbor_dofs_indices.begin(), neighbor_dofs_indices.end(), face_dofs_indices.begin() + n_dofs_int);
     }
 
     if(compute_auxiliary_right_hand_side){
         const unsigned int n_dofs_neigh_cell = this->fe_collection[neighbor_cell->active_fe_index()].n_dofs_per_cell();
-        std::vector<dealii::Tensor<1,dim,double>> neighbor_cell_rhs_aux (n_dofs_neigh_cell ); // defaults to 0.0 initialization
+        using Side = typename CellScratchArena<dim,real>::Side;
+        std::vector<dealii::Tensor<1,dim,double>> &neighbor_cell_rhs_aux = strong_arena.cell_rhs_aux(Side::exterior, n_dofs_neigh_cell); // defaults to 0.0 initialization
         assemble_face_term_auxiliary_equation (
             iface, neighbor_iface, 
             current_cell_index, neighbor_cell_index,
@@ -286,25 +834,90 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_and_build_operators(
                 rhs_aux[idim][neighbor_dofs_indices[i]] += neighbor_cell_rhs_aux[i][idim];
             }
         }
+
+        if(compute_dRdW){
+            StrongDGScratchArena<dim,nstate,FadType> &ad_arena = strong_arena.derivative_arena();
+            ad_arena.rewind();
+            std::array<std::vector<FadType>,nstate> &soln_coeff_int_ad = ad_arena.state_vectors(n_shape_fns_int);
+            get_solution_coefficients<FadType>(current_dofs_indices, poly_degree_int, derivative_stride, 0, soln_coeff_int_ad);
+            std::array<std::vector<FadType>,nstate> &soln_coeff_ext_ad = ad_arena.state_vectors(n_shape_fns_ext);
+            get_solution_coefficients<FadType>(neighbor_dofs_indices, poly_degree_ext, derivative_stride, n_dofs_int, soln_coeff_ext_ad);
+            std::vector<dealii::Tensor<1,dim,FadType>> &current_cell_rhs_aux_ad = ad_arena.tensors(n_dofs_int);
+            std::vector<dealii::Tensor<1,dim,FadType>> &neighbor_cell_rhs_aux_ad = ad_arena.tensors(n_dofs_ext);
+            assemble_face_term_auxiliary_equation<FadType> (
+                iface, neighbor_iface, 
+                current_cell_index, neighbor_cell_index,
+                poly_degree_int, poly_degree_ext,
+                soln_coeff_int_ad, soln_coeff_ext_ad,
+                soln_basis_int, soln_basis_ext,
+                metric_oper_int,
+                *(this->diss_num_flux_fad),
+                current_cell_rhs_aux_ad, neighbor_cell_rhs_aux_ad);
+            add_auxiliary_residual_derivatives(current_cell_rhs_aux_ad, current_dofs_indices, face_dofs_indices);
+            add_auxiliary_residual_derivatives(neighbor_cell_rhs_aux_ad, neighbor_dofs_indices, face_dofs_indices);
+        }
     }
     else{
-        assemble_face_term_strong (
+        std::array<std::vector<real>,nstate> &soln_coeff_int = strong_arena.state_vectors(n_shape_fns_int);
+        get_solution_coefficients<real>(current_dofs_indices, poly_degree_int, 0, 0, soln_coeff_int);
+        std::array<std::vector<real>,nstate> &soln_coeff_ext = strong_arena.state_vectors(n_shape_fns_ext);
+        get_solution_coefficients<real>(neighbor_dofs_indices, poly_degree_ext, 0, 0, soln_coeff_ext);
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &aux_soln_coeff_int = strong_arena.state_tensor_vectors(n_shape_fns_int);
+        get_auxiliary_solution_coefficients<real>(current_dofs_indices, poly_degree_int, 0, 0, 0, aux_soln_coeff_int);
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &aux_soln_coeff_ext = strong_arena.state_tensor_vectors(n_shape_fns_ext);
+        get_auxiliary_solution_coefficients<real>(neighbor_dofs_indices, poly_degree_ext, 0, 0, 0, aux_soln_coeff_ext);
+        assemble_face_term_strong<real> (
             iface, neighbor_iface, 
             current_cell_index,
             neighbor_cell_index,
             poly_degree_int, poly_degree_ext,
             penalty,
-            current_dofs_indices, neighbor_dofs_indices,
+            soln_coeff_int, soln_coeff_ext,
+            aux_soln_coeff_int, aux_soln_coeff_ext,
             soln_basis_int, soln_basis_ext,
             flux_basis_int, flux_basis_ext,
             soln_basis_projection_oper_int, soln_basis_projection_oper_ext,
             metric_oper_int, metric_oper_ext,
+            *(this->pde_physics_double), *(this->conv_num_flux_double), *(this->diss_num_flux_double),
+            strong_arena,
             current_cell_rhs, neighbor_cell_rhs);
         // add local contribution from neighbor cell to global vector
         const unsigned int n_dofs_neigh_cell = this->fe_collection[neighbor_cell->active_fe_index()].n_dofs_per_cell();
         for (unsigned int i=0; i<n_dofs_neigh_cell; ++i) {
             rhs[neighbor_dofs_indices[i]] += neighbor_cell_rhs[i];
         }
+
+        if(compute_dRdW){
+            StrongDGScratchArena<dim,nstate,FadType> &ad_arena = strong_arena.derivative_arena();
+            ad_arena.rewind();
+            std::array<std::vector<FadType>,nstate> &soln_coeff_int_ad = ad_arena.state_vectors(n_shape_fns_int);
+            get_solution_coefficients<FadType>(current_dofs_indices, poly_degree_int, n_derivatives, 0, soln_coeff_int_ad);
+            std::array<std::vector<FadType>,nstate> &soln_coeff_ext_ad = ad_arena.state_vectors(n_shape_fns_ext);
+            get_solution_coefficients<FadType>(neighbor_dofs_indices, poly_degree_ext, n_derivatives, n_dofs_int, soln_coeff_ext_ad);
+            std::array<dealii::Tensor<1,dim,std::vector<FadType>>,nstate> &aux_soln_coeff_int_ad = ad_arena.state_tensor_vectors(n_shape_fns_int);
+            get_auxiliary_solution_coefficients<FadType>(current_dofs_indices, poly_degree_int, n_derivatives, 0, derivative_stride, aux_soln_coeff_int_ad);
+            std::array<dealii::Tensor<1,dim,std::vector<FadType>>,nstate> &aux_soln_coeff_ext_ad = ad_arena.state_tensor_vectors(n_shape_fns_ext);
+            get_auxiliary_solution_coefficients<FadType>(neighbor_dofs_indices, poly_degree_ext, n_derivatives, n_dofs_int, derivative_stride, aux_soln_coeff_ext_ad);
+            std::vector<FadType> &current_cell_rhs_ad = ad_arena.vector(n_dofs_int);
+            std::vector<FadType> &neighbor_cell_rhs_ad = ad_arena.vector(n_dofs_ext);
+            assemble_face_term_strong<FadType> (
+                iface, neighbor_iface, 
+                current_cell_index,
+                neighbor_cell_index,
+                poly_degree_int, poly_degree_ext,
+                penalty,
+                soln_coeff_int_ad, soln_coeff_ext_ad,
+                aux_soln_coeff_int_ad, aux_soln_coeff_ext_ad,
+                soln_basis_int, soln_basis_ext,
+                flux_basis_int, flux_basis_ext,
+                soln_basis_projection_oper_int, soln_basis_projection_oper_ext,
+                metric_oper_int, metric_oper_ext,
+                *(this->pde_physics_fad), *(this->conv_num_flux_fad), *(this->diss_num_flux_fad),
+                ad_arena,
+                current_cell_rhs_ad, neighbor_cell_rhs_ad);
+            add_residual_derivatives(current_cell_rhs_ad, current_dofs_indices, face_dofs_indices);
+            add_residual_derivatives(neighbor_cell_rhs_ad, neighbor_dofs_indices, face_dofs_indices);
+        }
     }
 
 }
@@ -338,6 +951,7 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_subface_term_and_build_operato
     OPERATOR::metric_operators<real,dim,2*dim>             &metric_oper_ext,
     OPERATOR::mapping_shape_functions<dim,2*dim,real>           &mapping_basis,
     std::array<std::vector<real>,dim>                      &mapping_support_points,
+    ScratchArena                                           &scratch_arena,
     dealii::hp::FEFaceValues<dim,dim>                      &fe_values_collection_face_int,
     dealii::hp::FESubfaceValues<dim,dim>                   &/*fe_values_collection_subface*/,
     dealii::Vector<real>                                   &current_cell_rhs,
@@ -375,6 +989,7 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_subface_term_and_build_operato
         metric_oper_ext,
         mapping_basis,
         mapping_support_points,
+        scratch_arena,
         fe_values_collection_face_int,
         fe_values_collection_face_int,
         current_cell_rhs,
@@ -386,6 +1001,664 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_subface_term_and_build_operato
         compute_dRdW, compute_dRdX, compute_d2R);
 
 }
+template <int dim, int nstate, typename real, typename MeshType>
+void DGStrong<dim,nstate,real,MeshType>::build_volume_metric_terms(
+    const dealii::types::global_dof_index              cell_index,
+    const unsigned int                                 poly_degree,
+    const unsigned int                                 n_grid_nodes,
+    const std::array<std::vector<real>,dim>            &mapping_support_points,
+    OPERATOR::mapping_shape_functions<dim,2*dim,real>  &mapping_basis,
+    OPERATOR::metric_operators<real,dim,2*dim>         &metric_oper)
+{
+    const unsigned int n_quad_pts = this->volume_quadrature_collection[poly_degree].size();
+    if(!this->all_parameters->use_metric_terms_cache){
+        metric_oper.build_volume_metric_operators(
+            n_quad_pts, n_grid_nodes,
+            mapping_support_points,
+            mapping_basis,
+            this->all_parameters->use_invariant_curl_form);
+        return;
+    }
+
+    auto &cached_terms = this->high_order_grid->metric_terms_cache[cell_index];
+    if(cached_terms.poly_degree != poly_degree) cached_terms.reset(poly_degree);
+
+    if(!cached_terms.volume_is_cached){
+        metric_oper.build_volume_metric_operators(
+            n_quad_pts, n_grid_nodes,
+            mapping_support_points,
+            mapping_basis,
+            this->all_parameters->use_invariant_curl_form);
+        cached_terms.metric_cofactor_vol = metric_oper.metric_cofactor_vol;
+        cached_terms.det_Jac_vol = metric_oper.det_Jac_vol;
+        if(metric_oper.store_vol_flux_nodes) cached_terms.flux_nodes_vol = metric_oper.flux_nodes_vol;
+        cached_terms.volume_is_cached = true;
+        return;
+    }
+    metric_oper.metric_cofactor_vol = cached_terms.metric_cofactor_vol;
+    metric_oper.det_Jac_vol = cached_terms.det_Jac_vol;
+    if(metric_oper.store_vol_flux_nodes) metric_oper.flux_nodes_vol = cached_terms.flux_nodes_vol;
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGStrong<dim,nstate,real,MeshType>::build_facet_metric_terms(
+    const dealii::types::global_dof_index              cell_index,
+    const unsigned int                                 iface,
+    const unsigned int                                 poly_degree,
+    const unsigned int                                 n_grid_nodes,
+    const std::array<std::vector<real>,dim>            &mapping_support_points,
+    OPERATOR::mapping_shape_functions<dim,2*dim,real>  &mapping_basis,
+    OPERATOR::metric_operators<real,dim,2*dim>         &metric_oper)
+{
+    const unsigned int n_face_quad_pts = this->face_quadrature_collection[poly_degree].size();
+    if(!this->all_parameters->use_metric_terms_cache){
+        metric_oper.build_facet_metric_operators(
+            iface,
+            n_face_quad_pts, n_grid_nodes,
+            mapping_support_points,
+            mapping_basis,
+            this->all_parameters->use_invariant_curl_form);
+        return;
+    }
+
+    auto &cached_terms = this->high_order_grid->metric_terms_cache[cell_index];
+    if(cached_terms.poly_degree != poly_degree) cached_terms.reset(poly_degree);
+
+    if(!cached_terms.facet_is_cached[iface]){
+        metric_oper.build_facet_metric_operators(
+            iface,
+            n_face_quad_pts, n_grid_nodes,
+            mapping_support_points,
+            mapping_basis,
+            this->all_parameters->use_invariant_curl_form);
+        cached_terms.metric_cofactor_surf[iface] = metric_oper.metric_cofactor_surf;
+        cached_terms.det_Jac_surf[iface] = metric_oper.det_Jac_surf;
+        if(metric_oper.store_surf_flux_nodes) cached_terms.flux_nodes_surf[iface] = metric_oper.flux_nodes_surf[iface];
+        cached_terms.facet_is_cached[iface] = true;
+        return;
+    }
+    metric_oper.metric_cofactor_surf = cached_terms.metric_cofactor_surf[iface];
+    metric_oper.det_Jac_surf = cached_terms.det_Jac_surf[iface];
+    if(metric_oper.store_surf_flux_nodes) metric_oper.flux_nodes_surf[iface] = cached_terms.flux_nodes_surf[iface];
+}
+
+/*******************************************************************
+ *
+ *
+ *                  RESIDUAL IN BATCHES OF CELLS
+ *
+ *
+ *******************************************************************/
+
+namespace {
+/// 1D bases in the x, y and z directions that interpolate from the volume to face iface.
+/** Same selection as SumFactorizedOperators::matrix_vector_mult_surface_1D().
+ */
+std::array<const dealii::FullMatrix<double>*,3> face_bases(
+    const unsigned int                              iface,
+    const std::array<dealii::FullMatrix<double>,2> &basis_surf,
+    const dealii::FullMatrix<double>               &basis_vol)
+{
+    std::array<const dealii::FullMatrix<double>*,3> bases = {{&basis_vol, &basis_vol, &basis_vol}};
+    bases[iface / 2] = &basis_surf[iface % 2];
+    return bases;
+}
+} // namespace
+
+template <int dim, int nstate, typename real, typename MeshType>
+bool DGStrong<dim,nstate,real,MeshType>::prepare_cell_batches()
+{
+    using PDE_enum = Parameters::AllParameters::PartialDifferentialEquation;
+    const bool use_split_form = this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form;
+    const bool supported_discretization = !use_split_form
+        && !this->all_parameters->artificial_dissipation_param.add_artificial_dissipation
+        && !this->all_parameters->manufactured_convergence_study_param.manufactured_solution_param.use_manufactured_source_term
+        && !this->pde_physics_double->has_nonzero_physical_source
+        && (this->all_parameters->pde_type != PDE_enum::physics_model);
+    if (!supported_discretization) return false;
+
+    const VectorFingerprint volume_nodes_fingerprint(this->high_order_grid->volume_nodes);
+    const bool locally_valid = (cell_batches.n_active_cells == this->triangulation->n_active_cells())
+                               && (cell_batches.n_dofs == this->dof_handler.n_dofs())
+                               && (volume_nodes_fingerprint == cell_batches.volume_nodes);
+    const bool batches_are_valid = VectorFingerprint::up_to_date_on_all_processors(locally_valid, this->mpi_communicator);
+    if (batches_are_valid) return cell_batches.is_available;
+
+    const bool locally_available = build_cell_batches();
+    cell_batches.is_available = (dealii::Utilities::MPI::min(locally_available ? 1 : 0, this->mpi_communicator) == 1);
+    cell_batches.n_active_cells = this->triangulation->n_active_cells();
+    cell_batches.n_dofs = this->dof_handler.n_dofs();
+    cell_batches.volume_nodes = volume_nodes_fingerprint;
+    if (cell_batches.is_available) {
+        pcout << "Assembling the residual in batches of " << cell_batches.n_lanes << " cells." << std::endl;
+    } else {
+        pcout << "The mesh does not allow assembling the residual in batches of cells. Assembling it cell by cell." << std::endl;
+    }
+    return cell_batches.is_available;
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+bool DGStrong<dim,nstate,real,MeshType>::build_cell_batches()
+{
+    CellBatches &batches = cell_batches;
+#if DEAL_II_VERSION_GTE(9,2,0)
+    batches.n_lanes = dealii::VectorizedArray<double>::size();
+#else
+    batches.n_lanes = dealii::VectorizedArray<double>::n_array_elements;
+#endif
+    batches.n_filled_lanes.clear();
+    batches.lane_cells.clear();
+    batches.cell_face_slots.clear();
+    batches.face_batch_directions.clear();
+    batches.face_minus_cells.clear();
+    batches.face_plus_cells.clear();
+    batches.face_numerical_fluxes.clear();
+    batches.dof_local_indices.clear();
+    batches.active_cell_indices.clear();
+    batches.extents.clear();
+    batches.diameters.clear();
+
+    const unsigned int n_faces = dealii::GeometryInfo<dim>::faces_per_cell;
+    const dealii::FESystem<dim> &fe_metric = this->high_order_grid->fe_system;
+    const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
+    std::vector<dealii::types::global_dof_index> metric_dof_indices(n_metric_dofs);
+    std::vector<dealii::types::global_dof_index> dof_indices;
+    const auto &partitioner = *(this->solution.get_partitioner());
+
+    // Numbers a locally owned or ghost cell in the cell arrays of the batches the first time it is seen.
+    std::map<unsigned int, unsigned int> cell_numbers;
+    auto number_cell = [&](const auto &cell) -> unsigned int {
+        const auto inserted = cell_numbers.emplace(cell->active_cell_index(), batches.active_cell_indices.size());
+        if (!inserted.second) return inserted.first->second;
+
+        batches.active_cell_indices.push_back(cell->active_cell_index());
+        std::array<real,dim> extent;
+        for(int idim=0; idim<dim; idim++){
+            extent[idim] = cell->extent_in_direction(idim);
+        }
+        batches.extents.push_back(extent);
+        batches.diameters.push_back(cell->diameter());
+
+        const dealii::FESystem<dim,dim> &fe = this->fe_collection[cell->active_fe_index()];
+        const unsigned int n_dofs_cell = fe.dofs_per_cell;
+        const unsigned int n_shape_fns = n_dofs_cell / nstate;
+        dof_indices.resize(n_dofs_cell);
+        cell->get_dof_indices(dof_indices);
+        const unsigned int first = batches.dof_local_indices.size();
+        batches.dof_local_indices.resize(first + n_dofs_cell);
+        for (unsigned int idof = 0; idof < n_dofs_cell; ++idof) {
+            const unsigned int istate = fe.system_to_component_index(idof).first;
+            const unsigned int ishape = fe.system_to_component_index(idof).second;
+            batches.dof_local_indices[first + istate * n_shape_fns + ishape] = partitioner.global_to_local(dof_indices[idof]);
+        }
+        return inserted.first->second;
+    };
+
+    std::vector<unsigned int> owned_cells;
+    std::vector<unsigned int> owned_cells_neighbors;
+    bool degree_is_set = false;
+    auto metric_cell = this->high_order_grid->dof_handler_grid.begin_active();
+    for (auto cell = this->dof_handler.begin_active(); cell != this->dof_handler.end(); ++cell, ++metric_cell) {
+        if (!cell->is_locally_owned()) continue;
+
+        if (!degree_is_set) {
+            batches.poly_degree = cell->active_fe_index();
+            degree_is_set = true;
+        }
+        if (cell->active_fe_index() != batches.poly_degree) return false;
+
+        // The grid nodes of the cell must be the affine image of the reference nodes on an axis-aligned box.
+        const dealii::Point<dim> origin = cell->vertex(0);
+        dealii::Tensor<1,dim,double> extent;
+        for(int idim=0; idim<dim; idim++){
+            extent[idim] = cell->vertex(1 << idim)[idim] - origin[idim];
+            if (extent[idim] <= 0.0) return false;
+        }
+        const double tolerance = 1e-12 * extent.norm();
+        metric_cell->get_dof_indices(metric_dof_indices);
+        for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
+            const unsigned int icomponent = fe_metric.system_to_component_index(idof).first;
+            const double affine_node = origin[icomponent] + extent[icomponent] * fe_metric.unit_support_point(idof)[icomponent];
+            if (std::abs(this->high_order_grid->volume_nodes[metric_dof_indices[idof]] - affine_node) > tolerance) return false;
+        }
+
+        owned_cells.push_back(number_cell(cell));
+
+        // Every face must be conforming, either interior or periodic, and lie on the opposite face of the neighbor.
+        for (unsigned int iface = 0; iface < n_faces; ++iface) {
+            const auto face = cell->face(iface);
+            const bool is_periodic = face->at_boundary() && cell->has_periodic_neighbor(iface);
+            if (face->at_boundary() && !is_periodic) return false;
+            if (face->has_children()) return false;
+
+            const auto neighbor_cell = cell->neighbor_or_periodic_neighbor(iface);
+            if (neighbor_cell->has_children()) return false;
+            const bool neighbor_is_coarser = is_periodic ? cell->periodic_neighbor_is_coarser(iface) : cell->neighbor_is_coarser(iface);
+            if (neighbor_is_coarser) return false;
+            const unsigned int neighbor_iface = is_periodic ? cell->periodic_neighbor_of_periodic_neighbor(iface) : cell->neighbor_of_neighbor(iface);
+            if (neighbor_iface != (iface ^ 1)) return false;
+            if (neighbor_cell->active_fe_index() != batches.poly_degree) return false;
+
+            owned_cells_neighbors.push_back(number_cell(neighbor_cell));
+        }
+    }
+
+    // Lanes past the last owned cell repeat it, and are not written into the residual.
+    const unsigned int n_lanes = batches.n_lanes;
+    const unsigned int n_owned_cells = owned_cells.size();
+    const unsigned int n_batches = (n_owned_cells + n_lanes - 1) / n_lanes;
+    batches.n_filled_lanes.resize(n_batches);
+    batches.lane_cells.resize(n_batches * n_lanes);
+    for (unsigned int ibatch = 0; ibatch < n_batches; ++ibatch) {
+        batches.n_filled_lanes[ibatch] = std::min(n_lanes, n_owned_cells - ibatch * n_lanes);
+        for (unsigned int ilane = 0; ilane < n_lanes; ++ilane) {
+            const unsigned int iowned = ibatch * n_lanes + std::min(ilane, batches.n_filled_lanes[ibatch] - 1);
+            batches.lane_cells[ibatch * n_lanes + ilane] = owned_cells[iowned];
+        }
+    }
+
+    // Each face is numbered once per direction, from the cell on its lower side, whether its other cell is owned or a ghost.
+    std::map<unsigned int, unsigned int> face_numbers;
+    std::array<std::vector<unsigned int>,dim> minus_cells;
+    std::array<std::vector<unsigned int>,dim> plus_cells;
+    std::vector<unsigned int> owned_cells_faces(n_owned_cells * n_faces);
+    for (unsigned int iowned = 0; iowned < n_owned_cells; ++iowned) {
+        for (unsigned int iface = 0; iface < n_faces; ++iface) {
+            const unsigned int direction = iface / 2;
+            const bool is_minus_cell = (iface % 2 == 1);
+            const unsigned int minus_cell = is_minus_cell ? owned_cells[iowned] : owned_cells_neighbors[iowned * n_faces + iface];
+            const unsigned int plus_cell = is_minus_cell ? owned_cells_neighbors[iowned * n_faces + iface] : owned_cells[iowned];
+            const auto inserted = face_numbers.emplace(minus_cell * dim + direction, minus_cells[direction].size());
+            if (inserted.second) {
+                minus_cells[direction].push_back(minus_cell);
+                plus_cells[direction].push_back(plus_cell);
+            }
+            owned_cells_faces[iowned * n_faces + iface] = inserted.first->second;
+        }
+    }
+
+    // The faces of each direction fill their own face batches, the lanes past the last face repeating it.
+    std::array<unsigned int,dim> first_face_batch;
+    unsigned int n_face_batches = 0;
+    for (int direction = 0; direction < dim; ++direction) {
+        first_face_batch[direction] = n_face_batches;
+        n_face_batches += (minus_cells[direction].size() + n_lanes - 1) / n_lanes;
+    }
+    batches.face_batch_directions.resize(n_face_batches);
+    batches.face_minus_cells.resize(n_face_batches * n_lanes);
+    batches.face_plus_cells.resize(n_face_batches * n_lanes);
+    for (int direction = 0; direction < dim; ++direction) {
+        const unsigned int n_direction_faces = minus_cells[direction].size();
+        const unsigned int n_direction_face_batches = (n_direction_faces + n_lanes - 1) / n_lanes;
+        for (unsigned int islot = 0; islot < n_direction_face_batches * n_lanes; ++islot) {
+            const unsigned int ifbatch = first_face_batch[direction] + islot / n_lanes;
+            const unsigned int iface_number = std::min(islot, n_direction_faces - 1);
+            batches.face_batch_directions[ifbatch] = direction;
+            batches.face_minus_cells[ifbatch * n_lanes + islot % n_lanes] = minus_cells[direction][iface_number];
+            batches.face_plus_cells[ifbatch * n_lanes + islot % n_lanes] = plus_cells[direction][iface_number];
+        }
+    }
+    batches.cell_face_slots.resize(n_batches * n_lanes * n_faces);
+    for (unsigned int ibatch = 0; ibatch < n_batches; ++ibatch) {
+        for (unsigned int ilane = 0; ilane < n_lanes; ++ilane) {
+            const unsigned int iowned = ibatch * n_lanes + std::min(ilane, batches.n_filled_lanes[ibatch] - 1);
+            for (unsigned int iface = 0; iface < n_faces; ++iface) {
+                batches.cell_face_slots[(ibatch * n_lanes + ilane) * n_faces + iface]
+                    = first_face_batch[iface / 2] * n_lanes + owned_cells_faces[iowned * n_faces + iface];
+            }
+        }
+    }
+    const unsigned int n_face_quad_pts = this->face_quadrature_collection[batches.poly_degree].size();
+    batches.face_numerical_fluxes.resize(n_face_batches * nstate * n_face_quad_pts * n_lanes);
+    return true;
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGStrong<dim,nstate,real,MeshType>::assemble_cell_batched_residual(std::vector<std::unique_ptr<CellResidualScratchData>> &scratch_data)
+{
+    // Each face batch only writes its own numerical fluxes and each cell batch only its own residual entries,
+    // so the batches are split into one contiguous range per thread. The faces are all evaluated before the cells.
+    // An exception thrown by a task is stored and rethrown here, on the calling thread.
+    const unsigned int n_threads = scratch_data.size();
+    auto assemble_batches = [&](const unsigned int n_batches, const auto &assemble_batch) {
+        if (n_threads == 1) {
+            for (unsigned int ibatch = 0; ibatch < n_batches; ++ibatch) {
+                assemble_batch(ibatch, *(scratch_data[0]));
+            }
+            return;
+        }
+        std::vector<std::exception_ptr> task_exception(n_threads);
+        dealii::Threads::TaskGroup<void> task_group;
+        for (unsigned int ithread = 0; ithread < n_threads; ++ithread) {
+            const unsigned int first = (ithread * n_batches) / n_threads;
+            const unsigned int last = ((ithread+1) * n_batches) / n_threads;
+            if (first == last) continue;
+            task_group += dealii::Threads::new_task([&, ithread, first, last] () {
+                try {
+                    for (unsigned int ibatch = first; ibatch < last; ++ibatch) {
+                        assemble_batch(ibatch, *(scratch_data[ithread]));
+                    }
+                } catch(...) {
+                    task_exception[ithread] = std::current_exception();
+                }
+            });
+        }
+        task_group.join_all();
+        for (const std::exception_ptr &exception : task_exception) {
+            if (exception) std::rethrow_exception(exception);
+        }
+    };
+    assemble_batches(cell_batches.face_batch_directions.size(),
+                     [this](const unsigned int ifbatch, CellResidualScratchData &data) { assemble_face_batch(ifbatch, data); });
+    assemble_batches(cell_batches.n_filled_lanes.size(),
+                     [this](const unsigned int ibatch, CellResidualScratchData &data) { assemble_cell_batch(ibatch, data); });
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGStrong<dim,nstate,real,MeshType>::reinit_batch_operators(CellResidualScratchData &scratch_data)
+{
+    const unsigned int poly_degree = cell_batches.poly_degree;
+    const unsigned int grid_degree = this->high_order_grid->fe_system.tensor_degree();
+    OPERATOR::basis_functions<dim,2*dim,real> &soln_basis = scratch_data.soln_basis_int;
+    OPERATOR::basis_functions<dim,2*dim,real> &flux_basis = scratch_data.flux_basis_int;
+    if(poly_degree != soln_basis.current_degree){
+        soln_basis.current_degree = poly_degree; 
+        flux_basis.current_degree = poly_degree; 
+        scratch_data.mapping_basis.current_degree = poly_degree; 
+        this->reinit_operators_for_cell_residual_loop(poly_degree, poly_degree, grid_degree, 
+                                                      soln_basis, soln_basis, 
+                                                      flux_basis, flux_basis, 
+                                                      scratch_data.flux_basis_stiffness, 
+                                                      scratch_data.soln_basis_projection_oper_int, scratch_data.soln_basis_projection_oper_ext,
+                                                      scratch_data.mapping_basis);
+    }
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGStrong<dim,nstate,real,MeshType>::gather_batch_coefficients(
+    const unsigned int                                        *cells,
+    std::array<std::vector<real>,nstate>                      &soln_coeff,
+    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &aux_soln_coeff) const
+{
+    const unsigned int n_lanes = cell_batches.n_lanes;
+    const unsigned int n_dofs_cell = this->fe_collection[cell_batches.poly_degree].dofs_per_cell;
+    const unsigned int n_shape_fns = n_dofs_cell / nstate;
+    for(unsigned int ilane=0; ilane<n_lanes; ilane++){
+        const unsigned int *dof_indices = &cell_batches.dof_local_indices[cells[ilane] * n_dofs_cell];
+        for(int istate=0; istate<nstate; istate++){
+            for(unsigned int ishape=0; ishape<n_shape_fns; ishape++){
+                const unsigned int local_index = dof_indices[istate * n_shape_fns + ishape];
+                soln_coeff[istate][ishape * n_lanes + ilane] = this->solution.local_element(local_index);
+                if(this->use_auxiliary_eq){
+                    for(int idim=0; idim<dim; idim++){
+                        aux_soln_coeff[istate][idim][ishape * n_lanes + ilane] = this->auxiliary_solution[idim].local_element(local_index);
+                    }
+                }
+            }
+        }
+    }
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGStrong<dim,nstate,real,MeshType>::interpolate_batch(
+    OPERATOR::basis_functions<dim,2*dim,real>                       &soln_basis,
+    const std::array<std::vector<real>,nstate>                      &soln_coeff,
+    const std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &aux_soln_coeff,
+    const std::array<const dealii::FullMatrix<double>*,3>           &bases,
+    std::array<std::vector<real>,nstate>                            &soln,
+    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate>      &aux_soln) const
+{
+    const unsigned int n_lanes = cell_batches.n_lanes;
+    for(int istate=0; istate<nstate; istate++){
+        soln_basis.matrix_vector_mult_interleaved(soln_coeff[istate], soln[istate],
+                                                  *bases[0], *bases[1], *bases[2], n_lanes);
+        if(!this->use_auxiliary_eq) continue;
+        for(int idim=0; idim<dim; idim++){
+            soln_basis.matrix_vector_mult_interleaved(aux_soln_coeff[istate][idim], aux_soln[istate][idim],
+                                                      *bases[0], *bases[1], *bases[2], n_lanes);
+        }
+    }
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGStrong<dim,nstate,real,MeshType>::assemble_face_batch(
+    const unsigned int      ifbatch,
+    CellResidualScratchData &scratch_data)
+{
+    using StateVectors = std::array<std::vector<real>,nstate>;
+    using StateTensorVectors = std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate>;
+
+    StrongDGScratchArena<dim,nstate,real> &scratch_arena = strong_scratch_arena(scratch_data.scratch_arena);
+    scratch_arena.rewind();
+    reinit_batch_operators(scratch_data);
+    OPERATOR::basis_functions<dim,2*dim,real> &soln_basis = scratch_data.soln_basis_int;
+
+    const unsigned int poly_degree = cell_batches.poly_degree;
+    const unsigned int n_lanes = cell_batches.n_lanes;
+    const unsigned int n_face_quad_pts = this->face_quadrature_collection[poly_degree].size();
+    const unsigned int n_shape_fns = this->fe_collection[poly_degree].dofs_per_cell / nstate;
+    const unsigned int direction = cell_batches.face_batch_directions[ifbatch];
+    const unsigned int *minus_cells = &cell_batches.face_minus_cells[ifbatch * n_lanes];
+    const unsigned int *plus_cells = &cell_batches.face_plus_cells[ifbatch * n_lanes];
+
+    // Solution of both cells on the face, the upper face of the minus cell and the lower face of the plus cell.
+    StateVectors &soln_coeff = scratch_arena.state_vectors(n_shape_fns * n_lanes);
+    StateTensorVectors &aux_soln_coeff = scratch_arena.state_tensor_vectors(n_shape_fns * n_lanes);
+    StateVectors &soln_at_surf_q_minus = scratch_arena.state_vectors(n_face_quad_pts * n_lanes);
+    StateVectors &soln_at_surf_q_plus = scratch_arena.state_vectors(n_face_quad_pts * n_lanes);
+    StateTensorVectors &aux_soln_at_surf_q_minus = scratch_arena.state_tensor_vectors(n_face_quad_pts * n_lanes);
+    StateTensorVectors &aux_soln_at_surf_q_plus = scratch_arena.state_tensor_vectors(n_face_quad_pts * n_lanes);
+    gather_batch_coefficients(minus_cells, soln_coeff, aux_soln_coeff);
+    interpolate_batch(soln_basis, soln_coeff, aux_soln_coeff,
+                      face_bases(2 * direction + 1, soln_basis.oneD_surf_operator, soln_basis.oneD_vol_operator),
+                      soln_at_surf_q_minus, aux_soln_at_surf_q_minus);
+    gather_batch_coefficients(plus_cells, soln_coeff, aux_soln_coeff);
+    interpolate_batch(soln_basis, soln_coeff, aux_soln_coeff,
+                      face_bases(2 * direction, soln_basis.oneD_surf_operator, soln_basis.oneD_vol_operator),
+                      soln_at_surf_q_plus, aux_soln_at_surf_q_plus);
+
+    dealii::Tensor<1,dim,real> unit_phys_normal;
+    unit_phys_normal[direction] = 1.0;
+    const unsigned int degsq = (poly_degree == 0) ? 1 : poly_degree * (poly_degree+1);
+    real *face_numerical_fluxes = &cell_batches.face_numerical_fluxes[ifbatch * nstate * n_face_quad_pts * n_lanes];
+    for(unsigned int ilane=0; ilane<n_lanes; ilane++){
+        const std::array<real,dim> &extent_minus = cell_batches.extents[minus_cells[ilane]];
+        const std::array<real,dim> &extent_plus = cell_batches.extents[plus_cells[ilane]];
+        // Same penalty as DGBase::evaluate_penalty_scaling() averaged over both cells.
+        const real penalty1 = degsq / extent_minus[direction] * this->all_parameters->sipg_penalty_factor;
+        const real penalty2 = degsq / extent_plus[direction] * this->all_parameters->sipg_penalty_factor;
+        const real penalty = 0.5 * (penalty1 + penalty2);
+        // Norm of the facet metric cofactor matrix times the reference normal, the area scaling of the face.
+        real face_Jac_norm_scaled = 1.0;
+        for(int idim=0; idim<dim; idim++){
+            if(idim != (int)direction) face_Jac_norm_scaled *= extent_minus[idim];
+        }
+        const dealii::types::global_dof_index minus_cell_index = cell_batches.active_cell_indices[minus_cells[ilane]];
+        const dealii::types::global_dof_index plus_cell_index = cell_batches.active_cell_indices[plus_cells[ilane]];
+
+        for(unsigned int iquad=0; iquad<n_face_quad_pts; iquad++){
+            const unsigned int ipoint = iquad * n_lanes + ilane;
+            std::array<real,nstate> soln_state_minus;
+            std::array<real,nstate> soln_state_plus;
+            std::array<dealii::Tensor<1,dim,real>,nstate> aux_soln_state_minus;
+            std::array<dealii::Tensor<1,dim,real>,nstate> aux_soln_state_plus;
+            for(int istate=0; istate<nstate; istate++){
+                soln_state_minus[istate] = soln_at_surf_q_minus[istate][ipoint];
+                soln_state_plus[istate] = soln_at_surf_q_plus[istate][ipoint];
+                for(int idim=0; idim<dim; idim++){
+                    aux_soln_state_minus[istate][idim] = aux_soln_at_surf_q_minus[istate][idim][ipoint];
+                    aux_soln_state_plus[istate][idim] = aux_soln_at_surf_q_plus[istate][idim][ipoint];
+                }
+            }
+            const std::array<real,nstate> conv_num_flux_dot_n_at_q = this->conv_num_flux_double->evaluate_flux(soln_state_minus, soln_state_plus, unit_phys_normal);
+            const std::array<real,nstate> diss_auxi_num_flux_dot_n_at_q = this->diss_num_flux_double->evaluate_auxiliary_flux(
+                minus_cell_index, plus_cell_index,
+                0.0, 0.0,
+                soln_state_minus, soln_state_plus,
+                aux_soln_state_minus, aux_soln_state_plus,
+                unit_phys_normal, penalty, false);
+            for(int istate=0; istate<nstate; istate++){
+                face_numerical_fluxes[(istate * n_face_quad_pts + iquad) * n_lanes + ilane]
+                    = face_Jac_norm_scaled * (conv_num_flux_dot_n_at_q[istate] + diss_auxi_num_flux_dot_n_at_q[istate]);
+            }
+        }
+    }
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGStrong<dim,nstate,real,MeshType>::assemble_cell_batch(
+    const unsigned int      ibatch,
+    CellResidualScratchData &scratch_data)
+{
+    using StateVectors = std::array<std::vector<real>,nstate>;
+    using StateTensorVectors = std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate>;
+
+    StrongDGScratchArena<dim,nstate,real> &scratch_arena = strong_scratch_arena(scratch_data.scratch_arena);
+    scratch_arena.rewind();
+    reinit_batch_operators(scratch_data);
+    OPERATOR::basis_functions<dim,2*dim,real> &soln_basis = scratch_data.soln_basis_int;
+    OPERATOR::basis_functions<dim,2*dim,real> &flux_basis = scratch_data.flux_basis_int;
+
+    const unsigned int poly_degree = cell_batches.poly_degree;
+    const unsigned int n_lanes = cell_batches.n_lanes;
+    const unsigned int n_faces = dealii::GeometryInfo<dim>::faces_per_cell;
+    const unsigned int n_quad_pts = this->volume_quadrature_collection[poly_degree].size();
+    const unsigned int n_face_quad_pts = this->face_quadrature_collection[poly_degree].size();
+    const unsigned int n_dofs_cell = this->fe_collection[poly_degree].dofs_per_cell;
+    const unsigned int n_shape_fns = n_dofs_cell / nstate;
+    const std::vector<double> &vol_quad_weights = this->volume_quadrature_collection[poly_degree].get_weights();
+    const std::vector<double> &surf_quad_weights = this->face_quadrature_collection[poly_degree].get_weights();
+    const unsigned int *lane_cells = &cell_batches.lane_cells[ibatch * n_lanes];
+    const unsigned int n_filled_lanes = cell_batches.n_filled_lanes[ibatch];
+
+    // The metric Jacobian of an axis-aligned box of extents h is diag(h), such that its determinant
+    // is the product of the extents and the metric cofactor matrix is diag(det/h).
+    std::vector<real> &det_Jac = scratch_arena.vector(n_lanes);
+    std::array<std::vector<real>,dim> &metric_cofactor = scratch_arena.dim_vectors(n_lanes);
+    std::vector<dealii::types::global_dof_index> &lane_cell_indices = scratch_arena.dof_indices(n_lanes);
+    for(unsigned int ilane=0; ilane<n_lanes; ilane++){
+        const std::array<real,dim> &extent = cell_batches.extents[lane_cells[ilane]];
+        det_Jac[ilane] = 1.0;
+        for(int idim=0; idim<dim; idim++){
+            det_Jac[ilane] *= extent[idim];
+        }
+        for(int idim=0; idim<dim; idim++){
+            metric_cofactor[idim][ilane] = det_Jac[ilane] / extent[idim];
+        }
+        lane_cell_indices[ilane] = cell_batches.active_cell_indices[lane_cells[ilane]];
+    }
+
+    // Solution and auxiliary solution at the volume cubature nodes of all the lanes.
+    StateVectors &soln_coeff = scratch_arena.state_vectors(n_shape_fns * n_lanes);
+    StateTensorVectors &aux_soln_coeff = scratch_arena.state_tensor_vectors(n_shape_fns * n_lanes);
+    gather_batch_coefficients(lane_cells, soln_coeff, aux_soln_coeff);
+    StateVectors &soln_at_q = scratch_arena.state_vectors(n_quad_pts * n_lanes);
+    StateTensorVectors &aux_soln_at_q = scratch_arena.state_tensor_vectors(n_quad_pts * n_lanes);
+    const std::array<const dealii::FullMatrix<double>*,3> vol_bases = {{&soln_basis.oneD_vol_operator, &soln_basis.oneD_vol_operator, &soln_basis.oneD_vol_operator}};
+    interpolate_batch(soln_basis, soln_coeff, aux_soln_coeff, vol_bases, soln_at_q, aux_soln_at_q);
+
+    // The time step of each cell is evaluated from its own cubature values, as in assemble_volume_term_strong().
+    StateVectors &soln_at_q_lane = scratch_arena.state_vectors(n_quad_pts);
+    for(unsigned int ilane=0; ilane<n_filled_lanes; ilane++){
+        for(int istate=0; istate<nstate; istate++){
+            for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
+                soln_at_q_lane[istate][iquad] = soln_at_q[istate][iquad * n_lanes + ilane];
+            }
+        }
+        const unsigned int icell = lane_cells[ilane];
+        const dealii::types::global_dof_index cell_index = lane_cell_indices[ilane];
+        const real cell_volume = det_Jac[ilane];
+        const real cell_diameter = cell_volume / std::pow(cell_batches.diameters[icell],dim-1);
+        const real cell_radius = 0.5 * cell_diameter;
+        this->cell_volume[cell_index] = cell_volume;
+        this->max_dt_cell[cell_index] = this->evaluate_CFL(soln_at_q_lane, 0.0, cell_radius, poly_degree);
+    }
+
+    // The physics evaluates the fluxes of all the cubature nodes of all the lanes at once,
+    // the dissipative flux with the cell of each lane.
+    StateTensorVectors &ref_flux_at_q = scratch_arena.state_tensor_vectors(n_quad_pts * n_lanes);
+    StateTensorVectors &diffusive_phys_flux_at_q = scratch_arena.state_tensor_vectors(n_quad_pts * n_lanes);
+    this->pde_physics_double->convective_flux_batch(soln_at_q, ref_flux_at_q);
+    this->pde_physics_double->dissipative_flux_interleaved_batch(soln_at_q, aux_soln_at_q, lane_cell_indices, diffusive_phys_flux_at_q);
+
+    // The convective and dissipative fluxes enter the volume and face terms with the same sign,
+    // so their sum is transformed to reference space, in place, and differentiated once.
+    for(int istate=0; istate<nstate; istate++){
+        for(int idim=0; idim<dim; idim++){
+            real *ref_flux = ref_flux_at_q[istate][idim].data();
+            const real *diffusive_flux = diffusive_phys_flux_at_q[istate][idim].data();
+            const real *cofactor = metric_cofactor[idim].data();
+            for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
+                const unsigned int offset = iquad * n_lanes;
+                DEAL_II_OPENMP_SIMD_PRAGMA
+                for(unsigned int ilane=0; ilane<n_lanes; ilane++){
+                    ref_flux[offset + ilane] = cofactor[ilane] * (ref_flux[offset + ilane] + diffusive_flux[offset + ilane]);
+                }
+            }
+        }
+    }
+
+    // Volume term: minus the reference divergence of the reference flux.
+    StateVectors &rhs = scratch_arena.state_vectors(n_shape_fns * n_lanes);
+    std::vector<real> &flux_divergence = scratch_arena.vector(n_quad_pts * n_lanes);
+    for(int istate=0; istate<nstate; istate++){
+        for(int idim=0; idim<dim; idim++){
+            flux_basis.matrix_vector_mult_interleaved(ref_flux_at_q[istate][idim], flux_divergence,
+                                                      (idim == 0) ? flux_basis.oneD_grad_operator : flux_basis.oneD_vol_operator,
+                                                      (idim == 1) ? flux_basis.oneD_grad_operator : flux_basis.oneD_vol_operator,
+                                                      (idim == 2) ? flux_basis.oneD_grad_operator : flux_basis.oneD_vol_operator,
+                                                      n_lanes, (idim > 0));
+        }
+        soln_basis.inner_product_interleaved(flux_divergence, vol_quad_weights, rhs[istate],
+                                             soln_basis.oneD_vol_operator, soln_basis.oneD_vol_operator, soln_basis.oneD_vol_operator,
+                                             n_lanes, false, -1.0);
+    }
+
+    // Face terms of the lanes' own side of each face, as the interior side in assemble_face_term_strong().
+    StateVectors &face_flux = scratch_arena.state_vectors(n_face_quad_pts * n_lanes);
+    for(unsigned int iface=0; iface<n_faces; iface++){
+        const int dim_not_zero = iface / 2;
+        const double unit_ref_normal = dealii::GeometryInfo<dim>::unit_normal_vector[iface][dim_not_zero];
+
+        // Reference volume flux interpolated to the facet and dotted with the unit reference normal.
+        const std::array<const dealii::FullMatrix<double>*,3> flux_face_bases = face_bases(iface, flux_basis.oneD_surf_operator, flux_basis.oneD_vol_operator);
+        for(int istate=0; istate<nstate; istate++){
+            flux_basis.matrix_vector_mult_interleaved(ref_flux_at_q[istate][dim_not_zero], face_flux[istate],
+                                                      *flux_face_bases[0], *flux_face_bases[1], *flux_face_bases[2],
+                                                      n_lanes, false, unit_ref_normal);
+        }
+
+        // Minus the scaled numerical fluxes of assemble_face_batch(), evaluated from the minus to the plus cell
+        // of the face, such that their sign is flipped on the lower face of a cell.
+        for(unsigned int ilane=0; ilane<n_lanes; ilane++){
+            const unsigned int islot = cell_batches.cell_face_slots[(ibatch * n_lanes + ilane) * n_faces + iface];
+            const real *face_numerical_flux = &cell_batches.face_numerical_fluxes[(islot / n_lanes) * nstate * n_face_quad_pts * n_lanes + islot % n_lanes];
+            for(int istate=0; istate<nstate; istate++){
+                for(unsigned int iquad=0; iquad<n_face_quad_pts; iquad++){
+                    face_flux[istate][iquad * n_lanes + ilane] -= unit_ref_normal * face_numerical_flux[(istate * n_face_quad_pts + iquad) * n_lanes];
+                }
+            }
+        }
+
+        const std::array<const dealii::FullMatrix<double>*,3> soln_face_bases = face_bases(iface, soln_basis.oneD_surf_operator, soln_basis.oneD_vol_operator);
+        for(int istate=0; istate<nstate; istate++){
+            soln_basis.inner_product_interleaved(face_flux[istate], surf_quad_weights, rhs[istate],
+                                                 *soln_face_bases[0], *soln_face_bases[1], *soln_face_bases[2],
+                                                 n_lanes, true, 1.0);
+        }
+    }
+
+    // Only the owned cells of the batch write into the residual.
+    for(unsigned int ilane=0; ilane<n_filled_lanes; ilane++){
+        const unsigned int *dof_indices = &cell_batches.dof_local_indices[lane_cells[ilane] * n_dofs_cell];
+        for(int istate=0; istate<nstate; istate++){
+            for(unsigned int ishape=0; ishape<n_shape_fns; ishape++){
+                this->right_hand_side.local_element(dof_indices[istate * n_shape_fns + ishape]) += rhs[istate][ishape * n_lanes + ilane];
+            }
+        }
+    }
+}
+
 /*******************************************************************
  *
  *
@@ -395,18 +1668,16 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_subface_term_and_build_operato
  *******************************************************************/
 
 template <int dim, int nstate, typename real, typename MeshType>
-void DGStrong<dim,nstate,real,MeshType>::assemble_auxiliary_residual()
+void DGStrong<dim,nstate,real,MeshType>::assemble_auxiliary_residual(const bool compute_dRdW)
 {
     using PDE_enum = Parameters::AllParameters::PartialDifferentialEquation;
-    using ODE_enum = Parameters::ODESolverParam::ODESolverEnum;
     const PDE_enum pde_type = this->all_parameters->pde_type;
 
     if(pde_type == PDE_enum::burgers_viscous){
         pcout << "DG Strong not yet verified for Burgers' viscous. Aborting..." << std::endl;
         std::abort();
     }
-    // NOTE: auxiliary currently only works explicit time advancement - not implicit
-    if (this->use_auxiliary_eq && !(this->all_parameters->ode_solver_param.ode_solver_type == ODE_enum::implicit_solver)) {
+    if (this->use_auxiliary_eq) {
         //set auxiliary rhs to 0
         for(int idim=0; idim<dim; idim++){
             this->auxiliary_right_hand_side[idim] = 0;
@@ -440,6 +1711,16 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_auxiliary_residual()
             soln_basis_projection_oper_int, soln_basis_projection_oper_ext,
             mapping_basis);
 
+        this->allocate_scratch_arenas(1);
+
+        // dR/dQ is added by the cell loop of the primary equations, right after this one.
+        if(compute_dRdW){
+            for(int idim=0; idim<dim; idim++){
+                dRdQ[idim].reinit(this->locally_owned_dofs, this->sparsity_pattern, this->mpi_communicator);
+                dAdW[idim].reinit(this->locally_owned_dofs, this->sparsity_pattern, this->mpi_communicator);
+            }
+        }
+
         //loop over cells solving for auxiliary rhs
         auto metric_cell = this->high_order_grid->dof_handler_grid.begin_active();
         for (auto soln_cell = this->dof_handler.begin_active(); soln_cell != this->dof_handler.end(); ++soln_cell, ++metric_cell) {
@@ -448,7 +1729,7 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_auxiliary_residual()
             this->assemble_cell_residual (
                 soln_cell,
                 metric_cell,
-                false, false, false,
+                compute_dRdW, false, false,
                 fe_values_collection_volume,
                 fe_values_collection_face_int,
                 fe_values_collection_face_ext,
@@ -462,12 +1743,14 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_auxiliary_residual()
                 soln_basis_projection_oper_int, 
                 soln_basis_projection_oper_ext,
                 mapping_basis,
+                *(this->scratch_arenas[0]),
                 true,
                 this->right_hand_side,
                 this->auxiliary_right_hand_side);
         } // end of cell loop
 
         for(int idim=0; idim<dim; idim++){
+            if(compute_dRdW) dAdW[idim].compress(dealii::VectorOperation::add);
             //compress auxiliary rhs for solution transfer across mpi ranks
             this->auxiliary_right_hand_side[idim].compress(dealii::VectorOperation::add);
             //update ghost values
@@ -479,14 +1762,17 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_auxiliary_residual()
             else
                 this->global_inverse_mass_matrix_auxiliary.vmult(this->auxiliary_solution[idim], this->auxiliary_right_hand_side[idim]);
 
-            //update ghost values of auxiliary solution
-            this->auxiliary_solution[idim].update_ghost_values();
+            //update ghost values of auxiliary solution, or only start it if DGBase overlaps it with the cell loop
+            if(this->defer_auxiliary_ghost_exchange){
+                this->auxiliary_solution[idim].update_ghost_values_start(idim);
+                this->auxiliary_ghost_exchange_pending = true;
+            }
+            else{
+                this->auxiliary_solution[idim].update_ghost_values();
+            }
         }
     }//end of if statement for diffusive
-    else if (this->use_auxiliary_eq && (this->all_parameters->ode_solver_param.ode_solver_type == ODE_enum::implicit_solver)) {
-        pcout << "ERROR: " << "auxiliary currently only works for explicit time advancement. Aborting..." << std::endl;
-        std::abort();
-    } else {
+    else {
         // Do nothing
     }
 }
@@ -505,6 +1791,24 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_auxiliary_equation
     OPERATOR::basis_functions<dim,2*dim,real> &flux_basis,
     OPERATOR::metric_operators<real,dim,2*dim> &metric_oper,
     std::vector<dealii::Tensor<1,dim,real>> &local_auxiliary_RHS)
+{
+    std::array<std::vector<real>,nstate> soln_coeff;
+    get_solution_coefficients<real>(current_dofs_indices, poly_degree, 0, 0, soln_coeff);
+    assemble_volume_term_auxiliary_equation<real>(
+        soln_coeff, poly_degree,
+        soln_basis, flux_basis, metric_oper,
+        local_auxiliary_RHS);
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+template <typename adtype>
+void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_auxiliary_equation(
+    const std::array<std::vector<adtype>,nstate> &soln_coeff,
+    const unsigned int poly_degree,
+    OPERATOR::basis_functions<dim,2*dim,real> &soln_basis,
+    OPERATOR::basis_functions<dim,2*dim,real> &flux_basis,
+    OPERATOR::metric_operators<real,dim,2*dim> &metric_oper,
+    std::vector<dealii::Tensor<1,dim,adtype>> &local_auxiliary_RHS)
 {
     //Please see header file for exact formula we are solving.
     const unsigned int n_quad_pts  = this->volume_quadrature_collection[poly_degree].size();
@@ -512,43 +1816,29 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_auxiliary_equation
     const unsigned int n_shape_fns = n_dofs_cell / nstate;
     const std::vector<double> &quad_weights = this->volume_quadrature_collection[poly_degree].get_weights();
 
-    //Fetch the modal soln coefficients and the modal auxiliary soln coefficients
-    //We immediately separate them by state as to be able to use sum-factorization
-    //in the interpolation operator. If we left it by n_dofs_cell, then the matrix-vector
-    //mult would sum the states at the quadrature point.
-    //That is why the basis functions are of derived class state rather than base.
-    std::array<std::vector<real>,nstate> soln_coeff;
-    for (unsigned int idof = 0; idof < n_dofs_cell; ++idof) {
-        const unsigned int istate = this->fe_collection[poly_degree].system_to_component_index(idof).first;
-        const unsigned int ishape = this->fe_collection[poly_degree].system_to_component_index(idof).second;
-        if(ishape == 0)
-            soln_coeff[istate].resize(n_shape_fns);
-
-        soln_coeff[istate][ishape] = DGBase<dim,real,MeshType>::solution(current_dofs_indices[idof]);
-    }
     //Interpolate each state to the quadrature points using sum-factorization
     //with the basis functions in each reference direction.
     for(int istate=0; istate<nstate; istate++){
-        std::vector<real> soln_at_q(n_quad_pts);
+        std::vector<adtype> soln_at_q(n_quad_pts);
         //interpolate soln coeff to volume cubature nodes
-        soln_basis.matrix_vector_mult_1D(soln_coeff[istate], soln_at_q,
-                                         soln_basis.oneD_vol_operator);
+        ADOperator::matrix_vector_mult_1D(soln_basis, soln_coeff[istate], soln_at_q,
+                                          soln_basis.oneD_vol_operator);
         //the volume integral for the auxiliary equation is the physical integral of the physical gradient of the solution.
         //That is, we need to physically integrate (we have determinant of Jacobian cancel) the Eq. (12) (with u for chi) in
         //Cicchino, Alexander, et al. "Provably stable flux reconstruction high-order methods on curvilinear elements." Journal of Computational Physics 463 (2022): 111259.
 
         //apply gradient of reference basis functions on the solution at volume cubature nodes
-        dealii::Tensor<1,dim,std::vector<real>> ref_gradient_basis_fns_times_soln;
+        dealii::Tensor<1,dim,std::vector<adtype>> ref_gradient_basis_fns_times_soln;
         for(int idim=0; idim<dim; idim++){
             ref_gradient_basis_fns_times_soln[idim].resize(n_quad_pts);
         }
-        flux_basis.gradient_matrix_vector_mult_1D(soln_at_q, ref_gradient_basis_fns_times_soln,
-                                                  flux_basis.oneD_vol_operator,
-                                                  flux_basis.oneD_grad_operator);
+        ADOperator::gradient_matrix_vector_mult_1D(flux_basis, soln_at_q, ref_gradient_basis_fns_times_soln,
+                                                   flux_basis.oneD_vol_operator,
+                                                   flux_basis.oneD_grad_operator);
         //transform the gradient into a physical gradient operator scaled by determinant of metric Jacobian
         //then apply the inner product in each direction
         for(int idim=0; idim<dim; idim++){
-            std::vector<real> phys_gradient_u(n_quad_pts);
+            std::vector<adtype> phys_gradient_u(n_quad_pts);
             for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
                 for(int jdim=0; jdim<dim; jdim++){
                     //transform into the physical gradient
@@ -557,11 +1847,11 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_auxiliary_equation
                 }
             }
             //Note that we let the determiant of the metric Jacobian cancel off between the integral and physical gradient
-            std::vector<real> rhs(n_shape_fns);
-            soln_basis.inner_product_1D(phys_gradient_u, quad_weights,
-                                        rhs,
-                                        soln_basis.oneD_vol_operator,
-                                        false, 1.0);//it's added since auxiliary is EQUAL to the gradient of the soln
+            std::vector<adtype> rhs(n_shape_fns);
+            ADOperator::inner_product_1D(soln_basis, phys_gradient_u, quad_weights,
+                                         rhs,
+                                         soln_basis.oneD_vol_operator,
+                                         false, 1.0);//it's added since auxiliary is EQUAL to the gradient of the soln
 
             //write the the auxiliary rhs for the test function.
             for(unsigned int ishape=0; ishape<n_shape_fns; ishape++){
@@ -572,15 +1862,18 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_auxiliary_equation
 }
 
 template <int dim, int nstate, typename real, typename MeshType>
+template <typename adtype>
 void DGStrong<dim,nstate,real,MeshType>::assemble_boundary_term_auxiliary_equation(
     const unsigned int iface,
     const dealii::types::global_dof_index current_cell_index,
     const unsigned int poly_degree,
     const unsigned int boundary_id,
-    const std::vector<dealii::types::global_dof_index> &dofs_indices,
+    const std::array<std::vector<adtype>,nstate> &soln_coeff,
     OPERATOR::basis_functions<dim,2*dim,real> &soln_basis,
     OPERATOR::metric_operators<real,dim,2*dim> &metric_oper,
-    std::vector<dealii::Tensor<1,dim,real>> &local_auxiliary_RHS)
+    Physics::PhysicsBase<dim,nstate,adtype> &physics,
+    NumericalFlux::NumericalFluxDissipative<dim,nstate,adtype> &diss_num_flux,
+    std::vector<dealii::Tensor<1,dim,adtype>> &local_auxiliary_RHS)
 {
     (void) current_cell_index;
 
@@ -588,45 +1881,33 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_boundary_term_auxiliary_equati
     const unsigned int n_quad_pts_vol  = this->volume_quadrature_collection[poly_degree].size();
     const unsigned int n_dofs          = this->fe_collection[poly_degree].dofs_per_cell;
     const unsigned int n_shape_fns     = n_dofs / nstate;
-    AssertDimension (n_dofs, dofs_indices.size());
-
-    //Extract interior modal coefficients of solution
-    std::array<std::vector<real>,nstate> soln_coeff;
-    for (unsigned int idof = 0; idof < n_dofs; ++idof) {
-        const unsigned int istate = this->fe_collection[poly_degree].system_to_component_index(idof).first;
-        const unsigned int ishape = this->fe_collection[poly_degree].system_to_component_index(idof).second;
-        //allocate
-        if(ishape == 0)
-            soln_coeff[istate].resize(n_shape_fns);
-        //solve
-        soln_coeff[istate][ishape] = DGBase<dim,real,MeshType>::solution(dofs_indices[idof]);
-    }
+    AssertDimension (n_shape_fns, soln_coeff[0].size());
 
     //Interpolate soln to facet, and gradient to facet.
-    std::array<std::vector<real>,nstate> soln_at_surf_q;
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> ref_grad_soln_at_vol_q;
+    std::array<std::vector<adtype>,nstate> soln_at_surf_q;
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> ref_grad_soln_at_vol_q;
     for(int istate=0; istate<nstate; ++istate){
         //allocate
         soln_at_surf_q[istate].resize(n_face_quad_pts);
         //solve soln at facet cubature nodes
-        soln_basis.matrix_vector_mult_surface_1D(iface, soln_coeff[istate], soln_at_surf_q[istate],
-                                                 soln_basis.oneD_surf_operator,
-                                                 soln_basis.oneD_vol_operator);
+        ADOperator::matrix_vector_mult_surface_1D(soln_basis, iface, soln_coeff[istate], soln_at_surf_q[istate],
+                                                  soln_basis.oneD_surf_operator,
+                                                  soln_basis.oneD_vol_operator);
         //solve reference gradient of soln at facet cubature nodes
         for(int idim=0; idim<dim; idim++){
             ref_grad_soln_at_vol_q[istate][idim].resize(n_quad_pts_vol);
         }
-        soln_basis.gradient_matrix_vector_mult_1D(soln_coeff[istate], ref_grad_soln_at_vol_q[istate],
-                                                  soln_basis.oneD_vol_operator,
-                                                  soln_basis.oneD_grad_operator);
+        ADOperator::gradient_matrix_vector_mult_1D(soln_basis, soln_coeff[istate], ref_grad_soln_at_vol_q[istate],
+                                                   soln_basis.oneD_vol_operator,
+                                                   soln_basis.oneD_grad_operator);
     }
 
     // Get physical gradient of solution on the surface
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> phys_grad_soln_at_surf_q;
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> phys_grad_soln_at_surf_q;
     for(int istate=0; istate<nstate; istate++){
         //transform the gradient into a physical gradient operator
         for(int idim=0; idim<dim; idim++){
-            std::vector<real> phys_gradient_u(n_quad_pts_vol);
+            std::vector<adtype> phys_gradient_u(n_quad_pts_vol);
             for(unsigned int iquad=0; iquad<n_quad_pts_vol; iquad++){
                 for(int jdim=0; jdim<dim; jdim++){
                     //transform into the physical gradient
@@ -637,16 +1918,16 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_boundary_term_auxiliary_equati
             }
             phys_grad_soln_at_surf_q[istate][idim].resize(n_face_quad_pts);
             //interpolate physical volume gradient of the solution to the surface
-            soln_basis.matrix_vector_mult_surface_1D(iface, phys_gradient_u, phys_grad_soln_at_surf_q[istate][idim],
-                                                     soln_basis.oneD_surf_operator,
-                                                     soln_basis.oneD_vol_operator);
+            ADOperator::matrix_vector_mult_surface_1D(soln_basis, iface, phys_gradient_u, phys_grad_soln_at_surf_q[istate][idim],
+                                                      soln_basis.oneD_surf_operator,
+                                                      soln_basis.oneD_vol_operator);
         }
     }
 
     //evaluate physical facet fluxes dot product with physical unit normal scaled by determinant of metric facet Jacobian
     //the outward reference normal dircetion.
     const dealii::Tensor<1,dim,double> unit_ref_normal_int = dealii::GeometryInfo<dim>::unit_normal_vector[iface];
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> surf_num_flux_minus_surf_soln_dot_normal;
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> surf_num_flux_minus_surf_soln_dot_normal;
     for(unsigned int iquad=0; iquad<n_face_quad_pts; iquad++){
         //Copy Metric Cofactor on the facet in a way can use for transforming Tensor Blocks to reference space
         //The way it is stored in metric_operators is to use sum-factorization in each direction,
@@ -659,8 +1940,8 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_boundary_term_auxiliary_equati
                 metric_cofactor_surf[idim][jdim] = metric_oper.metric_cofactor_surf[idim][jdim][iquad];
             }
         }
-        std::array<real,nstate> soln_state;
-        std::array<dealii::Tensor<1,dim,real>,nstate> phys_grad_soln_state;
+        std::array<adtype,nstate> soln_state;
+        std::array<dealii::Tensor<1,dim,adtype>,nstate> phys_grad_soln_state;
         for(int istate=0; istate<nstate; istate++){
             soln_state[istate] = soln_at_surf_q[istate][iquad];
             for(int idim=0; idim<dim; idim++){
@@ -675,16 +1956,16 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_boundary_term_auxiliary_equati
         const double face_Jac_norm_scaled = unit_phys_normal_int.norm();
         unit_phys_normal_int /= face_Jac_norm_scaled;//normalize it. 
 
-        std::array<real,nstate> soln_boundary;
-        std::array<dealii::Tensor<1,dim,real>,nstate> grad_soln_boundary;
-        dealii::Point<dim,real> surf_flux_node;
+        std::array<adtype,nstate> soln_boundary;
+        std::array<dealii::Tensor<1,dim,adtype>,nstate> grad_soln_boundary;
+        dealii::Point<dim,adtype> surf_flux_node;
         for(int idim=0; idim<dim; idim++){
             surf_flux_node[idim] = metric_oper.flux_nodes_surf[iface][idim][iquad];
         }
-        this->pde_physics_double->boundary_face_values (boundary_id, surf_flux_node, unit_phys_normal_int, soln_state, phys_grad_soln_state, soln_boundary, grad_soln_boundary);
+        physics.boundary_face_values (boundary_id, surf_flux_node, unit_phys_normal_int, soln_state, phys_grad_soln_state, soln_boundary, grad_soln_boundary);
 
-        std::array<real,nstate> diss_soln_num_flux;
-        diss_soln_num_flux = this->diss_num_flux_double->evaluate_solution_flux(soln_state, soln_boundary, unit_phys_normal_int);
+        std::array<adtype,nstate> diss_soln_num_flux;
+        diss_soln_num_flux = diss_num_flux.evaluate_solution_flux(soln_state, soln_boundary, unit_phys_normal_int);
 
         for(int istate=0; istate<nstate; istate++){
             for(int idim=0; idim<dim; idim++){
@@ -702,14 +1983,14 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_boundary_term_auxiliary_equati
     const std::vector<double> &surf_quad_weights = this->face_quadrature_collection[poly_degree].get_weights();
     for(int istate=0; istate<nstate; istate++){
         for(int idim=0; idim<dim; idim++){
-            std::vector<real> rhs(n_shape_fns);
-
-            soln_basis.inner_product_surface_1D(iface, 
-                                                surf_num_flux_minus_surf_soln_dot_normal[istate][idim],
-                                                surf_quad_weights, rhs,
-                                                soln_basis.oneD_surf_operator,
-                                                soln_basis.oneD_vol_operator,
-                                                false, 1.0);//it's added since auxiliary is EQUAL to the gradient of the soln
+            std::vector<adtype> rhs(n_shape_fns);
+
+            ADOperator::inner_product_surface_1D(soln_basis, iface, 
+                                                 surf_num_flux_minus_surf_soln_dot_normal[istate][idim],
+                                                 surf_quad_weights, rhs,
+                                                 soln_basis.oneD_surf_operator,
+                                                 soln_basis.oneD_vol_operator,
+                                                 false, 1.0);//it's added since auxiliary is EQUAL to the gradient of the soln
             for(unsigned int ishape=0; ishape<n_shape_fns; ishape++){
                 local_auxiliary_RHS[istate*n_shape_fns + ishape][idim] += rhs[ishape]; 
             }
@@ -731,6 +2012,38 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_auxiliary_equation(
     OPERATOR::metric_operators<real,dim,2*dim> &metric_oper_int,
     std::vector<dealii::Tensor<1,dim,real>> &local_auxiliary_RHS_int,
     std::vector<dealii::Tensor<1,dim,real>> &local_auxiliary_RHS_ext)
+{
+    std::array<std::vector<real>,nstate> soln_coeff_int;
+    get_solution_coefficients<real>(dof_indices_int, poly_degree_int, 0, 0, soln_coeff_int);
+    std::array<std::vector<real>,nstate> soln_coeff_ext;
+    get_solution_coefficients<real>(dof_indices_ext, poly_degree_ext, 0, 0, soln_coeff_ext);
+    assemble_face_term_auxiliary_equation<real>(
+        iface, neighbor_iface,
+        current_cell_index, neighbor_cell_index,
+        poly_degree_int, poly_degree_ext,
+        soln_coeff_int, soln_coeff_ext,
+        soln_basis_int, soln_basis_ext,
+        metric_oper_int,
+        *(this->diss_num_flux_double),
+        local_auxiliary_RHS_int, local_auxiliary_RHS_ext);
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+template <typename adtype>
+void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_auxiliary_equation(
+    const unsigned int iface, const unsigned int neighbor_iface,
+    const dealii::types::global_dof_index current_cell_index,
+    const dealii::types::global_dof_index neighbor_cell_index,
+    const unsigned int poly_degree_int, 
+    const unsigned int poly_degree_ext,
+    const std::array<std::vector<adtype>,nstate> &soln_coeff_int,
+    const std::array<std::vector<adtype>,nstate> &soln_coeff_ext,
+    OPERATOR::basis_functions<dim,2*dim,real> &soln_basis_int,
+    OPERATOR::basis_functions<dim,2*dim,real> &soln_basis_ext,
+    OPERATOR::metric_operators<real,dim,2*dim> &metric_oper_int,
+    NumericalFlux::NumericalFluxDissipative<dim,nstate,adtype> &diss_num_flux,
+    std::vector<dealii::Tensor<1,dim,adtype>> &local_auxiliary_RHS_int,
+    std::vector<dealii::Tensor<1,dim,adtype>> &local_auxiliary_RHS_ext)
 {
     (void) current_cell_index;
     (void) neighbor_cell_index;
@@ -743,56 +2056,32 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_auxiliary_equation(
     const unsigned int n_shape_fns_int = n_dofs_int / nstate;
     const unsigned int n_shape_fns_ext = n_dofs_ext / nstate;
 
-    AssertDimension (n_dofs_int, dof_indices_int.size());
-    AssertDimension (n_dofs_ext, dof_indices_ext.size());
-
-    //Extract interior modal coefficients of solution
-    std::array<std::vector<real>,nstate> soln_coeff_int;
-    for (unsigned int idof = 0; idof < n_dofs_int; ++idof) {
-        const unsigned int istate = this->fe_collection[poly_degree_int].system_to_component_index(idof).first;
-        const unsigned int ishape = this->fe_collection[poly_degree_int].system_to_component_index(idof).second;
-        //allocate
-        if(ishape == 0) soln_coeff_int[istate].resize(n_shape_fns_int);
-
-        //solve
-        soln_coeff_int[istate][ishape] = DGBase<dim,real,MeshType>::solution(dof_indices_int[idof]);
-    }
-
-    //Extract exterior modal coefficients of solution
-    std::array<std::vector<real>,nstate> soln_coeff_ext;
-    for (unsigned int idof = 0; idof < n_dofs_ext; ++idof) {
-        const unsigned int istate = this->fe_collection[poly_degree_ext].system_to_component_index(idof).first;
-        const unsigned int ishape = this->fe_collection[poly_degree_ext].system_to_component_index(idof).second;
-        //allocate
-        if(ishape == 0) soln_coeff_ext[istate].resize(n_shape_fns_ext);
-
-        //solve
-        soln_coeff_ext[istate][ishape] = DGBase<dim,real,MeshType>::solution(dof_indices_ext[idof]);
-    }
+    AssertDimension (n_shape_fns_int, soln_coeff_int[0].size());
+    AssertDimension (n_shape_fns_ext, soln_coeff_ext[0].size());
 
     //Interpolate soln modal coefficients to the facet
-    std::array<std::vector<real>,nstate> soln_at_surf_q_int;
-    std::array<std::vector<real>,nstate> soln_at_surf_q_ext;
+    std::array<std::vector<adtype>,nstate> soln_at_surf_q_int;
+    std::array<std::vector<adtype>,nstate> soln_at_surf_q_ext;
     for(int istate=0; istate<nstate; ++istate){
         //allocate
         soln_at_surf_q_int[istate].resize(n_face_quad_pts);
         soln_at_surf_q_ext[istate].resize(n_face_quad_pts);
         //solve soln at facet cubature nodes
-        soln_basis_int.matrix_vector_mult_surface_1D(iface,
-                                                     soln_coeff_int[istate], soln_at_surf_q_int[istate],
-                                                     soln_basis_int.oneD_surf_operator,
-                                                     soln_basis_int.oneD_vol_operator);
-        soln_basis_ext.matrix_vector_mult_surface_1D(neighbor_iface,
-                                                     soln_coeff_ext[istate], soln_at_surf_q_ext[istate],
-                                                     soln_basis_ext.oneD_surf_operator,
-                                                     soln_basis_ext.oneD_vol_operator);
+        ADOperator::matrix_vector_mult_surface_1D(soln_basis_int, iface,
+                                                  soln_coeff_int[istate], soln_at_surf_q_int[istate],
+                                                  soln_basis_int.oneD_surf_operator,
+                                                  soln_basis_int.oneD_vol_operator);
+        ADOperator::matrix_vector_mult_surface_1D(soln_basis_ext, neighbor_iface,
+                                                  soln_coeff_ext[istate], soln_at_surf_q_ext[istate],
+                                                  soln_basis_ext.oneD_surf_operator,
+                                                  soln_basis_ext.oneD_vol_operator);
     }
 
     //evaluate physical facet fluxes dot product with physical unit normal scaled by determinant of metric facet Jacobian
     //the outward reference normal dircetion.
     const dealii::Tensor<1,dim,double> unit_ref_normal_int = dealii::GeometryInfo<dim>::unit_normal_vector[iface];
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> surf_num_flux_minus_surf_soln_int_dot_normal;
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> surf_num_flux_minus_surf_soln_ext_dot_normal;
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> surf_num_flux_minus_surf_soln_int_dot_normal;
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> surf_num_flux_minus_surf_soln_ext_dot_normal;
     for (unsigned int iquad=0; iquad<n_face_quad_pts; ++iquad) {
         //Copy Metric Cofactor on the facet in a way can use for transforming Tensor Blocks to reference space
         //The way it is stored in metric_operators is to use sum-factorization in each direction,
@@ -813,14 +2102,14 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_auxiliary_equation(
         const double face_Jac_norm_scaled = unit_phys_normal_int.norm();
         unit_phys_normal_int /= face_Jac_norm_scaled;//normalize it. 
 
-        std::array<real,nstate> diss_soln_num_flux;
-        std::array<real,nstate> soln_state_int;
-        std::array<real,nstate> soln_state_ext;
+        std::array<adtype,nstate> diss_soln_num_flux;
+        std::array<adtype,nstate> soln_state_int;
+        std::array<adtype,nstate> soln_state_ext;
         for(int istate=0; istate<nstate; istate++){
             soln_state_int[istate] = soln_at_surf_q_int[istate][iquad];
             soln_state_ext[istate] = soln_at_surf_q_ext[istate][iquad];
         }
-        diss_soln_num_flux = this->diss_num_flux_double->evaluate_solution_flux(soln_state_int, soln_state_ext, unit_phys_normal_int);
+        diss_soln_num_flux = diss_num_flux.evaluate_solution_flux(soln_state_int, soln_state_ext, unit_phys_normal_int);
 
         for(int istate=0; istate<nstate; istate++){
             for(int idim=0; idim<dim; idim++){
@@ -842,26 +2131,26 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_auxiliary_equation(
     const std::vector<double> &surf_quad_weights = this->face_quadrature_collection[poly_degree_int].get_weights();
     for(int istate=0; istate<nstate; istate++){
         for(int idim=0; idim<dim; idim++){
-            std::vector<real> rhs_int(n_shape_fns_int);
+            std::vector<adtype> rhs_int(n_shape_fns_int);
 
-            soln_basis_int.inner_product_surface_1D(iface, 
-                                                    surf_num_flux_minus_surf_soln_int_dot_normal[istate][idim],
-                                                    surf_quad_weights, rhs_int,
-                                                    soln_basis_int.oneD_surf_operator,
-                                                    soln_basis_int.oneD_vol_operator,
-                                                    false, 1.0);//it's added since auxiliary is EQUAL to the gradient of the soln
+            ADOperator::inner_product_surface_1D(soln_basis_int, iface, 
+                                                 surf_num_flux_minus_surf_soln_int_dot_normal[istate][idim],
+                                                 surf_quad_weights, rhs_int,
+                                                 soln_basis_int.oneD_surf_operator,
+                                                 soln_basis_int.oneD_vol_operator,
+                                                 false, 1.0);//it's added since auxiliary is EQUAL to the gradient of the soln
 
             for(unsigned int ishape=0; ishape<n_shape_fns_int; ishape++){
                 local_auxiliary_RHS_int[istate*n_shape_fns_int + ishape][idim] += rhs_int[ishape]; 
             }
-            std::vector<real> rhs_ext(n_shape_fns_ext);
+            std::vector<adtype> rhs_ext(n_shape_fns_ext);
 
-            soln_basis_ext.inner_product_surface_1D(neighbor_iface, 
-                                                    surf_num_flux_minus_surf_soln_ext_dot_normal[istate][idim],
-                                                    surf_quad_weights, rhs_ext,
-                                                    soln_basis_ext.oneD_surf_operator,
-                                                    soln_basis_ext.oneD_vol_operator,
-                                                    false, 1.0);//it's added since auxiliary is EQUAL to the gradient of the soln
+            ADOperator::inner_product_surface_1D(soln_basis_ext, neighbor_iface, 
+                                                 surf_num_flux_minus_surf_soln_ext_dot_normal[istate][idim],
+                                                 surf_quad_weights, rhs_ext,
+                                                 soln_basis_ext.oneD_surf_operator,
+                                                 soln_basis_ext.oneD_vol_operator,
+                                                 false, 1.0);//it's added since auxiliary is EQUAL to the gradient of the soln
 
             for(unsigned int ishape=0; ishape<n_shape_fns_ext; ishape++){
                 local_auxiliary_RHS_ext[istate*n_shape_fns_ext + ishape][idim] += rhs_ext[ishape]; 
@@ -876,17 +2165,21 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_auxiliary_equation(
 *
 ****************************************************/
 template <int dim, int nstate, typename real, typename MeshType>
+template <typename adtype>
 void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_strong(
     typename dealii::DoFHandler<dim>::active_cell_iterator cell,
     const dealii::types::global_dof_index                  current_cell_index,
-    const std::vector<dealii::types::global_dof_index>     &cell_dofs_indices,
+    const std::array<std::vector<adtype>,nstate>           &soln_coeff,
+    const std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &aux_soln_coeff,
     const unsigned int                                     poly_degree,
     OPERATOR::basis_functions<dim,2*dim,real>                   &soln_basis,
     OPERATOR::basis_functions<dim,2*dim,real>                   &flux_basis,
     OPERATOR::local_basis_stiffness<dim,2*dim,real>             &flux_basis_stiffness,
     OPERATOR::vol_projection_operator<dim,2*dim,real>           &soln_basis_projection_oper,
     OPERATOR::metric_operators<real,dim,2*dim>             &metric_oper,
-    dealii::Vector<real>                                   &local_rhs_int_cell)
+    Physics::PhysicsBase<dim,nstate,adtype>                &physics,
+    StrongDGScratchArena<dim,nstate,adtype>                &scratch_arena,
+    LocalResidual<adtype>                                  &local_rhs_int_cell)
 {
     (void) current_cell_index;
 
@@ -896,111 +2189,81 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_strong(
     const unsigned int n_quad_pts_1D  = this->oneD_quadrature_collection[poly_degree].size();
     assert(n_quad_pts == pow(n_quad_pts_1D, dim));
     const std::vector<double> &vol_quad_weights = this->volume_quadrature_collection[poly_degree].get_weights();
-    const std::vector<double> &oneD_vol_quad_weights = this->oneD_quadrature_collection[poly_degree].get_weights();
 
-    AssertDimension (n_dofs_cell, cell_dofs_indices.size());
+    AssertDimension (n_shape_fns, soln_coeff[0].size());
 
-    // Fetch the modal soln coefficients and the modal auxiliary soln coefficients
-    // We immediately separate them by state as to be able to use sum-factorization
-    // in the interpolation operator. If we left it by n_dofs_cell, then the matrix-vector
-    // mult would sum the states at the quadrature point.
-    std::array<std::vector<real>,nstate> soln_coeff;
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> aux_soln_coeff;
-    for (unsigned int idof = 0; idof < n_dofs_cell; ++idof) {
-        const unsigned int istate = this->fe_collection[poly_degree].system_to_component_index(idof).first;
-        const unsigned int ishape = this->fe_collection[poly_degree].system_to_component_index(idof).second;
-        if(ishape == 0)
-            soln_coeff[istate].resize(n_shape_fns);
-        soln_coeff[istate][ishape] = DGBase<dim,real,MeshType>::solution(cell_dofs_indices[idof]);
-        for(int idim=0; idim<dim; idim++){
-            if(ishape == 0)
-                aux_soln_coeff[istate][idim].resize(n_shape_fns);
-            if(this->use_auxiliary_eq){
-                aux_soln_coeff[istate][idim][ishape] = DGBase<dim,real,MeshType>::auxiliary_solution[idim](cell_dofs_indices[idof]);
-            }
-            else{
-                aux_soln_coeff[istate][idim][ishape] = 0.0;
-            }
-        }
-    }
-    std::array<std::vector<real>,nstate> soln_at_q;
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> aux_soln_at_q; //auxiliary sol at flux nodes
-    std::vector<std::array<real,nstate>> soln_at_q_for_max_CFL(n_quad_pts);//Need soln written in a different for to use pre-existing max CFL function
+    // The modal soln coefficients and the modal auxiliary soln coefficients are separated by state
+    // as to be able to use sum-factorization in the interpolation operator, see get_solution_coefficients().
+    // All the temporaries below are taken from the scratch arena, already sized and zeroed.
+    std::array<std::vector<adtype>,nstate> &soln_at_q = scratch_arena.state_vectors(n_quad_pts);
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &aux_soln_at_q = scratch_arena.state_tensor_vectors(n_quad_pts); //auxiliary sol at flux nodes
     // Interpolate each state to the quadrature points using sum-factorization
     // with the basis functions in each reference direction.
     for(int istate=0; istate<nstate; istate++){
-        soln_at_q[istate].resize(n_quad_pts);
-        soln_basis.matrix_vector_mult_1D(soln_coeff[istate], soln_at_q[istate],
-                                         soln_basis.oneD_vol_operator);
+        ADOperator::matrix_vector_mult_1D(soln_basis, soln_coeff[istate], soln_at_q[istate],
+                                          soln_basis.oneD_vol_operator);
         for(int idim=0; idim<dim; idim++){
-            aux_soln_at_q[istate][idim].resize(n_quad_pts);
-            soln_basis.matrix_vector_mult_1D(aux_soln_coeff[istate][idim], aux_soln_at_q[istate][idim],
-                                             soln_basis.oneD_vol_operator);
-        }
-        for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
-            soln_at_q_for_max_CFL[iquad][istate] = soln_at_q[istate][iquad];
+            ADOperator::matrix_vector_mult_1D(soln_basis, aux_soln_coeff[istate][idim], aux_soln_at_q[istate][idim],
+                                              soln_basis.oneD_vol_operator);
         }
     }
 
-    // For pseudotime, we need to compute the time_scaled_solution.
-    // Thus, we need to evaluate the max_dt_cell (as previously done in dg/weak_dg.cpp -> assemble_volume_term_explicit)
-    // Get max artificial dissipation
-    real max_artificial_diss = 0.0;
-    const unsigned int n_dofs_arti_diss = this->fe_q_artificial_dissipation.dofs_per_cell;
-    typename dealii::DoFHandler<dim>::active_cell_iterator artificial_dissipation_cell(
-        this->triangulation.get(), cell->level(), cell->index(), &(this->dof_handler_artificial_dissipation));
-    std::vector<dealii::types::global_dof_index> dof_indices_artificial_dissipation(n_dofs_arti_diss);
-    artificial_dissipation_cell->get_dof_indices (dof_indices_artificial_dissipation);
-    for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
-        real artificial_diss_coeff_at_q = 0.0;
-        if ( this->all_parameters->artificial_dissipation_param.add_artificial_dissipation ) {
-            const dealii::Point<dim,real> point = this->volume_quadrature_collection[poly_degree].point(iquad);
-            for (unsigned int idof=0; idof<n_dofs_arti_diss; ++idof) {
-                const unsigned int index = dof_indices_artificial_dissipation[idof];
-                artificial_diss_coeff_at_q += this->artificial_dissipation_c0[index] * this->fe_q_artificial_dissipation.shape_value(idof, point);
+    // The derivatives of the residual do not evaluate the time step of the cell.
+    if constexpr (std::is_same<adtype,real>::value) {
+        // For pseudotime, we need to compute the time_scaled_solution.
+        // Thus, we need to evaluate the max_dt_cell (as previously done in dg/weak_dg.cpp -> assemble_volume_term_explicit)
+        // Get max artificial dissipation
+        real max_artificial_diss = 0.0;
+        const unsigned int n_dofs_arti_diss = this->fe_q_artificial_dissipation.dofs_per_cell;
+        typename dealii::DoFHandler<dim>::active_cell_iterator artificial_dissipation_cell(
+            this->triangulation.get(), cell->level(), cell->index(), &(this->dof_handler_artificial_dissipation));
+        std::vector<dealii::types::global_dof_index> &dof_indices_artificial_dissipation = scratch_arena.dof_indices(n_dofs_arti_diss);
+        artificial_dissipation_cell->get_dof_indices (dof_indices_artificial_dissipation);
+        for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
+            real artificial_diss_coeff_at_q = 0.0;
+            if ( this->all_parameters->artificial_dissipation_param.add_artificial_dissipation ) {
+                const dealii::Point<dim,real> point = this->volume_quadrature_collection[poly_degree].point(iquad);
+                for (unsigned int idof=0; idof<n_dofs_arti_diss; ++idof) {
+                    const unsigned int index = dof_indices_artificial_dissipation[idof];
+                    artificial_diss_coeff_at_q += this->artificial_dissipation_c0[index] * this->fe_q_artificial_dissipation.shape_value(idof, point);
+                }
+                max_artificial_diss = std::max(artificial_diss_coeff_at_q, max_artificial_diss);
             }
-            max_artificial_diss = std::max(artificial_diss_coeff_at_q, max_artificial_diss);
         }
+        // Get max_dt_cell for time_scaled_solution with pseudotime
+        real cell_volume_estimate = 0.0;
+        for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
+            cell_volume_estimate += metric_oper.det_Jac_vol[iquad] * vol_quad_weights[iquad];
+        }
+        const real cell_volume = cell_volume_estimate;
+        const real diameter = cell->diameter();
+        const real cell_diameter = cell_volume / std::pow(diameter,dim-1);
+        const real cell_radius = 0.5 * cell_diameter;
+        this->cell_volume[current_cell_index] = cell_volume;
+        this->max_dt_cell[current_cell_index] = this->evaluate_CFL ( soln_at_q, max_artificial_diss, cell_radius, poly_degree);
     }
-    // Get max_dt_cell for time_scaled_solution with pseudotime
-    real cell_volume_estimate = 0.0;
-    for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
-        cell_volume_estimate += metric_oper.det_Jac_vol[iquad] * vol_quad_weights[iquad];
-    }
-    const real cell_volume = cell_volume_estimate;
-    const real diameter = cell->diameter();
-    const real cell_diameter = cell_volume / std::pow(diameter,dim-1);
-    const real cell_radius = 0.5 * cell_diameter;
-    this->cell_volume[current_cell_index] = cell_volume;
-    this->max_dt_cell[current_cell_index] = this->evaluate_CFL ( soln_at_q_for_max_CFL, max_artificial_diss, cell_radius, poly_degree);
+
+    // Parts of the residual assembled for the cell, see DGBase::set_residual_part() and DGBase::set_active_time_level().
+    // Only the time step is evaluated for a cell whose level is not active.
+    const bool assemble_convective = this->assembles_convective_terms() && this->time_level_is_active(current_cell_index);
+    const bool assemble_dissipative = this->assembles_dissipative_terms() && this->time_level_is_active(current_cell_index);
+    if (!assemble_convective && !assemble_dissipative) return;
 
     //get entropy projected variables
-    std::array<std::vector<real>,nstate> entropy_var_at_q;
-    std::array<std::vector<real>,nstate> projected_entropy_var_at_q;
+    const bool use_split_form = this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form;
+    const unsigned int n_quad_pts_split = use_split_form ? n_quad_pts : 0;
+    std::array<std::vector<adtype>,nstate> &entropy_var_at_q = scratch_arena.state_vectors(n_quad_pts_split);
+    std::array<std::vector<adtype>,nstate> &projected_entropy_var_at_q = scratch_arena.state_vectors(n_quad_pts_split);
     if (this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
+        physics.compute_entropy_variables_batch(soln_at_q, entropy_var_at_q);
         for(int istate=0; istate<nstate; istate++){
-            entropy_var_at_q[istate].resize(n_quad_pts);
-            projected_entropy_var_at_q[istate].resize(n_quad_pts);
-        }
-        for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
-            std::array<real,nstate> soln_state;
-            for(int istate=0; istate<nstate; istate++){
-                soln_state[istate] = soln_at_q[istate][iquad];
-            }
-            std::array<real,nstate> entropy_var;
-            entropy_var = this->pde_physics_double->compute_entropy_variables(soln_state);
-            for(int istate=0; istate<nstate; istate++){
-                entropy_var_at_q[istate][iquad] = entropy_var[istate];
-            }
-        }
-        for(int istate=0; istate<nstate; istate++){
-            std::vector<real> entropy_var_coeff(n_shape_fns);;
-            soln_basis_projection_oper.matrix_vector_mult_1D(entropy_var_at_q[istate],
-                                                             entropy_var_coeff,
-                                                             soln_basis_projection_oper.oneD_vol_operator);
-            soln_basis.matrix_vector_mult_1D(entropy_var_coeff,
-                                             projected_entropy_var_at_q[istate],
-                                             soln_basis.oneD_vol_operator);
+            std::vector<adtype> &entropy_var_coeff = scratch_arena.vector(n_shape_fns);
+            ADOperator::matrix_vector_mult_1D(soln_basis_projection_oper, entropy_var_at_q[istate],
+                                              entropy_var_coeff,
+                                              soln_basis_projection_oper.oneD_vol_operator);
+            ADOperator::matrix_vector_mult_1D(soln_basis, entropy_var_coeff,
+                                              projected_entropy_var_at_q[istate],
+                                              soln_basis.oneD_vol_operator);
         }
     }
 
@@ -1009,40 +2272,59 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_strong(
     //From the paper: Cicchino, Alexander, et al. "Provably stable flux reconstruction high-order methods on curvilinear elements." Journal of Computational Physics 463 (2022): 111259.
     //For conservative DG, we compute the reference flux as per Eq. (9), to then recover the second volume integral in Eq. (17).
     //For curvilinear split-form in Eq. (22), we apply a two-pt flux of the metric-cofactor matrix on the matrix operator constructed by the entropy stable/conservtive 2pt flux.
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> conv_ref_flux_at_q;
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> diffusive_ref_flux_at_q;
-    std::array<std::vector<real>,nstate> source_at_q;
-    std::array<std::vector<real>,nstate> physical_source_at_q;
-
-    // The matrix of two-pt fluxes for Hadamard products
-    std::array<std::array<dealii::FullMatrix<real>,dim>,nstate> conv_ref_2pt_flux_at_q;
-    //Hadamard tensor-product sparsity pattern
-    std::vector<std::array<unsigned int,dim>> Hadamard_rows_sparsity(n_quad_pts * n_quad_pts_1D);//size n^{d+1}
-    std::vector<std::array<unsigned int,dim>> Hadamard_columns_sparsity(n_quad_pts * n_quad_pts_1D);
-    //allocate reference 2pt flux for Hadamard product
-    if (this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
-        for(int istate=0; istate<nstate; istate++){
-            for(int idim=0; idim<dim; idim++){
-                conv_ref_2pt_flux_at_q[istate][idim].reinit(n_quad_pts, n_quad_pts_1D);//size n^d x n
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &conv_ref_flux_at_q = scratch_arena.state_tensor_vectors(n_quad_pts);
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &diffusive_ref_flux_at_q = scratch_arena.state_tensor_vectors(n_quad_pts);
+    const bool use_manufactured_source = this->all_parameters->manufactured_convergence_study_param.manufactured_solution_param.use_manufactured_source_term;
+    std::array<std::vector<adtype>,nstate> &source_at_q = scratch_arena.state_vectors(use_manufactured_source ? n_quad_pts : 0);
+    std::array<std::vector<adtype>,nstate> &physical_source_at_q = scratch_arena.state_vectors(physics.has_nonzero_physical_source ? n_quad_pts : 0);
+
+    // The matrix of two-pt fluxes for Hadamard products, size n^d x n
+    std::array<std::array<dealii::FullMatrix<adtype>,dim>,nstate> &conv_ref_2pt_flux_at_q = scratch_arena.state_dim_matrices(n_quad_pts_split, n_quad_pts_1D);
+    //Hadamard tensor-product sparsity pattern, the dof pairs that give non-zero entries for each direction
+    //to use the "sum-factorized" Hadamard product. Built with the flux basis stiffness operator for the current degree.
+    const std::vector<std::array<unsigned int,dim>> &Hadamard_rows_sparsity = flux_basis_stiffness.Hadamard_rows_sparsity;//size n^{d+1}
+    const std::vector<std::array<unsigned int,dim>> &Hadamard_columns_sparsity = flux_basis_stiffness.Hadamard_columns_sparsity;
+    if (use_split_form){
+        AssertDimension(Hadamard_rows_sparsity.size(), n_quad_pts * n_quad_pts_1D);
+    }
+
+    //For split forms, the conservative variables from the projected entropy variables are evaluated once per flux node,
+    //and the two-point fluxes of a row of the Hadamard product, that is with the n_quad_pts_1D flux nodes in each reference direction,
+    //are evaluated by the physics in a single batch.
+    std::array<std::vector<adtype>,nstate> &soln_from_entropy_var_at_q = scratch_arena.state_vectors(n_quad_pts_split);
+    std::array<std::vector<adtype>,nstate> &soln_2pt_row = scratch_arena.state_vectors(use_split_form ? dim * n_quad_pts_1D : 0);
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &conv_phys_flux_2pt_row = scratch_arena.state_tensor_vectors(use_split_form ? dim * n_quad_pts_1D : 0);
+    if (use_split_form){
+        for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
+            std::array<adtype,nstate> entropy_var;
+            for(int istate=0; istate<nstate; istate++){
+                entropy_var[istate] = projected_entropy_var_at_q[istate][iquad];
+            }
+            const std::array<adtype,nstate> soln_state = physics.compute_conservative_variables_from_entropy_variables (entropy_var);
+            for(int istate=0; istate<nstate; istate++){
+                soln_from_entropy_var_at_q[istate][iquad] = soln_state[istate];
             }
         }
-        //extract the dof pairs that give non-zero entries for each direction
-        //to use the "sum-factorized" Hadamard product.
-        flux_basis.sum_factorized_Hadamard_sparsity_pattern(n_quad_pts_1D, n_quad_pts_1D, Hadamard_rows_sparsity, Hadamard_columns_sparsity);
     }
 
+    //The physical fluxes and the manufactured source are evaluated by the physics for all the flux nodes at once.
+    //For split forms, the dissipative flux and the sources use the conservative variables from the projected entropy variables.
+    const std::array<std::vector<adtype>,nstate> &soln_for_phys_at_q = use_split_form ? soln_from_entropy_var_at_q : soln_at_q;
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &conv_phys_flux_at_q = scratch_arena.state_tensor_vectors(use_split_form ? 0 : n_quad_pts);
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &diffusive_phys_flux_at_q = scratch_arena.state_tensor_vectors(n_quad_pts);
+    if (!use_split_form && assemble_convective){
+        physics.convective_flux_batch(soln_at_q, conv_phys_flux_at_q);
+    }
+    if (assemble_dissipative){
+        physics.dissipative_flux_batch(soln_for_phys_at_q, aux_soln_at_q, current_cell_index, diffusive_phys_flux_at_q);
+    }
+    if (use_manufactured_source && assemble_dissipative){
+        // The flux nodes are only copied for an AD type.
+        dealii::Tensor<1,dim,std::vector<adtype>> &flux_nodes_buffer = scratch_arena.tensor_vectors(std::is_same<adtype,real>::value ? 0 : n_quad_pts);
+        physics.source_term_batch(ADOperator::flux_nodes(metric_oper.flux_nodes_vol, flux_nodes_buffer), soln_for_phys_at_q, this->current_time, current_cell_index, source_at_q);
+    }
 
     for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
-        //extract soln and auxiliary soln at quad pt to be used in physics
-        std::array<real,nstate> soln_state;
-        std::array<dealii::Tensor<1,dim,real>,nstate> aux_soln_state;
-        for(int istate=0; istate<nstate; istate++){
-            soln_state[istate] = soln_at_q[istate][iquad];
-            for(int idim=0; idim<dim; idim++){
-                aux_soln_state[istate][idim] = aux_soln_at_q[istate][idim][iquad];
-            }
-        }
-
         // Copy Metric Cofactor in a way can use for transforming Tensor Blocks to reference space
         // The way it is stored in metric_operators is to use sum-factorization in each direction,
         // but here it is cleaner to apply a reference transformation in each Tensor block returned by physics.
@@ -1053,19 +2335,17 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_strong(
             }
         }
 
-        // Evaluate physical convective flux
-        // If 2pt flux, transform to reference at construction to improve performance.
+        // Evaluate the two-point convective fluxes.
+        // Transform to reference at construction to improve performance.
         // We technically use a REFERENCE 2pt flux for all entropy stable schemes.
-        std::array<dealii::Tensor<1,dim,real>,nstate> conv_phys_flux;
-        if (this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
+        if (use_split_form && assemble_convective){
             //get the soln for iquad from projected entropy variables
-            std::array<real,nstate> entropy_var;
+            std::array<adtype,nstate> soln_state;
             for(int istate=0; istate<nstate; istate++){
-                entropy_var[istate] = projected_entropy_var_at_q[istate][iquad];
+                soln_state[istate] = soln_from_entropy_var_at_q[istate][iquad];
             }
-            soln_state = this->pde_physics_double->compute_conservative_variables_from_entropy_variables (entropy_var);
             
-            //loop over all the non-zero entries for "sum-factorized" Hadamard product that corresponds to the iquad.
+            //gather the states of all the non-zero entries for "sum-factorized" Hadamard product that corresponds to the iquad.
             for(unsigned int row_index = iquad * n_quad_pts_1D, column_index = 0; 
                // Hadamard_rows_sparsity[row_index][0] == iquad; 
                 column_index < n_quad_pts_1D; 
@@ -1076,12 +2356,28 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_strong(
                     std::abort();
                 }
 
+                for(int ref_dim=0; ref_dim<dim; ref_dim++){
+                    const unsigned int flux_quad = Hadamard_columns_sparsity[row_index][ref_dim];//extract flux_quad pt that corresponds to a non-zero entry for Hadamard product.
+                    for(int istate=0; istate<nstate; istate++){
+                        soln_2pt_row[istate][ref_dim * n_quad_pts_1D + column_index] = soln_from_entropy_var_at_q[istate][flux_quad];
+                    }
+                }
+            }
+
+            //Compute the physical fluxes of the whole row
+            physics.convective_numerical_split_flux_batch(soln_state, soln_2pt_row, conv_phys_flux_2pt_row);
+
+            for(unsigned int row_index = iquad * n_quad_pts_1D, column_index = 0; 
+                column_index < n_quad_pts_1D; 
+                row_index++, column_index++){
+
                 // Copy Metric Cofactor in a way can use for transforming Tensor Blocks to reference space
                 // The way it is stored in metric_operators is to use sum-factorization in each direction,
                 // but here it is cleaner to apply a reference transformation in each Tensor block returned by physics.
 
                 for(int ref_dim=0; ref_dim<dim; ref_dim++){
                     const unsigned int flux_quad = Hadamard_columns_sparsity[row_index][ref_dim];//extract flux_quad pt that corresponds to a non-zero entry for Hadamard product.
+                    const unsigned int row_point = ref_dim * n_quad_pts_1D + column_index;
 
                     dealii::Tensor<2,dim,real> metric_cofactor_flux_basis;
                     for(int idim=0; idim<dim; idim++){
@@ -1089,22 +2385,16 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_strong(
                             metric_cofactor_flux_basis[idim][jdim] = metric_oper.metric_cofactor_vol[idim][jdim][flux_quad];
                         }
                     }
-                    std::array<real,nstate> soln_state_flux_basis;
-                    std::array<real,nstate> entropy_var_flux_basis;
-                    for(int istate=0; istate<nstate; istate++){
-                        entropy_var_flux_basis[istate] = projected_entropy_var_at_q[istate][flux_quad];
-                    }
-                    soln_state_flux_basis = this->pde_physics_double->compute_conservative_variables_from_entropy_variables (entropy_var_flux_basis);
-
-                    //Compute the physical flux
-                    std::array<dealii::Tensor<1,dim,real>,nstate> conv_phys_flux_2pt;
-                    conv_phys_flux_2pt = this->pde_physics_double->convective_numerical_split_flux(soln_state, soln_state_flux_basis);
                      
                     for(int istate=0; istate<nstate; istate++){
-                        dealii::Tensor<1,dim,real> conv_ref_flux_2pt;
+                        dealii::Tensor<1,dim,adtype> conv_phys_flux_2pt;
+                        for(int idim=0; idim<dim; idim++){
+                            conv_phys_flux_2pt[idim] = conv_phys_flux_2pt_row[istate][idim][row_point];
+                        }
+                        dealii::Tensor<1,dim,adtype> conv_ref_flux_2pt;
                         //For each state, transform the physical flux to a reference flux.
-                        metric_oper.transform_physical_to_reference(
-                            conv_phys_flux_2pt[istate],
+                        ADOperator::transform_physical_to_reference(
+                            conv_phys_flux_2pt,
                             0.5*(metric_cofactor + metric_cofactor_flux_basis),
                             conv_ref_flux_2pt);
                         //write into reference Hadamard flux matrix
@@ -1113,74 +2403,69 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_strong(
                 }
             }
         }
-        else{
-            //Compute the physical flux
-            conv_phys_flux = this->pde_physics_double->convective_flux (soln_state);
-        }
-
-        //Diffusion
-        std::array<dealii::Tensor<1,dim,real>,nstate> diffusive_phys_flux;
-        //Compute the physical dissipative flux
-        diffusive_phys_flux = this->pde_physics_double->dissipative_flux(soln_state, aux_soln_state, current_cell_index);
-
-        // Manufactured source
-        std::array<real,nstate> manufactured_source;
-        if(this->all_parameters->manufactured_convergence_study_param.manufactured_solution_param.use_manufactured_source_term) {
-            dealii::Point<dim,real> vol_flux_node;
-            for(int idim=0; idim<dim; idim++){
-                vol_flux_node[idim] = metric_oper.flux_nodes_vol[idim][iquad];
-            }
-            //compute the manufactured source
-            manufactured_source = this->pde_physics_double->source_term (vol_flux_node, soln_state, this->current_time, current_cell_index);
-        }
 
         // Physical source
-        std::array<real,nstate> physical_source;
-        if(this->pde_physics_double->has_nonzero_physical_source) {
-            dealii::Point<dim,real> vol_flux_node;
+        if(physics.has_nonzero_physical_source && assemble_dissipative) {
+            std::array<adtype,nstate> soln_state;
+            std::array<dealii::Tensor<1,dim,adtype>,nstate> aux_soln_state;
+            for(int istate=0; istate<nstate; istate++){
+                soln_state[istate] = soln_for_phys_at_q[istate][iquad];
+                for(int idim=0; idim<dim; idim++){
+                    aux_soln_state[istate][idim] = aux_soln_at_q[istate][idim][iquad];
+                }
+            }
+            dealii::Point<dim,adtype> vol_flux_node;
             for(int idim=0; idim<dim; idim++){
                 vol_flux_node[idim] = metric_oper.flux_nodes_vol[idim][iquad];
             }
             //compute the physical source
-            physical_source = this->pde_physics_double->physical_source_term (vol_flux_node, soln_state, aux_soln_state, current_cell_index);
+            const std::array<adtype,nstate> physical_source = physics.physical_source_term (vol_flux_node, soln_state, aux_soln_state, current_cell_index);
+            for(int istate=0; istate<nstate; istate++){
+                physical_source_at_q[istate][iquad] = physical_source[istate];
+            }
         }
 
         //Write the values in a way that we can use sum-factorization on.
         for(int istate=0; istate<nstate; istate++){
-            dealii::Tensor<1,dim,real> conv_ref_flux;
-            dealii::Tensor<1,dim,real> diffusive_ref_flux;
+            dealii::Tensor<1,dim,adtype> conv_phys_flux;
+            dealii::Tensor<1,dim,adtype> diffusive_phys_flux;
+            for(int idim=0; idim<dim; idim++){
+                if (!use_split_form){
+                    conv_phys_flux[idim] = conv_phys_flux_at_q[istate][idim][iquad];
+                }
+                diffusive_phys_flux[idim] = diffusive_phys_flux_at_q[istate][idim][iquad];
+            }
+            dealii::Tensor<1,dim,adtype> conv_ref_flux;
+            dealii::Tensor<1,dim,adtype> diffusive_ref_flux;
             //Trnasform to reference fluxes
-            if (this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
+            if (use_split_form){
                 //Do Nothing. 
                 //I am leaving this block here so the diligent reader
                 //remembers that, for entropy stable schemes, we construct
                 //a REFERENCE two-point flux at construction, where the physical
                 //to reference transformation was done by splitting the metric cofactor.
             }
-            else{
+            else if (assemble_convective){
                 //transform the conservative convective physical flux to reference space
-                metric_oper.transform_physical_to_reference(
-                    conv_phys_flux[istate],
+                ADOperator::transform_physical_to_reference(
+                    conv_phys_flux,
                     metric_cofactor,
                     conv_ref_flux);
             }
             //transform the dissipative flux to reference space
-            metric_oper.transform_physical_to_reference(
-                diffusive_phys_flux[istate],
-                metric_cofactor,
-                diffusive_ref_flux);
+            if (assemble_dissipative){
+                ADOperator::transform_physical_to_reference(
+                    diffusive_phys_flux,
+                    metric_cofactor,
+                    diffusive_ref_flux);
+            }
 
             //Write the data in a way that we can use sum-factorization on.
             //Since sum-factorization improves the speed for matrix-vector multiplications,
             //We need the values to have their inner elements be vectors.
             for(int idim=0; idim<dim; idim++){
-                //allocate
-                if(iquad == 0){
-                    conv_ref_flux_at_q[istate][idim].resize(n_quad_pts);
-                    diffusive_ref_flux_at_q[istate][idim].resize(n_quad_pts);
-                }
                 //write data
-                if (this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
+                if (use_split_form){
                     //Do nothing because written in a Hadamard product sum-factorized form above.
                 }
                 else{
@@ -1189,33 +2474,11 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_strong(
 
                 diffusive_ref_flux_at_q[istate][idim][iquad] = diffusive_ref_flux[idim];
             }
-            if(this->all_parameters->manufactured_convergence_study_param.manufactured_solution_param.use_manufactured_source_term) {
-                if(iquad == 0){
-                    source_at_q[istate].resize(n_quad_pts);
-                }
-                source_at_q[istate][iquad] = manufactured_source[istate];
-            }
-            if(this->pde_physics_double->has_nonzero_physical_source) {
-                if(iquad == 0){
-                    physical_source_at_q[istate].resize(n_quad_pts);
-                }
-                physical_source_at_q[istate][iquad] = physical_source[istate];
-            }
         }
     }
 
     // Get a flux basis reference gradient operator in a sum-factorized Hadamard product sparse form. Then apply the divergence.
-    std::array<dealii::FullMatrix<real>,dim> flux_basis_stiffness_skew_symm_oper_sparse;
-    if (this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
-        for(int idim=0; idim<dim; idim++){
-            flux_basis_stiffness_skew_symm_oper_sparse[idim].reinit(n_quad_pts, n_quad_pts_1D);
-        }
-        flux_basis.sum_factorized_Hadamard_basis_assembly(n_quad_pts_1D, n_quad_pts_1D, 
-                                                          Hadamard_rows_sparsity, Hadamard_columns_sparsity,
-                                                          flux_basis_stiffness.oneD_skew_symm_vol_oper, 
-                                                          oneD_vol_quad_weights,
-                                                          flux_basis_stiffness_skew_symm_oper_sparse);
-    }
+    const std::array<dealii::FullMatrix<double>,dim> &flux_basis_stiffness_skew_symm_oper_sparse = flux_basis_stiffness.skew_symm_vol_oper_Hadamard_sparse;
 
     //For each state we:
     //  1. Compute reference divergence.
@@ -1223,18 +2486,21 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_strong(
     for(int istate=0; istate<nstate; istate++){
 
         //Compute reference divergence of the reference fluxes.
-        std::vector<real> conv_flux_divergence(n_quad_pts); 
-        std::vector<real> diffusive_flux_divergence(n_quad_pts); 
+        std::vector<adtype> &conv_flux_divergence = scratch_arena.vector(n_quad_pts); 
+        std::vector<adtype> &diffusive_flux_divergence = scratch_arena.vector(n_quad_pts); 
 
-        if (this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
+        if (!assemble_convective){
+            //The convective terms are not assembled.
+        }
+        else if (this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
             //2pt flux Hadamard Product, and then multiply by vector of ones scaled by 1.
             // Same as the volume term in Eq. (15) in Chan, Jesse. "Skew-symmetric entropy stable modal discontinuous Galerkin formulations." Journal of Scientific Computing 81.1 (2019): 459-485. but, 
             // where we use the reference skew-symmetric stiffness operator of the flux basis for the Q operator and the reference two-point flux as to make use of Alex's Hadamard product
             // sum-factorization type algorithm that exploits the structure of the flux basis in the reference space to have O(n^{d+1}).
 
             for(int ref_dim=0; ref_dim<dim; ref_dim++){
-                dealii::FullMatrix<real> divergence_ref_flux_Hadamard_product(n_quad_pts, n_quad_pts_1D);
-                flux_basis.Hadamard_product(flux_basis_stiffness_skew_symm_oper_sparse[ref_dim], conv_ref_2pt_flux_at_q[istate][ref_dim], divergence_ref_flux_Hadamard_product); 
+                dealii::FullMatrix<adtype> &divergence_ref_flux_Hadamard_product = scratch_arena.matrix(n_quad_pts, n_quad_pts_1D);
+                ADOperator::Hadamard_product(flux_basis, flux_basis_stiffness_skew_symm_oper_sparse[ref_dim], conv_ref_2pt_flux_at_q[istate][ref_dim], divergence_ref_flux_Hadamard_product); 
                 //Hadamard product times the vector of ones.
                 for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
                     if(ref_dim == 0){
@@ -1249,14 +2515,16 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_strong(
         }
         else{
             //Reference divergence of the reference convective flux.
-            flux_basis.divergence_matrix_vector_mult_1D(conv_ref_flux_at_q[istate], conv_flux_divergence,
-                                                        flux_basis.oneD_vol_operator,
-                                                        flux_basis.oneD_grad_operator);
+            ADOperator::divergence_matrix_vector_mult_1D(flux_basis, conv_ref_flux_at_q[istate], conv_flux_divergence,
+                                                         flux_basis.oneD_vol_operator,
+                                                         flux_basis.oneD_grad_operator);
         }
         //Reference divergence of the reference diffusive flux.
-        flux_basis.divergence_matrix_vector_mult_1D(diffusive_ref_flux_at_q[istate], diffusive_flux_divergence,
-                                                    flux_basis.oneD_vol_operator,
-                                                    flux_basis.oneD_grad_operator);
+        if (assemble_dissipative){
+            ADOperator::divergence_matrix_vector_mult_1D(flux_basis, diffusive_ref_flux_at_q[istate], diffusive_flux_divergence,
+                                                         flux_basis.oneD_vol_operator,
+                                                         flux_basis.oneD_grad_operator);
+        }
 
 
         // Strong form
@@ -1267,60 +2535,72 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_strong(
         // rhs = - \divergence( Fconv + Fdiss ) + source 
         // Since we have done an integration by parts, the volume term resulting from the divergence of Fconv and Fdiss
         // is negative. Therefore, negative of negative means we add that volume term to the right-hand-side
-        std::vector<real> rhs(n_shape_fns);
+        std::vector<adtype> &rhs = scratch_arena.vector(n_shape_fns);
 
         // Convective
-        if (this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
-            std::vector<real> ones(n_quad_pts, 1.0);
-            soln_basis.inner_product_1D(conv_flux_divergence, ones, rhs, soln_basis.oneD_vol_operator, false, -1.0);
+        // The rhs is zeroed by the scratch arena, such that the terms that follow can be added to it when this one is not assembled.
+        if (!assemble_convective){
+            //The convective terms are not assembled.
+        }
+        else if (this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
+            std::vector<adtype> &ones = scratch_arena.vector(n_quad_pts, 1.0);
+            ADOperator::inner_product_1D(soln_basis, conv_flux_divergence, ones, rhs, soln_basis.oneD_vol_operator, false, -1.0);
         }
         else {
-            soln_basis.inner_product_1D(conv_flux_divergence, vol_quad_weights, rhs, soln_basis.oneD_vol_operator, false, -1.0);
+            ADOperator::inner_product_1D(soln_basis, conv_flux_divergence, vol_quad_weights, rhs, soln_basis.oneD_vol_operator, false, -1.0);
         }
 
         // Diffusive
         // Note that for diffusion, the negative is defined in the physics. Since we used the auxiliary
         // variable, put a negative here.
-        soln_basis.inner_product_1D(diffusive_flux_divergence, vol_quad_weights, rhs, soln_basis.oneD_vol_operator, true, -1.0);
+        if (assemble_dissipative){
+            ADOperator::inner_product_1D(soln_basis, diffusive_flux_divergence, vol_quad_weights, rhs, soln_basis.oneD_vol_operator, true, -1.0);
+        }
 
         // Manufactured source
-        if(this->all_parameters->manufactured_convergence_study_param.manufactured_solution_param.use_manufactured_source_term) {
-            std::vector<real> JxW(n_quad_pts);
+        if(use_manufactured_source && assemble_dissipative) {
+            std::vector<adtype> &JxW = scratch_arena.vector(n_quad_pts);
             for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
                 JxW[iquad] = vol_quad_weights[iquad] * metric_oper.det_Jac_vol[iquad];
             }
-            soln_basis.inner_product_1D(source_at_q[istate], JxW, rhs, soln_basis.oneD_vol_operator, true, 1.0);
+            ADOperator::inner_product_1D(soln_basis, source_at_q[istate], JxW, rhs, soln_basis.oneD_vol_operator, true, 1.0);
         }
 
         // Physical source
-        if(this->pde_physics_double->has_nonzero_physical_source) {
-            std::vector<real> JxW(n_quad_pts);
+        if(physics.has_nonzero_physical_source && assemble_dissipative) {
+            std::vector<adtype> &JxW = scratch_arena.vector(n_quad_pts);
             for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
                 JxW[iquad] = vol_quad_weights[iquad] * metric_oper.det_Jac_vol[iquad];
             }
-            soln_basis.inner_product_1D(physical_source_at_q[istate], JxW, rhs, soln_basis.oneD_vol_operator, true, 1.0);
+            ADOperator::inner_product_1D(soln_basis, physical_source_at_q[istate], JxW, rhs, soln_basis.oneD_vol_operator, true, 1.0);
         }
 
         for(unsigned int ishape=0; ishape<n_shape_fns; ishape++){
-            local_rhs_int_cell(istate*n_shape_fns + ishape) += rhs[ishape];
+            local_rhs_int_cell[istate*n_shape_fns + ishape] += rhs[ishape];
         }
 
     }
 }
 
 template <int dim, int nstate, typename real, typename MeshType>
+template <typename adtype>
 void DGStrong<dim,nstate,real,MeshType>::assemble_boundary_term_strong(
     const unsigned int iface, 
     const dealii::types::global_dof_index current_cell_index,
     const unsigned int boundary_id,
     const unsigned int poly_degree, 
     const real penalty,
-    const std::vector<dealii::types::global_dof_index> &dof_indices,
+    const std::array<std::vector<adtype>,nstate> &soln_coeff,
+    const std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &aux_soln_coeff,
     OPERATOR::basis_functions<dim,2*dim,real> &soln_basis,
     OPERATOR::basis_functions<dim,2*dim,real> &flux_basis,
     OPERATOR::vol_projection_operator<dim,2*dim,real> &soln_basis_projection_oper,
     OPERATOR::metric_operators<real,dim,2*dim> &metric_oper,
-    dealii::Vector<real> &local_rhs_cell)
+    Physics::PhysicsBase<dim,nstate,adtype> &physics,
+    NumericalFlux::NumericalFluxConvective<dim,nstate,adtype> &conv_num_flux,
+    NumericalFlux::NumericalFluxDissipative<dim,nstate,adtype> &diss_num_flux,
+    StrongDGScratchArena<dim,nstate,adtype> &scratch_arena,
+    LocalResidual<adtype> &local_rhs_cell)
 {
     (void) current_cell_index;
 
@@ -1331,81 +2611,60 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_boundary_term_strong(
     const unsigned int n_shape_fns = n_dofs / nstate; 
     const std::vector<double> &face_quad_weights = this->face_quadrature_collection[poly_degree].get_weights();
 
-    AssertDimension (n_dofs, dof_indices.size());
+    AssertDimension (n_shape_fns, soln_coeff[0].size());
+
+    // All the temporaries below are taken from the scratch arena, already sized and zeroed.
+    const bool use_split_form = this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form;
 
-    // Fetch the modal soln coefficients and the modal auxiliary soln coefficients
-    // We immediately separate them by state as to be able to use sum-factorization
-    // in the interpolation operator. If we left it by n_dofs_cell, then the matrix-vector
-    // mult would sum the states at the quadrature point.
-    std::array<std::vector<real>,nstate> soln_coeff;
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> aux_soln_coeff;
-    for (unsigned int idof = 0; idof < n_dofs; ++idof) {
-        const unsigned int istate = this->fe_collection[poly_degree].system_to_component_index(idof).first;
-        const unsigned int ishape = this->fe_collection[poly_degree].system_to_component_index(idof).second;
-        // allocate
-        if(ishape == 0){
-            soln_coeff[istate].resize(n_shape_fns);
-        }
-        // solve
-        soln_coeff[istate][ishape] = DGBase<dim,real,MeshType>::solution(dof_indices[idof]);
-        for(int idim=0; idim<dim; idim++){
-            //allocate
-            if(ishape == 0){
-                aux_soln_coeff[istate][idim].resize(n_shape_fns);
-            }
-            //solve
-            if(this->use_auxiliary_eq){
-                aux_soln_coeff[istate][idim][ishape] = DGBase<dim,real,MeshType>::auxiliary_solution[idim](dof_indices[idof]);
-            }
-            else{
-                aux_soln_coeff[istate][idim][ishape] = 0.0;
-            }
-        }
-    }
     // Interpolate the modal coefficients to the volume cubature nodes.
-    std::array<std::vector<real>,nstate> soln_at_vol_q;
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> aux_soln_at_vol_q;
+    std::array<std::vector<adtype>,nstate> &soln_at_vol_q = scratch_arena.state_vectors(n_quad_pts_vol);
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &aux_soln_at_vol_q = scratch_arena.state_tensor_vectors(n_quad_pts_vol);
     // Interpolate modal soln coefficients to the facet.
-    std::array<std::vector<real>,nstate> soln_at_surf_q;
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> aux_soln_at_surf_q;
+    std::array<std::vector<adtype>,nstate> &soln_at_surf_q = scratch_arena.state_vectors(n_face_quad_pts);
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &aux_soln_at_surf_q = scratch_arena.state_tensor_vectors(n_face_quad_pts);
     for(int istate=0; istate<nstate; ++istate){
-        //allocate
-        soln_at_vol_q[istate].resize(n_quad_pts_vol);
         //solve soln at volume cubature nodes
-        soln_basis.matrix_vector_mult_1D(soln_coeff[istate], soln_at_vol_q[istate],
-                                         soln_basis.oneD_vol_operator);
+        ADOperator::matrix_vector_mult_1D(soln_basis, soln_coeff[istate], soln_at_vol_q[istate],
+                                          soln_basis.oneD_vol_operator);
 
-        //allocate
-        soln_at_surf_q[istate].resize(n_face_quad_pts);
         //solve soln at facet cubature nodes
-        soln_basis.matrix_vector_mult_surface_1D(iface,
-                                                 soln_coeff[istate], soln_at_surf_q[istate],
-                                                 soln_basis.oneD_surf_operator,
-                                                 soln_basis.oneD_vol_operator);
+        ADOperator::matrix_vector_mult_surface_1D(soln_basis, iface,
+                                                  soln_coeff[istate], soln_at_surf_q[istate],
+                                                  soln_basis.oneD_surf_operator,
+                                                  soln_basis.oneD_vol_operator);
 
         for(int idim=0; idim<dim; idim++){
-            //alocate
-            aux_soln_at_vol_q[istate][idim].resize(n_quad_pts_vol);
             //solve auxiliary soln at volume cubature nodes
-            soln_basis.matrix_vector_mult_1D(aux_soln_coeff[istate][idim], aux_soln_at_vol_q[istate][idim],
-                                             soln_basis.oneD_vol_operator);
+            ADOperator::matrix_vector_mult_1D(soln_basis, aux_soln_coeff[istate][idim], aux_soln_at_vol_q[istate][idim],
+                                              soln_basis.oneD_vol_operator);
 
-            //allocate
-            aux_soln_at_surf_q[istate][idim].resize(n_face_quad_pts);
             //solve auxiliary soln at facet cubature nodes
-            soln_basis.matrix_vector_mult_surface_1D(iface,
-                                                     aux_soln_coeff[istate][idim], aux_soln_at_surf_q[istate][idim],
-                                                     soln_basis.oneD_surf_operator,
-                                                     soln_basis.oneD_vol_operator);
+            ADOperator::matrix_vector_mult_surface_1D(soln_basis, iface,
+                                                      aux_soln_coeff[istate][idim], aux_soln_at_surf_q[istate][idim],
+                                                      soln_basis.oneD_surf_operator,
+                                                      soln_basis.oneD_vol_operator);
         }
     }
 
+    // Parts of the residual assembled, see DGBase::set_residual_part().
+    const bool assemble_convective = this->assembles_convective_terms();
+    const bool assemble_dissipative = this->assembles_dissipative_terms();
+
     // Get volume reference fluxes and interpolate them to the facet.
     // Compute reference volume fluxes in both interior and exterior cells.
 
     // First we do interior.
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> conv_ref_flux_at_vol_q;
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> diffusive_ref_flux_at_vol_q;
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &conv_ref_flux_at_vol_q = scratch_arena.state_tensor_vectors(n_quad_pts_vol);
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &diffusive_ref_flux_at_vol_q = scratch_arena.state_tensor_vectors(n_quad_pts_vol);
+    // Evaluate the physical fluxes of all the volume cubature nodes at once.
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &conv_phys_flux_at_vol_q = scratch_arena.state_tensor_vectors(use_split_form ? 0 : n_quad_pts_vol);
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &diffusive_phys_flux_at_vol_q = scratch_arena.state_tensor_vectors(n_quad_pts_vol);
+    if(!use_split_form && assemble_convective){
+        physics.convective_flux_batch(soln_at_vol_q, conv_phys_flux_at_vol_q);
+    }
+    if(assemble_dissipative){
+        physics.dissipative_flux_batch(soln_at_vol_q, aux_soln_at_vol_q, current_cell_index, diffusive_phys_flux_at_vol_q);
+    }
     for (unsigned int iquad=0; iquad<n_quad_pts_vol; ++iquad) {
         // Copy Metric Cofactor in a way can use for transforming Tensor Blocks to reference space
         // The way it is stored in metric_operators is to use sum-factorization in each direction,
@@ -1416,51 +2675,38 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_boundary_term_strong(
                 metric_cofactor_vol[idim][jdim] = metric_oper.metric_cofactor_vol[idim][jdim][iquad];
             }
         }
-        std::array<real,nstate> soln_state;
-        std::array<dealii::Tensor<1,dim,real>,nstate> aux_soln_state;
-        for(int istate=0; istate<nstate; istate++){
-            soln_state[istate] = soln_at_vol_q[istate][iquad];
-            for(int idim=0; idim<dim; idim++){
-                aux_soln_state[istate][idim] = aux_soln_at_vol_q[istate][idim][iquad];
-            }
-        }
-
-        // Evaluate physical convective flux
-        std::array<dealii::Tensor<1,dim,real>,nstate> conv_phys_flux;
-        if(!this->all_parameters->use_split_form && !this->all_parameters->use_curvilinear_split_form){
-            conv_phys_flux = this->pde_physics_double->convective_flux (soln_state);
-        }
-
-        // Compute the physical dissipative flux
-        std::array<dealii::Tensor<1,dim,real>,nstate> diffusive_phys_flux;
-        diffusive_phys_flux = this->pde_physics_double->dissipative_flux(soln_state, aux_soln_state, current_cell_index);
 
         // Write the values in a way that we can use sum-factorization on.
         for(int istate=0; istate<nstate; istate++){
-            dealii::Tensor<1,dim,real> conv_ref_flux;
-            dealii::Tensor<1,dim,real> diffusive_ref_flux;
+            dealii::Tensor<1,dim,adtype> conv_phys_flux;
+            dealii::Tensor<1,dim,adtype> diffusive_phys_flux;
+            for(int idim=0; idim<dim; idim++){
+                if(!use_split_form){
+                    conv_phys_flux[idim] = conv_phys_flux_at_vol_q[istate][idim][iquad];
+                }
+                diffusive_phys_flux[idim] = diffusive_phys_flux_at_vol_q[istate][idim][iquad];
+            }
+            dealii::Tensor<1,dim,adtype> conv_ref_flux;
+            dealii::Tensor<1,dim,adtype> diffusive_ref_flux;
             // transform the conservative convective physical flux to reference space
-            if(!this->all_parameters->use_split_form && !this->all_parameters->use_curvilinear_split_form){
-                metric_oper.transform_physical_to_reference(
-                    conv_phys_flux[istate],
+            if(!use_split_form && assemble_convective){
+                ADOperator::transform_physical_to_reference(
+                    conv_phys_flux,
                     metric_cofactor_vol,
                     conv_ref_flux);
             }
             // transform the dissipative flux to reference space
-            metric_oper.transform_physical_to_reference(
-                diffusive_phys_flux[istate],
-                metric_cofactor_vol,
-                diffusive_ref_flux);
+            if(assemble_dissipative){
+                ADOperator::transform_physical_to_reference(
+                    diffusive_phys_flux,
+                    metric_cofactor_vol,
+                    diffusive_ref_flux);
+            }
 
             // Write the data in a way that we can use sum-factorization on.
             // Since sum-factorization improves the speed for matrix-vector multiplications,
             // We need the values to have their inner elements be vectors.
             for(int idim=0; idim<dim; idim++){
-                //allocate
-                if(iquad == 0){
-                    conv_ref_flux_at_vol_q[istate][idim].resize(n_quad_pts_vol);
-                    diffusive_ref_flux_at_vol_q[istate][idim].resize(n_quad_pts_vol);
-                }
                 //write data
                 if(!this->all_parameters->use_split_form && !this->all_parameters->use_curvilinear_split_form){
                     conv_ref_flux_at_vol_q[istate][idim][iquad] = conv_ref_flux[idim];
@@ -1479,33 +2725,31 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_boundary_term_strong(
     const dealii::Tensor<1,dim,double> unit_ref_normal_int = dealii::GeometryInfo<dim>::unit_normal_vector[iface];
     const int dim_not_zero = iface / 2;//reference direction of face integer division
 
-    std::array<std::vector<real>,nstate> conv_int_vol_ref_flux_interp_to_face_dot_ref_normal;
-    std::array<std::vector<real>,nstate> diffusive_int_vol_ref_flux_interp_to_face_dot_ref_normal;
+    std::array<std::vector<adtype>,nstate> &conv_int_vol_ref_flux_interp_to_face_dot_ref_normal = scratch_arena.state_vectors(n_face_quad_pts);
+    std::array<std::vector<adtype>,nstate> &diffusive_int_vol_ref_flux_interp_to_face_dot_ref_normal = scratch_arena.state_vectors(n_face_quad_pts);
     for(int istate=0; istate<nstate; istate++){
-        //allocate
-        conv_int_vol_ref_flux_interp_to_face_dot_ref_normal[istate].resize(n_face_quad_pts);
-        diffusive_int_vol_ref_flux_interp_to_face_dot_ref_normal[istate].resize(n_face_quad_pts);
-
         //solve
         //Note, since the normal is zero in all other reference directions, we only have to interpolate one given reference direction to the facet
 
         //interpolate reference volume convective flux to the facet, and apply unit reference normal as scaled by 1.0 or -1.0
-        if(!this->all_parameters->use_split_form && !this->all_parameters->use_curvilinear_split_form){
-            flux_basis.matrix_vector_mult_surface_1D(iface, 
-                                                     conv_ref_flux_at_vol_q[istate][dim_not_zero],
-                                                     conv_int_vol_ref_flux_interp_to_face_dot_ref_normal[istate],
-                                                     flux_basis.oneD_surf_operator,//the flux basis interpolates from the flux nodes
-                                                     flux_basis.oneD_vol_operator,
-                                                     false, unit_ref_normal_int[dim_not_zero]);//don't add to previous value, scale by unit_normal int
+        if(!use_split_form && assemble_convective){
+            ADOperator::matrix_vector_mult_surface_1D(flux_basis, iface, 
+                                                      conv_ref_flux_at_vol_q[istate][dim_not_zero],
+                                                      conv_int_vol_ref_flux_interp_to_face_dot_ref_normal[istate],
+                                                      flux_basis.oneD_surf_operator,//the flux basis interpolates from the flux nodes
+                                                      flux_basis.oneD_vol_operator,
+                                                      false, unit_ref_normal_int[dim_not_zero]);//don't add to previous value, scale by unit_normal int
         }
 
         //interpolate reference volume dissipative flux to the facet, and apply unit reference normal as scaled by 1.0 or -1.0
-        flux_basis.matrix_vector_mult_surface_1D(iface, 
-                                                 diffusive_ref_flux_at_vol_q[istate][dim_not_zero],
-                                                 diffusive_int_vol_ref_flux_interp_to_face_dot_ref_normal[istate],
-                                                 flux_basis.oneD_surf_operator,
-                                                 flux_basis.oneD_vol_operator,
-                                                 false, unit_ref_normal_int[dim_not_zero]);
+        if(assemble_dissipative){
+            ADOperator::matrix_vector_mult_surface_1D(flux_basis, iface, 
+                                                      diffusive_ref_flux_at_vol_q[istate][dim_not_zero],
+                                                      diffusive_int_vol_ref_flux_interp_to_face_dot_ref_normal[istate],
+                                                      flux_basis.oneD_surf_operator,
+                                                      flux_basis.oneD_vol_operator,
+                                                      false, unit_ref_normal_int[dim_not_zero]);
+        }
     }
 
     //Note that for entropy-dissipation and entropy stability, the conservative variables
@@ -1515,62 +2759,56 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_boundary_term_strong(
     //pages 355 (Eq. 57 with text around it) and  page 359 (Eq 86 and text below it).
 
     // First, transform the volume conservative solution at volume cubature nodes to entropy variables.
-    std::array<std::vector<real>,nstate> entropy_var_vol;
-    for(unsigned int iquad=0; iquad<n_quad_pts_vol; iquad++){
-        std::array<real,nstate> soln_state;
-        for(int istate=0; istate<nstate; istate++){
-            soln_state[istate] = soln_at_vol_q[istate][iquad];
-        }
-        std::array<real,nstate> entropy_var;
-        entropy_var = this->pde_physics_double->compute_entropy_variables(soln_state);
-        for(int istate=0; istate<nstate; istate++){
-            if(iquad==0){
-                entropy_var_vol[istate].resize(n_quad_pts_vol);
-            }
-            entropy_var_vol[istate][iquad] = entropy_var[istate];
-        }
-    }
+    std::array<std::vector<adtype>,nstate> &entropy_var_vol = scratch_arena.state_vectors(n_quad_pts_vol);
+    physics.compute_entropy_variables_batch(soln_at_vol_q, entropy_var_vol);
 
     //project it onto the solution basis functions and interpolate it
-    std::array<std::vector<real>,nstate> projected_entropy_var_vol;
-    std::array<std::vector<real>,nstate> projected_entropy_var_surf;
+    std::array<std::vector<adtype>,nstate> &projected_entropy_var_vol = scratch_arena.state_vectors(n_quad_pts_vol);
+    std::array<std::vector<adtype>,nstate> &projected_entropy_var_surf = scratch_arena.state_vectors(n_face_quad_pts);
     for(int istate=0; istate<nstate; istate++){
-        // allocate
-        projected_entropy_var_vol[istate].resize(n_quad_pts_vol);
-        projected_entropy_var_surf[istate].resize(n_face_quad_pts);
-
         //interior
-        std::vector<real> entropy_var_coeff(n_shape_fns);
-        soln_basis_projection_oper.matrix_vector_mult_1D(entropy_var_vol[istate],
-                                                         entropy_var_coeff,
-                                                         soln_basis_projection_oper.oneD_vol_operator);
-        soln_basis.matrix_vector_mult_1D(entropy_var_coeff,
-                                         projected_entropy_var_vol[istate],
-                                         soln_basis.oneD_vol_operator);
-        soln_basis.matrix_vector_mult_surface_1D(iface,
-                                                 entropy_var_coeff, 
-                                                 projected_entropy_var_surf[istate],
-                                                 soln_basis.oneD_surf_operator,
-                                                 soln_basis.oneD_vol_operator);
+        std::vector<adtype> &entropy_var_coeff = scratch_arena.vector(n_shape_fns);
+        ADOperator::matrix_vector_mult_1D(soln_basis_projection_oper, entropy_var_vol[istate],
+                                          entropy_var_coeff,
+                                          soln_basis_projection_oper.oneD_vol_operator);
+        ADOperator::matrix_vector_mult_1D(soln_basis, entropy_var_coeff,
+                                          projected_entropy_var_vol[istate],
+                                          soln_basis.oneD_vol_operator);
+        ADOperator::matrix_vector_mult_surface_1D(soln_basis, iface,
+                                                  entropy_var_coeff, 
+                                                  projected_entropy_var_surf[istate],
+                                                  soln_basis.oneD_surf_operator,
+                                                  soln_basis.oneD_vol_operator);
     }
 
     //get the surface-volume sparsity pattern for a "sum-factorized" Hadamard product only computing terms needed for the operation.
-    const unsigned int row_size = n_face_quad_pts * n_quad_pts_1D;
-    const unsigned int col_size = n_face_quad_pts * n_quad_pts_1D;
-    std::vector<unsigned int> Hadamard_rows_sparsity(row_size);
-    std::vector<unsigned int> Hadamard_columns_sparsity(col_size);
-    if(this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
-        flux_basis.sum_factorized_Hadamard_surface_sparsity_pattern(n_face_quad_pts, n_quad_pts_1D, Hadamard_rows_sparsity, Hadamard_columns_sparsity, dim_not_zero);
+    //Built with the flux basis for the current degree.
+    const std::vector<unsigned int> &Hadamard_rows_sparsity = flux_basis.surf_Hadamard_rows_sparsity[iface];
+    const std::vector<unsigned int> &Hadamard_columns_sparsity = flux_basis.surf_Hadamard_columns_sparsity[iface];
+    if(use_split_form){
+        AssertDimension(Hadamard_rows_sparsity.size(), n_face_quad_pts * n_quad_pts_1D);
     }
 
-    std::array<std::vector<real>,nstate> surf_vol_ref_2pt_flux_interp_surf;
-    std::array<std::vector<real>,nstate> surf_vol_ref_2pt_flux_interp_vol;
-    if(this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
+    std::array<std::vector<adtype>,nstate> &surf_vol_ref_2pt_flux_interp_surf = scratch_arena.state_vectors(use_split_form ? n_face_quad_pts : 0);
+    std::array<std::vector<adtype>,nstate> &surf_vol_ref_2pt_flux_interp_vol = scratch_arena.state_vectors(use_split_form ? n_quad_pts_vol : 0);
+    if(use_split_form && assemble_convective){
         //get surface-volume hybrid 2pt flux from Eq.(15) in Chan, Jesse. "Skew-symmetric entropy stable modal discontinuous Galerkin formulations." Journal of Scientific Computing 81.1 (2019): 459-485.
-        std::array<dealii::FullMatrix<real>,nstate> surface_ref_2pt_flux;
         //make use of the sparsity pattern from above to assemble only n^d non-zero entries without ever allocating not computing zeros.
-        for(int istate=0; istate<nstate; istate++){
-            surface_ref_2pt_flux[istate].reinit(n_face_quad_pts, n_quad_pts_1D);
+        std::array<dealii::FullMatrix<adtype>,nstate> &surface_ref_2pt_flux = scratch_arena.state_matrices(n_face_quad_pts, n_quad_pts_1D);
+        //the conservative values at the volume nodes from the projected entropy variables,
+        //and the two-point fluxes of a row of the Hadamard product evaluated by the physics in a single batch.
+        std::array<std::vector<adtype>,nstate> &soln_from_entropy_var_vol = scratch_arena.state_vectors(n_quad_pts_vol);
+        std::array<std::vector<adtype>,nstate> &soln_2pt_row = scratch_arena.state_vectors(n_quad_pts_1D);
+        std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &conv_phys_flux_2pt_row = scratch_arena.state_tensor_vectors(n_quad_pts_1D);
+        for(unsigned int iquad=0; iquad<n_quad_pts_vol; iquad++){
+            std::array<adtype,nstate> entropy_var;
+            for(int istate=0; istate<nstate; istate++){
+                entropy_var[istate] = projected_entropy_var_vol[istate][iquad];
+            }
+            const std::array<adtype,nstate> soln_state = physics.compute_conservative_variables_from_entropy_variables (entropy_var);
+            for(int istate=0; istate<nstate; istate++){
+                soln_from_entropy_var_vol[istate][iquad] = soln_state[istate];
+            }
         }
         for(unsigned int iquad_face=0; iquad_face<n_face_quad_pts; iquad_face++){
             dealii::Tensor<2,dim,real> metric_cofactor_surf;
@@ -1581,12 +2819,12 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_boundary_term_strong(
             }
              
             //Compute the conservative values on the facet from the interpolated entorpy variables.
-            std::array<real,nstate> entropy_var_face;
+            std::array<adtype,nstate> entropy_var_face;
             for(int istate=0; istate<nstate; istate++){
                 entropy_var_face[istate] = projected_entropy_var_surf[istate][iquad_face];
             }
-            std::array<real,nstate> soln_state_face;
-            soln_state_face= this->pde_physics_double->compute_conservative_variables_from_entropy_variables (entropy_var_face);
+            std::array<adtype,nstate> soln_state_face;
+            soln_state_face= physics.compute_conservative_variables_from_entropy_variables (entropy_var_face);
 
             //only do the n_quad_1D vol points that give non-zero entries from Hadamard product.
             for(unsigned int row_index = iquad_face * n_quad_pts_1D, column_index = 0; 
@@ -1597,6 +2835,21 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_boundary_term_strong(
                     pcout<<"The boundary Hadamard rows sparsity pattern does not match."<<std::endl;
                     std::abort();
                 }
+                //Note that the flux basis is collocated on the volume cubature set so we don't need to evaluate the entropy variables
+                //on the volume set then transform back to the conservative variables since the flux basis volume
+                //projection is identity.
+                const unsigned int iquad_vol = Hadamard_columns_sparsity[row_index];
+                for(int istate=0; istate<nstate; istate++){
+                    soln_2pt_row[istate][column_index] = soln_from_entropy_var_vol[istate][iquad_vol];
+                }
+            }
+
+            //Compute the physical fluxes of the whole row
+            physics.convective_numerical_split_flux_batch(soln_state_face, soln_2pt_row, conv_phys_flux_2pt_row);
+
+            for(unsigned int row_index = iquad_face * n_quad_pts_1D, column_index = 0; 
+                column_index < n_quad_pts_1D;
+                row_index++, column_index++){
 
                 const unsigned int iquad_vol = Hadamard_columns_sparsity[row_index];//extract flux_quad pt that corresponds to a non-zero entry for Hadamard product.
                 // Copy Metric Cofactor in a way can use for transforming Tensor Blocks to reference space
@@ -1608,24 +2861,15 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_boundary_term_strong(
                         metric_cofactor_vol[idim][jdim] = metric_oper.metric_cofactor_vol[idim][jdim][iquad_vol];
                     }
                 }
-                std::array<real,nstate> entropy_var;
                 for(int istate=0; istate<nstate; istate++){
-                    entropy_var[istate] = projected_entropy_var_vol[istate][iquad_vol];
-                }
-                std::array<real,nstate> soln_state;
-                soln_state = this->pde_physics_double->compute_conservative_variables_from_entropy_variables (entropy_var);
-                //Note that the flux basis is collocated on the volume cubature set so we don't need to evaluate the entropy variables
-                //on the volume set then transform back to the conservative variables since the flux basis volume
-                //projection is identity.
-
-                //Compute the physical flux
-                std::array<dealii::Tensor<1,dim,real>,nstate> conv_phys_flux_2pt;
-                conv_phys_flux_2pt = this->pde_physics_double->convective_numerical_split_flux(soln_state, soln_state_face);
-                for(int istate=0; istate<nstate; istate++){
-                    dealii::Tensor<1,dim,real> conv_ref_flux_2pt;
+                    dealii::Tensor<1,dim,adtype> conv_phys_flux_2pt;
+                    for(int idim=0; idim<dim; idim++){
+                        conv_phys_flux_2pt[idim] = conv_phys_flux_2pt_row[istate][idim][column_index];
+                    }
+                    dealii::Tensor<1,dim,adtype> conv_ref_flux_2pt;
                     //For each state, transform the physical flux to a reference flux.
-                    metric_oper.transform_physical_to_reference(
-                        conv_phys_flux_2pt[istate],
+                    ADOperator::transform_physical_to_reference(
+                        conv_phys_flux_2pt,
                         0.5*(metric_cofactor_surf + metric_cofactor_vol),
                         conv_ref_flux_2pt);
                     //only store the dim not zero in reference space bc dot product with unit ref normal later.
@@ -1635,29 +2879,18 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_boundary_term_strong(
         }
         //get the surface basis operator from Hadamard sparsity pattern
         //to be applied at n^d operations (on the face so n^{d+1-1}=n^d flops)
-        //also only allocates n^d terms.
-        const int iface_1D = iface % 2;//the reference face number
-        const std::vector<double> &oneD_quad_weights_vol= this->oneD_quadrature_collection[poly_degree].get_weights();
-        dealii::FullMatrix<real> surf_oper_sparse(n_face_quad_pts, n_quad_pts_1D);
-        flux_basis.sum_factorized_Hadamard_surface_basis_assembly(n_face_quad_pts, n_quad_pts_1D, 
-                                                                  Hadamard_rows_sparsity, Hadamard_columns_sparsity,
-                                                                  flux_basis.oneD_surf_operator[iface_1D], 
-                                                                  oneD_quad_weights_vol,
-                                                                  surf_oper_sparse,
-                                                                  dim_not_zero);
+        //also only stores n^d terms.
+        const dealii::FullMatrix<double> &surf_oper_sparse = flux_basis.surf_oper_Hadamard_sparse[iface];
 
         // Apply the surface Hadamard products and multiply with vector of ones for both off diagonal terms in
         // Eq.(15) in Chan, Jesse. "Skew-symmetric entropy stable modal discontinuous Galerkin formulations." Journal of Scientific Computing 81.1 (2019): 459-485.
         for(int istate=0; istate<nstate; istate++){
             //first apply Hadamard product with the structure made above.
-            dealii::FullMatrix<real> surface_ref_2pt_flux_int_Hadamard_with_surf_oper(n_face_quad_pts, n_quad_pts_1D);
-            flux_basis.Hadamard_product(surf_oper_sparse, 
-                                        surface_ref_2pt_flux[istate], 
-                                        surface_ref_2pt_flux_int_Hadamard_with_surf_oper);
+            dealii::FullMatrix<adtype> &surface_ref_2pt_flux_int_Hadamard_with_surf_oper = scratch_arena.matrix(n_face_quad_pts, n_quad_pts_1D);
+            ADOperator::Hadamard_product(flux_basis, surf_oper_sparse, 
+                                         surface_ref_2pt_flux[istate], 
+                                         surface_ref_2pt_flux_int_Hadamard_with_surf_oper);
             //sum with reference unit normal
-            surf_vol_ref_2pt_flux_interp_surf[istate].resize(n_face_quad_pts);
-            surf_vol_ref_2pt_flux_interp_vol[istate].resize(n_quad_pts_vol);
-         
             for(unsigned int iface_quad=0; iface_quad<n_face_quad_pts; iface_quad++){
                 for(unsigned int iquad_int=0; iquad_int<n_quad_pts_1D; iquad_int++){
                     surf_vol_ref_2pt_flux_interp_surf[istate][iface_quad] 
@@ -1674,8 +2907,8 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_boundary_term_strong(
 
 
     //the outward reference normal dircetion.
-    std::array<std::vector<real>,nstate> conv_flux_dot_normal;
-    std::array<std::vector<real>,nstate> diss_flux_dot_normal_diff;
+    std::array<std::vector<adtype>,nstate> &conv_flux_dot_normal = scratch_arena.state_vectors(n_face_quad_pts);
+    std::array<std::vector<adtype>,nstate> &diss_flux_dot_normal_diff = scratch_arena.state_vectors(n_face_quad_pts);
     // Get surface numerical fluxes
     for (unsigned int iquad=0; iquad<n_face_quad_pts; ++iquad) {
         // Copy Metric Cofactor on the facet in a way can use for transforming Tensor Blocks to reference space
@@ -1699,9 +2932,9 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_boundary_term_strong(
 
         //get the projected entropy variables, soln, and 
         //auxiliary solution on the surface point.
-        std::array<real,nstate> entropy_var_face_int;
-        std::array<dealii::Tensor<1,dim,real>,nstate> aux_soln_state_int;
-        std::array<real,nstate> soln_interp_to_face_int;
+        std::array<adtype,nstate> entropy_var_face_int;
+        std::array<dealii::Tensor<1,dim,adtype>,nstate> aux_soln_state_int;
+        std::array<adtype,nstate> soln_interp_to_face_int;
         for(int istate=0; istate<nstate; istate++){
             soln_interp_to_face_int[istate] = soln_at_surf_q[istate][iquad];
             entropy_var_face_int[istate] = projected_entropy_var_surf[istate][iquad];
@@ -1711,8 +2944,8 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_boundary_term_strong(
         }
 
         //extract solution on surface from projected entropy variables
-        std::array<real,nstate> soln_state_int;
-        soln_state_int = this->pde_physics_double->compute_conservative_variables_from_entropy_variables (entropy_var_face_int);
+        std::array<adtype,nstate> soln_state_int;
+        soln_state_int = physics.compute_conservative_variables_from_entropy_variables (entropy_var_face_int);
 
 
         if(!this->all_parameters->use_split_form && !this->all_parameters->use_curvilinear_split_form){
@@ -1721,9 +2954,9 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_boundary_term_strong(
             }
         }
 
-        std::array<real,nstate> soln_boundary;
-        std::array<dealii::Tensor<1,dim,real>,nstate> grad_soln_boundary;
-        dealii::Point<dim,real> surf_flux_node;
+        std::array<adtype,nstate> soln_boundary;
+        std::array<dealii::Tensor<1,dim,adtype>,nstate> grad_soln_boundary;
+        dealii::Point<dim,adtype> surf_flux_node;
         for(int idim=0; idim<dim; idim++){
             surf_flux_node[idim] = metric_oper.flux_nodes_surf[iface][idim][iquad];
         }
@@ -1731,80 +2964,92 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_boundary_term_strong(
         //or solution from the projected entropy variables.
         //Now, it uses projected entropy variables for NSFR, and solution
         //interpolated to face for conservative DG.
-        this->pde_physics_double->boundary_face_values (boundary_id, surf_flux_node, unit_phys_normal_int, soln_state_int, aux_soln_state_int, soln_boundary, grad_soln_boundary);
+        physics.boundary_face_values (boundary_id, surf_flux_node, unit_phys_normal_int, soln_state_int, aux_soln_state_int, soln_boundary, grad_soln_boundary);
         
         // Convective numerical flux.
-        std::array<real,nstate> conv_num_flux_dot_n_at_q;
-        conv_num_flux_dot_n_at_q = this->conv_num_flux_double->evaluate_flux(soln_state_int, soln_boundary, unit_phys_normal_int);
+        std::array<adtype,nstate> conv_num_flux_dot_n_at_q;
+        if(assemble_convective){
+            conv_num_flux_dot_n_at_q = conv_num_flux.evaluate_flux(soln_state_int, soln_boundary, unit_phys_normal_int);
+        }
         
         // Dissipative numerical flux
-        std::array<real,nstate> diss_auxi_num_flux_dot_n_at_q;
-        diss_auxi_num_flux_dot_n_at_q = this->diss_num_flux_double->evaluate_auxiliary_flux(
-            current_cell_index, current_cell_index,
-            0.0, 0.0,
-            soln_interp_to_face_int, soln_boundary,
-            aux_soln_state_int, grad_soln_boundary,
-            unit_phys_normal_int, penalty, true);
+        std::array<adtype,nstate> diss_auxi_num_flux_dot_n_at_q;
+        if(assemble_dissipative){
+            diss_auxi_num_flux_dot_n_at_q = diss_num_flux.evaluate_auxiliary_flux(
+                current_cell_index, current_cell_index,
+                0.0, 0.0,
+                soln_interp_to_face_int, soln_boundary,
+                aux_soln_state_int, grad_soln_boundary,
+                unit_phys_normal_int, penalty, true);
+        }
 
         for(int istate=0; istate<nstate; istate++){
-            // allocate
-            if(iquad==0){
-                conv_flux_dot_normal[istate].resize(n_face_quad_pts);
-                diss_flux_dot_normal_diff[istate].resize(n_face_quad_pts);
-            }
             // write data
-            conv_flux_dot_normal[istate][iquad] = face_Jac_norm_scaled * conv_num_flux_dot_n_at_q[istate];
-            diss_flux_dot_normal_diff[istate][iquad] = face_Jac_norm_scaled * diss_auxi_num_flux_dot_n_at_q[istate]
-                                                     - diffusive_int_vol_ref_flux_interp_to_face_dot_ref_normal[istate][iquad];
+            if(assemble_convective){
+                conv_flux_dot_normal[istate][iquad] = face_Jac_norm_scaled * conv_num_flux_dot_n_at_q[istate];
+            }
+            if(assemble_dissipative){
+                diss_flux_dot_normal_diff[istate][iquad] = face_Jac_norm_scaled * diss_auxi_num_flux_dot_n_at_q[istate]
+                                                         - diffusive_int_vol_ref_flux_interp_to_face_dot_ref_normal[istate][iquad];
+            }
         }
     }
 
     //solve rhs
     for(int istate=0; istate<nstate; istate++){
-        std::vector<real> rhs(n_shape_fns);
+        // The rhs is zeroed by the scratch arena, such that the dissipative terms can be added to it when the convective ones are not assembled.
+        std::vector<adtype> &rhs = scratch_arena.vector(n_shape_fns);
         //Convective flux on the facet
-        if(this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
-            std::vector<real> ones_surf(n_face_quad_pts, 1.0);
-            soln_basis.inner_product_surface_1D(iface, 
-                                                surf_vol_ref_2pt_flux_interp_surf[istate], 
-                                                ones_surf, rhs, 
-                                                soln_basis.oneD_surf_operator, 
-                                                soln_basis.oneD_vol_operator,
-                                                false, -1.0);
-            std::vector<real> ones_vol(n_quad_pts_vol, 1.0);
-            soln_basis.inner_product_1D(surf_vol_ref_2pt_flux_interp_vol[istate], 
-                                            ones_vol, rhs, 
-                                            soln_basis.oneD_vol_operator, 
-                                            true, -1.0);
+        if(!assemble_convective){
+            //The convective terms are not assembled.
+        }
+        else if(use_split_form){
+            std::vector<adtype> &ones_surf = scratch_arena.vector(n_face_quad_pts, 1.0);
+            ADOperator::inner_product_surface_1D(soln_basis, iface, 
+                                                 surf_vol_ref_2pt_flux_interp_surf[istate], 
+                                                 ones_surf, rhs, 
+                                                 soln_basis.oneD_surf_operator, 
+                                                 soln_basis.oneD_vol_operator,
+                                                 false, -1.0);
+            std::vector<adtype> &ones_vol = scratch_arena.vector(n_quad_pts_vol, 1.0);
+            ADOperator::inner_product_1D(soln_basis, surf_vol_ref_2pt_flux_interp_vol[istate], 
+                                             ones_vol, rhs, 
+                                             soln_basis.oneD_vol_operator, 
+                                             true, -1.0);
         }
         else{
-            soln_basis.inner_product_surface_1D(iface, conv_int_vol_ref_flux_interp_to_face_dot_ref_normal[istate], 
-                                                face_quad_weights, rhs, 
-                                                soln_basis.oneD_surf_operator, 
-                                                soln_basis.oneD_vol_operator,
-                                                false, 1.0);//adding=false, scaled by factor=-1.0 bc subtract it
+            ADOperator::inner_product_surface_1D(soln_basis, iface, conv_int_vol_ref_flux_interp_to_face_dot_ref_normal[istate], 
+                                                 face_quad_weights, rhs, 
+                                                 soln_basis.oneD_surf_operator, 
+                                                 soln_basis.oneD_vol_operator,
+                                                 false, 1.0);//adding=false, scaled by factor=-1.0 bc subtract it
         }
         //Convective surface nnumerical flux.
-        soln_basis.inner_product_surface_1D(iface, conv_flux_dot_normal[istate], 
-                                            face_quad_weights, rhs, 
-                                            soln_basis.oneD_surf_operator, 
-                                            soln_basis.oneD_vol_operator,
-                                            true, -1.0);//adding=true, scaled by factor=-1.0 bc subtract it
+        if(assemble_convective){
+            ADOperator::inner_product_surface_1D(soln_basis, iface, conv_flux_dot_normal[istate], 
+                                                 face_quad_weights, rhs, 
+                                                 soln_basis.oneD_surf_operator, 
+                                                 soln_basis.oneD_vol_operator,
+                                                 true, -1.0);//adding=true, scaled by factor=-1.0 bc subtract it
+        }
         //Dissipative surface numerical flux.
-        soln_basis.inner_product_surface_1D(iface, diss_flux_dot_normal_diff[istate], 
-                                            face_quad_weights, rhs, 
-                                            soln_basis.oneD_surf_operator, 
-                                            soln_basis.oneD_vol_operator,
-                                            true, -1.0);//adding=true, scaled by factor=-1.0 bc subtract it
+        if(assemble_dissipative){
+            ADOperator::inner_product_surface_1D(soln_basis, iface, diss_flux_dot_normal_diff[istate], 
+                                                 face_quad_weights, rhs, 
+                                                 soln_basis.oneD_surf_operator, 
+                                                 soln_basis.oneD_vol_operator,
+                                                 true, -1.0);//adding=true, scaled by factor=-1.0 bc subtract it
+        }
 
         for(unsigned int ishape=0; ishape<n_shape_fns; ishape++){
-            local_rhs_cell(istate*n_shape_fns + ishape) += rhs[ishape];
+            local_rhs_cell[istate*n_shape_fns + ishape] += rhs[ishape];
         }
     }
 }
 
 
 template <int dim, int nstate, typename real, typename MeshType>
+template <typename adtype>
 void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_strong(
     const unsigned int iface, const unsigned int neighbor_iface, 
     const dealii::types::global_dof_index current_cell_index,
@@ -1812,8 +3057,10 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_strong(
     const unsigned int poly_degree_int, 
     const unsigned int poly_degree_ext, 
     const real penalty,
-    const std::vector<dealii::types::global_dof_index> &dof_indices_int,
-    const std::vector<dealii::types::global_dof_index> &dof_indices_ext,
+    const std::array<std::vector<adtype>,nstate>            &soln_coeff_int,
+    const std::array<std::vector<adtype>,nstate>            &soln_coeff_ext,
+    const std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &aux_soln_coeff_int,
+    const std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &aux_soln_coeff_ext,
     OPERATOR::basis_functions<dim,2*dim,real>               &soln_basis_int,
     OPERATOR::basis_functions<dim,2*dim,real>               &soln_basis_ext,
     OPERATOR::basis_functions<dim,2*dim,real>               &flux_basis_int,
@@ -1822,8 +3069,12 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_strong(
     OPERATOR::vol_projection_operator<dim,2*dim,real>       &soln_basis_projection_oper_ext,
     OPERATOR::metric_operators<real,dim,2*dim>         &metric_oper_int,
     OPERATOR::metric_operators<real,dim,2*dim>         &metric_oper_ext,
-    dealii::Vector<real>                               &local_rhs_int_cell,
-    dealii::Vector<real>                               &local_rhs_ext_cell)
+    Physics::PhysicsBase<dim,nstate,adtype>            &physics,
+    NumericalFlux::NumericalFluxConvective<dim,nstate,adtype> &conv_num_flux,
+    NumericalFlux::NumericalFluxDissipative<dim,nstate,adtype> &diss_num_flux,
+    StrongDGScratchArena<dim,nstate,adtype>            &scratch_arena,
+    LocalResidual<adtype>                              &local_rhs_int_cell,
+    LocalResidual<adtype>                              &local_rhs_ext_cell)
 {
     (void) current_cell_index;
     (void) neighbor_cell_index;
@@ -1841,122 +3092,83 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_strong(
     const unsigned int n_shape_fns_int = n_dofs_int / nstate;
     const unsigned int n_shape_fns_ext = n_dofs_ext / nstate;
 
-    AssertDimension (n_dofs_int, dof_indices_int.size());
-    AssertDimension (n_dofs_ext, dof_indices_ext.size());
-
-    // Extract interior modal coefficients of solution
-    std::array<std::vector<real>,nstate> soln_coeff_int;
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> aux_soln_coeff_int;
-    for (unsigned int idof = 0; idof < n_dofs_int; ++idof) {
-        const unsigned int istate = this->fe_collection[poly_degree_int].system_to_component_index(idof).first;
-        const unsigned int ishape = this->fe_collection[poly_degree_int].system_to_component_index(idof).second;
-        if(ishape == 0)
-            soln_coeff_int[istate].resize(n_shape_fns_int);
-
-        soln_coeff_int[istate][ishape] = DGBase<dim,real,MeshType>::solution(dof_indices_int[idof]);
-        for(int idim=0; idim<dim; idim++){
-            if(ishape == 0){
-                aux_soln_coeff_int[istate][idim].resize(n_shape_fns_int);
-            }
-            if(this->use_auxiliary_eq){
-                aux_soln_coeff_int[istate][idim][ishape] = DGBase<dim,real,MeshType>::auxiliary_solution[idim](dof_indices_int[idof]);
-            }
-            else{
-                aux_soln_coeff_int[istate][idim][ishape] = 0.0;
-            }
-        }
-    }
+    AssertDimension (n_shape_fns_int, soln_coeff_int[0].size());
+    AssertDimension (n_shape_fns_ext, soln_coeff_ext[0].size());
 
-    // Extract exterior modal coefficients of solution
-    std::array<std::vector<real>,nstate> soln_coeff_ext;
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> aux_soln_coeff_ext;
-    for (unsigned int idof = 0; idof < n_dofs_ext; ++idof) {
-        const unsigned int istate = this->fe_collection[poly_degree_ext].system_to_component_index(idof).first;
-        const unsigned int ishape = this->fe_collection[poly_degree_ext].system_to_component_index(idof).second;
-        if(ishape == 0){
-            soln_coeff_ext[istate].resize(n_shape_fns_ext);
-        }
-        soln_coeff_ext[istate][ishape] = DGBase<dim,real,MeshType>::solution(dof_indices_ext[idof]);
-        for(int idim=0; idim<dim; idim++){
-            if(ishape == 0){
-                aux_soln_coeff_ext[istate][idim].resize(n_shape_fns_ext);
-            }
-            if(this->use_auxiliary_eq){
-                aux_soln_coeff_ext[istate][idim][ishape] = DGBase<dim,real,MeshType>::auxiliary_solution[idim](dof_indices_ext[idof]);
-            }
-            else{
-                aux_soln_coeff_ext[istate][idim][ishape] = 0.0;
-            }
-        }
-    }
+    // All the temporaries below are taken from the scratch arena, already sized and zeroed.
+    const bool use_split_form = this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form;
 
     // Interpolate the modal coefficients to the volume cubature nodes.
-    std::array<std::vector<real>,nstate> soln_at_vol_q_int;
-    std::array<std::vector<real>,nstate> soln_at_vol_q_ext;
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> aux_soln_at_vol_q_int;
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> aux_soln_at_vol_q_ext;
+    std::array<std::vector<adtype>,nstate> &soln_at_vol_q_int = scratch_arena.state_vectors(n_quad_pts_vol_int);
+    std::array<std::vector<adtype>,nstate> &soln_at_vol_q_ext = scratch_arena.state_vectors(n_quad_pts_vol_ext);
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &aux_soln_at_vol_q_int = scratch_arena.state_tensor_vectors(n_quad_pts_vol_int);
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &aux_soln_at_vol_q_ext = scratch_arena.state_tensor_vectors(n_quad_pts_vol_ext);
     // Interpolate modal soln coefficients to the facet.
-    std::array<std::vector<real>,nstate> soln_at_surf_q_int;
-    std::array<std::vector<real>,nstate> soln_at_surf_q_ext;
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> aux_soln_at_surf_q_int;
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> aux_soln_at_surf_q_ext;
+    std::array<std::vector<adtype>,nstate> &soln_at_surf_q_int = scratch_arena.state_vectors(n_face_quad_pts);
+    std::array<std::vector<adtype>,nstate> &soln_at_surf_q_ext = scratch_arena.state_vectors(n_face_quad_pts);
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &aux_soln_at_surf_q_int = scratch_arena.state_tensor_vectors(n_face_quad_pts);
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &aux_soln_at_surf_q_ext = scratch_arena.state_tensor_vectors(n_face_quad_pts);
     for(int istate=0; istate<nstate; ++istate){
-        // allocate
-        soln_at_vol_q_int[istate].resize(n_quad_pts_vol_int);
-        soln_at_vol_q_ext[istate].resize(n_quad_pts_vol_ext);
         // solve soln at volume cubature nodes
-        soln_basis_int.matrix_vector_mult_1D(soln_coeff_int[istate], soln_at_vol_q_int[istate],
-                                             soln_basis_int.oneD_vol_operator);
-        soln_basis_ext.matrix_vector_mult_1D(soln_coeff_ext[istate], soln_at_vol_q_ext[istate],
-                                             soln_basis_ext.oneD_vol_operator);
+        ADOperator::matrix_vector_mult_1D(soln_basis_int, soln_coeff_int[istate], soln_at_vol_q_int[istate],
+                                          soln_basis_int.oneD_vol_operator);
+        ADOperator::matrix_vector_mult_1D(soln_basis_ext, soln_coeff_ext[istate], soln_at_vol_q_ext[istate],
+                                          soln_basis_ext.oneD_vol_operator);
 
-        // allocate
-        soln_at_surf_q_int[istate].resize(n_face_quad_pts);
-        soln_at_surf_q_ext[istate].resize(n_face_quad_pts);
         // solve soln at facet cubature nodes
-        soln_basis_int.matrix_vector_mult_surface_1D(iface,
-                                                     soln_coeff_int[istate], soln_at_surf_q_int[istate],
-                                                     soln_basis_int.oneD_surf_operator,
-                                                     soln_basis_int.oneD_vol_operator);
-        soln_basis_ext.matrix_vector_mult_surface_1D(neighbor_iface,
-                                                     soln_coeff_ext[istate], soln_at_surf_q_ext[istate],
-                                                     soln_basis_ext.oneD_surf_operator,
-                                                     soln_basis_ext.oneD_vol_operator);
+        ADOperator::matrix_vector_mult_surface_1D(soln_basis_int, iface,
+                                                  soln_coeff_int[istate], soln_at_surf_q_int[istate],
+                                                  soln_basis_int.oneD_surf_operator,
+                                                  soln_basis_int.oneD_vol_operator);
+        ADOperator::matrix_vector_mult_surface_1D(soln_basis_ext, neighbor_iface,
+                                                  soln_coeff_ext[istate], soln_at_surf_q_ext[istate],
+                                                  soln_basis_ext.oneD_surf_operator,
+                                                  soln_basis_ext.oneD_vol_operator);
 
         for(int idim=0; idim<dim; idim++){
-            // alocate
-            aux_soln_at_vol_q_int[istate][idim].resize(n_quad_pts_vol_int);
-            aux_soln_at_vol_q_ext[istate][idim].resize(n_quad_pts_vol_ext);
             // solve auxiliary soln at volume cubature nodes
-            soln_basis_int.matrix_vector_mult_1D(aux_soln_coeff_int[istate][idim], aux_soln_at_vol_q_int[istate][idim],
-                                                 soln_basis_int.oneD_vol_operator);
-            soln_basis_ext.matrix_vector_mult_1D(aux_soln_coeff_ext[istate][idim], aux_soln_at_vol_q_ext[istate][idim],
-                                                 soln_basis_ext.oneD_vol_operator);
-
-            // allocate
-            aux_soln_at_surf_q_int[istate][idim].resize(n_face_quad_pts);
-            aux_soln_at_surf_q_ext[istate][idim].resize(n_face_quad_pts);
+            ADOperator::matrix_vector_mult_1D(soln_basis_int, aux_soln_coeff_int[istate][idim], aux_soln_at_vol_q_int[istate][idim],
+                                              soln_basis_int.oneD_vol_operator);
+            ADOperator::matrix_vector_mult_1D(soln_basis_ext, aux_soln_coeff_ext[istate][idim], aux_soln_at_vol_q_ext[istate][idim],
+                                              soln_basis_ext.oneD_vol_operator);
+
             // solve auxiliary soln at facet cubature nodes
-            soln_basis_int.matrix_vector_mult_surface_1D(iface,
-                                                         aux_soln_coeff_int[istate][idim], aux_soln_at_surf_q_int[istate][idim],
-                                                         soln_basis_int.oneD_surf_operator,
-                                                         soln_basis_int.oneD_vol_operator);
-            soln_basis_ext.matrix_vector_mult_surface_1D(neighbor_iface,
-                                                         aux_soln_coeff_ext[istate][idim], aux_soln_at_surf_q_ext[istate][idim],
-                                                         soln_basis_ext.oneD_surf_operator,
-                                                         soln_basis_ext.oneD_vol_operator);
+            ADOperator::matrix_vector_mult_surface_1D(soln_basis_int, iface,
+                                                      aux_soln_coeff_int[istate][idim], aux_soln_at_surf_q_int[istate][idim],
+                                                      soln_basis_int.oneD_surf_operator,
+                                                      soln_basis_int.oneD_vol_operator);
+            ADOperator::matrix_vector_mult_surface_1D(soln_basis_ext, neighbor_iface,
+                                                      aux_soln_coeff_ext[istate][idim], aux_soln_at_surf_q_ext[istate][idim],
+                                                      soln_basis_ext.oneD_surf_operator,
+                                                      soln_basis_ext.oneD_vol_operator);
         }
     }
 
-
+    // Parts of the residual assembled, see DGBase::set_residual_part().
+    // With local time stepping, the numerical fluxes belong to the level of the face
+    // and the fluxes of each cell to the level of that cell, see DGBase::set_active_time_level().
+    const bool assemble_convective = this->assembles_convective_terms();
+    const bool assemble_dissipative = this->assembles_dissipative_terms();
+    const bool face_level_is_active = this->face_time_level_is_active(current_cell_index, neighbor_cell_index);
+    const bool int_level_is_active = this->time_level_is_active(current_cell_index);
+    const bool ext_level_is_active = this->time_level_is_active(neighbor_cell_index);
 
 
     // Get volume reference fluxes and interpolate them to the facet.
     // Compute reference volume fluxes in both interior and exterior cells.
 
     // First we do interior.
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> conv_ref_flux_at_vol_q_int;
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> diffusive_ref_flux_at_vol_q_int;
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &conv_ref_flux_at_vol_q_int = scratch_arena.state_tensor_vectors(n_quad_pts_vol_int);
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &diffusive_ref_flux_at_vol_q_int = scratch_arena.state_tensor_vectors(n_quad_pts_vol_int);
+    // Evaluate the physical fluxes of all the volume cubature nodes at once.
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &conv_phys_flux_at_vol_q_int = scratch_arena.state_tensor_vectors(use_split_form ? 0 : n_quad_pts_vol_int);
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &diffusive_phys_flux_at_vol_q_int = scratch_arena.state_tensor_vectors(n_quad_pts_vol_int);
+    if(!use_split_form && assemble_convective){
+        physics.convective_flux_batch(soln_at_vol_q_int, conv_phys_flux_at_vol_q_int);
+    }
+    if(assemble_dissipative){
+        physics.dissipative_flux_batch(soln_at_vol_q_int, aux_soln_at_vol_q_int, current_cell_index, diffusive_phys_flux_at_vol_q_int);
+    }
     for (unsigned int iquad=0; iquad<n_quad_pts_vol_int; ++iquad) {
         // Copy Metric Cofactor in a way can use for transforming Tensor Blocks to reference space
         // The way it is stored in metric_operators is to use sum-factorization in each direction,
@@ -1967,52 +3179,38 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_strong(
                 metric_cofactor_vol_int[idim][jdim] = metric_oper_int.metric_cofactor_vol[idim][jdim][iquad];
             }
         }
-        std::array<real,nstate> soln_state;
-        std::array<dealii::Tensor<1,dim,real>,nstate> aux_soln_state;
+        // Write the values in a way that we can use sum-factorization on.
         for(int istate=0; istate<nstate; istate++){
-            soln_state[istate] = soln_at_vol_q_int[istate][iquad];
+            dealii::Tensor<1,dim,adtype> conv_phys_flux;
+            dealii::Tensor<1,dim,adtype> diffusive_phys_flux;
             for(int idim=0; idim<dim; idim++){
-                aux_soln_state[istate][idim] = aux_soln_at_vol_q_int[istate][idim][iquad];
+                //Only for conservtive DG do we interpolate volume fluxes to the facet
+                if(!use_split_form){
+                    conv_phys_flux[idim] = conv_phys_flux_at_vol_q_int[istate][idim][iquad];
+                }
+                diffusive_phys_flux[idim] = diffusive_phys_flux_at_vol_q_int[istate][idim][iquad];
             }
-        }
-
-        // Evaluate physical convective flux
-        std::array<dealii::Tensor<1,dim,real>,nstate> conv_phys_flux;
-        //Only for conservtive DG do we interpolate volume fluxes to the facet
-        if(!this->all_parameters->use_split_form && !this->all_parameters->use_curvilinear_split_form){
-            conv_phys_flux = this->pde_physics_double->convective_flux (soln_state);
-        }
-
-        // Compute the physical dissipative flux
-        std::array<dealii::Tensor<1,dim,real>,nstate> diffusive_phys_flux;
-        diffusive_phys_flux = this->pde_physics_double->dissipative_flux(soln_state, aux_soln_state, current_cell_index);
-
-        // Write the values in a way that we can use sum-factorization on.
-        for(int istate=0; istate<nstate; istate++){
-            dealii::Tensor<1,dim,real> conv_ref_flux;
-            dealii::Tensor<1,dim,real> diffusive_ref_flux;
+            dealii::Tensor<1,dim,adtype> conv_ref_flux;
+            dealii::Tensor<1,dim,adtype> diffusive_ref_flux;
             // transform the conservative convective physical flux to reference space
-            if(!this->all_parameters->use_split_form && !this->all_parameters->use_curvilinear_split_form){
-                metric_oper_int.transform_physical_to_reference(
-                    conv_phys_flux[istate],
+            if(!use_split_form && assemble_convective){
+                ADOperator::transform_physical_to_reference(
+                    conv_phys_flux,
                     metric_cofactor_vol_int,
                     conv_ref_flux);
             }
             // transform the dissipative flux to reference space
-            metric_oper_int.transform_physical_to_reference(
-                diffusive_phys_flux[istate],
-                metric_cofactor_vol_int,
-                diffusive_ref_flux);
+            if(assemble_dissipative){
+                ADOperator::transform_physical_to_reference(
+                    diffusive_phys_flux,
+                    metric_cofactor_vol_int,
+                    diffusive_ref_flux);
+            }
 
             // Write the data in a way that we can use sum-factorization on.
             // Since sum-factorization improves the speed for matrix-vector multiplications,
             // We need the values to have their inner elements be vectors.
             for(int idim=0; idim<dim; idim++){
-                // allocate
-                if(iquad == 0){
-                    conv_ref_flux_at_vol_q_int[istate][idim].resize(n_quad_pts_vol_int);
-                    diffusive_ref_flux_at_vol_q_int[istate][idim].resize(n_quad_pts_vol_int);
-                }
                 // write data
                 if(!this->all_parameters->use_split_form && !this->all_parameters->use_curvilinear_split_form){
                     conv_ref_flux_at_vol_q_int[istate][idim][iquad] = conv_ref_flux[idim];
@@ -2024,8 +3222,17 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_strong(
 
     // Next we do exterior volume reference fluxes.
     // Note we split the quad integrals because the interior and exterior could be of different poly basis
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> conv_ref_flux_at_vol_q_ext;
-    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> diffusive_ref_flux_at_vol_q_ext;
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &conv_ref_flux_at_vol_q_ext = scratch_arena.state_tensor_vectors(n_quad_pts_vol_ext);
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &diffusive_ref_flux_at_vol_q_ext = scratch_arena.state_tensor_vectors(n_quad_pts_vol_ext);
+    // Evaluate the physical fluxes of all the volume cubature nodes at once.
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &conv_phys_flux_at_vol_q_ext = scratch_arena.state_tensor_vectors(use_split_form ? 0 : n_quad_pts_vol_ext);
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &diffusive_phys_flux_at_vol_q_ext = scratch_arena.state_tensor_vectors(n_quad_pts_vol_ext);
+    if(!use_split_form && assemble_convective){
+        physics.convective_flux_batch(soln_at_vol_q_ext, conv_phys_flux_at_vol_q_ext);
+    }
+    if(assemble_dissipative){
+        physics.dissipative_flux_batch(soln_at_vol_q_ext, aux_soln_at_vol_q_ext, neighbor_cell_index, diffusive_phys_flux_at_vol_q_ext);
+    }
     for (unsigned int iquad=0; iquad<n_quad_pts_vol_ext; ++iquad) {
 
         // Extract exterior volume metric cofactor matrix at given volume cubature node.
@@ -2036,51 +3243,38 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_strong(
             }
         }
 
-        std::array<real,nstate> soln_state;
-        std::array<dealii::Tensor<1,dim,real>,nstate> aux_soln_state;
+        // Write the values in a way that we can use sum-factorization on.
         for(int istate=0; istate<nstate; istate++){
-            soln_state[istate] = soln_at_vol_q_ext[istate][iquad];
+            dealii::Tensor<1,dim,adtype> conv_phys_flux;
+            dealii::Tensor<1,dim,adtype> diffusive_phys_flux;
             for(int idim=0; idim<dim; idim++){
-                aux_soln_state[istate][idim] = aux_soln_at_vol_q_ext[istate][idim][iquad];
+                //Only for conservtive DG do we interpolate volume fluxes to the facet
+                if(!use_split_form){
+                    conv_phys_flux[idim] = conv_phys_flux_at_vol_q_ext[istate][idim][iquad];
+                }
+                diffusive_phys_flux[idim] = diffusive_phys_flux_at_vol_q_ext[istate][idim][iquad];
             }
-        }
-
-        // Evaluate physical convective flux
-        std::array<dealii::Tensor<1,dim,real>,nstate> conv_phys_flux;
-        if(!this->all_parameters->use_split_form && !this->all_parameters->use_curvilinear_split_form){
-            conv_phys_flux = this->pde_physics_double->convective_flux (soln_state);
-        }
-
-        // Compute the physical dissipative flux
-        std::array<dealii::Tensor<1,dim,real>,nstate> diffusive_phys_flux;
-        diffusive_phys_flux = this->pde_physics_double->dissipative_flux(soln_state, aux_soln_state, neighbor_cell_index);
-
-        // Write the values in a way that we can use sum-factorization on.
-        for(int istate=0; istate<nstate; istate++){
-            dealii::Tensor<1,dim,real> conv_ref_flux;
-            dealii::Tensor<1,dim,real> diffusive_ref_flux;
+            dealii::Tensor<1,dim,adtype> conv_ref_flux;
+            dealii::Tensor<1,dim,adtype> diffusive_ref_flux;
             // transform the conservative convective physical flux to reference space
-            if(!this->all_parameters->use_split_form && !this->all_parameters->use_curvilinear_split_form){
-                metric_oper_ext.transform_physical_to_reference(
-                    conv_phys_flux[istate],
+            if(!use_split_form && assemble_convective){
+                ADOperator::transform_physical_to_reference(
+                    conv_phys_flux,
                     metric_cofactor_vol_ext,
                     conv_ref_flux);
             }
             // transform the dissipative flux to reference space
-            metric_oper_ext.transform_physical_to_reference(
-                diffusive_phys_flux[istate],
-                metric_cofactor_vol_ext,
-                diffusive_ref_flux);
+            if(assemble_dissipative){
+                ADOperator::transform_physical_to_reference(
+                    diffusive_phys_flux,
+                    metric_cofactor_vol_ext,
+                    diffusive_ref_flux);
+            }
 
             // Write the data in a way that we can use sum-factorization on.
             // Since sum-factorization improves the speed for matrix-vector multiplications,
             // We need the values to have their inner elements be vectors.
             for(int idim=0; idim<dim; idim++){
-                // allocate
-                if(iquad == 0){
-                    conv_ref_flux_at_vol_q_ext[istate][idim].resize(n_quad_pts_vol_ext);
-                    diffusive_ref_flux_at_vol_q_ext[istate][idim].resize(n_quad_pts_vol_ext);
-                }
                 // write data
                 if(!this->all_parameters->use_split_form && !this->all_parameters->use_curvilinear_split_form){
                     conv_ref_flux_at_vol_q_ext[istate][idim][iquad] = conv_ref_flux[idim];
@@ -2101,49 +3295,45 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_strong(
     const int dim_not_zero_int = iface / 2;//reference direction of face integer division
     const int dim_not_zero_ext = neighbor_iface / 2;//reference direction of face integer division
 
-    std::array<std::vector<real>,nstate> conv_int_vol_ref_flux_interp_to_face_dot_ref_normal;
-    std::array<std::vector<real>,nstate> conv_ext_vol_ref_flux_interp_to_face_dot_ref_normal;
-    std::array<std::vector<real>,nstate> diffusive_int_vol_ref_flux_interp_to_face_dot_ref_normal;
-    std::array<std::vector<real>,nstate> diffusive_ext_vol_ref_flux_interp_to_face_dot_ref_normal;
+    std::array<std::vector<adtype>,nstate> &conv_int_vol_ref_flux_interp_to_face_dot_ref_normal = scratch_arena.state_vectors(n_face_quad_pts);
+    std::array<std::vector<adtype>,nstate> &conv_ext_vol_ref_flux_interp_to_face_dot_ref_normal = scratch_arena.state_vectors(n_face_quad_pts);
+    std::array<std::vector<adtype>,nstate> &diffusive_int_vol_ref_flux_interp_to_face_dot_ref_normal = scratch_arena.state_vectors(n_face_quad_pts);
+    std::array<std::vector<adtype>,nstate> &diffusive_ext_vol_ref_flux_interp_to_face_dot_ref_normal = scratch_arena.state_vectors(n_face_quad_pts);
     for(int istate=0; istate<nstate; istate++){
-        //allocate
-        conv_int_vol_ref_flux_interp_to_face_dot_ref_normal[istate].resize(n_face_quad_pts);
-        conv_ext_vol_ref_flux_interp_to_face_dot_ref_normal[istate].resize(n_face_quad_pts);
-        diffusive_int_vol_ref_flux_interp_to_face_dot_ref_normal[istate].resize(n_face_quad_pts);
-        diffusive_ext_vol_ref_flux_interp_to_face_dot_ref_normal[istate].resize(n_face_quad_pts);
-
         // solve
         // Note, since the normal is zero in all other reference directions, we only have to interpolate one given reference direction to the facet
         
         // interpolate reference volume convective flux to the facet, and apply unit reference normal as scaled by 1.0 or -1.0
-        if(!this->all_parameters->use_split_form && !this->all_parameters->use_curvilinear_split_form){
-            flux_basis_int.matrix_vector_mult_surface_1D(iface, 
-                                                         conv_ref_flux_at_vol_q_int[istate][dim_not_zero_int],
-                                                         conv_int_vol_ref_flux_interp_to_face_dot_ref_normal[istate],
-                                                         flux_basis_int.oneD_surf_operator,//the flux basis interpolates from the flux nodes
-                                                         flux_basis_int.oneD_vol_operator,
-                                                         false, unit_ref_normal_int[dim_not_zero_int]);//don't add to previous value, scale by unit_normal int
-            flux_basis_ext.matrix_vector_mult_surface_1D(neighbor_iface, 
-                                                         conv_ref_flux_at_vol_q_ext[istate][dim_not_zero_ext],
-                                                         conv_ext_vol_ref_flux_interp_to_face_dot_ref_normal[istate],
-                                                         flux_basis_ext.oneD_surf_operator,
-                                                         flux_basis_ext.oneD_vol_operator,
-                                                         false, unit_ref_normal_ext[dim_not_zero_ext]);//don't add to previous value, unit_normal ext is -unit normal int
+        if(!use_split_form && assemble_convective){
+            ADOperator::matrix_vector_mult_surface_1D(flux_basis_int, iface, 
+                                                      conv_ref_flux_at_vol_q_int[istate][dim_not_zero_int],
+                                                      conv_int_vol_ref_flux_interp_to_face_dot_ref_normal[istate],
+                                                      flux_basis_int.oneD_surf_operator,//the flux basis interpolates from the flux nodes
+                                                      flux_basis_int.oneD_vol_operator,
+                                                      false, unit_ref_normal_int[dim_not_zero_int]);//don't add to previous value, scale by unit_normal int
+            ADOperator::matrix_vector_mult_surface_1D(flux_basis_ext, neighbor_iface, 
+                                                      conv_ref_flux_at_vol_q_ext[istate][dim_not_zero_ext],
+                                                      conv_ext_vol_ref_flux_interp_to_face_dot_ref_normal[istate],
+                                                      flux_basis_ext.oneD_surf_operator,
+                                                      flux_basis_ext.oneD_vol_operator,
+                                                      false, unit_ref_normal_ext[dim_not_zero_ext]);//don't add to previous value, unit_normal ext is -unit normal int
         }
 
         // interpolate reference volume dissipative flux to the facet, and apply unit reference normal as scaled by 1.0 or -1.0
-        flux_basis_int.matrix_vector_mult_surface_1D(iface, 
-                                                     diffusive_ref_flux_at_vol_q_int[istate][dim_not_zero_int],
-                                                     diffusive_int_vol_ref_flux_interp_to_face_dot_ref_normal[istate],
-                                                     flux_basis_int.oneD_surf_operator,
-                                                     flux_basis_int.oneD_vol_operator,
-                                                     false, unit_ref_normal_int[dim_not_zero_int]);
-        flux_basis_ext.matrix_vector_mult_surface_1D(neighbor_iface, 
-                                                     diffusive_ref_flux_at_vol_q_ext[istate][dim_not_zero_ext],
-                                                     diffusive_ext_vol_ref_flux_interp_to_face_dot_ref_normal[istate],
-                                                     flux_basis_ext.oneD_surf_operator,
-                                                     flux_basis_ext.oneD_vol_operator,
-                                                     false, unit_ref_normal_ext[dim_not_zero_ext]);
+        if(assemble_dissipative){
+            ADOperator::matrix_vector_mult_surface_1D(flux_basis_int, iface, 
+                                                      diffusive_ref_flux_at_vol_q_int[istate][dim_not_zero_int],
+                                                      diffusive_int_vol_ref_flux_interp_to_face_dot_ref_normal[istate],
+                                                      flux_basis_int.oneD_surf_operator,
+                                                      flux_basis_int.oneD_vol_operator,
+                                                      false, unit_ref_normal_int[dim_not_zero_int]);
+            ADOperator::matrix_vector_mult_surface_1D(flux_basis_ext, neighbor_iface, 
+                                                      diffusive_ref_flux_at_vol_q_ext[istate][dim_not_zero_ext],
+                                                      diffusive_ext_vol_ref_flux_interp_to_face_dot_ref_normal[istate],
+                                                      flux_basis_ext.oneD_surf_operator,
+                                                      flux_basis_ext.oneD_vol_operator,
+                                                      false, unit_ref_normal_ext[dim_not_zero_ext]);
+        }
     }
 
 
@@ -2154,105 +3344,94 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_strong(
     //pages 355 (Eq. 57 with text around it) and  page 359 (Eq 86 and text below it).
 
     // First, transform the volume conservative solution at volume cubature nodes to entropy variables.
-    std::array<std::vector<real>,nstate> entropy_var_vol_int;
-    for(unsigned int iquad=0; iquad<n_quad_pts_vol_int; iquad++){
-        std::array<real,nstate> soln_state;
-        for(int istate=0; istate<nstate; istate++){
-            soln_state[istate] = soln_at_vol_q_int[istate][iquad];
-        }
-        std::array<real,nstate> entropy_var;
-        entropy_var = this->pde_physics_double->compute_entropy_variables(soln_state);
-        for(int istate=0; istate<nstate; istate++){
-            if(iquad==0){
-                entropy_var_vol_int[istate].resize(n_quad_pts_vol_int);
-            }
-            entropy_var_vol_int[istate][iquad] = entropy_var[istate];
-        }
-    }
-    std::array<std::vector<real>,nstate> entropy_var_vol_ext;
-    for(unsigned int iquad=0; iquad<n_quad_pts_vol_ext; iquad++){
-        std::array<real,nstate> soln_state;
-        for(int istate=0; istate<nstate; istate++){
-            soln_state[istate] = soln_at_vol_q_ext[istate][iquad];
-        }
-        std::array<real,nstate> entropy_var;
-        entropy_var = this->pde_physics_double->compute_entropy_variables(soln_state);
-        for(int istate=0; istate<nstate; istate++){
-            if(iquad==0){
-                entropy_var_vol_ext[istate].resize(n_quad_pts_vol_ext);
-            }
-            entropy_var_vol_ext[istate][iquad] = entropy_var[istate];
-        }
-    }
+    std::array<std::vector<adtype>,nstate> &entropy_var_vol_int = scratch_arena.state_vectors(n_quad_pts_vol_int);
+    physics.compute_entropy_variables_batch(soln_at_vol_q_int, entropy_var_vol_int);
+    std::array<std::vector<adtype>,nstate> &entropy_var_vol_ext = scratch_arena.state_vectors(n_quad_pts_vol_ext);
+    physics.compute_entropy_variables_batch(soln_at_vol_q_ext, entropy_var_vol_ext);
 
     //project it onto the solution basis functions and interpolate it
-    std::array<std::vector<real>,nstate> projected_entropy_var_vol_int;
-    std::array<std::vector<real>,nstate> projected_entropy_var_vol_ext;
-    std::array<std::vector<real>,nstate> projected_entropy_var_surf_int;
-    std::array<std::vector<real>,nstate> projected_entropy_var_surf_ext;
+    std::array<std::vector<adtype>,nstate> &projected_entropy_var_vol_int = scratch_arena.state_vectors(n_quad_pts_vol_int);
+    std::array<std::vector<adtype>,nstate> &projected_entropy_var_vol_ext = scratch_arena.state_vectors(n_quad_pts_vol_ext);
+    std::array<std::vector<adtype>,nstate> &projected_entropy_var_surf_int = scratch_arena.state_vectors(n_face_quad_pts);
+    std::array<std::vector<adtype>,nstate> &projected_entropy_var_surf_ext = scratch_arena.state_vectors(n_face_quad_pts);
     for(int istate=0; istate<nstate; istate++){
-        // allocate
-        projected_entropy_var_vol_int[istate].resize(n_quad_pts_vol_int);
-        projected_entropy_var_vol_ext[istate].resize(n_quad_pts_vol_ext);
-        projected_entropy_var_surf_int[istate].resize(n_face_quad_pts);
-        projected_entropy_var_surf_ext[istate].resize(n_face_quad_pts);
-
         //interior
-        std::vector<real> entropy_var_coeff_int(n_shape_fns_int);
-        soln_basis_projection_oper_int.matrix_vector_mult_1D(entropy_var_vol_int[istate],
-                                                             entropy_var_coeff_int,
-                                                             soln_basis_projection_oper_int.oneD_vol_operator);
-        soln_basis_int.matrix_vector_mult_1D(entropy_var_coeff_int,
-                                             projected_entropy_var_vol_int[istate],
-                                             soln_basis_int.oneD_vol_operator);
-        soln_basis_int.matrix_vector_mult_surface_1D(iface,
-                                                     entropy_var_coeff_int, 
-                                                     projected_entropy_var_surf_int[istate],
-                                                     soln_basis_int.oneD_surf_operator,
-                                                     soln_basis_int.oneD_vol_operator);
+        std::vector<adtype> &entropy_var_coeff_int = scratch_arena.vector(n_shape_fns_int);
+        ADOperator::matrix_vector_mult_1D(soln_basis_projection_oper_int, entropy_var_vol_int[istate],
+                                          entropy_var_coeff_int,
+                                          soln_basis_projection_oper_int.oneD_vol_operator);
+        ADOperator::matrix_vector_mult_1D(soln_basis_int, entropy_var_coeff_int,
+                                          projected_entropy_var_vol_int[istate],
+                                          soln_basis_int.oneD_vol_operator);
+        ADOperator::matrix_vector_mult_surface_1D(soln_basis_int, iface,
+                                                  entropy_var_coeff_int, 
+                                                  projected_entropy_var_surf_int[istate],
+                                                  soln_basis_int.oneD_surf_operator,
+                                                  soln_basis_int.oneD_vol_operator);
 
         //exterior
-        std::vector<real> entropy_var_coeff_ext(n_shape_fns_ext);
-        soln_basis_projection_oper_ext.matrix_vector_mult_1D(entropy_var_vol_ext[istate],
-                                                             entropy_var_coeff_ext,
-                                                             soln_basis_projection_oper_ext.oneD_vol_operator);
-
-        soln_basis_ext.matrix_vector_mult_1D(entropy_var_coeff_ext,
-                                             projected_entropy_var_vol_ext[istate],
-                                             soln_basis_ext.oneD_vol_operator);
-        soln_basis_ext.matrix_vector_mult_surface_1D(neighbor_iface,
-                                                     entropy_var_coeff_ext, 
-                                                     projected_entropy_var_surf_ext[istate],
-                                                     soln_basis_ext.oneD_surf_operator,
-                                                     soln_basis_ext.oneD_vol_operator);
+        std::vector<adtype> &entropy_var_coeff_ext = scratch_arena.vector(n_shape_fns_ext);
+        ADOperator::matrix_vector_mult_1D(soln_basis_projection_oper_ext, entropy_var_vol_ext[istate],
+                                          entropy_var_coeff_ext,
+                                          soln_basis_projection_oper_ext.oneD_vol_operator);
+
+        ADOperator::matrix_vector_mult_1D(soln_basis_ext, entropy_var_coeff_ext,
+                                          projected_entropy_var_vol_ext[istate],
+                                          soln_basis_ext.oneD_vol_operator);
+        ADOperator::matrix_vector_mult_surface_1D(soln_basis_ext, neighbor_iface,
+                                                  entropy_var_coeff_ext, 
+                                                  projected_entropy_var_surf_ext[istate],
+                                                  soln_basis_ext.oneD_surf_operator,
+                                                  soln_basis_ext.oneD_vol_operator);
     }
 
     //get the surface-volume sparsity pattern for a "sum-factorized" Hadamard product only computing terms needed for the operation.
-    const unsigned int row_size_int = n_face_quad_pts * n_quad_pts_1D_int;
-    const unsigned int col_size_int = n_face_quad_pts * n_quad_pts_1D_int;
-    std::vector<unsigned int> Hadamard_rows_sparsity_int(row_size_int);
-    std::vector<unsigned int> Hadamard_columns_sparsity_int(col_size_int);
-    const unsigned int row_size_ext = n_face_quad_pts * n_quad_pts_1D_ext;
-    const unsigned int col_size_ext = n_face_quad_pts * n_quad_pts_1D_ext;
-    std::vector<unsigned int> Hadamard_rows_sparsity_ext(row_size_ext);
-    std::vector<unsigned int> Hadamard_columns_sparsity_ext(col_size_ext);
-    if(this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
-        flux_basis_int.sum_factorized_Hadamard_surface_sparsity_pattern(n_face_quad_pts, n_quad_pts_1D_int, Hadamard_rows_sparsity_int, Hadamard_columns_sparsity_int, dim_not_zero_int);
-        flux_basis_ext.sum_factorized_Hadamard_surface_sparsity_pattern(n_face_quad_pts, n_quad_pts_1D_ext, Hadamard_rows_sparsity_ext, Hadamard_columns_sparsity_ext, dim_not_zero_ext);
-    }
-
-    std::array<std::vector<real>,nstate> surf_vol_ref_2pt_flux_interp_surf_int;
-    std::array<std::vector<real>,nstate> surf_vol_ref_2pt_flux_interp_surf_ext;
-    std::array<std::vector<real>,nstate> surf_vol_ref_2pt_flux_interp_vol_int;
-    std::array<std::vector<real>,nstate> surf_vol_ref_2pt_flux_interp_vol_ext;
-    if(this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
+    //Built with the interior and exterior flux bases for their current degrees.
+    const std::vector<unsigned int> &Hadamard_rows_sparsity_int = flux_basis_int.surf_Hadamard_rows_sparsity[iface];
+    const std::vector<unsigned int> &Hadamard_columns_sparsity_int = flux_basis_int.surf_Hadamard_columns_sparsity[iface];
+    const std::vector<unsigned int> &Hadamard_rows_sparsity_ext = flux_basis_ext.surf_Hadamard_rows_sparsity[neighbor_iface];
+    const std::vector<unsigned int> &Hadamard_columns_sparsity_ext = flux_basis_ext.surf_Hadamard_columns_sparsity[neighbor_iface];
+    if(use_split_form){
+        AssertDimension(Hadamard_rows_sparsity_int.size(), n_face_quad_pts * n_quad_pts_1D_int);
+        AssertDimension(Hadamard_rows_sparsity_ext.size(), n_face_quad_pts * n_quad_pts_1D_ext);
+    }
+
+    std::array<std::vector<adtype>,nstate> &surf_vol_ref_2pt_flux_interp_surf_int = scratch_arena.state_vectors(use_split_form ? n_face_quad_pts : 0);
+    std::array<std::vector<adtype>,nstate> &surf_vol_ref_2pt_flux_interp_surf_ext = scratch_arena.state_vectors(use_split_form ? n_face_quad_pts : 0);
+    std::array<std::vector<adtype>,nstate> &surf_vol_ref_2pt_flux_interp_vol_int = scratch_arena.state_vectors(use_split_form ? n_quad_pts_vol_int : 0);
+    std::array<std::vector<adtype>,nstate> &surf_vol_ref_2pt_flux_interp_vol_ext = scratch_arena.state_vectors(use_split_form ? n_quad_pts_vol_ext : 0);
+    if(use_split_form && assemble_convective){
         //get surface-volume hybrid 2pt flux from Eq.(15) in Chan, Jesse. "Skew-symmetric entropy stable modal discontinuous Galerkin formulations." Journal of Scientific Computing 81.1 (2019): 459-485.
-        std::array<dealii::FullMatrix<real>,nstate> surface_ref_2pt_flux_int;
-        std::array<dealii::FullMatrix<real>,nstate> surface_ref_2pt_flux_ext;
         //make use of the sparsity pattern from above to assemble only n^d non-zero entries without ever allocating not computing zeros.
-        for(int istate=0; istate<nstate; istate++){
-            surface_ref_2pt_flux_int[istate].reinit(n_face_quad_pts, n_quad_pts_1D_int);
-            surface_ref_2pt_flux_ext[istate].reinit(n_face_quad_pts, n_quad_pts_1D_ext);
+        std::array<dealii::FullMatrix<adtype>,nstate> &surface_ref_2pt_flux_int = scratch_arena.state_matrices(n_face_quad_pts, n_quad_pts_1D_int);
+        std::array<dealii::FullMatrix<adtype>,nstate> &surface_ref_2pt_flux_ext = scratch_arena.state_matrices(n_face_quad_pts, n_quad_pts_1D_ext);
+        //the conservative values at the volume nodes from the projected entropy variables,
+        //and the two-point fluxes of a row of the Hadamard product evaluated by the physics in a single batch.
+        std::array<std::vector<adtype>,nstate> &soln_from_entropy_var_vol_int = scratch_arena.state_vectors(n_quad_pts_vol_int);
+        std::array<std::vector<adtype>,nstate> &soln_from_entropy_var_vol_ext = scratch_arena.state_vectors(n_quad_pts_vol_ext);
+        std::array<std::vector<adtype>,nstate> &soln_2pt_row_int = scratch_arena.state_vectors(n_quad_pts_1D_int);
+        std::array<std::vector<adtype>,nstate> &soln_2pt_row_ext = scratch_arena.state_vectors(n_quad_pts_1D_ext);
+        std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &conv_phys_flux_2pt_row_int = scratch_arena.state_tensor_vectors(n_quad_pts_1D_int);
+        std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &conv_phys_flux_2pt_row_ext = scratch_arena.state_tensor_vectors(n_quad_pts_1D_ext);
+        for(unsigned int iquad=0; iquad<n_quad_pts_vol_int; iquad++){
+            std::array<adtype,nstate> entropy_var;
+            for(int istate=0; istate<nstate; istate++){
+                entropy_var[istate] = projected_entropy_var_vol_int[istate][iquad];
+            }
+            const std::array<adtype,nstate> soln_state = physics.compute_conservative_variables_from_entropy_variables (entropy_var);
+            for(int istate=0; istate<nstate; istate++){
+                soln_from_entropy_var_vol_int[istate][iquad] = soln_state[istate];
+            }
+        }
+        for(unsigned int iquad=0; iquad<n_quad_pts_vol_ext; iquad++){
+            std::array<adtype,nstate> entropy_var;
+            for(int istate=0; istate<nstate; istate++){
+                entropy_var[istate] = projected_entropy_var_vol_ext[istate][iquad];
+            }
+            const std::array<adtype,nstate> soln_state = physics.compute_conservative_variables_from_entropy_variables (entropy_var);
+            for(int istate=0; istate<nstate; istate++){
+                soln_from_entropy_var_vol_ext[istate][iquad] = soln_state[istate];
+            }
         }
         for(unsigned int iquad_face=0; iquad_face<n_face_quad_pts; iquad_face++){
             dealii::Tensor<2,dim,real> metric_cofactor_surf;
@@ -2263,16 +3442,16 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_strong(
             }
              
             //Compute the conservative values on the facet from the interpolated entorpy variables.
-            std::array<real,nstate> entropy_var_face_int;
-            std::array<real,nstate> entropy_var_face_ext;
+            std::array<adtype,nstate> entropy_var_face_int;
+            std::array<adtype,nstate> entropy_var_face_ext;
             for(int istate=0; istate<nstate; istate++){
                 entropy_var_face_int[istate] = projected_entropy_var_surf_int[istate][iquad_face];
                 entropy_var_face_ext[istate] = projected_entropy_var_surf_ext[istate][iquad_face];
             }
-            std::array<real,nstate> soln_state_face_int;
-            soln_state_face_int = this->pde_physics_double->compute_conservative_variables_from_entropy_variables (entropy_var_face_int);
-            std::array<real,nstate> soln_state_face_ext;
-            soln_state_face_ext = this->pde_physics_double->compute_conservative_variables_from_entropy_variables (entropy_var_face_ext);
+            std::array<adtype,nstate> soln_state_face_int;
+            soln_state_face_int = physics.compute_conservative_variables_from_entropy_variables (entropy_var_face_int);
+            std::array<adtype,nstate> soln_state_face_ext;
+            soln_state_face_ext = physics.compute_conservative_variables_from_entropy_variables (entropy_var_face_ext);
 
             //only do the n_quad_1D vol points that give non-zero entries from Hadamard product.
             for(unsigned int row_index = iquad_face * n_quad_pts_1D_int, column_index = 0; 
@@ -2283,6 +3462,18 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_strong(
                     pcout<<"The interior Hadamard rows sparsity pattern does not match."<<std::endl;
                     std::abort();
                 }
+                const unsigned int iquad_vol = Hadamard_columns_sparsity_int[row_index];
+                for(int istate=0; istate<nstate; istate++){
+                    soln_2pt_row_int[istate][column_index] = soln_from_entropy_var_vol_int[istate][iquad_vol];
+                }
+            }
+
+            //Compute the physical fluxes of the whole row
+            physics.convective_numerical_split_flux_batch(soln_state_face_int, soln_2pt_row_int, conv_phys_flux_2pt_row_int);
+
+            for(unsigned int row_index = iquad_face * n_quad_pts_1D_int, column_index = 0; 
+                column_index < n_quad_pts_1D_int;
+                row_index++, column_index++){
 
                 const unsigned int iquad_vol = Hadamard_columns_sparsity_int[row_index];//extract flux_quad pt that corresponds to a non-zero entry for Hadamard product.
                 // Copy Metric Cofactor in a way can use for transforming Tensor Blocks to reference space
@@ -2294,24 +3485,18 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_strong(
                         metric_cofactor_vol_int[idim][jdim] = metric_oper_int.metric_cofactor_vol[idim][jdim][iquad_vol];
                     }
                 }
-                std::array<real,nstate> entropy_var;
-                for(int istate=0; istate<nstate; istate++){
-                    entropy_var[istate] = projected_entropy_var_vol_int[istate][iquad_vol];
-                }
-                std::array<real,nstate> soln_state;
-                soln_state = this->pde_physics_double->compute_conservative_variables_from_entropy_variables (entropy_var);
                 //Note that the flux basis is collocated on the volume cubature set so we don't need to evaluate the entropy variables
                 //on the volume set then transform back to the conservative variables since the flux basis volume
                 //projection is identity.
-
-                //Compute the physical flux
-                std::array<dealii::Tensor<1,dim,real>,nstate> conv_phys_flux_2pt;
-                conv_phys_flux_2pt = this->pde_physics_double->convective_numerical_split_flux(soln_state, soln_state_face_int);
                 for(int istate=0; istate<nstate; istate++){
-                    dealii::Tensor<1,dim,real> conv_ref_flux_2pt;
+                    dealii::Tensor<1,dim,adtype> conv_phys_flux_2pt;
+                    for(int idim=0; idim<dim; idim++){
+                        conv_phys_flux_2pt[idim] = conv_phys_flux_2pt_row_int[istate][idim][column_index];
+                    }
+                    dealii::Tensor<1,dim,adtype> conv_ref_flux_2pt;
                     //For each state, transform the physical flux to a reference flux.
-                    metric_oper_int.transform_physical_to_reference(
-                        conv_phys_flux_2pt[istate],
+                    ADOperator::transform_physical_to_reference(
+                        conv_phys_flux_2pt,
                         0.5*(metric_cofactor_surf + metric_cofactor_vol_int),
                         conv_ref_flux_2pt);
                     //only store the dim not zero in reference space bc dot product with unit ref normal later.
@@ -2326,6 +3511,18 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_strong(
                     pcout<<"The exterior Hadamard rows sparsity pattern does not match."<<std::endl;
                     std::abort();
                 }
+                const unsigned int iquad_vol = Hadamard_columns_sparsity_ext[row_index];
+                for(int istate=0; istate<nstate; istate++){
+                    soln_2pt_row_ext[istate][column_index] = soln_from_entropy_var_vol_ext[istate][iquad_vol];
+                }
+            }
+
+            //Compute the physical fluxes of the whole row
+            physics.convective_numerical_split_flux_batch(soln_state_face_ext, soln_2pt_row_ext, conv_phys_flux_2pt_row_ext);
+
+            for(unsigned int row_index = iquad_face * n_quad_pts_1D_ext, column_index = 0; 
+                column_index < n_quad_pts_1D_ext;
+                row_index++, column_index++){
 
                 const unsigned int iquad_vol = Hadamard_columns_sparsity_ext[row_index];//extract flux_quad pt that corresponds to a non-zero entry for Hadamard product.
                 // Copy Metric Cofactor in a way can use for transforming Tensor Blocks to reference space
@@ -2337,20 +3534,15 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_strong(
                         metric_cofactor_vol_ext[idim][jdim] = metric_oper_ext.metric_cofactor_vol[idim][jdim][iquad_vol];
                     }
                 }
-                std::array<real,nstate> entropy_var;
-                for(int istate=0; istate<nstate; istate++){
-                    entropy_var[istate] = projected_entropy_var_vol_ext[istate][iquad_vol];
-                }
-                std::array<real,nstate> soln_state;
-                soln_state = this->pde_physics_double->compute_conservative_variables_from_entropy_variables (entropy_var);
-                //Compute the physical flux
-                std::array<dealii::Tensor<1,dim,real>,nstate> conv_phys_flux_2pt;
-                conv_phys_flux_2pt = this->pde_physics_double->convective_numerical_split_flux(soln_state, soln_state_face_ext);
                 for(int istate=0; istate<nstate; istate++){
-                    dealii::Tensor<1,dim,real> conv_ref_flux_2pt;
+                    dealii::Tensor<1,dim,adtype> conv_phys_flux_2pt;
+                    for(int idim=0; idim<dim; idim++){
+                        conv_phys_flux_2pt[idim] = conv_phys_flux_2pt_row_ext[istate][idim][column_index];
+                    }
+                    dealii::Tensor<1,dim,adtype> conv_ref_flux_2pt;
                     //For each state, transform the physical flux to a reference flux.
-                    metric_oper_ext.transform_physical_to_reference(
-                        conv_phys_flux_2pt[istate],
+                    ADOperator::transform_physical_to_reference(
+                        conv_phys_flux_2pt,
                         0.5*(metric_cofactor_surf + metric_cofactor_vol_ext),
                         conv_ref_flux_2pt);
                     //only store the dim not zero in reference space bc dot product with unit ref normal later.
@@ -2361,44 +3553,23 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_strong(
 
         //get the surface basis operator from Hadamard sparsity pattern
         //to be applied at n^d operations (on the face so n^{d+1-1}=n^d flops)
-        //also only allocates n^d terms.
-        const int iface_1D = iface % 2;//the reference face number
-        const std::vector<double> &oneD_quad_weights_vol_int = this->oneD_quadrature_collection[poly_degree_int].get_weights();
-        dealii::FullMatrix<real> surf_oper_sparse_int(n_face_quad_pts, n_quad_pts_1D_int);
-        flux_basis_int.sum_factorized_Hadamard_surface_basis_assembly(n_face_quad_pts, n_quad_pts_1D_int, 
-                                                                      Hadamard_rows_sparsity_int, Hadamard_columns_sparsity_int,
-                                                                      flux_basis_int.oneD_surf_operator[iface_1D], 
-                                                                      oneD_quad_weights_vol_int,
-                                                                      surf_oper_sparse_int,
-                                                                      dim_not_zero_int);
-        const int neighbor_iface_1D = neighbor_iface % 2;//the reference neighbour face number
-        const std::vector<double> &oneD_quad_weights_vol_ext = this->oneD_quadrature_collection[poly_degree_ext].get_weights();
-        dealii::FullMatrix<real> surf_oper_sparse_ext(n_face_quad_pts, n_quad_pts_1D_ext);
-        flux_basis_ext.sum_factorized_Hadamard_surface_basis_assembly(n_face_quad_pts, n_quad_pts_1D_ext, 
-                                                                      Hadamard_rows_sparsity_ext, Hadamard_columns_sparsity_ext,
-                                                                      flux_basis_ext.oneD_surf_operator[neighbor_iface_1D], 
-                                                                      oneD_quad_weights_vol_ext,
-                                                                      surf_oper_sparse_ext,
-                                                                      dim_not_zero_ext);
+        //also only stores n^d terms.
+        const dealii::FullMatrix<double> &surf_oper_sparse_int = flux_basis_int.surf_oper_Hadamard_sparse[iface];
+        const dealii::FullMatrix<double> &surf_oper_sparse_ext = flux_basis_ext.surf_oper_Hadamard_sparse[neighbor_iface];
 
         // Apply the surface Hadamard products and multiply with vector of ones for both off diagonal terms in
         // Eq.(15) in Chan, Jesse. "Skew-symmetric entropy stable modal discontinuous Galerkin formulations." Journal of Scientific Computing 81.1 (2019): 459-485.
         for(int istate=0; istate<nstate; istate++){
             //first apply Hadamard product with the structure made above.
-            dealii::FullMatrix<real> surface_ref_2pt_flux_int_Hadamard_with_surf_oper(n_face_quad_pts, n_quad_pts_1D_int);
-            flux_basis_int.Hadamard_product(surf_oper_sparse_int, 
-                                            surface_ref_2pt_flux_int[istate], 
-                                            surface_ref_2pt_flux_int_Hadamard_with_surf_oper);
-            dealii::FullMatrix<real> surface_ref_2pt_flux_ext_Hadamard_with_surf_oper(n_face_quad_pts, n_quad_pts_1D_ext);
-            flux_basis_ext.Hadamard_product(surf_oper_sparse_ext, 
-                                            surface_ref_2pt_flux_ext[istate], 
-                                            surface_ref_2pt_flux_ext_Hadamard_with_surf_oper);
+            dealii::FullMatrix<adtype> &surface_ref_2pt_flux_int_Hadamard_with_surf_oper = scratch_arena.matrix(n_face_quad_pts, n_quad_pts_1D_int);
+            ADOperator::Hadamard_product(flux_basis_int, surf_oper_sparse_int, 
+                                         surface_ref_2pt_flux_int[istate], 
+                                         surface_ref_2pt_flux_int_Hadamard_with_surf_oper);
+            dealii::FullMatrix<adtype> &surface_ref_2pt_flux_ext_Hadamard_with_surf_oper = scratch_arena.matrix(n_face_quad_pts, n_quad_pts_1D_ext);
+            ADOperator::Hadamard_product(flux_basis_ext, surf_oper_sparse_ext, 
+                                         surface_ref_2pt_flux_ext[istate], 
+                                         surface_ref_2pt_flux_ext_Hadamard_with_surf_oper);
             //sum with reference unit normal
-            surf_vol_ref_2pt_flux_interp_surf_int[istate].resize(n_face_quad_pts);
-            surf_vol_ref_2pt_flux_interp_surf_ext[istate].resize(n_face_quad_pts);
-            surf_vol_ref_2pt_flux_interp_vol_int[istate].resize(n_quad_pts_vol_int);
-            surf_vol_ref_2pt_flux_interp_vol_ext[istate].resize(n_quad_pts_vol_ext);
-         
             for(unsigned int iface_quad=0; iface_quad<n_face_quad_pts; iface_quad++){
                 for(unsigned int iquad_int=0; iquad_int<n_quad_pts_1D_int; iquad_int++){
                     surf_vol_ref_2pt_flux_interp_surf_int[istate][iface_quad] 
@@ -2426,8 +3597,8 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_strong(
 
     // Evaluate reference numerical fluxes.
     
-    std::array<std::vector<real>,nstate> conv_num_flux_dot_n;
-    std::array<std::vector<real>,nstate> diss_auxi_num_flux_dot_n;
+    std::array<std::vector<adtype>,nstate> &conv_num_flux_dot_n = scratch_arena.state_vectors(n_face_quad_pts);
+    std::array<std::vector<adtype>,nstate> &diss_auxi_num_flux_dot_n = scratch_arena.state_vectors(n_face_quad_pts);
     for (unsigned int iquad=0; iquad<n_face_quad_pts; ++iquad) {
         // Copy Metric Cofactor on the facet in a way can use for transforming Tensor Blocks to reference space
         // The way it is stored in metric_operators is to use sum-factorization in each direction,
@@ -2441,12 +3612,12 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_strong(
             }
         }
 
-        std::array<real,nstate> entropy_var_face_int;
-        std::array<real,nstate> entropy_var_face_ext;
-        std::array<dealii::Tensor<1,dim,real>,nstate> aux_soln_state_int;
-        std::array<dealii::Tensor<1,dim,real>,nstate> aux_soln_state_ext;
-        std::array<real,nstate> soln_interp_to_face_int;
-        std::array<real,nstate> soln_interp_to_face_ext;
+        std::array<adtype,nstate> entropy_var_face_int;
+        std::array<adtype,nstate> entropy_var_face_ext;
+        std::array<dealii::Tensor<1,dim,adtype>,nstate> aux_soln_state_int;
+        std::array<dealii::Tensor<1,dim,adtype>,nstate> aux_soln_state_ext;
+        std::array<adtype,nstate> soln_interp_to_face_int;
+        std::array<adtype,nstate> soln_interp_to_face_ext;
         for(int istate=0; istate<nstate; istate++){
             soln_interp_to_face_int[istate] = soln_at_surf_q_int[istate][iquad];
             soln_interp_to_face_ext[istate] = soln_at_surf_q_ext[istate][iquad];
@@ -2458,10 +3629,10 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_strong(
             }
         }
 
-        std::array<real,nstate> soln_state_int;
-        soln_state_int = this->pde_physics_double->compute_conservative_variables_from_entropy_variables (entropy_var_face_int);
-        std::array<real,nstate> soln_state_ext;
-        soln_state_ext = this->pde_physics_double->compute_conservative_variables_from_entropy_variables (entropy_var_face_ext);
+        std::array<adtype,nstate> soln_state_int;
+        soln_state_int = physics.compute_conservative_variables_from_entropy_variables (entropy_var_face_int);
+        std::array<adtype,nstate> soln_state_ext;
+        soln_state_ext = physics.compute_conservative_variables_from_entropy_variables (entropy_var_face_ext);
 
 
         if(!this->all_parameters->use_split_form && !this->all_parameters->use_curvilinear_split_form){
@@ -2481,17 +3652,21 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_strong(
         // Note that the facet determinant of metric jacobian is the above norm multiplied by the determinant of the metric Jacobian evaluated on the facet.
         // Since the determinant of the metric Jacobian evaluated on the face cancels off, we can just scale the numerical flux by the norm.
 
-        std::array<real,nstate> conv_num_flux_dot_n_at_q;
-        std::array<real,nstate> diss_auxi_num_flux_dot_n_at_q;
+        std::array<adtype,nstate> conv_num_flux_dot_n_at_q;
+        std::array<adtype,nstate> diss_auxi_num_flux_dot_n_at_q;
         // Convective numerical flux. 
-        conv_num_flux_dot_n_at_q = this->conv_num_flux_double->evaluate_flux(soln_state_int, soln_state_ext, unit_phys_normal_int);
+        if(assemble_convective && face_level_is_active){
+            conv_num_flux_dot_n_at_q = conv_num_flux.evaluate_flux(soln_state_int, soln_state_ext, unit_phys_normal_int);
+        }
         // dissipative numerical flux
-        diss_auxi_num_flux_dot_n_at_q = this->diss_num_flux_double->evaluate_auxiliary_flux(
-            current_cell_index, neighbor_cell_index,
-            0.0, 0.0,
-            soln_interp_to_face_int, soln_interp_to_face_ext,
-            aux_soln_state_int, aux_soln_state_ext,
-            unit_phys_normal_int, penalty, false);
+        if(assemble_dissipative && face_level_is_active){
+            diss_auxi_num_flux_dot_n_at_q = diss_num_flux.evaluate_auxiliary_flux(
+                current_cell_index, neighbor_cell_index,
+                0.0, 0.0,
+                soln_interp_to_face_int, soln_interp_to_face_ext,
+                aux_soln_state_int, aux_soln_state_ext,
+                unit_phys_normal_int, penalty, false);
+        }
 
         // Write the values in a way that we can use sum-factorization on.
         for(int istate=0; istate<nstate; istate++){
@@ -2499,124 +3674,149 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_strong(
             // Since sum-factorization improves the speed for matrix-vector multiplications,
             // We need the values to have their inner elements be vectors of n_face_quad_pts.
 
-            // allocate
-            if(iquad == 0){
-                conv_num_flux_dot_n[istate].resize(n_face_quad_pts);
-                diss_auxi_num_flux_dot_n[istate].resize(n_face_quad_pts);
-            }
-
             // write data
-            conv_num_flux_dot_n[istate][iquad] = face_Jac_norm_scaled * conv_num_flux_dot_n_at_q[istate];
-            diss_auxi_num_flux_dot_n[istate][iquad] = face_Jac_norm_scaled * diss_auxi_num_flux_dot_n_at_q[istate];
+            if(assemble_convective && face_level_is_active){
+                conv_num_flux_dot_n[istate][iquad] = face_Jac_norm_scaled * conv_num_flux_dot_n_at_q[istate];
+            }
+            if(assemble_dissipative && face_level_is_active){
+                diss_auxi_num_flux_dot_n[istate][iquad] = face_Jac_norm_scaled * diss_auxi_num_flux_dot_n_at_q[istate];
+            }
         }
     }
 
     // Compute RHS
+    // The rhs are zeroed by the scratch arena, such that the terms that are assembled can be added to them
+    // when the preceding ones are not.
+    const bool assemble_convective_int = assemble_convective && int_level_is_active;
+    const bool assemble_dissipative_int = assemble_dissipative && int_level_is_active;
+    const bool assemble_convective_ext = assemble_convective && ext_level_is_active;
+    const bool assemble_dissipative_ext = assemble_dissipative && ext_level_is_active;
+    const bool assemble_convective_num_flux = assemble_convective && face_level_is_active;
+    const bool assemble_dissipative_num_flux = assemble_dissipative && face_level_is_active;
+
     const std::vector<double> &surf_quad_weights = this->face_quadrature_collection[poly_degree_int].get_weights();
     for(int istate=0; istate<nstate; istate++){
         // interior RHS
-        std::vector<real> rhs_int(n_shape_fns_int);
+        std::vector<adtype> &rhs_int = scratch_arena.vector(n_shape_fns_int);
 
         // convective flux
-        if(this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
-            std::vector<real> ones_surf(n_face_quad_pts, 1.0);
-            soln_basis_int.inner_product_surface_1D(iface, 
-                                                    surf_vol_ref_2pt_flux_interp_surf_int[istate], 
-                                                    ones_surf, rhs_int, 
-                                                    soln_basis_int.oneD_surf_operator, 
-                                                    soln_basis_int.oneD_vol_operator,
-                                                    false, -1.0);
-            std::vector<real> ones_vol(n_quad_pts_vol_int, 1.0);
-            soln_basis_int.inner_product_1D(surf_vol_ref_2pt_flux_interp_vol_int[istate], 
-                                            ones_vol, rhs_int, 
-                                            soln_basis_int.oneD_vol_operator, 
-                                            true, -1.0);
+        if(!assemble_convective_int){
+            //The convective flux of the interior cell is not assembled.
+        }
+        else if(use_split_form){
+            std::vector<adtype> &ones_surf = scratch_arena.vector(n_face_quad_pts, 1.0);
+            ADOperator::inner_product_surface_1D(soln_basis_int, iface, 
+                                                 surf_vol_ref_2pt_flux_interp_surf_int[istate], 
+                                                 ones_surf, rhs_int, 
+                                                 soln_basis_int.oneD_surf_operator, 
+                                                 soln_basis_int.oneD_vol_operator,
+                                                 false, -1.0);
+            std::vector<adtype> &ones_vol = scratch_arena.vector(n_quad_pts_vol_int, 1.0);
+            ADOperator::inner_product_1D(soln_basis_int, surf_vol_ref_2pt_flux_interp_vol_int[istate], 
+                                         ones_vol, rhs_int, 
+                                         soln_basis_int.oneD_vol_operator, 
+                                         true, -1.0);
         }
         else 
         {
-            soln_basis_int.inner_product_surface_1D(iface, 
-                                                    conv_int_vol_ref_flux_interp_to_face_dot_ref_normal[istate], 
-                                                    surf_quad_weights, rhs_int, 
-                                                    soln_basis_int.oneD_surf_operator, 
-                                                    soln_basis_int.oneD_vol_operator,
-                                                    false, 1.0);
+            ADOperator::inner_product_surface_1D(soln_basis_int, iface, 
+                                                 conv_int_vol_ref_flux_interp_to_face_dot_ref_normal[istate], 
+                                                 surf_quad_weights, rhs_int, 
+                                                 soln_basis_int.oneD_surf_operator, 
+                                                 soln_basis_int.oneD_vol_operator,
+                                                 false, 1.0);
         }
         // dissipative flux
-        soln_basis_int.inner_product_surface_1D(iface, 
-                                                diffusive_int_vol_ref_flux_interp_to_face_dot_ref_normal[istate], 
-                                                surf_quad_weights, rhs_int, 
-                                                soln_basis_int.oneD_surf_operator, 
-                                                soln_basis_int.oneD_vol_operator,
-                                                true, 1.0);//adding=true, subtract the negative so add it
+        if(assemble_dissipative_int){
+            ADOperator::inner_product_surface_1D(soln_basis_int, iface, 
+                                                 diffusive_int_vol_ref_flux_interp_to_face_dot_ref_normal[istate], 
+                                                 surf_quad_weights, rhs_int, 
+                                                 soln_basis_int.oneD_surf_operator, 
+                                                 soln_basis_int.oneD_vol_operator,
+                                                 true, 1.0);//adding=true, subtract the negative so add it
+        }
         // convective numerical flux
-        soln_basis_int.inner_product_surface_1D(iface, conv_num_flux_dot_n[istate], 
-                                                surf_quad_weights, rhs_int, 
-                                                soln_basis_int.oneD_surf_operator, 
-                                                soln_basis_int.oneD_vol_operator,
-                                                true, -1.0);//adding=true, scaled by factor=-1.0 bc subtract it
+        if(assemble_convective_num_flux){
+            ADOperator::inner_product_surface_1D(soln_basis_int, iface, conv_num_flux_dot_n[istate], 
+                                                 surf_quad_weights, rhs_int, 
+                                                 soln_basis_int.oneD_surf_operator, 
+                                                 soln_basis_int.oneD_vol_operator,
+                                                 true, -1.0);//adding=true, scaled by factor=-1.0 bc subtract it
+        }
         // dissipative numerical flux
-        soln_basis_int.inner_product_surface_1D(iface, diss_auxi_num_flux_dot_n[istate], 
-                                                surf_quad_weights, rhs_int, 
-                                                soln_basis_int.oneD_surf_operator, 
-                                                soln_basis_int.oneD_vol_operator,
-                                                true, -1.0);//adding=true, scaled by factor=-1.0 bc subtract it
+        if(assemble_dissipative_num_flux){
+            ADOperator::inner_product_surface_1D(soln_basis_int, iface, diss_auxi_num_flux_dot_n[istate], 
+                                                 surf_quad_weights, rhs_int, 
+                                                 soln_basis_int.oneD_surf_operator, 
+                                                 soln_basis_int.oneD_vol_operator,
+                                                 true, -1.0);//adding=true, scaled by factor=-1.0 bc subtract it
+        }
 
 
         for(unsigned int ishape=0; ishape<n_shape_fns_int; ishape++){
-            local_rhs_int_cell(istate*n_shape_fns_int + ishape) += rhs_int[ishape];
+            local_rhs_int_cell[istate*n_shape_fns_int + ishape] += rhs_int[ishape];
         }
 
         // exterior RHS
-        std::vector<real> rhs_ext(n_shape_fns_ext);
+        std::vector<adtype> &rhs_ext = scratch_arena.vector(n_shape_fns_ext);
 
         // convective flux
-        if(this->all_parameters->use_split_form || this->all_parameters->use_curvilinear_split_form){
-            std::vector<real> ones_surf(n_face_quad_pts, 1.0);
-            soln_basis_ext.inner_product_surface_1D(neighbor_iface, 
-                                                    surf_vol_ref_2pt_flux_interp_surf_ext[istate], 
-                                                    ones_surf, rhs_ext, 
-                                                    soln_basis_ext.oneD_surf_operator, 
-                                                    soln_basis_ext.oneD_vol_operator,
-                                                    false, -1.0);//the negative sign is bc the surface Hadamard function computes it on the otherside.
+        if(!assemble_convective_ext){
+            //The convective flux of the exterior cell is not assembled.
+        }
+        else if(use_split_form){
+            std::vector<adtype> &ones_surf = scratch_arena.vector(n_face_quad_pts, 1.0);
+            ADOperator::inner_product_surface_1D(soln_basis_ext, neighbor_iface, 
+                                                 surf_vol_ref_2pt_flux_interp_surf_ext[istate], 
+                                                 ones_surf, rhs_ext, 
+                                                 soln_basis_ext.oneD_surf_operator, 
+                                                 soln_basis_ext.oneD_vol_operator,
+                                                 false, -1.0);//the negative sign is bc the surface Hadamard function computes it on the otherside.
                                                     //to satisfy the unit test that checks consistency with Jesse Chan's formulation.
-            std::vector<real> ones_vol(n_quad_pts_vol_ext, 1.0);
-            soln_basis_ext.inner_product_1D(surf_vol_ref_2pt_flux_interp_vol_ext[istate], 
-                                            ones_vol, rhs_ext, 
-                                            soln_basis_ext.oneD_vol_operator, 
-                                            true, -1.0);
+            std::vector<adtype> &ones_vol = scratch_arena.vector(n_quad_pts_vol_ext, 1.0);
+            ADOperator::inner_product_1D(soln_basis_ext, surf_vol_ref_2pt_flux_interp_vol_ext[istate], 
+                                         ones_vol, rhs_ext, 
+                                         soln_basis_ext.oneD_vol_operator, 
+                                         true, -1.0);
         }
         else 
         {
-            soln_basis_ext.inner_product_surface_1D(neighbor_iface, 
-                                                    conv_ext_vol_ref_flux_interp_to_face_dot_ref_normal[istate], 
-                                                    surf_quad_weights, rhs_ext, 
-                                                    soln_basis_ext.oneD_surf_operator, 
-                                                    soln_basis_ext.oneD_vol_operator,
-                                                    false, 1.0);//adding false
+            ADOperator::inner_product_surface_1D(soln_basis_ext, neighbor_iface, 
+                                                 conv_ext_vol_ref_flux_interp_to_face_dot_ref_normal[istate], 
+                                                 surf_quad_weights, rhs_ext, 
+                                                 soln_basis_ext.oneD_surf_operator, 
+                                                 soln_basis_ext.oneD_vol_operator,
+                                                 false, 1.0);//adding false
         }
         // dissipative flux
-        soln_basis_ext.inner_product_surface_1D(neighbor_iface, 
-                                                diffusive_ext_vol_ref_flux_interp_to_face_dot_ref_normal[istate], 
-                                                surf_quad_weights, rhs_ext, 
-                                                soln_basis_ext.oneD_surf_operator, 
-                                                soln_basis_ext.oneD_vol_operator,
-                                                true, 1.0);//adding=true
+        if(assemble_dissipative_ext){
+            ADOperator::inner_product_surface_1D(soln_basis_ext, neighbor_iface, 
+                                                 diffusive_ext_vol_ref_flux_interp_to_face_dot_ref_normal[istate], 
+                                                 surf_quad_weights, rhs_ext, 
+                                                 soln_basis_ext.oneD_surf_operator, 
+                                                 soln_basis_ext.oneD_vol_operator,
+                                                 true, 1.0);//adding=true
+        }
         // convective numerical flux
-        soln_basis_ext.inner_product_surface_1D(neighbor_iface, conv_num_flux_dot_n[istate], 
-                                                surf_quad_weights, rhs_ext, 
-                                                soln_basis_ext.oneD_surf_operator, 
-                                                soln_basis_ext.oneD_vol_operator,
-                                                true, 1.0);//adding=true, scaled by factor=1.0 because negative numerical flux and subtract it
+        if(assemble_convective_num_flux){
+            ADOperator::inner_product_surface_1D(soln_basis_ext, neighbor_iface, conv_num_flux_dot_n[istate], 
+                                                 surf_quad_weights, rhs_ext, 
+                                                 soln_basis_ext.oneD_surf_operator, 
+                                                 soln_basis_ext.oneD_vol_operator,
+                                                 true, 1.0);//adding=true, scaled by factor=1.0 because negative numerical flux and subtract it
+        }
         // dissipative numerical flux
-        soln_basis_ext.inner_product_surface_1D(neighbor_iface, diss_auxi_num_flux_dot_n[istate], 
-                                                surf_quad_weights, rhs_ext, 
-                                                soln_basis_ext.oneD_surf_operator, 
-                                                soln_basis_ext.oneD_vol_operator,
-                                                true, 1.0);//adding=true, scaled by factor=1.0 because negative numerical flux and subtract it
+        if(assemble_dissipative_num_flux){
+            ADOperator::inner_product_surface_1D(soln_basis_ext, neighbor_iface, diss_auxi_num_flux_dot_n[istate], 
+                                                 surf_quad_weights, rhs_ext, 
+                                                 soln_basis_ext.oneD_surf_operator, 
+                                                 soln_basis_ext.oneD_vol_operator,
+                                                 true, 1.0);//adding=true, scaled by factor=1.0 because negative numerical flux and subtract it
+        }
 
 
         for(unsigned int ishape=0; ishape<n_shape_fns_ext; ishape++){
-            local_rhs_ext_cell(istate*n_shape_fns_ext + ishape) += rhs_ext[ishape];
+            local_rhs_ext_cell[istate*n_shape_fns_ext + ishape] += rhs_ext[ishape];
         }
     }
 }
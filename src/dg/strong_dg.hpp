@@ -26,19 +26,170 @@ public:
         const unsigned int degree,
         const unsigned int max_degree_input,
         const unsigned int grid_degree_input,
-        const std::shared_ptr<Triangulation> triangulation_input);
+        const std::shared_ptr<Triangulation> triangulation_input,
+        const MPI_Comm mpi_communicator_input = MPI_COMM_WORLD);
 
     /// Assembles the auxiliary equations' residuals and solves for the auxiliary variables.
     /** For information regarding auxiliary vs. primary quations, see 
      *  Quaegebeur, Nadarajah, Navah and Zwanenburg 2019: Stability of Energy Stable Flux 
      *                Reconstruction for the Diffusion Problem Using Compact Numerical Fluxes
+     *  If compute_dRdW, the derivatives of the auxiliary right-hand sides with respect to the solution
+     *  are stored for add_auxiliary_dRdW().
      */
-    void assemble_auxiliary_residual ();
+    void assemble_auxiliary_residual (const bool compute_dRdW);
 
     /// Allocate the dual vector for optimization.
     void allocate_dual_vector ();
 
+    /// The strong-form terms scale their convective and dissipative contributions by the factors of DGBase::set_residual_part().
+    bool supports_residual_splitting () const override { return true; }
+
+    /// The strong-form terms separate the numerical fluxes of the faces from the fluxes of each cell, see DGBase::set_active_time_level().
+    bool supports_local_time_stepping () const override { return true; }
+
+protected:
+    /// Creates the strong-form scratch arena used by the volume, boundary and face terms.
+    std::unique_ptr<ScratchArena> create_scratch_arena() const override;
+
+    /// Returns the scratch arena as the strong-form arena created by create_scratch_arena().
+    StrongDGScratchArena<dim,nstate,real> & strong_scratch_arena(ScratchArena &scratch_arena) const;
+
+    /// Adds the dependence of the residual on the solution through the auxiliary solution to dRdW.
+    /** The auxiliary solution is Q = M_aux^{-1} A(W), hence
+     *  dRdW = dR/dW|_Q + sum_idim dR/dQ_idim M_aux^{-1} dA_idim/dW.
+     *  The cell loop adds dR/dW|_Q to the system_matrix and stores dR/dQ_idim, and
+     *  assemble_auxiliary_residual() stores dA_idim/dW. The product couples cells two faces apart,
+     *  which DGBase::allocate_system() includes in the sparsity pattern.
+     */
+    void add_auxiliary_dRdW () override;
+
+    /// Local residual of the terms evaluated with adtype.
+    /** dealii::Vector in double, as assembled by DGBase. A std::vector with the AD type, whose derivatives are
+     *  added to the system matrix by the *_and_build_operators functions.
+     */
+    template <typename adtype>
+    using LocalResidual = typename std::conditional<std::is_same<adtype,real>::value, dealii::Vector<real>, std::vector<adtype>>::type;
+
+    /// Reads the modal coefficients of the solution of a cell, split by state.
+    /** With FadType, the coefficient of local degree of freedom idof is seeded with the derivative
+     *  first_derivative + idof out of n_derivatives.
+     */
+    template <typename adtype>
+    void get_solution_coefficients(
+        const std::vector<dealii::types::global_dof_index> &dofs_indices,
+        const unsigned int                                 poly_degree,
+        const unsigned int                                 n_derivatives,
+        const unsigned int                                 first_derivative,
+        std::array<std::vector<adtype>,nstate>             &soln_coeff) const;
+
+    /// Reads the modal coefficients of the auxiliary solution of a cell, split by state and direction.
+    /** Zero without the auxiliary equations. With FadType, the coefficient of local degree of freedom idof
+     *  in direction idim is seeded with the derivative first_derivative + (idim+1)*derivative_stride + idof
+     *  out of n_derivatives.
+     */
+    template <typename adtype>
+    void get_auxiliary_solution_coefficients(
+        const std::vector<dealii::types::global_dof_index>         &dofs_indices,
+        const unsigned int                                         poly_degree,
+        const unsigned int                                         n_derivatives,
+        const unsigned int                                         first_derivative,
+        const unsigned int                                         derivative_stride,
+        std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &aux_soln_coeff) const;
+
+    /// Adds the derivatives of the local residual to dRdW, and to dR/dQ with the auxiliary equations.
+    /** The derivatives are ordered as seeded by get_solution_coefficients() and
+     *  get_auxiliary_solution_coefficients(), with the stride columns.size(). Thread-safe.
+     */
+    void add_residual_derivatives(
+        const std::vector<FadType>                         &local_rhs,
+        const std::vector<dealii::types::global_dof_index> &rows,
+        const std::vector<dealii::types::global_dof_index> &columns);
+
+    /// Adds the derivatives of the local auxiliary residual to dA/dW. Thread-safe.
+    void add_auxiliary_residual_derivatives(
+        const std::vector<dealii::Tensor<1,dim,FadType>>   &local_auxiliary_rhs,
+        const std::vector<dealii::types::global_dof_index> &rows,
+        const std::vector<dealii::types::global_dof_index> &columns);
+
+    /// Alias to the per-thread scratch data of the base class.
+    using CellResidualScratchData = typename DGBase<dim,real,MeshType>::CellResidualScratchData;
+
+    /// See DGBase::prepare_cell_batches().
+    /** Batches are available for the conservative strong form on meshes of axis-aligned boxes of a
+     *  single polynomial degree, where every face is conforming and either interior or periodic,
+     *  without artificial dissipation, source terms or physics models. All the cells then share the
+     *  same operators, and their metric terms are diagonal and constant, only scaled by the cell extents.
+     *  The batches are rebuilt when the grid nodes, cells or degrees of freedom change.
+     */
+    bool prepare_cell_batches() override;
+
+    /// See DGBase::assemble_cell_batched_residual().
+    /** The numerical fluxes of every face are first evaluated once, in batches of faces. Each cell then
+     *  assembles its volume term and its own side of all its faces, such that only the locally owned
+     *  residual entries are written and the batches need no coloring between threads.
+     */
+    void assemble_cell_batched_residual(std::vector<std::unique_ptr<CellResidualScratchData>> &scratch_data) override;
+
 private:
+    /// Locally owned cells grouped into batches of n_lanes cells assembled together.
+    /** Within a batch, the solution, fluxes and residual of the cells are interleaved, the values of the
+     *  lanes at a node being contiguous, in the style of deal.II's VectorizedArray and MatrixFree.
+     *  The owned cells and their face neighbors are numbered in the cell arrays below.
+     */
+    struct CellBatches
+    {
+        bool is_available = false; ///< Whether the mesh and discretization allow assembling the batches.
+        unsigned int n_lanes = 1; ///< Number of cells per batch, the SIMD width of doubles.
+        unsigned int poly_degree = 0; ///< Polynomial degree of all the cells.
+        std::vector<unsigned int> n_filled_lanes; ///< Number of owned cells in each batch. The remaining lanes repeat the last one.
+        std::vector<unsigned int> lane_cells; ///< Cell of lane ilane of batch ibatch at ibatch * n_lanes + ilane.
+        std::vector<unsigned int> cell_face_slots; ///< Face slot of face iface of the cell of a lane at (ibatch * n_lanes + ilane) * n_faces + iface.
+        std::vector<unsigned int> face_batch_directions; ///< Direction of the normal of the faces of each face batch.
+        std::vector<unsigned int> face_minus_cells; ///< Cell on the lower side of the face of slot ifbatch * n_lanes + ilane.
+        std::vector<unsigned int> face_plus_cells; ///< Cell on the upper side of the face of slot ifbatch * n_lanes + ilane.
+        /// Scaled numerical flux from the minus to the plus cell of each face slot.
+        /** State istate at face node iquad of slot ifbatch * n_lanes + ilane at ((ifbatch * nstate + istate) * n_face_quad_pts + iquad) * n_lanes + ilane.
+         */
+        std::vector<real> face_numerical_fluxes;
+        std::vector<unsigned int> dof_local_indices; ///< Local solution index of state istate and shape ishape of cell icell at icell * n_dofs + istate * n_shape_fns + ishape.
+        std::vector<dealii::types::global_dof_index> active_cell_indices; ///< Active cell index of each cell.
+        std::vector<std::array<real,dim>> extents; ///< Extent of each cell in each direction.
+        std::vector<real> diameters; ///< Diameter of each cell.
+        unsigned int n_active_cells = 0; ///< Number of active cells the batches were built for.
+        dealii::types::global_dof_index n_dofs = 0; ///< Number of degrees of freedom the batches were built for.
+        VectorFingerprint volume_nodes; ///< Fingerprint of the grid nodes the batches were built for.
+    };
+
+    /// Batches of cells of prepare_cell_batches().
+    CellBatches cell_batches;
+
+    /// Builds cell_batches for the locally owned cells and returns whether the local mesh allows it.
+    bool build_cell_batches();
+
+    /// Reinitializes the operators of the scratch data for the degree of the batches.
+    void reinit_batch_operators(CellResidualScratchData &scratch_data);
+
+    /// Gathers the modal coefficients of the given cell of each lane, interleaved across the lanes.
+    void gather_batch_coefficients(
+        const unsigned int                                        *cells,
+        std::array<std::vector<real>,nstate>                      &soln_coeff,
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &aux_soln_coeff) const;
+
+    /// Interpolates the interleaved coefficients of the solution and auxiliary solution with the given 1D bases.
+    void interpolate_batch(
+        OPERATOR::basis_functions<dim,2*dim,real>                       &soln_basis,
+        const std::array<std::vector<real>,nstate>                      &soln_coeff,
+        const std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &aux_soln_coeff,
+        const std::array<const dealii::FullMatrix<double>*,3>           &bases,
+        std::array<std::vector<real>,nstate>                            &soln,
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate>      &aux_soln) const;
+
+    /// Evaluates the numerical fluxes of the faces of face batch ifbatch into CellBatches::face_numerical_fluxes.
+    void assemble_face_batch(const unsigned int ifbatch, CellResidualScratchData &scratch_data);
+
+    /// Assembles the residual of the cells of batch ibatch.
+    void assemble_cell_batch(const unsigned int ibatch, CellResidualScratchData &scratch_data);
+
     /// Assembles the auxiliary equations' cell residuals.
     template<typename DoFCellAccessorType1, typename DoFCellAccessorType2>
     void assemble_cell_auxiliary_residual (
@@ -63,6 +214,7 @@ protected:
         OPERATOR::metric_operators<real,dim,2*dim>             &metric_oper,
         OPERATOR::mapping_shape_functions<dim,2*dim,real>      &mapping_basis,
         std::array<std::vector<real>,dim>                      &mapping_support_points,
+        ScratchArena                                           &scratch_arena,
         dealii::hp::FEValues<dim,dim>                          &/*fe_values_collection_volume*/,
         dealii::hp::FEValues<dim,dim>                          &/*fe_values_collection_volume_lagrange*/,
         const dealii::FESystem<dim,dim>                        &/*current_fe_ref*/,
@@ -90,6 +242,7 @@ protected:
         OPERATOR::metric_operators<real,dim,2*dim>             &metric_oper,
         OPERATOR::mapping_shape_functions<dim,2*dim,real>      &mapping_basis,
         std::array<std::vector<real>,dim>                      &mapping_support_points,
+        ScratchArena                                           &scratch_arena,
         dealii::hp::FEFaceValues<dim,dim>                      &/*fe_values_collection_face_int*/,
         const dealii::FESystem<dim,dim>                        &/*current_fe_ref*/,
         dealii::Vector<real>                                   &local_rhs_int_cell,
@@ -125,6 +278,7 @@ protected:
         OPERATOR::metric_operators<real,dim,2*dim>             &metric_oper_ext,
         OPERATOR::mapping_shape_functions<dim,2*dim,real>      &mapping_basis,
         std::array<std::vector<real>,dim>                      &mapping_support_points,
+        ScratchArena                                           &scratch_arena,
         dealii::hp::FEFaceValues<dim,dim>                      &/*fe_values_collection_face_int*/,
         dealii::hp::FEFaceValues<dim,dim>                      &/*fe_values_collection_face_ext*/,
         dealii::Vector<real>                                   &current_cell_rhs,
@@ -166,6 +320,7 @@ protected:
         OPERATOR::metric_operators<real,dim,2*dim>             &metric_oper_ext,
         OPERATOR::mapping_shape_functions<dim,2*dim,real>      &mapping_basis,
         std::array<std::vector<real>,dim>                      &mapping_support_points,
+        ScratchArena                                           &scratch_arena,
         dealii::hp::FEFaceValues<dim,dim>                      &fe_values_collection_face_int,
         dealii::hp::FESubfaceValues<dim,dim>                   &/*fe_values_collection_subface*/,
         dealii::Vector<real>                                   &current_cell_rhs,
@@ -191,16 +346,29 @@ public:
         std::vector<dealii::Tensor<1,dim,real>>            &local_auxiliary_RHS);
 
 protected:
+    /// Volume RHS for the auxiliary equation from the modal solution coefficients, see above.
+    template <typename adtype>
+    void assemble_volume_term_auxiliary_equation(
+        const std::array<std::vector<adtype>,nstate>       &soln_coeff,
+        const unsigned int                                 poly_degree,
+        OPERATOR::basis_functions<dim,2*dim,real>          &soln_basis,
+        OPERATOR::basis_functions<dim,2*dim,real>          &flux_basis,
+        OPERATOR::metric_operators<real,dim,2*dim>         &metric_oper,
+        std::vector<dealii::Tensor<1,dim,adtype>>          &local_auxiliary_RHS);
+
     /// Evaluate the boundary RHS for the auxiliary equation.
+    template <typename adtype>
     void assemble_boundary_term_auxiliary_equation(
         const unsigned int                                 iface,
         const dealii::types::global_dof_index              current_cell_index,
         const unsigned int                                 poly_degree,
         const unsigned int                                 boundary_id,
-        const std::vector<dealii::types::global_dof_index> &dofs_indices,
+        const std::array<std::vector<adtype>,nstate>       &soln_coeff,
         OPERATOR::basis_functions<dim,2*dim,real>          &soln_basis,
         OPERATOR::metric_operators<real,dim,2*dim>         &metric_oper,
-        std::vector<dealii::Tensor<1,dim,real>>            &local_auxiliary_RHS);
+        Physics::PhysicsBase<dim,nstate,adtype>            &physics,
+        NumericalFlux::NumericalFluxDissipative<dim,nstate,adtype> &diss_num_flux,
+        std::vector<dealii::Tensor<1,dim,adtype>>          &local_auxiliary_RHS);
 
 public:
     /// Evaluate the facet RHS for the auxiliary equation.
@@ -225,6 +393,24 @@ public:
         std::vector<dealii::Tensor<1,dim,real>>            &local_auxiliary_RHS_ext);
 
 protected:
+    /// Facet RHS for the auxiliary equation from the modal solution coefficients of both sides, see above.
+    template <typename adtype>
+    void assemble_face_term_auxiliary_equation(
+        const unsigned int                                 iface, 
+        const unsigned int                                 neighbor_iface,
+        const dealii::types::global_dof_index              current_cell_index,
+        const dealii::types::global_dof_index              neighbor_cell_index,
+        const unsigned int                                 poly_degree_int, 
+        const unsigned int                                 poly_degree_ext,
+        const std::array<std::vector<adtype>,nstate>       &soln_coeff_int,
+        const std::array<std::vector<adtype>,nstate>       &soln_coeff_ext,
+        OPERATOR::basis_functions<dim,2*dim,real>          &soln_basis_int,
+        OPERATOR::basis_functions<dim,2*dim,real>          &soln_basis_ext,
+        OPERATOR::metric_operators<real,dim,2*dim>         &metric_oper_int,
+        NumericalFlux::NumericalFluxDissipative<dim,nstate,adtype> &diss_num_flux,
+        std::vector<dealii::Tensor<1,dim,adtype>>          &local_auxiliary_RHS_int,
+        std::vector<dealii::Tensor<1,dim,adtype>>          &local_auxiliary_RHS_ext);
+
     /// Strong form primary equation's volume right-hand-side.
     /**  We refer to Cicchino, Alexander, et al. "Provably stable flux reconstruction high-order methods on curvilinear elements." Journal of Computational Physics 463 (2022): 111259.
     * Conservative form Eq. (17): <br>
@@ -242,32 +428,44 @@ protected:
     * \f]
     * where \f$ (\mathbf{F})_{ij} = 0.5\left( \mathbf{C}_m(\mathbf{\xi}_i^r)+\mathbf{C}_m(\mathbf{\xi}_j^r) \right) \cdot \mathbf{f}_s(\mathbf{u}(\mathbf{\xi}_i^r),\mathbf{u}(\mathbf{\xi}_j^r)) \f$; that is, the 
     * matrix of REFERENCE two-point entropy conserving fluxes.
+    *
+    * The modal coefficients are read by the caller. With adtype = FadType, the time step of the cell is not evaluated.
     */
+    template <typename adtype>
     void assemble_volume_term_strong(
         typename dealii::DoFHandler<dim>::active_cell_iterator cell,
         const dealii::types::global_dof_index              current_cell_index,
-        const std::vector<dealii::types::global_dof_index> &cell_dofs_indices,
+        const std::array<std::vector<adtype>,nstate>       &soln_coeff,
+        const std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &aux_soln_coeff,
         const unsigned int                                 poly_degree,
         OPERATOR::basis_functions<dim,2*dim,real>          &soln_basis,
         OPERATOR::basis_functions<dim,2*dim,real>          &flux_basis,
         OPERATOR::local_basis_stiffness<dim,2*dim,real>    &flux_basis_stiffness,
         OPERATOR::vol_projection_operator<dim,2*dim,real>  &soln_basis_projection_oper,
         OPERATOR::metric_operators<real,dim,2*dim>         &metric_oper,
-        dealii::Vector<real>                               &local_rhs_int_cell);
+        Physics::PhysicsBase<dim,nstate,adtype>            &physics,
+        StrongDGScratchArena<dim,nstate,adtype>            &scratch_arena,
+        LocalResidual<adtype>                              &local_rhs_int_cell);
 
     /// Strong form primary equation's boundary right-hand-side.
+    template <typename adtype>
     void assemble_boundary_term_strong(
         const unsigned int                                 iface, 
         const dealii::types::global_dof_index              current_cell_index,
         const unsigned int                                 boundary_id,
         const unsigned int                                 poly_degree, 
         const real                                         penalty,
-        const std::vector<dealii::types::global_dof_index> &dof_indices,
+        const std::array<std::vector<adtype>,nstate>       &soln_coeff,
+        const std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &aux_soln_coeff,
         OPERATOR::basis_functions<dim,2*dim,real>          &soln_basis,
         OPERATOR::basis_functions<dim,2*dim,real>          &flux_basis,
         OPERATOR::vol_projection_operator<dim,2*dim,real>  &soln_basis_projection_oper,
         OPERATOR::metric_operators<real,dim,2*dim>         &metric_oper,
-        dealii::Vector<real>                               &local_rhs_cell);
+        Physics::PhysicsBase<dim,nstate,adtype>            &physics,
+        NumericalFlux::NumericalFluxConvective<dim,nstate,adtype> &conv_num_flux,
+        NumericalFlux::NumericalFluxDissipative<dim,nstate,adtype> &diss_num_flux,
+        StrongDGScratchArena<dim,nstate,adtype>            &scratch_arena,
+        LocalResidual<adtype>                              &local_rhs_cell);
 
     /// Strong form primary equation's facet right-hand-side.
     /**
@@ -278,6 +476,7 @@ protected:
     * ,\:\forall i=1,\dots,N_p.
     * \f]
     */
+    template <typename adtype>
     void assemble_face_term_strong(
         const unsigned int                                 iface, 
         const unsigned int                                 neighbor_iface, 
@@ -286,8 +485,10 @@ protected:
         const unsigned int                                 poly_degree_int, 
         const unsigned int                                 poly_degree_ext, 
         const real                                         penalty,
-        const std::vector<dealii::types::global_dof_index> &dof_indices_int,
-        const std::vector<dealii::types::global_dof_index> &dof_indices_ext,
+        const std::array<std::vector<adtype>,nstate>       &soln_coeff_int,
+        const std::array<std::vector<adtype>,nstate>       &soln_coeff_ext,
+        const std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &aux_soln_coeff_int,
+        const std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &aux_soln_coeff_ext,
         OPERATOR::basis_functions<dim,2*dim,real>          &soln_basis_int,
         OPERATOR::basis_functions<dim,2*dim,real>          &soln_basis_ext,
         OPERATOR::basis_functions<dim,2*dim,real>          &flux_basis_int,
@@ -296,8 +497,12 @@ protected:
         OPERATOR::vol_projection_operator<dim,2*dim,real>  &soln_basis_projection_oper_ext,
         OPERATOR::metric_operators<real,dim,2*dim>         &metric_oper_int,
         OPERATOR::metric_operators<real,dim,2*dim>         &metric_oper_ext,
-        dealii::Vector<real>                               &local_rhs_int_cell,
-        dealii::Vector<real>                               &local_rhs_ext_cell);
+        Physics::PhysicsBase<dim,nstate,adtype>            &physics,
+        NumericalFlux::NumericalFluxConvective<dim,nstate,adtype> &conv_num_flux,
+        NumericalFlux::NumericalFluxDissipative<dim,nstate,adtype> &diss_num_flux,
+        StrongDGScratchArena<dim,nstate,adtype>            &scratch_arena,
+        LocalResidual<adtype>                              &local_rhs_int_cell,
+        LocalResidual<adtype>                              &local_rhs_ext_cell);
 
 protected:
     /// Evaluate the integral over the cell volume and the specified derivatives.
@@ -367,8 +572,37 @@ protected:
         dealii::Vector<real> &current_cell_rhs,
         const dealii::FEValues<dim,dim> &fe_values_lagrange);
     
+    /// Builds the volume metric terms of a cell into metric_oper.
+    /** If Parameters::AllParameters::use_metric_terms_cache is set, the terms are copied from the
+     *  high-order grid's metric terms cache when available, and stored in it otherwise.
+     */
+    void build_volume_metric_terms(
+        const dealii::types::global_dof_index              cell_index,
+        const unsigned int                                 poly_degree,
+        const unsigned int                                 n_grid_nodes,
+        const std::array<std::vector<real>,dim>            &mapping_support_points,
+        OPERATOR::mapping_shape_functions<dim,2*dim,real>  &mapping_basis,
+        OPERATOR::metric_operators<real,dim,2*dim>         &metric_oper);
+
+    /// Builds the facet metric terms of face iface of a cell into metric_oper.
+    /** Uses the high-order grid's metric terms cache the same way as build_volume_metric_terms(). */
+    void build_facet_metric_terms(
+        const dealii::types::global_dof_index              cell_index,
+        const unsigned int                                 iface,
+        const unsigned int                                 poly_degree,
+        const unsigned int                                 n_grid_nodes,
+        const std::array<std::vector<real>,dim>            &mapping_support_points,
+        OPERATOR::mapping_shape_functions<dim,2*dim,real>  &mapping_basis,
+        OPERATOR::metric_operators<real,dim,2*dim>         &metric_oper);
 
     using DGBase<dim,real,MeshType>::pcout; ///< Parallel std::cout that only outputs on mpi_rank==0
+
+private:
+    /// Derivatives of the residual with respect to the auxiliary solution in each direction, see add_auxiliary_dRdW().
+    std::array<dealii::TrilinosWrappers::SparseMatrix,dim> dRdQ;
+
+    /// Derivatives of the auxiliary right-hand side in each direction with respect to the solution, see add_auxiliary_dRdW().
+    std::array<dealii::TrilinosWrappers::SparseMatrix,dim> dAdW;
     
 }; // end of DGStrong class
 
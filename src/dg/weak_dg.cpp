@@ -31,6 +31,10 @@ template <typename real, int dim> using CoordGrad = std::array<dealii::Tensor<1,
 template <typename real, int nstate> using State = std::array<real, nstate>;
 // First index corresponds to the component of the state, second index corresponds to the component of the gradient.
 template <typename real, int dim, int nstate> using DirectionalState = std::array<dealii::Tensor<1, dim, real>, nstate>;
+
+// States of a batch of points, stored by component such that the physics is evaluated for all the points at once.
+template <typename real, int nstate> using StateVectors = std::array<std::vector<real>, nstate>;
+template <typename real, int dim, int nstate> using DirectionalStateVectors = std::array<dealii::Tensor<1, dim, std::vector<real>>, nstate>;
 }
 
 namespace {
@@ -452,8 +456,9 @@ DGWeak<dim,nstate,real,MeshType>::DGWeak(
     const unsigned int degree,
     const unsigned int max_degree_input,
     const unsigned int grid_degree_input,
-    const std::shared_ptr<Triangulation> triangulation_input)
-    : DGBaseState<dim,nstate,real,MeshType>::DGBaseState(parameters_input, degree, max_degree_input, grid_degree_input, triangulation_input)
+    const std::shared_ptr<Triangulation> triangulation_input,
+    const MPI_Comm mpi_communicator_input)
+    : DGBaseState<dim,nstate,real,MeshType>::DGBaseState(parameters_input, degree, max_degree_input, grid_degree_input, triangulation_input, mpi_communicator_input)
 { }
 
 template <int dim, int nstate, typename real, typename MeshType>
@@ -1084,7 +1089,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_term_derivatives(
                 AssertIsFinite(residual_derivatives[idof]);
             }
             const bool elide_zero_values = false;
-            this->system_matrix.add(soln_dof_indices[itest], soln_dof_indices, residual_derivatives, elide_zero_values);
+            this->add_to_system_matrix(soln_dof_indices[itest], soln_dof_indices, residual_derivatives, elide_zero_values);
         }
         if (compute_dRdX) {
             std::vector<real> residual_derivatives(n_metric_dofs);
@@ -1169,7 +1174,8 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_codi_taped_derivatives(
                                           w_start, w_end, x_start, x_end );
 
     using TH = codi::TapeHelper<adtype>;
-    TH th;
+    CoDiTapeCache<adtype> &tape_cache = get_tape_cache<adtype>();
+    TH &th = tape_cache.tape_helper;
     adtype::getGlobalTape();
     if (compute_dRdW || compute_dRdX || compute_d2R) {
         th.startRecording();
@@ -1236,41 +1242,39 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_codi_taped_derivatives(
         AssertIsFinite(local_rhs_cell(itest));
     }
 
-    if (compute_dRdW) {
-        typename TH::JacobianType& jac = th.createJacobian();
+    if (compute_dRdW || compute_dRdX) {
+        // A single evaluation gives both dRdW and dRdX, and the row buffers are reused across the rows.
+        typename TH::JacobianType& jac = tape_cache.jacobian();
         th.evalJacobian(jac);
-        for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
 
+        if (compute_dRdW) {
             std::vector<real> residual_derivatives(n_soln_dofs);
-            for (unsigned int idof = 0; idof < n_soln_dofs; ++idof) {
-                const unsigned int i_dx = idof+w_start;
-                residual_derivatives[idof] = jac(itest,i_dx);
-                AssertIsFinite(residual_derivatives[idof]);
+            for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+                for (unsigned int idof = 0; idof < n_soln_dofs; ++idof) {
+                    const unsigned int i_dx = idof+w_start;
+                    residual_derivatives[idof] = jac(itest,i_dx);
+                    AssertIsFinite(residual_derivatives[idof]);
+                }
+                const bool elide_zero_values = false;
+                this->add_to_system_matrix(soln_dof_indices[itest], soln_dof_indices, residual_derivatives, elide_zero_values);
             }
-            const bool elide_zero_values = false;
-            this->system_matrix.add(soln_dof_indices[itest], soln_dof_indices, residual_derivatives, elide_zero_values);
         }
-        th.deleteJacobian(jac);
-
-    }
 
-    if (compute_dRdX) {
-        typename TH::JacobianType& jac = th.createJacobian();
-        th.evalJacobian(jac);
-        for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+        if (compute_dRdX) {
             std::vector<real> residual_derivatives(n_metric_dofs);
-            for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
-                const unsigned int i_dx = idof+x_start;
-                residual_derivatives[idof] = jac(itest,i_dx);
+            for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+                for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
+                    const unsigned int i_dx = idof+x_start;
+                    residual_derivatives[idof] = jac(itest,i_dx);
+                }
+                this->dRdXv.add(soln_dof_indices[itest], metric_dof_indices, residual_derivatives);
             }
-            this->dRdXv.add(soln_dof_indices[itest], metric_dof_indices, residual_derivatives);
         }
-        th.deleteJacobian(jac);
     }
 
 
     if (compute_d2R) {
-        typename TH::HessianType& hes = th.createHessian();
+        typename TH::HessianType& hes = tape_cache.hessian();
         th.evalHessian(hes);
 
         int i_dependent = (compute_dRdW || compute_dRdX) ? n_soln_dofs : 0;
@@ -1306,8 +1310,6 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_codi_taped_derivatives(
             }
             this->d2RdXdX.add(metric_dof_indices[idof], metric_dof_indices, dXidX);
         }
-
-        th.deleteHessian(hes);
     }
     for (unsigned int idof = 0; idof < n_soln_dofs; ++idof) {
         adtype::getGlobalTape().deactivateValue(local_solution.coefficients[idof]);
@@ -2133,7 +2135,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_derivatives(
                 residual_derivatives[idof] = rhs_int[itest_int].dx(i_dx).val();
             }
             const bool elide_zero_values = false;
-            this->system_matrix.add(soln_dof_indices_int[itest_int], soln_dof_indices_int, residual_derivatives, elide_zero_values);
+            this->add_to_system_matrix(soln_dof_indices_int[itest_int], soln_dof_indices_int, residual_derivatives, elide_zero_values);
 
             // dR_int_dW_ext
             residual_derivatives.resize(n_soln_dofs_ext);
@@ -2141,7 +2143,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_derivatives(
                 const unsigned int i_dx = idof+w_ext_start;
                 residual_derivatives[idof] = rhs_int[itest_int].dx(i_dx).val();
             }
-            this->system_matrix.add(soln_dof_indices_int[itest_int], soln_dof_indices_ext, residual_derivatives, elide_zero_values);
+            this->add_to_system_matrix(soln_dof_indices_int[itest_int], soln_dof_indices_ext, residual_derivatives, elide_zero_values);
         }
 
         for (unsigned int itest_ext=0; itest_ext<n_soln_dofs_ext; ++itest_ext) {
@@ -2152,7 +2154,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_derivatives(
                 residual_derivatives[idof] = rhs_ext[itest_ext].dx(i_dx).val();
             }
             const bool elide_zero_values = false;
-            this->system_matrix.add(soln_dof_indices_ext[itest_ext], soln_dof_indices_int, residual_derivatives, elide_zero_values);
+            this->add_to_system_matrix(soln_dof_indices_ext[itest_ext], soln_dof_indices_int, residual_derivatives, elide_zero_values);
 
             // dR_ext_dW_ext
             residual_derivatives.resize(n_soln_dofs_ext);
@@ -2160,7 +2162,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_derivatives(
                 const unsigned int i_dx = idof+w_ext_start;
                 residual_derivatives[idof] = rhs_ext[itest_ext].dx(i_dx).val();
             }
-            this->system_matrix.add(soln_dof_indices_ext[itest_ext], soln_dof_indices_ext, residual_derivatives, elide_zero_values);
+            this->add_to_system_matrix(soln_dof_indices_ext[itest_ext], soln_dof_indices_ext, residual_derivatives, elide_zero_values);
         }
     }
     if (compute_dRdX) {
@@ -2368,7 +2370,8 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_codi_taped_derivatives(
         x_int_start, x_int_end, x_ext_start, x_ext_end);
 
     using TH = codi::TapeHelper<adtype>;
-    TH th;
+    CoDiTapeCache<adtype> &tape_cache = get_tape_cache<adtype>();
+    TH &th = tape_cache.tape_helper;
     adtype::getGlobalTape();
     if (compute_dRdW || compute_dRdX || compute_d2R) {
         th.startRecording();
@@ -2472,7 +2475,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_codi_taped_derivatives(
     }
 
     if (compute_dRdW || compute_dRdX) {
-        typename TH::JacobianType& jac = th.createJacobian();
+        typename TH::JacobianType& jac = tape_cache.jacobian();
         th.evalJacobian(jac);
 
         if (compute_dRdW) {
@@ -2488,7 +2491,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_codi_taped_derivatives(
                     residual_derivatives[idof] = jac(i_dependent,i_dx);
                 }
                 const bool elide_zero_values = false;
-                this->system_matrix.add(soln_dof_indices_int[itest_int], soln_dof_indices_int, residual_derivatives, elide_zero_values);
+                this->add_to_system_matrix(soln_dof_indices_int[itest_int], soln_dof_indices_int, residual_derivatives, elide_zero_values);
 
                 // dR_int_dW_ext
                 residual_derivatives.resize(n_soln_dofs_ext);
@@ -2496,7 +2499,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_codi_taped_derivatives(
                     const unsigned int i_dx = idof+w_ext_start;
                     residual_derivatives[idof] = jac(i_dependent,i_dx);
                 }
-                this->system_matrix.add(soln_dof_indices_int[itest_int], soln_dof_indices_ext, residual_derivatives, elide_zero_values);
+                this->add_to_system_matrix(soln_dof_indices_int[itest_int], soln_dof_indices_ext, residual_derivatives, elide_zero_values);
             }
 
             for (unsigned int itest_ext=0; itest_ext<n_soln_dofs_ext; ++itest_ext) {
@@ -2510,7 +2513,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_codi_taped_derivatives(
                     residual_derivatives[idof] = jac(i_dependent,i_dx);
                 }
                 const bool elide_zero_values = false;
-                this->system_matrix.add(soln_dof_indices_ext[itest_ext], soln_dof_indices_int, residual_derivatives, elide_zero_values);
+                this->add_to_system_matrix(soln_dof_indices_ext[itest_ext], soln_dof_indices_int, residual_derivatives, elide_zero_values);
 
                 // dR_ext_dW_ext
                 residual_derivatives.resize(n_soln_dofs_ext);
@@ -2518,7 +2521,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_codi_taped_derivatives(
                     const unsigned int i_dx = idof+w_ext_start;
                     residual_derivatives[idof] = jac(i_dependent,i_dx);
                 }
-                this->system_matrix.add(soln_dof_indices_ext[itest_ext], soln_dof_indices_ext, residual_derivatives, elide_zero_values);
+                this->add_to_system_matrix(soln_dof_indices_ext[itest_ext], soln_dof_indices_ext, residual_derivatives, elide_zero_values);
             }
         }
 
@@ -2563,12 +2566,10 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_codi_taped_derivatives(
                 this->dRdXv.add(soln_dof_indices_ext[itest_ext], metric_dof_indices_ext, residual_derivatives);
             }
         }
-
-        th.deleteJacobian(jac);
     }
 
     if (compute_d2R) {
-        typename TH::HessianType& hes = th.createHessian();
+        typename TH::HessianType& hes = tape_cache.hessian();
         th.evalHessian(hes);
 
         std::vector<real> dWidW(n_soln_dofs_int);
@@ -2681,8 +2682,6 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_codi_taped_derivatives(
             }
             this->d2RdXdX.add(metric_dof_indices_ext[idof], metric_dof_indices_ext, dXidX);
         }
-
-        th.deleteHessian(hes);
     }
 
     for (unsigned int idof = 0; idof < n_soln_dofs_int; ++idof) {
@@ -2977,58 +2976,90 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_volume_term(
         artificial_diss_coeff_at_q[iquad] = arti_diss * gegenbauer;*/
     }
 
-    std::vector<State> soln_at_q(n_quad_pts);
-    std::vector<DirectionalState> soln_grad_at_q(n_quad_pts); // Tensor initialize with zeros
-
-    std::vector<DirectionalState> conv_phys_flux_at_q(n_quad_pts);
-    std::vector<DirectionalState> diss_phys_flux_at_q(n_quad_pts);
-    std::vector<State> source_at_q;
+    // The solution and the physical fluxes at the quadrature points are stored by state,
+    // such that the physics evaluates them for the whole cell at once.
+    StateVectors<real2,nstate> soln_at_q;
+    DirectionalStateVectors<real2,dim,nstate> soln_grad_at_q;
+    DirectionalStateVectors<real2,dim,nstate> conv_phys_flux_at_q;
+    DirectionalStateVectors<real2,dim,nstate> diss_phys_flux_at_q;
+    for (int istate=0; istate<nstate; istate++) {
+        soln_at_q[istate].assign(n_quad_pts, 0.0);
+        for (int d=0;d<dim;++d) {
+            soln_grad_at_q[istate][d].assign(n_quad_pts, 0.0);
+            conv_phys_flux_at_q[istate][d].resize(n_quad_pts);
+            diss_phys_flux_at_q[istate][d].resize(n_quad_pts);
+        }
+    }
     std::vector<State> physical_source_at_q;
+    StateVectors<real2,nstate> source_at_q;
 
     for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
-        for (int istate=0; istate<nstate; istate++) {
-            soln_at_q[iquad][istate]      = 0;
-            soln_grad_at_q[iquad][istate] = 0;
-        }
         for (unsigned int idof=0; idof<n_soln_dofs; ++idof) {
             const unsigned int istate = local_solution.finite_element.system_to_component_index(idof).first;
-            soln_at_q[iquad][istate]      += local_solution.coefficients[idof] * interpolation_operator[idof][iquad];
+            soln_at_q[istate][iquad]      += local_solution.coefficients[idof] * interpolation_operator[idof][iquad];
             for (int d=0;d<dim;++d) {
-                soln_grad_at_q[iquad][istate][d] += local_solution.coefficients[idof] * gradient_operator[d][idof][iquad];
+                soln_grad_at_q[istate][d][iquad] += local_solution.coefficients[idof] * gradient_operator[d][idof][iquad];
             }
         }
-        conv_phys_flux_at_q[iquad] = physics.convective_flux (soln_at_q[iquad]);
-        diss_phys_flux_at_q[iquad] = physics.dissipative_flux (soln_at_q[iquad], soln_grad_at_q[iquad], current_cell_index);
+    }
+    physics.convective_flux_batch (soln_at_q, conv_phys_flux_at_q);
+    physics.dissipative_flux_batch (soln_at_q, soln_grad_at_q, current_cell_index, diss_phys_flux_at_q);
 
-        if(physics.has_nonzero_physical_source){
-            physical_source_at_q.resize(n_quad_pts);
-            dealii::Point<dim,real2> ad_points;
-            for (int d=0;d<dim;++d) { ad_points[d] = 0.0;}
+    const bool use_manufactured_source = this->all_parameters->manufactured_convergence_study_param.manufactured_solution_param.use_manufactured_source_term;
+    if (physics.has_nonzero_physical_source || use_manufactured_source) {
+        // Physical coordinates of the quadrature points
+        dealii::Tensor<1,dim,std::vector<real2>> ad_points;
+        for (int d=0;d<dim;++d) { ad_points[d].assign(n_quad_pts, 0.0); }
+        for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
             for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
                 const int iaxis = local_metric.finite_element.system_to_component_index(idof).first;
-                ad_points[iaxis] += local_metric.coefficients[idof] * local_metric.finite_element.shape_value(idof,unit_quad_pts[iquad]);
+                ad_points[iaxis][iquad] += local_metric.coefficients[idof] * local_metric.finite_element.shape_value(idof,unit_quad_pts[iquad]);
             }
-            physical_source_at_q[iquad] = physics.physical_source_term (ad_points, soln_at_q[iquad], soln_grad_at_q[iquad], current_cell_index);
         }
 
-        if (this->all_parameters->artificial_dissipation_param.add_artificial_dissipation) {
-            DirectionalState artificial_diss_phys_flux_at_q;
-            //artificial_diss_phys_flux_at_q = physics.artificial_dissipative_flux (artificial_diss_coeff, soln_at_q[iquad], soln_grad_at_q[iquad]);
-            artificial_diss_phys_flux_at_q = this->artificial_dissip->calc_artificial_dissipation_flux(soln_at_q[iquad], soln_grad_at_q[iquad],artificial_diss_coeff_at_q[iquad]);
-            for (int s=0; s<nstate; s++) {
-                diss_phys_flux_at_q[iquad][s] += artificial_diss_phys_flux_at_q[s];
+        if(physics.has_nonzero_physical_source){
+            physical_source_at_q.resize(n_quad_pts);
+            for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
+                dealii::Point<dim,real2> ad_point;
+                State soln_state;
+                DirectionalState soln_grad_state;
+                for (int d=0;d<dim;++d) { ad_point[d] = ad_points[d][iquad]; }
+                for (int istate=0; istate<nstate; istate++) {
+                    soln_state[istate] = soln_at_q[istate][iquad];
+                    for (int d=0;d<dim;++d) {
+                        soln_grad_state[istate][d] = soln_grad_at_q[istate][d][iquad];
+                    }
+                }
+                physical_source_at_q[iquad] = physics.physical_source_term (ad_point, soln_state, soln_grad_state, current_cell_index);
             }
         }
 
-        if(this->all_parameters->manufactured_convergence_study_param.manufactured_solution_param.use_manufactured_source_term) {
-            source_at_q.resize(n_quad_pts);
-            dealii::Point<dim,real2> ad_point;
-            for (int d=0;d<dim;++d) { ad_point[d] = 0.0;}
-            for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
-                const int iaxis = local_metric.finite_element.system_to_component_index(idof).first;
-                ad_point[iaxis] += local_metric.coefficients[idof] * local_metric.finite_element.shape_value(idof,unit_quad_pts[iquad]);
+        if(use_manufactured_source) {
+            for (int istate=0; istate<nstate; istate++) {
+                source_at_q[istate].resize(n_quad_pts);
+            }
+            physics.source_term_batch (ad_points, soln_at_q, this->current_time, current_cell_index, source_at_q);
+        }
+    }
+
+    if (this->all_parameters->artificial_dissipation_param.add_artificial_dissipation) {
+        for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
+            State soln_state;
+            DirectionalState soln_grad_state;
+            for (int istate=0; istate<nstate; istate++) {
+                soln_state[istate] = soln_at_q[istate][iquad];
+                for (int d=0;d<dim;++d) {
+                    soln_grad_state[istate][d] = soln_grad_at_q[istate][d][iquad];
+                }
+            }
+            DirectionalState artificial_diss_phys_flux_at_q;
+            //artificial_diss_phys_flux_at_q = physics.artificial_dissipative_flux (artificial_diss_coeff, soln_state, soln_grad_state);
+            artificial_diss_phys_flux_at_q = this->artificial_dissip->calc_artificial_dissipation_flux(soln_state, soln_grad_state, artificial_diss_coeff_at_q[iquad]);
+            for (int s=0; s<nstate; s++) {
+                for (int d=0;d<dim;++d) {
+                    diss_phys_flux_at_q[s][d][iquad] += artificial_diss_phys_flux_at_q[s][d];
+                }
             }
-            source_at_q[iquad] = physics.source_term (ad_point, soln_at_q[iquad], this->current_time, current_cell_index);
         }
     }
 
@@ -3050,18 +3081,18 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_volume_term(
 
             for (int d=0;d<dim;++d) {
                 // Convective
-                rhs[itest] = rhs[itest] + gradient_operator[d][itest][iquad] * conv_phys_flux_at_q[iquad][istate][d] * JxW_iquad;
+                rhs[itest] = rhs[itest] + gradient_operator[d][itest][iquad] * conv_phys_flux_at_q[istate][d][iquad] * JxW_iquad;
                 //// Diffusive
                 //// Note that for diffusion, the negative is defined in the physics
-                rhs[itest] = rhs[itest] + gradient_operator[d][itest][iquad] * diss_phys_flux_at_q[iquad][istate][d] * JxW_iquad;
+                rhs[itest] = rhs[itest] + gradient_operator[d][itest][iquad] * diss_phys_flux_at_q[istate][d][iquad] * JxW_iquad;
             }
             // Physical source
             if(physics.has_nonzero_physical_source){
                 rhs[itest] = rhs[itest] + interpolation_operator[itest][iquad]* physical_source_at_q[iquad][istate] * JxW_iquad;
             }
             // Source
-            if(this->all_parameters->manufactured_convergence_study_param.manufactured_solution_param.use_manufactured_source_term) {
-                rhs[itest] = rhs[itest] + interpolation_operator[itest][iquad]* source_at_q[iquad][istate] * JxW_iquad;
+            if(use_manufactured_source) {
+                rhs[itest] = rhs[itest] + interpolation_operator[itest][iquad]* source_at_q[istate][iquad] * JxW_iquad;
             }
         }
         dual_dot_residual += local_dual[itest]*rhs[itest];
@@ -3166,7 +3197,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_volume_term_derivatives(
                 AssertIsFinite(residual_derivatives[idof]);
             }
             const bool elide_zero_values = false;
-            this->system_matrix.add(soln_dof_indices[itest], soln_dof_indices, residual_derivatives, elide_zero_values);
+            this->add_to_system_matrix(soln_dof_indices[itest], soln_dof_indices, residual_derivatives, elide_zero_values);
         }
         if (compute_dRdX) {
             std::vector<real> residual_derivatives(n_metric_dofs);
@@ -3271,7 +3302,8 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_volume_codi_taped_derivatives(
                                           w_start, w_end, x_start, x_end );
 
     using TH = codi::TapeHelper<adtype>;
-    TH th;
+    CoDiTapeCache<adtype> &tape_cache = get_tape_cache<adtype>();
+    TH &th = tape_cache.tape_helper;
     adtype::getGlobalTape();
     if (compute_dRdW || compute_dRdX || compute_d2R) {
         th.startRecording();
@@ -3325,41 +3357,39 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_volume_codi_taped_derivatives(
         AssertIsFinite(local_rhs_cell(itest));
     }
 
-    if (compute_dRdW) {
-        typename TH::JacobianType& jac = th.createJacobian();
+    if (compute_dRdW || compute_dRdX) {
+        // A single evaluation gives both dRdW and dRdX, and the row buffers are reused across the rows.
+        typename TH::JacobianType& jac = tape_cache.jacobian();
         th.evalJacobian(jac);
-        for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
 
+        if (compute_dRdW) {
             std::vector<real> residual_derivatives(n_soln_dofs);
-            for (unsigned int idof = 0; idof < n_soln_dofs; ++idof) {
-                const unsigned int i_dx = idof+w_start;
-                residual_derivatives[idof] = jac(itest,i_dx);
-                AssertIsFinite(residual_derivatives[idof]);
+            for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+                for (unsigned int idof = 0; idof < n_soln_dofs; ++idof) {
+                    const unsigned int i_dx = idof+w_start;
+                    residual_derivatives[idof] = jac(itest,i_dx);
+                    AssertIsFinite(residual_derivatives[idof]);
+                }
+                const bool elide_zero_values = false;
+                this->add_to_system_matrix(soln_dof_indices[itest], soln_dof_indices, residual_derivatives, elide_zero_values);
             }
-            const bool elide_zero_values = false;
-            this->system_matrix.add(soln_dof_indices[itest], soln_dof_indices, residual_derivatives, elide_zero_values);
         }
-        th.deleteJacobian(jac);
-
-    }
 
-    if (compute_dRdX) {
-        typename TH::JacobianType& jac = th.createJacobian();
-        th.evalJacobian(jac);
-        for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+        if (compute_dRdX) {
             std::vector<real> residual_derivatives(n_metric_dofs);
-            for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
-                const unsigned int i_dx = idof+x_start;
-                residual_derivatives[idof] = jac(itest,i_dx);
+            for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+                for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
+                    const unsigned int i_dx = idof+x_start;
+                    residual_derivatives[idof] = jac(itest,i_dx);
+                }
+                this->dRdXv.add(soln_dof_indices[itest], metric_dof_indices, residual_derivatives);
             }
-            this->dRdXv.add(soln_dof_indices[itest], metric_dof_indices, residual_derivatives);
         }
-        th.deleteJacobian(jac);
     }
 
 
     if (compute_d2R) {
-        typename TH::HessianType& hes = th.createHessian();
+        typename TH::HessianType& hes = tape_cache.hessian();
         th.evalHessian(hes);
 
         int i_dependent = (compute_dRdW || compute_dRdX) ? n_soln_dofs : 0;
@@ -3395,8 +3425,6 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_volume_codi_taped_derivatives(
             }
             this->d2RdXdX.add(metric_dof_indices[idof], metric_dof_indices, dXidX);
         }
-
-        th.deleteHessian(hes);
     }
 
     for (unsigned int idof = 0; idof < n_soln_dofs; ++idof) {
@@ -3627,6 +3655,232 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_derivatives(
 #endif
 
 
+template <int dim, int nstate, typename real, typename MeshType>
+void DGWeak<dim,nstate,real,MeshType>::assemble_volume_directional_derivative(
+    typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+    const dealii::types::global_dof_index current_cell_index,
+    const dealii::FEValues<dim,dim> &fe_values_vol,
+    const dealii::FESystem<dim,dim> &fe_soln,
+    const dealii::Quadrature<dim> &quadrature,
+    const std::vector<dealii::types::global_dof_index> &metric_dof_indices,
+    const std::vector<dealii::types::global_dof_index> &soln_dof_indices,
+    dealii::Vector<real> &local_rhs_cell)
+{
+    // RadFadType is evaluated without recording, such that only its primal values are computed.
+    // Those are of the static-size forward type codi_TangentType, which carries the tangent
+    // without the heap allocation of each FadType derivative array.
+    using adtype = RadFadType;
+
+    const bool compute_metric_derivatives = true;
+
+    const dealii::FESystem<dim> &fe_metric = this->high_order_grid->fe_system;
+    const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
+    const unsigned int n_soln_dofs = fe_soln.dofs_per_cell;
+
+    AssertDimension (n_soln_dofs, soln_dof_indices.size());
+
+    LocalSolution<adtype, dim, nstate> local_solution(fe_soln);
+    LocalSolution<adtype, dim, dim> local_metric(fe_metric);
+
+    std::vector<real> local_dual(n_soln_dofs);
+    for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+        local_dual[itest] = this->dual[soln_dof_indices[itest]];
+    }
+
+    // Passive values carrying a single tangent seeded with the direction.
+    for (unsigned int idof = 0; idof < n_soln_dofs; ++idof) {
+        local_solution.coefficients[idof] = this->solution(soln_dof_indices[idof]);
+        local_solution.coefficients[idof].value().gradient()[0] = (*this->dRdW_direction)(soln_dof_indices[idof]);
+    }
+    for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
+        local_metric.coefficients[idof] = this->high_order_grid->volume_nodes[metric_dof_indices[idof]];
+    }
+
+    adtype dual_dot_residual = 0.0;
+    std::vector<adtype> rhs(n_soln_dofs);
+    assemble_volume_term<adtype>(
+        cell,
+        current_cell_index,
+        local_solution, local_metric, local_dual,
+        quadrature,
+        *(DGBaseState<dim,nstate,real,MeshType>::pde_physics_rad_fad),
+        rhs, dual_dot_residual,
+        compute_metric_derivatives, fe_values_vol);
+
+    for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+        local_rhs_cell(itest) += getValue<adtype>(rhs[itest]);
+        AssertIsFinite(local_rhs_cell(itest));
+        this->dRdW_direction_product[soln_dof_indices[itest]] += rhs[itest].getValue().getGradient()[0];
+    }
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_directional_derivative(
+    typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+    const dealii::types::global_dof_index current_cell_index,
+    const unsigned int face_number,
+    const unsigned int boundary_id,
+    const dealii::FEFaceValuesBase<dim,dim> &fe_values_boundary,
+    const real penalty,
+    const dealii::FESystem<dim,dim> &fe_soln,
+    const dealii::Quadrature<dim-1> &quadrature,
+    const std::vector<dealii::types::global_dof_index> &metric_dof_indices,
+    const std::vector<dealii::types::global_dof_index> &soln_dof_indices,
+    dealii::Vector<real> &local_rhs_cell)
+{
+    // Passive RadFadType carrying the tangent in its primal values, see assemble_volume_directional_derivative().
+    using adtype = RadFadType;
+
+    const bool compute_metric_derivatives = true;
+
+    const dealii::FESystem<dim> &fe_metric = this->high_order_grid->fe_system;
+    const unsigned int n_soln_dofs = fe_values_boundary.dofs_per_cell;
+    const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
+
+    AssertDimension (n_soln_dofs, soln_dof_indices.size());
+
+    LocalSolution<adtype, dim, nstate> local_solution(fe_soln);
+    LocalSolution<adtype, dim, dim> local_metric(fe_metric);
+
+    for (unsigned int idof = 0; idof < n_soln_dofs; ++idof) {
+        local_solution.coefficients[idof] = this->solution(soln_dof_indices[idof]);
+        local_solution.coefficients[idof].value().gradient()[0] = (*this->dRdW_direction)(soln_dof_indices[idof]);
+    }
+    for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
+        local_metric.coefficients[idof] = this->high_order_grid->volume_nodes[metric_dof_indices[idof]];
+    }
+
+    std::vector<real> local_dual(n_soln_dofs);
+    for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+        local_dual[itest] = this->dual[soln_dof_indices[itest]];
+    }
+
+    std::vector<adtype> rhs(n_soln_dofs);
+    adtype dual_dot_residual;
+    assemble_boundary_term(
+        cell,
+        current_cell_index,
+        local_solution,
+        local_metric,
+        local_dual,
+        face_number,
+        boundary_id,
+        *(DGBaseState<dim,nstate,real,MeshType>::pde_physics_rad_fad),
+        *(DGBaseState<dim,nstate,real,MeshType>::conv_num_flux_rad_fad),
+        *(DGBaseState<dim,nstate,real,MeshType>::diss_num_flux_rad_fad),
+        fe_values_boundary,
+        penalty,
+        quadrature,
+        rhs,
+        dual_dot_residual,
+        compute_metric_derivatives);
+
+    for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+        local_rhs_cell(itest) += getValue<adtype>(rhs[itest]);
+        AssertIsFinite(local_rhs_cell(itest));
+        this->dRdW_direction_product[soln_dof_indices[itest]] += rhs[itest].getValue().getGradient()[0];
+    }
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGWeak<dim,nstate,real,MeshType>::assemble_face_directional_derivative(
+    typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+    const dealii::types::global_dof_index current_cell_index,
+    const dealii::types::global_dof_index neighbor_cell_index,
+    const std::pair<unsigned int, int> face_subface_int,
+    const std::pair<unsigned int, int> face_subface_ext,
+    const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set_int,
+    const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set_ext,
+    const dealii::FEFaceValuesBase<dim,dim>     &fe_values_int,
+    const dealii::FEFaceValuesBase<dim,dim>     &fe_values_ext,
+    const real penalty,
+    const dealii::FESystem<dim,dim> &fe_int,
+    const dealii::FESystem<dim,dim> &fe_ext,
+    const dealii::Quadrature<dim-1> &face_quadrature,
+    const std::vector<dealii::types::global_dof_index> &metric_dof_indices_int,
+    const std::vector<dealii::types::global_dof_index> &metric_dof_indices_ext,
+    const std::vector<dealii::types::global_dof_index> &soln_dof_indices_int,
+    const std::vector<dealii::types::global_dof_index> &soln_dof_indices_ext,
+    dealii::Vector<real>          &local_rhs_int_cell,
+    dealii::Vector<real>          &local_rhs_ext_cell)
+{
+    // Passive RadFadType carrying the tangent in its primal values, see assemble_volume_directional_derivative().
+    using adtype = RadFadType;
+
+    const dealii::FESystem<dim> &fe_metric = this->high_order_grid->fe_system;
+    const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
+    const unsigned int n_soln_dofs_int = fe_int.dofs_per_cell;
+    const unsigned int n_soln_dofs_ext = fe_ext.dofs_per_cell;
+
+    AssertDimension (n_soln_dofs_int, soln_dof_indices_int.size());
+    AssertDimension (n_soln_dofs_ext, soln_dof_indices_ext.size());
+
+    LocalSolution<adtype, dim, nstate> soln_int(fe_int);
+    LocalSolution<adtype, dim, nstate> soln_ext(fe_ext);
+    LocalSolution<adtype, dim, dim> metric_int(fe_metric);
+    LocalSolution<adtype, dim, dim> metric_ext(fe_metric);
+
+    // Both sides are seeded with the direction, such that the tangent is the sum of dR/dW_int and dR/dW_ext.
+    for (unsigned int idof = 0; idof < n_soln_dofs_int; ++idof) {
+        soln_int.coefficients[idof] = this->solution(soln_dof_indices_int[idof]);
+        soln_int.coefficients[idof].value().gradient()[0] = (*this->dRdW_direction)(soln_dof_indices_int[idof]);
+    }
+    for (unsigned int idof = 0; idof < n_soln_dofs_ext; ++idof) {
+        soln_ext.coefficients[idof] = this->solution(soln_dof_indices_ext[idof]);
+        soln_ext.coefficients[idof].value().gradient()[0] = (*this->dRdW_direction)(soln_dof_indices_ext[idof]);
+    }
+    for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
+        metric_int.coefficients[idof] = this->high_order_grid->volume_nodes[metric_dof_indices_int[idof]];
+        metric_ext.coefficients[idof] = this->high_order_grid->volume_nodes[metric_dof_indices_ext[idof]];
+    }
+
+    std::vector<double> dual_int(n_soln_dofs_int);
+    std::vector<double> dual_ext(n_soln_dofs_ext);
+    for (unsigned int itest=0; itest<n_soln_dofs_int; ++itest) {
+        dual_int[itest] = this->dual[soln_dof_indices_int[itest]];
+    }
+    for (unsigned int itest=0; itest<n_soln_dofs_ext; ++itest) {
+        dual_ext[itest] = this->dual[soln_dof_indices_ext[itest]];
+    }
+
+    std::vector<adtype> rhs_int(n_soln_dofs_int);
+    std::vector<adtype> rhs_ext(n_soln_dofs_ext);
+    adtype dual_dot_residual;
+
+    const bool compute_dRdW = false, compute_dRdX = false, compute_d2R = false;
+    assemble_face_term(
+        cell,
+        current_cell_index,
+        neighbor_cell_index,
+        soln_int, soln_ext, metric_int, metric_ext,
+        dual_int,
+        dual_ext,
+        face_subface_int,
+        face_subface_ext,
+        face_data_set_int,
+        face_data_set_ext,
+        *(DGBaseState<dim,nstate,real,MeshType>::pde_physics_rad_fad),
+        *(DGBaseState<dim,nstate,real,MeshType>::conv_num_flux_rad_fad),
+        *(DGBaseState<dim,nstate,real,MeshType>::diss_num_flux_rad_fad),
+        fe_values_int,
+        fe_values_ext,
+        penalty,
+        face_quadrature,
+        rhs_int,
+        rhs_ext,
+        dual_dot_residual,
+        compute_dRdW, compute_dRdX, compute_d2R);
+
+    for (unsigned int itest_int=0; itest_int<n_soln_dofs_int; ++itest_int) {
+        local_rhs_int_cell[itest_int] += getValue<adtype>(rhs_int[itest_int]);
+        this->dRdW_direction_product[soln_dof_indices_int[itest_int]] += rhs_int[itest_int].getValue().getGradient()[0];
+    }
+    for (unsigned int itest_ext=0; itest_ext<n_soln_dofs_ext; ++itest_ext) {
+        local_rhs_ext_cell[itest_ext] += getValue<adtype>(rhs_ext[itest_ext]);
+        this->dRdW_direction_product[soln_dof_indices_ext[itest_ext]] += rhs_ext[itest_ext].getValue().getGradient()[0];
+    }
+}
+
 template <int dim, int nstate, typename real, typename MeshType>
 void DGWeak<dim,nstate,real,MeshType>::assemble_volume_term_and_build_operators(
     typename dealii::DoFHandler<dim>::active_cell_iterator cell,
@@ -3643,6 +3897,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_volume_term_and_build_operators(
     OPERATOR::metric_operators<real,dim,2*dim>             &/*metric_oper*/,
     OPERATOR::mapping_shape_functions<dim,2*dim,real>           &/*mapping_basis*/,
     std::array<std::vector<real>,dim>                      &/*mapping_support_points*/,
+    ScratchArena                                           &/*scratch_arena*/,
     dealii::hp::FEValues<dim,dim>                          &fe_values_collection_volume,
     dealii::hp::FEValues<dim,dim>                          &fe_values_collection_volume_lagrange,
     const dealii::FESystem<dim,dim>                        &current_fe_ref,
@@ -3674,6 +3929,15 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_volume_term_and_build_operators(
     //set current rhs to zero since the explicit call was just to set the max_dt_cell.
     local_rhs_int_cell*=0.0;
 
+    if (this->dRdW_direction != nullptr) {
+        assemble_volume_directional_derivative (
+            cell,
+            current_cell_index,
+            fe_values_volume, current_fe_ref, this->volume_quadrature_collection[i_quad],
+            metric_dof_indices, cell_dofs_indices,
+            local_rhs_int_cell);
+        return;
+    }
     assemble_volume_term_derivatives (
         cell,
         current_cell_index,
@@ -3702,6 +3966,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_term_and_build_operator
     OPERATOR::metric_operators<real,dim,2*dim>             &/*metric_oper*/,
     OPERATOR::mapping_shape_functions<dim,2*dim,real>           &/*mapping_basis*/,
     std::array<std::vector<real>,dim>                      &/*mapping_support_points*/,
+    ScratchArena                                           &/*scratch_arena*/,
     dealii::hp::FEFaceValues<dim,dim>                      &fe_values_collection_face_int,
     const dealii::FESystem<dim,dim>                        &current_fe_ref,
     dealii::Vector<real>                                   &local_rhs_int_cell,
@@ -3717,6 +3982,15 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_term_and_build_operator
     fe_values_collection_face_int.reinit (cell, iface, i_quad, i_mapp, i_fele);
     const dealii::FEFaceValues<dim,dim> &fe_values_face_int = fe_values_collection_face_int.get_present_fe_values();
     const dealii::Quadrature<dim-1> face_quadrature = this->face_quadrature_collection[i_quad];
+    if (this->dRdW_direction != nullptr) {
+        assemble_boundary_directional_derivative (
+            cell,
+            current_cell_index,
+            iface, boundary_id, fe_values_face_int, penalty,
+            current_fe_ref, face_quadrature,
+            metric_dof_indices, cell_dofs_indices, local_rhs_int_cell);
+        return;
+    }
     assemble_boundary_term_derivatives (
         cell,
         current_cell_index,
@@ -3754,6 +4028,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_and_build_operators(
     OPERATOR::metric_operators<real,dim,2*dim>             &/*metric_oper_ext*/,
     OPERATOR::mapping_shape_functions<dim,2*dim,real>           &/*mapping_basis*/,
     std::array<std::vector<real>,dim>                      &/*mapping_support_points*/,
+    ScratchArena                                           &/*scratch_arena*/,
     dealii::hp::FEFaceValues<dim,dim>                      &fe_values_collection_face_int,
     dealii::hp::FEFaceValues<dim,dim>                      &fe_values_collection_face_ext,
     dealii::Vector<real>                                   &current_cell_rhs,
@@ -3795,21 +4070,38 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_and_build_operators(
                                                                                   neighbor_cell->face_rotation(neighbor_iface),
                                                                                   used_face_quadrature.size());
 
-    assemble_face_term_derivatives (
-        cell,
-        current_cell_index,
-        neighbor_cell_index,
-        face_subface_int, face_subface_ext,
-        face_data_set_int,
-        face_data_set_ext,
-        fe_values_face_int, fe_values_face_ext,
-        penalty,
-        this->fe_collection[i_fele], this->fe_collection[i_fele_n],
-        used_face_quadrature,
-        current_metric_dofs_indices, neighbor_metric_dofs_indices,
-        current_dofs_indices, neighbor_dofs_indices,
-        current_cell_rhs, neighbor_cell_rhs,
-        compute_dRdW, compute_dRdX, compute_d2R);
+    if (this->dRdW_direction != nullptr) {
+        assemble_face_directional_derivative (
+            cell,
+            current_cell_index,
+            neighbor_cell_index,
+            face_subface_int, face_subface_ext,
+            face_data_set_int,
+            face_data_set_ext,
+            fe_values_face_int, fe_values_face_ext,
+            penalty,
+            this->fe_collection[i_fele], this->fe_collection[i_fele_n],
+            used_face_quadrature,
+            current_metric_dofs_indices, neighbor_metric_dofs_indices,
+            current_dofs_indices, neighbor_dofs_indices,
+            current_cell_rhs, neighbor_cell_rhs);
+    } else {
+        assemble_face_term_derivatives (
+            cell,
+            current_cell_index,
+            neighbor_cell_index,
+            face_subface_int, face_subface_ext,
+            face_data_set_int,
+            face_data_set_ext,
+            fe_values_face_int, fe_values_face_ext,
+            penalty,
+            this->fe_collection[i_fele], this->fe_collection[i_fele_n],
+            used_face_quadrature,
+            current_metric_dofs_indices, neighbor_metric_dofs_indices,
+            current_dofs_indices, neighbor_dofs_indices,
+            current_cell_rhs, neighbor_cell_rhs,
+            compute_dRdW, compute_dRdX, compute_d2R);
+    }
 
     // Add local contribution from neighbor cell to global vector
     const unsigned int n_dofs_neigh_cell = this->fe_collection[neighbor_cell->active_fe_index()].n_dofs_per_cell();
@@ -3847,6 +4139,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_subface_term_and_build_operators
     OPERATOR::metric_operators<real,dim,2*dim>             &/*metric_oper_ext*/,
     OPERATOR::mapping_shape_functions<dim,2*dim,real>           &/*mapping_basis*/,
     std::array<std::vector<real>,dim>                      &/*mapping_support_points*/,
+    ScratchArena                                           &/*scratch_arena*/,
     dealii::hp::FEFaceValues<dim,dim>                      &fe_values_collection_face_int,
     dealii::hp::FESubfaceValues<dim,dim>                   &fe_values_collection_subface,
     dealii::Vector<real>                                   &current_cell_rhs,
@@ -3889,21 +4182,38 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_subface_term_and_build_operators
                                                                                         used_face_quadrature.size(),
                                                                                 neighbor_cell->subface_case(neighbor_iface));
 
-    assemble_face_term_derivatives (
-        cell,
-        current_cell_index,
-        neighbor_cell_index,
-        face_subface_int, face_subface_ext,
-        face_data_set_int,
-        face_data_set_ext,
-        fe_values_face_int, fe_values_face_ext,
-        penalty,
-        this->fe_collection[i_fele], this->fe_collection[i_fele_n],
-        used_face_quadrature,
-        current_metric_dofs_indices, neighbor_metric_dofs_indices,
-        current_dofs_indices, neighbor_dofs_indices,
-        current_cell_rhs, neighbor_cell_rhs,
-        compute_dRdW, compute_dRdX, compute_d2R);
+    if (this->dRdW_direction != nullptr) {
+        assemble_face_directional_derivative (
+            cell,
+            current_cell_index,
+            neighbor_cell_index,
+            face_subface_int, face_subface_ext,
+            face_data_set_int,
+            face_data_set_ext,
+            fe_values_face_int, fe_values_face_ext,
+            penalty,
+            this->fe_collection[i_fele], this->fe_collection[i_fele_n],
+            used_face_quadrature,
+            current_metric_dofs_indices, neighbor_metric_dofs_indices,
+            current_dofs_indices, neighbor_dofs_indices,
+            current_cell_rhs, neighbor_cell_rhs);
+    } else {
+        assemble_face_term_derivatives (
+            cell,
+            current_cell_index,
+            neighbor_cell_index,
+            face_subface_int, face_subface_ext,
+            face_data_set_int,
+            face_data_set_ext,
+            fe_values_face_int, fe_values_face_ext,
+            penalty,
+            this->fe_collection[i_fele], this->fe_collection[i_fele_n],
+            used_face_quadrature,
+            current_metric_dofs_indices, neighbor_metric_dofs_indices,
+            current_dofs_indices, neighbor_dofs_indices,
+            current_cell_rhs, neighbor_cell_rhs,
+            compute_dRdW, compute_dRdX, compute_d2R);
+    }
 
     // Add local contribution from neighbor cell to global vector
     const unsigned int n_dofs_neigh_cell = this->fe_collection[neighbor_cell->active_fe_index()].n_dofs_per_cell();
@@ -3914,7 +4224,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_subface_term_and_build_operators
 }
 
 template <int dim, int nstate, typename real, typename MeshType>
-void DGWeak<dim,nstate,real,MeshType>::assemble_auxiliary_residual ()
+void DGWeak<dim,nstate,real,MeshType>::assemble_auxiliary_residual (const bool /*compute_dRdW*/)
 {
     //Do Nothing.
 }
@@ -1,6 +1,7 @@
 #ifndef __WEAK_DISCONTINUOUSGALERKIN_H__
 #define __WEAK_DISCONTINUOUSGALERKIN_H__
 
+#include "codi_tape_cache.hpp"
 #include "dg_base_state.hpp"
 #include "solution/local_solution.hpp"
 
@@ -26,7 +27,19 @@ public:
         const unsigned int degree,
         const unsigned int max_degree_input,
         const unsigned int grid_degree_input,
-        const std::shared_ptr<Triangulation> triangulation_input);
+        const std::shared_ptr<Triangulation> triangulation_input,
+        const MPI_Comm mpi_communicator_input = MPI_COMM_WORLD);
+
+    /// The weak form evaluates DGBase::dRdW_vmult() with forward AD directional derivatives.
+    bool supports_dRdW_vmult () const override { return true; }
+
+    /// The weak form tapes dRdW, dRdX and d2R with CoDiPack.
+    bool derivatives_use_global_tape () const override { return true; }
+
+    /// Number of Jacobians and Hessians created by the tape caches of the taped derivatives.
+    /** Stays constant once every cell type has been assembled, see CoDiTapeCache::n_allocations().
+     */
+    unsigned int n_tape_cache_allocations () const { return tape_cache_rad.n_allocations() + tape_cache_rad_fad.n_allocations(); }
 
 private:
 
@@ -46,6 +59,7 @@ private:
         OPERATOR::metric_operators<real,dim,2*dim>             &/*metric_oper*/,
         OPERATOR::mapping_shape_functions<dim,2*dim,real>      &/*mapping_basis*/,
         std::array<std::vector<real>,dim>                      &/*mapping_support_points*/,
+        ScratchArena                                           &/*scratch_arena*/,
         dealii::hp::FEValues<dim,dim>                          &fe_values_collection_volume,
         dealii::hp::FEValues<dim,dim>                          &fe_values_collection_volume_lagrange,
         const dealii::FESystem<dim,dim>                        &current_fe_ref,
@@ -73,6 +87,7 @@ private:
         OPERATOR::metric_operators<real,dim,2*dim>             &/*metric_oper*/,
         OPERATOR::mapping_shape_functions<dim,2*dim,real>      &/*mapping_basis*/,
         std::array<std::vector<real>,dim>                      &/*mapping_support_points*/,
+        ScratchArena                                           &/*scratch_arena*/,
         dealii::hp::FEFaceValues<dim,dim>                      &fe_values_collection_face_int,
         const dealii::FESystem<dim,dim>                        &current_fe_ref,
         dealii::Vector<real>                                   &local_rhs_int_cell,
@@ -108,6 +123,7 @@ private:
         OPERATOR::metric_operators<real,dim,2*dim>             &/*metric_oper_ext*/,
         OPERATOR::mapping_shape_functions<dim,2*dim,real>      &/*mapping_basis*/,
         std::array<std::vector<real>,dim>                      &/*mapping_support_points*/,
+        ScratchArena                                           &/*scratch_arena*/,
         dealii::hp::FEFaceValues<dim,dim>                      &fe_values_collection_face_int,
         dealii::hp::FEFaceValues<dim,dim>                      &fe_values_collection_face_ext,
         dealii::Vector<real>                                   &current_cell_rhs,
@@ -147,6 +163,7 @@ private:
         OPERATOR::metric_operators<real,dim,2*dim>             &/*metric_oper_ext*/,
         OPERATOR::mapping_shape_functions<dim,2*dim,real>      &/*mapping_basis*/,
         std::array<std::vector<real>,dim>                      &/*mapping_support_points*/,
+        ScratchArena                                           &/*scratch_arena*/,
         dealii::hp::FEFaceValues<dim,dim>                      &fe_values_collection_face_int,
         dealii::hp::FESubfaceValues<dim,dim>                   &fe_values_collection_subface,
         dealii::Vector<real>                                   &current_cell_rhs,
@@ -158,7 +175,7 @@ private:
         const bool compute_dRdW, const bool compute_dRdX, const bool compute_d2R);
 
     /// Assembles the auxiliary equations' residuals and solves for the auxiliary variables.
-    void assemble_auxiliary_residual ();
+    void assemble_auxiliary_residual (const bool compute_dRdW);
 
     /// Allocate the dual vector for optimization.
     void allocate_dual_vector ();
@@ -428,6 +445,56 @@ private:
         dealii::Vector<real>          &local_rhs_ext_cell,
         const bool compute_dRdW, const bool compute_dRdX, const bool compute_d2R);
 
+    /// Evaluate the integral over the cell volume and its derivative in the direction of DGBase::dRdW_vmult().
+    /** The solution coefficients carry a single static-size tangent seeded with the direction, see codi_TangentType.
+     *  The residual is added to local_rhs_cell, its directional derivative to DGBase::dRdW_direction_product.
+     */
+    void assemble_volume_directional_derivative(
+        typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+        const dealii::types::global_dof_index current_cell_index,
+        const dealii::FEValues<dim,dim> &fe_values_vol,
+        const dealii::FESystem<dim,dim> &fe_soln,
+        const dealii::Quadrature<dim> &quadrature,
+        const std::vector<dealii::types::global_dof_index> &metric_dof_indices,
+        const std::vector<dealii::types::global_dof_index> &soln_dof_indices,
+        dealii::Vector<real> &local_rhs_cell);
+
+    /// Evaluate the integral over the boundary and its derivative in the direction of DGBase::dRdW_vmult().
+    void assemble_boundary_directional_derivative(
+        typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+        const dealii::types::global_dof_index current_cell_index,
+        const unsigned int face_number,
+        const unsigned int boundary_id,
+        const dealii::FEFaceValuesBase<dim,dim> &fe_values_boundary,
+        const real penalty,
+        const dealii::FESystem<dim,dim> &fe_soln,
+        const dealii::Quadrature<dim-1> &quadrature,
+        const std::vector<dealii::types::global_dof_index> &metric_dof_indices,
+        const std::vector<dealii::types::global_dof_index> &soln_dof_indices,
+        dealii::Vector<real> &local_rhs_cell);
+
+    /// Evaluate the integral over the internal face and its derivative in the direction of DGBase::dRdW_vmult().
+    void assemble_face_directional_derivative(
+        typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+        const dealii::types::global_dof_index current_cell_index,
+        const dealii::types::global_dof_index neighbor_cell_index,
+        const std::pair<unsigned int, int> face_subface_int,
+        const std::pair<unsigned int, int> face_subface_ext,
+        const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set_int,
+        const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set_ext,
+        const dealii::FEFaceValuesBase<dim,dim>     &fe_values_int,
+        const dealii::FEFaceValuesBase<dim,dim>     &fe_values_ext,
+        const real penalty,
+        const dealii::FESystem<dim,dim> &fe_int,
+        const dealii::FESystem<dim,dim> &fe_ext,
+        const dealii::Quadrature<dim-1> &face_quadrature,
+        const std::vector<dealii::types::global_dof_index> &metric_dof_indices_int,
+        const std::vector<dealii::types::global_dof_index> &metric_dof_indices_ext,
+        const std::vector<dealii::types::global_dof_index> &soln_dof_indices_int,
+        const std::vector<dealii::types::global_dof_index> &soln_dof_indices_ext,
+        dealii::Vector<real>          &local_rhs_int_cell,
+        dealii::Vector<real>          &local_rhs_ext_cell);
+
     /// Evaluate the integral over the cell volume
     void assemble_volume_term_explicit(
         typename dealii::DoFHandler<dim>::active_cell_iterator cell,
@@ -441,6 +508,22 @@ private:
         const dealii::FEValues<dim,dim> &fe_values_lagrange);
     
 
+    /// Tape helper and Jacobians of the taped dRdW and dRdX, reused across cells.
+    CoDiTapeCache<RadType> tape_cache_rad;
+    /// Tape helper and Hessians of the taped d2R, reused across cells.
+    CoDiTapeCache<RadFadType> tape_cache_rad_fad;
+
+    /// Returns the tape cache of the taped derivatives of the given type.
+    template <typename adtype>
+    CoDiTapeCache<adtype> & get_tape_cache ()
+    {
+        if constexpr (std::is_same<adtype, RadType>::value) {
+            return tape_cache_rad;
+        } else {
+            return tape_cache_rad_fad;
+        }
+    }
+
     using DGBase<dim,real,MeshType>::pcout; ///< Parallel std::cout that only outputs on mpi_rank==0
 }; // end of DGWeak class
 
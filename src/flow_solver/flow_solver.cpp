@@ -8,6 +8,7 @@
 #include "reduced_order/pod_basis_offline.h"
 #include "physics/initial_conditions/set_initial_condition.h"
 #include "mesh/mesh_adaptation/mesh_adaptation.h"
+#include "ode_solver/parareal_driver.h"
 #include <deal.II/base/timer.h>
 
 namespace PHiLiP {
@@ -392,6 +393,62 @@ void FlowSolver<dim,nstate>::perform_steady_state_mesh_adaptation() const
     pcout<<"Finished running mesh adaptation cycles."<<std::endl; 
 }
 
+template <int dim, int nstate>
+void FlowSolver<dim,nstate>::advance_solution_with_parareal() const
+{
+    if(flow_solver_param.adaptive_time_step == true) {
+        pcout << "Error: Parareal iterations require a constant time step. Set adaptive_time_step to false. Aborting..." << std::endl;
+        std::abort();
+    }
+    using ODEEnum = Parameters::ODESolverParam::ODESolverEnum;
+    if(ode_param.ode_solver_type == ODEEnum::pod_galerkin_solver || ode_param.ode_solver_type == ODEEnum::pod_petrov_galerkin_solver) {
+        pcout << "Error: Parareal iterations are not available with the reduced-order ODE solvers. Aborting..." << std::endl;
+        std::abort();
+    }
+
+    pcout << "Setting constant time step... " << std::flush;
+    const double time_step = flow_solver_case->get_constant_time_step(dg);
+    flow_solver_case->set_time_step(time_step);
+    pcout << "done." << std::endl;
+    const double coarse_time_step = flow_solver_param.parareal_coarse_time_step_factor * time_step;
+
+    // The coarse propagator is a second instance of the ODE solver on the same DG
+    pcout << "Creating the coarse propagator of the Parareal iterations... " << std::endl;
+    std::shared_ptr<ODE::ODESolverBase<dim, double>> coarse_ode_solver = ODE::ODESolverFactory<dim, double>::create_ODESolver(dg);
+    coarse_ode_solver->allocate_ode_system();
+
+    std::shared_ptr<dealii::TableHandler> unsteady_data_table = std::make_shared<dealii::TableHandler>();
+    pcout << "Writing unsteady data computed at initial time... " << std::endl;
+    flow_solver_case->compute_unsteady_data_and_write_to_table(ode_solver, dg, unsteady_data_table);
+    pcout << "done." << std::endl;
+
+    // The flow cases generate the grid and reduce the unsteady data over mpi_communicator, which is then a single slice group
+    ODE::PararealDriver<dim, double> parareal_driver(dg, ode_solver, coarse_ode_solver,
+                                                     flow_solver_param.parareal_number_of_time_slices,
+                                                     flow_solver_param.parareal_maximum_iterations,
+                                                     flow_solver_param.parareal_tolerance,
+                                                     this->mpi_communicator);
+    pcout << "Advancing solution in time with Parareal iterations over "
+          << flow_solver_param.parareal_number_of_time_slices << " time slices... " << std::endl;
+    pcout << "Timer starting. " << std::endl;
+    dealii::Timer timer(this->mpi_communicator,false);
+    timer.start();
+    const int n_parareal_iterations = parareal_driver.advance(ode_solver->current_time, final_time, time_step, coarse_time_step);
+    timer.stop();
+    pcout << "Timer stopped. " << std::endl;
+    pcout << "Parareal iterations: " << n_parareal_iterations << std::endl;
+    const double max_wall_time = dealii::Utilities::MPI::max(timer.wall_time(), this->mpi_communicator);
+    pcout << "Elapsed wall time (mpi max): " << max_wall_time << " seconds." << std::endl;
+    pcout << "Elapsed CPU time: " << timer.cpu_time() << " seconds." << std::endl;
+
+    // Unsteady data at the slice ends, the last one leaving the final solution in dg
+    for (unsigned int n = 1; n < parareal_driver.slice_solutions.size(); ++n) {
+        dg->solution = parareal_driver.slice_solutions[n];
+        dg->solution.update_ghost_values();
+        flow_solver_case->compute_unsteady_data_and_write_to_table(parareal_driver.slice_iterations[n], parareal_driver.slice_times[n], dg, unsteady_data_table);
+    }
+}
+
 template <int dim, int nstate>
 int FlowSolver<dim,nstate>::run() const
 {
@@ -427,7 +484,12 @@ int FlowSolver<dim,nstate>::run() const
     //----------------------------------------------------
     // Select unsteady or steady-state
     //----------------------------------------------------
-    if(flow_solver_param.steady_state == false){
+    if(flow_solver_param.steady_state == false && flow_solver_param.use_parareal == true){
+        //----------------------------------------------------
+        //         UNSTEADY FLOW WITH PARAREAL ITERATIONS
+        //----------------------------------------------------
+        advance_solution_with_parareal();
+    } else if(flow_solver_param.steady_state == false){
         //----------------------------------------------------
         //                  UNSTEADY FLOW
         //----------------------------------------------------
@@ -509,7 +571,7 @@ int FlowSolver<dim,nstate>::run() const
             flow_solver_case->compute_unsteady_data_and_write_to_table(ode_solver, dg, unsteady_data_table);
             // update next time step
             if(flow_solver_param.adaptive_time_step == true) {
-                next_time_step = flow_solver_case->get_adaptive_time_step(dg);
+                next_time_step = flow_solver_case->get_next_adaptive_time_step(ode_solver, dg);
             } else {
                 next_time_step = flow_solver_case->get_constant_time_step(dg);
             }
@@ -137,6 +137,12 @@ private:
      */
     void perform_steady_state_mesh_adaptation() const;
 
+    /// Advances the unsteady solution to the final time with Parareal iterations.
+    /** The ODE solver is the fine propagator, and a second instance of it with a larger time step
+     *  is the coarse propagator, see ODE::PararealDriver.
+     */
+    void advance_solution_with_parareal() const;
+
     /// Fixed times at which to output the solution
     dealii::Table<1,double> output_solution_fixed_times;
 };
@@ -179,6 +179,23 @@ double FlowSolverCaseBase<dim,nstate>::get_adaptive_time_step_initial(std::share
     return 0.0;
 }
 
+template <int dim, int nstate>
+double FlowSolverCaseBase<dim,nstate>::get_next_adaptive_time_step(
+        const std::shared_ptr<ODE::ODESolverBase<dim, double>> ode_solver,
+        std::shared_ptr<DGBase<dim,double>> dg) const
+{
+    using PolicyEnum = Parameters::FlowSolverParam::AdaptiveTimeStepPolicy;
+    if (all_param.flow_solver_param.adaptive_time_step_policy == PolicyEnum::embedded_error) {
+        if (ode_solver->error_controlled_time_step <= 0.0) {
+            pcout << "ERROR: The ODE solver did not provide an error controlled time step. "
+                  << "The embedded_error policy requires a runge_kutta_method with an embedded method. Aborting..." << std::endl;
+            std::abort();
+        }
+        return ode_solver->error_controlled_time_step;
+    }
+    return get_adaptive_time_step(dg);
+}
+
 template <int dim, int nstate>
 void FlowSolverCaseBase<dim, nstate>::steady_state_postprocessing(std::shared_ptr <DGBase<dim, double>> /*dg*/) const
 {
@@ -64,6 +64,13 @@ public:
     /// Virtual function to compute the initial adaptive time step
     virtual double get_adaptive_time_step_initial(std::shared_ptr <DGBase<dim, double>> dg);
 
+    /// Computes the next adaptive time step with the policy selected in the flow solver parameters
+    /** Returns get_adaptive_time_step() for the cfl policy, and the time step proposed by the
+     *  embedded error controller of the ODE solver for the embedded_error policy. */
+    double get_next_adaptive_time_step(
+            const std::shared_ptr<ODE::ODESolverBase<dim, double>> ode_solver,
+            std::shared_ptr <DGBase<dim, double>> dg) const;
+
     /// Virtual function for postprocessing when solving for steady state
     virtual void steady_state_postprocessing(std::shared_ptr <DGBase<dim, double>> dg) const;
 
@@ -168,6 +168,12 @@ dealii::LinearAlgebra::distributed::Vector<real> Adjoint<dim, nstate, real, Mesh
     adjoint_fine.reinit(dg->solution);
     
     dg->assemble_residual(true);
+    if (dg->jacobian_uses_block_storage()) {
+        // The block_csr Jacobian is transposed block by block.
+        dg->block_system_matrix *= -1.0;
+        solve_linear(dg->get_block_system_matrix_transpose(), dIdw_fine, adjoint_fine, dg->all_parameters->linear_solver_param);
+        return adjoint_fine;
+    }
     dg->system_matrix *= -1.0;
 
     dealii::TrilinosWrappers::SparseMatrix system_matrix_transpose;
@@ -198,6 +204,12 @@ dealii::LinearAlgebra::distributed::Vector<real> Adjoint<dim, nstate, real, Mesh
     adjoint_coarse.reinit(dg->solution);
 
     dg->assemble_residual(true);
+    if (dg->jacobian_uses_block_storage()) {
+        // The block_csr Jacobian is transposed block by block.
+        dg->block_system_matrix *= -1.0;
+        solve_linear(dg->get_block_system_matrix_transpose(), dIdw_coarse, adjoint_coarse, dg->all_parameters->linear_solver_param);
+        return adjoint_coarse;
+    }
     dg->system_matrix *= -1.0;
 
     dealii::TrilinosWrappers::SparseMatrix system_matrix_transpose;
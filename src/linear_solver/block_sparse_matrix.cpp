@@ -0,0 +1,425 @@
+#include <algorithm>
+#include <map>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/full_matrix.h>
+
+#include "block_sparse_matrix.h"
+
+namespace PHiLiP {
+
+void BlockSparseMatrix::reinit(
+    const std::shared_ptr<const dealii::Utilities::MPI::Partitioner> &partitioner_input,
+    const std::vector<std::vector<dealii::types::global_dof_index>> &block_dofs,
+    const std::vector<unsigned int> &block_owners,
+    const std::vector<std::vector<unsigned int>> &block_couplings)
+{
+    AssertDimension(block_dofs.size(), block_owners.size());
+    AssertDimension(block_dofs.size(), block_couplings.size());
+
+    partitioner = partitioner_input;
+    n_global_rows = partitioner->size();
+    const unsigned int this_process = partitioner->this_mpi_process();
+    const unsigned int n_local_dofs = partitioner->locally_owned_range().n_elements()
+                                      + partitioner->ghost_indices().n_elements();
+    const unsigned int n_stored_blocks = block_dofs.size();
+
+    n_owned_blocks = 0;
+    while (n_owned_blocks < n_stored_blocks && block_owners[n_owned_blocks] == this_process) ++n_owned_blocks;
+    for (unsigned int iblock = n_owned_blocks; iblock < n_stored_blocks; ++iblock) {
+        Assert(block_owners[iblock] != this_process,
+               dealii::ExcMessage("The locally owned blocks must come first."));
+    }
+    block_owner = block_owners;
+
+    block_dof_start.assign(n_stored_blocks+1, 0);
+    for (unsigned int iblock = 0; iblock < n_stored_blocks; ++iblock) {
+        block_dof_start[iblock+1] = block_dof_start[iblock] + block_dofs[iblock].size();
+    }
+    block_local_dofs.resize(block_dof_start.back());
+    dof_block.assign(n_local_dofs, dealii::numbers::invalid_unsigned_int);
+    dof_position.assign(n_local_dofs, dealii::numbers::invalid_unsigned_int);
+    for (unsigned int iblock = 0; iblock < n_stored_blocks; ++iblock) {
+        for (unsigned int idof = 0; idof < block_dofs[iblock].size(); ++idof) {
+            const unsigned int local_index = partitioner->global_to_local(block_dofs[iblock][idof]);
+            Assert(dof_block[local_index] == dealii::numbers::invalid_unsigned_int,
+                   dealii::ExcMessage("A degree of freedom belongs to two blocks."));
+            block_local_dofs[block_dof_start[iblock] + idof] = local_index;
+            dof_block[local_index] = iblock;
+            dof_position[local_index] = idof;
+        }
+    }
+
+    row_start.assign(n_stored_blocks+1, 0);
+    column_block.clear();
+    entry_start.assign(1, 0);
+    diagonal_entry.assign(n_stored_blocks, dealii::numbers::invalid_unsigned_int);
+    for (unsigned int iblock = 0; iblock < n_stored_blocks; ++iblock) {
+        std::vector<unsigned int> columns = block_couplings[iblock];
+        columns.push_back(iblock);
+        std::sort(columns.begin(), columns.end());
+        columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+        for (const unsigned int jblock : columns) {
+            if (jblock == iblock) diagonal_entry[iblock] = column_block.size();
+            column_block.push_back(jblock);
+            entry_start.push_back(entry_start.back() + block_size(iblock) * block_size(jblock));
+        }
+        row_start[iblock+1] = column_block.size();
+    }
+    values.assign(entry_start.back(), 0.0);
+}
+
+void BlockSparseMatrix::clear()
+{
+    partitioner.reset();
+    n_global_rows = 0;
+    n_owned_blocks = 0;
+    std::vector<unsigned int>().swap(block_dof_start);
+    std::vector<unsigned int>().swap(block_local_dofs);
+    std::vector<unsigned int>().swap(block_owner);
+    std::vector<unsigned int>().swap(dof_block);
+    std::vector<unsigned int>().swap(dof_position);
+    std::vector<unsigned int>().swap(row_start);
+    std::vector<unsigned int>().swap(column_block);
+    std::vector<std::size_t>().swap(entry_start);
+    std::vector<unsigned int>().swap(diagonal_entry);
+    std::vector<double>().swap(values);
+}
+
+BlockSparseMatrix & BlockSparseMatrix::operator=(const double value)
+{
+    Assert(value == 0.0, dealii::ExcMessage("Only zero can be assigned to a BlockSparseMatrix."));
+    (void) value;
+    std::fill(values.begin(), values.end(), 0.0);
+    return *this;
+}
+
+BlockSparseMatrix & BlockSparseMatrix::operator*=(const double factor)
+{
+    for (double &value : values) value *= factor;
+    return *this;
+}
+
+unsigned int BlockSparseMatrix::find_entry(const unsigned int row_block, const unsigned int col_block) const
+{
+    const auto first = column_block.begin() + row_start[row_block];
+    const auto last = column_block.begin() + row_start[row_block+1];
+    const auto entry = std::lower_bound(first, last, col_block);
+    if (entry == last || *entry != col_block) return dealii::numbers::invalid_unsigned_int;
+    return entry - column_block.begin();
+}
+
+void BlockSparseMatrix::add(
+    const dealii::types::global_dof_index row,
+    const std::vector<dealii::types::global_dof_index> &columns,
+    const std::vector<double> &row_values,
+    const bool elide_zero_values)
+{
+    AssertDimension(columns.size(), row_values.size());
+    const unsigned int local_row = partitioner->global_to_local(row);
+    const unsigned int row_block = dof_block[local_row];
+    Assert(row_block != dealii::numbers::invalid_unsigned_int,
+           dealii::ExcMessage("The row does not belong to any block."));
+    const unsigned int row_position = dof_position[local_row];
+
+    // The columns usually all belong to one block, which is then only looked up once.
+    unsigned int current_col_block = dealii::numbers::invalid_unsigned_int;
+    double *current_row = nullptr;
+    for (unsigned int icol = 0; icol < columns.size(); ++icol) {
+        if (elide_zero_values && row_values[icol] == 0.0) continue;
+        const unsigned int local_col = partitioner->global_to_local(columns[icol]);
+        const unsigned int col_block = dof_block[local_col];
+        if (col_block != current_col_block) {
+            const unsigned int entry = find_entry(row_block, col_block);
+            Assert(entry != dealii::numbers::invalid_unsigned_int,
+                   dealii::ExcMessage("Adding to blocks that are not coupled."));
+            current_col_block = col_block;
+            current_row = &values[entry_start[entry] + row_position * block_size(col_block)];
+        }
+        current_row[dof_position[local_col]] += row_values[icol];
+    }
+}
+
+void BlockSparseMatrix::add(const double factor, const dealii::TrilinosWrappers::SparseMatrix &matrix)
+{
+    std::vector<dealii::types::global_dof_index> columns;
+    std::vector<double> row_values;
+    for (const auto row : partitioner->locally_owned_range()) {
+        columns.clear();
+        row_values.clear();
+        for (auto entry = matrix.begin(row); entry != matrix.end(row); ++entry) {
+            columns.push_back(entry->column());
+            row_values.push_back(factor * entry->value());
+        }
+        const bool elide_zero_values = true;
+        add(row, columns, row_values, elide_zero_values);
+    }
+}
+
+void BlockSparseMatrix::compress()
+{
+    const MPI_Comm mpi_communicator = partitioner->get_mpi_communicator();
+
+    // Blocks are identified across processors by the global index of their first degree of freedom.
+    const auto first_global_dof = [&](const unsigned int block) {
+        return partitioner->local_to_global(block_local_dofs[block_dof_start[block]]);
+    };
+
+    // The pairs of block identifiers and the block values are sent as two messages to each owner.
+    std::map<unsigned int, std::vector<dealii::types::global_dof_index>> outgoing_blocks;
+    std::map<unsigned int, std::vector<double>> outgoing_values;
+    for (unsigned int iblock = n_owned_blocks; iblock < n_blocks(); ++iblock) {
+        std::vector<dealii::types::global_dof_index> &blocks = outgoing_blocks[block_owner[iblock]];
+        std::vector<double> &block_values = outgoing_values[block_owner[iblock]];
+        for (unsigned int entry = row_start[iblock]; entry < row_start[iblock+1]; ++entry) {
+            blocks.push_back(first_global_dof(iblock));
+            blocks.push_back(first_global_dof(column_block[entry]));
+            block_values.insert(block_values.end(), values.begin() + entry_start[entry], values.begin() + entry_start[entry+1]);
+            std::fill(values.begin() + entry_start[entry], values.begin() + entry_start[entry+1], 0.0);
+        }
+    }
+
+    const auto incoming_blocks = dealii::Utilities::MPI::some_to_some(mpi_communicator, outgoing_blocks);
+    const auto incoming_values = dealii::Utilities::MPI::some_to_some(mpi_communicator, outgoing_values);
+    for (const auto &sender_and_blocks : incoming_blocks) {
+        const std::vector<dealii::types::global_dof_index> &blocks = sender_and_blocks.second;
+        const std::vector<double> &block_values = incoming_values.at(sender_and_blocks.first);
+        std::size_t value_offset = 0;
+        for (unsigned int ipair = 0; ipair < blocks.size(); ipair += 2) {
+            const unsigned int row_block = dof_block[partitioner->global_to_local(blocks[ipair])];
+            const unsigned int col_block = dof_block[partitioner->global_to_local(blocks[ipair+1])];
+            const unsigned int entry = find_entry(row_block, col_block);
+            Assert(row_block < n_owned_blocks && entry != dealii::numbers::invalid_unsigned_int,
+                   dealii::ExcMessage("Received a block that is not coupled on its owner."));
+            const std::size_t n_entries = entry_start[entry+1] - entry_start[entry];
+            for (std::size_t i = 0; i < n_entries; ++i) {
+                values[entry_start[entry] + i] += block_values[value_offset + i];
+            }
+            value_offset += n_entries;
+        }
+    }
+}
+
+void BlockSparseMatrix::copy_transpose_from(const BlockSparseMatrix &matrix)
+{
+    if (&matrix == this) {
+        BlockSparseMatrix copy(matrix);
+        copy_transpose_from(copy);
+        return;
+    }
+    if (block_dof_start != matrix.block_dof_start || block_local_dofs != matrix.block_local_dofs
+        || row_start != matrix.row_start || column_block != matrix.column_block) {
+        partitioner = matrix.partitioner;
+        n_global_rows = matrix.n_global_rows;
+        n_owned_blocks = matrix.n_owned_blocks;
+        block_dof_start = matrix.block_dof_start;
+        block_local_dofs = matrix.block_local_dofs;
+        block_owner = matrix.block_owner;
+        dof_block = matrix.dof_block;
+        dof_position = matrix.dof_position;
+        row_start = matrix.row_start;
+        column_block = matrix.column_block;
+        entry_start = matrix.entry_start;
+        diagonal_entry = matrix.diagonal_entry;
+        values.resize(matrix.values.size());
+    }
+    std::fill(values.begin(), values.end(), 0.0);
+
+    // Only the locally owned block rows of a compressed matrix hold values.
+    for (unsigned int iblock = 0; iblock < n_owned_blocks; ++iblock) {
+        const unsigned int n_rows = block_size(iblock);
+        for (unsigned int entry = row_start[iblock]; entry < row_start[iblock+1]; ++entry) {
+            const unsigned int jblock = column_block[entry];
+            const unsigned int n_cols = block_size(jblock);
+            const unsigned int transpose_entry = find_entry(jblock, iblock);
+            Assert(transpose_entry != dealii::numbers::invalid_unsigned_int,
+                   dealii::ExcMessage("The blocks of the matrix do not couple symmetrically."));
+            const double *block = &matrix.values[entry_start[entry]];
+            double *transpose_block = &values[entry_start[transpose_entry]];
+            for (unsigned int irow = 0; irow < n_rows; ++irow) {
+                for (unsigned int icol = 0; icol < n_cols; ++icol) {
+                    transpose_block[icol * n_rows + irow] = block[irow * n_cols + icol];
+                }
+            }
+        }
+    }
+    compress();
+}
+
+void BlockSparseMatrix::vmult(VectorType &dst, const VectorType &src) const
+{
+    Assert(src.partitioners_are_compatible(*partitioner),
+           dealii::ExcMessage("The vector must have the ghost entries of the matrix partitioner."));
+    src.update_ghost_values();
+    std::vector<double> src_block;
+    for (unsigned int iblock = 0; iblock < n_owned_blocks; ++iblock) {
+        const unsigned int n_rows = block_size(iblock);
+        const unsigned int *row_dofs = &block_local_dofs[block_dof_start[iblock]];
+        for (unsigned int irow = 0; irow < n_rows; ++irow) dst.local_element(row_dofs[irow]) = 0.0;
+
+        for (unsigned int entry = row_start[iblock]; entry < row_start[iblock+1]; ++entry) {
+            const unsigned int jblock = column_block[entry];
+            const unsigned int n_cols = block_size(jblock);
+            const unsigned int *col_dofs = &block_local_dofs[block_dof_start[jblock]];
+            src_block.resize(n_cols);
+            for (unsigned int icol = 0; icol < n_cols; ++icol) src_block[icol] = src.local_element(col_dofs[icol]);
+
+            const double *block = &values[entry_start[entry]];
+            for (unsigned int irow = 0; irow < n_rows; ++irow) {
+                const double *block_row = block + irow * n_cols;
+                double sum = 0.0;
+                for (unsigned int icol = 0; icol < n_cols; ++icol) sum += block_row[icol] * src_block[icol];
+                dst.local_element(row_dofs[irow]) += sum;
+            }
+        }
+    }
+}
+
+std::size_t BlockSparseMatrix::memory_consumption() const
+{
+    return values.capacity() * sizeof(double)
+           + entry_start.capacity() * sizeof(std::size_t)
+           + (block_dof_start.capacity() + block_local_dofs.capacity() + block_owner.capacity()
+              + dof_block.capacity() + dof_position.capacity() + row_start.capacity()
+              + column_block.capacity() + diagonal_entry.capacity()) * sizeof(unsigned int);
+}
+
+double BlockSparseMatrix::el(const dealii::types::global_dof_index row, const dealii::types::global_dof_index column) const
+{
+    const unsigned int local_row = partitioner->global_to_local(row);
+    const unsigned int local_col = partitioner->global_to_local(column);
+    const unsigned int entry = find_entry(dof_block[local_row], dof_block[local_col]);
+    if (entry == dealii::numbers::invalid_unsigned_int) return 0.0;
+    return values[entry_start[entry] + dof_position[local_row] * block_size(dof_block[local_col]) + dof_position[local_col]];
+}
+
+void PreconditionBlockILU::initialize(const BlockSparseMatrix &matrix_input, const bool use_ilu)
+{
+    matrix = &matrix_input;
+    is_ilu = use_ilu;
+    const BlockSparseMatrix &A = *matrix;
+    factors.resize(A.values.size());
+    std::copy(A.values.begin(), A.values.end(), factors.begin());
+
+    dealii::FullMatrix<double> diagonal_inverse;
+    dealii::FullMatrix<double> lower;
+    for (unsigned int iblock = 0; iblock < A.n_owned_blocks; ++iblock) {
+        const unsigned int n_i = A.block_size(iblock);
+
+        // Row-wise block ILU(0): each lower block L_ik = A_ik U_kk^{-1} updates the blocks A_ij,
+        // j > k, of the current row that are also coupled to row k. Blocks of other processors are dropped.
+        if (is_ilu) {
+            for (unsigned int entry_ik = A.row_start[iblock]; entry_ik < A.diagonal_entry[iblock]; ++entry_ik) {
+                const unsigned int kblock = A.column_block[entry_ik];
+                if (kblock >= A.n_owned_blocks) continue;
+                const unsigned int n_k = A.block_size(kblock);
+
+                double *A_ik = &factors[A.entry_start[entry_ik]];
+                const double *inverse_U_kk = &factors[A.entry_start[A.diagonal_entry[kblock]]];
+                lower.reinit(n_i, n_k);
+                for (unsigned int r = 0; r < n_i; ++r) {
+                    for (unsigned int c = 0; c < n_k; ++c) {
+                        double sum = 0.0;
+                        for (unsigned int l = 0; l < n_k; ++l) sum += A_ik[r*n_k + l] * inverse_U_kk[l*n_k + c];
+                        lower(r,c) = sum;
+                    }
+                }
+                for (unsigned int r = 0; r < n_i; ++r) {
+                    for (unsigned int c = 0; c < n_k; ++c) A_ik[r*n_k + c] = lower(r,c);
+                }
+
+                for (unsigned int entry_ij = entry_ik+1; entry_ij < A.row_start[iblock+1]; ++entry_ij) {
+                    const unsigned int jblock = A.column_block[entry_ij];
+                    if (jblock >= A.n_owned_blocks) continue;
+                    const unsigned int entry_kj = A.find_entry(kblock, jblock);
+                    if (entry_kj == dealii::numbers::invalid_unsigned_int) continue;
+                    const unsigned int n_j = A.block_size(jblock);
+                    double *A_ij = &factors[A.entry_start[entry_ij]];
+                    const double *U_kj = &factors[A.entry_start[entry_kj]];
+                    for (unsigned int r = 0; r < n_i; ++r) {
+                        for (unsigned int l = 0; l < n_k; ++l) {
+                            const double L_rl = A_ik[r*n_k + l];
+                            for (unsigned int c = 0; c < n_j; ++c) A_ij[r*n_j + c] -= L_rl * U_kj[l*n_j + c];
+                        }
+                    }
+                }
+            }
+        }
+
+        double *diagonal = &factors[A.entry_start[A.diagonal_entry[iblock]]];
+        diagonal_inverse.reinit(n_i, n_i);
+        for (unsigned int r = 0; r < n_i; ++r) {
+            for (unsigned int c = 0; c < n_i; ++c) diagonal_inverse(r,c) = diagonal[r*n_i + c];
+        }
+        diagonal_inverse.gauss_jordan();
+        for (unsigned int r = 0; r < n_i; ++r) {
+            for (unsigned int c = 0; c < n_i; ++c) diagonal[r*n_i + c] = diagonal_inverse(r,c);
+        }
+    }
+    work.resize(A.partitioner->locally_owned_range().n_elements());
+}
+
+void PreconditionBlockILU::vmult(VectorType &dst, const VectorType &src) const
+{
+    Assert(matrix != nullptr, dealii::ExcMessage("The preconditioner has not been initialized."));
+    const BlockSparseMatrix &A = *matrix;
+
+    // Forward substitution with the unit lower blocks, y_i = r_i - sum_{k<i} L_ik y_k, stored in work.
+    for (unsigned int iblock = 0; iblock < A.n_owned_blocks; ++iblock) {
+        const unsigned int n_i = A.block_size(iblock);
+        const unsigned int *row_dofs = &A.block_local_dofs[A.block_dof_start[iblock]];
+        for (unsigned int r = 0; r < n_i; ++r) work[row_dofs[r]] = src.local_element(row_dofs[r]);
+        if (!is_ilu) continue;
+        for (unsigned int entry_ik = A.row_start[iblock]; entry_ik < A.diagonal_entry[iblock]; ++entry_ik) {
+            const unsigned int kblock = A.column_block[entry_ik];
+            if (kblock >= A.n_owned_blocks) continue;
+            const unsigned int n_k = A.block_size(kblock);
+            const unsigned int *col_dofs = &A.block_local_dofs[A.block_dof_start[kblock]];
+            const double *L_ik = &factors[A.entry_start[entry_ik]];
+            for (unsigned int r = 0; r < n_i; ++r) {
+                double sum = 0.0;
+                for (unsigned int c = 0; c < n_k; ++c) sum += L_ik[r*n_k + c] * work[col_dofs[c]];
+                work[row_dofs[r]] -= sum;
+            }
+        }
+    }
+
+    // Backward substitution, x_i = U_ii^{-1} (y_i - sum_{j>i} U_ij x_j), also stored in work.
+    std::vector<double> rhs_block;
+    for (unsigned int iblock = A.n_owned_blocks; iblock-- > 0;) {
+        const unsigned int n_i = A.block_size(iblock);
+        const unsigned int *row_dofs = &A.block_local_dofs[A.block_dof_start[iblock]];
+        rhs_block.resize(n_i);
+        for (unsigned int r = 0; r < n_i; ++r) rhs_block[r] = work[row_dofs[r]];
+        if (is_ilu) {
+            for (unsigned int entry_ij = A.diagonal_entry[iblock]+1; entry_ij < A.row_start[iblock+1]; ++entry_ij) {
+                const unsigned int jblock = A.column_block[entry_ij];
+                if (jblock >= A.n_owned_blocks) continue;
+                const unsigned int n_j = A.block_size(jblock);
+                const unsigned int *col_dofs = &A.block_local_dofs[A.block_dof_start[jblock]];
+                const double *U_ij = &factors[A.entry_start[entry_ij]];
+                for (unsigned int r = 0; r < n_i; ++r) {
+                    double sum = 0.0;
+                    for (unsigned int c = 0; c < n_j; ++c) sum += U_ij[r*n_j + c] * work[col_dofs[c]];
+                    rhs_block[r] -= sum;
+                }
+            }
+        }
+        const double *inverse_U_ii = &factors[A.entry_start[A.diagonal_entry[iblock]]];
+        for (unsigned int r = 0; r < n_i; ++r) {
+            double sum = 0.0;
+            for (unsigned int c = 0; c < n_i; ++c) sum += inverse_U_ii[r*n_i + c] * rhs_block[c];
+            work[row_dofs[r]] = sum;
+        }
+    }
+
+    for (unsigned int iblock = 0; iblock < A.n_owned_blocks; ++iblock) {
+        for (unsigned int idof = A.block_dof_start[iblock]; idof < A.block_dof_start[iblock+1]; ++idof) {
+            const unsigned int local_index = A.block_local_dofs[idof];
+            dst.local_element(local_index) = work[local_index];
+        }
+    }
+}
+
+} // PHiLiP namespace
@@ -0,0 +1,179 @@
+#ifndef __BLOCK_SPARSE_MATRIX_H__
+#define __BLOCK_SPARSE_MATRIX_H__
+
+#include <memory>
+#include <vector>
+
+#include <deal.II/base/partitioner.h>
+#include <deal.II/base/subscriptor.h>
+#include <deal.II/base/types.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/trilinos_sparse_matrix.h>
+
+namespace PHiLiP {
+
+/// Sparse matrix stored as dense blocks coupling groups of degrees of freedom.
+/** Meant for the DG residual Jacobian, where each block groups the degrees of freedom of one cell
+ *  and a block row only couples to the cell itself and its face neighbours. Only one column index
+ *  is stored per block instead of one per entry, and the entries of each block are contiguous
+ *  such that the products of vmult() run over unit-stride rows.
+ *
+ *  The rows of blocks owned by other processors may be added to, for example by the face terms
+ *  computed on this processor. Those contributions are sent to the owners by compress(), like the
+ *  Trilinos matrices do for their non-local rows.
+ */
+class BlockSparseMatrix : public dealii::Subscriptor
+{
+public:
+    /// Vector type the matrix applies to.
+    using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+
+    /// Sets up the block structure and zeroes the entries.
+    /** @param partitioner     Parallel layout of the vectors the matrix applies to.
+     *  @param block_dofs      Global indices of the degrees of freedom of each block. The locally
+     *                         owned blocks must come first, followed by the blocks of other
+     *                         processors whose degrees of freedom are ghosts of the partitioner.
+     *  @param block_owners    Rank owning each block.
+     *  @param block_couplings Blocks coupled to each block, including itself.
+     */
+    void reinit(const std::shared_ptr<const dealii::Utilities::MPI::Partitioner> &partitioner,
+                const std::vector<std::vector<dealii::types::global_dof_index>> &block_dofs,
+                const std::vector<unsigned int> &block_owners,
+                const std::vector<std::vector<unsigned int>> &block_couplings);
+
+    /// Releases the memory.
+    void clear();
+
+    /// Sets all the entries to the given value, which can only be zero.
+    BlockSparseMatrix & operator=(const double value);
+
+    /// Scales all the entries.
+    BlockSparseMatrix & operator*=(const double factor);
+
+    /// Adds values to a row, in the same way as dealii::TrilinosWrappers::SparseMatrix::add().
+    /** The row and columns must belong to coupled blocks. The row may belong to a block of
+     *  another processor, in which case compress() must be called before using the matrix.
+     */
+    void add(const dealii::types::global_dof_index row,
+             const std::vector<dealii::types::global_dof_index> &columns,
+             const std::vector<double> &values,
+             const bool elide_zero_values = true);
+
+    /// Adds factor times a matrix whose entries all lie within coupled blocks.
+    /** Typically the block diagonal mass matrix. Only its locally owned rows are read.
+     */
+    void add(const double factor, const dealii::TrilinosWrappers::SparseMatrix &matrix);
+
+    /// Sends the rows of the blocks owned by other processors to their owners and adds them.
+    void compress();
+
+    /// Sets this matrix to the transpose of a compressed matrix.
+    /** The blocks couple symmetrically, so the transpose has the block structure of the matrix and each
+     *  block entry (i,j) is the transpose of the entry (j,i). The entries whose transposes belong to the
+     *  blocks of other processors are sent to their owners, as in compress().
+     */
+    void copy_transpose_from(const BlockSparseMatrix &matrix);
+
+    /// Matrix-vector product dst = A src.
+    /** The ghost values of src are updated, hence src must share the partitioner of the matrix.
+     */
+    void vmult(VectorType &dst, const VectorType &src) const;
+
+    /// Number of rows.
+    dealii::types::global_dof_index m() const { return n_global_rows; }
+
+    /// Number of locally owned blocks.
+    unsigned int n_locally_owned_blocks() const { return n_owned_blocks; }
+
+    /// Number of locally stored blocks, owned or not.
+    unsigned int n_blocks() const { return block_dof_start.empty() ? 0 : block_dof_start.size()-1; }
+
+    /// Number of stored block entries, that is non-zero blocks.
+    unsigned int n_block_entries() const { return column_block.size(); }
+
+    /// Memory used by the entries and the indices, in bytes.
+    std::size_t memory_consumption() const;
+
+    /// Returns the value of entry (row, column), zero if it is not stored.
+    /** Slow lookup meant for testing.
+     */
+    double el(const dealii::types::global_dof_index row, const dealii::types::global_dof_index column) const;
+
+private:
+    friend class PreconditionBlockILU;
+
+    /// Index of the block entry coupling row_block to col_block.
+    /** Returns dealii::numbers::invalid_unsigned_int if they are not coupled.
+     */
+    unsigned int find_entry(const unsigned int row_block, const unsigned int col_block) const;
+
+    /// Number of degrees of freedom of a block.
+    unsigned int block_size(const unsigned int block) const
+    { return block_dof_start[block+1] - block_dof_start[block]; }
+
+    /// Layout of the vectors the matrix applies to.
+    std::shared_ptr<const dealii::Utilities::MPI::Partitioner> partitioner;
+    /// Global number of rows.
+    dealii::types::global_dof_index n_global_rows = 0;
+    /// Number of locally owned blocks, which are stored first.
+    unsigned int n_owned_blocks = 0;
+
+    /// Offsets of each block into block_local_dofs.
+    std::vector<unsigned int> block_dof_start;
+    /// Partitioner local indices of the degrees of freedom of each block.
+    std::vector<unsigned int> block_local_dofs;
+    /// Rank owning each block.
+    std::vector<unsigned int> block_owner;
+
+    /// Block of each partitioner local index, dealii::numbers::invalid_unsigned_int if none.
+    std::vector<unsigned int> dof_block;
+    /// Position of each partitioner local index within its block.
+    std::vector<unsigned int> dof_position;
+
+    /// Offsets of each block row into column_block and entry_start.
+    std::vector<unsigned int> row_start;
+    /// Column block of each block entry, sorted within each block row.
+    std::vector<unsigned int> column_block;
+    /// Offset of each block entry into values, stored row-major.
+    std::vector<std::size_t> entry_start;
+    /// Entry of the diagonal block of each block row.
+    std::vector<unsigned int> diagonal_entry;
+    /// Values of all the blocks.
+    std::vector<double> values;
+};
+
+/// Block-Jacobi or block-ILU(0) preconditioner of a BlockSparseMatrix.
+/** Only the couplings between locally owned blocks are factored, such that the preconditioner
+ *  applies without communication, like the non-overlapping domain decomposition preconditioners.
+ *  The inverses of the diagonal blocks are stored in place of the factored diagonal blocks.
+ */
+class PreconditionBlockILU : public dealii::Subscriptor
+{
+public:
+    /// Vector type the preconditioner applies to.
+    using VectorType = BlockSparseMatrix::VectorType;
+
+    /// Factors the matrix.
+    /** @param matrix    Matrix to factor, which must outlive the preconditioner.
+     *  @param use_ilu   Block-ILU(0) if true, block-Jacobi otherwise.
+     */
+    void initialize(const BlockSparseMatrix &matrix, const bool use_ilu);
+
+    /// Applies the preconditioner, dst = P^{-1} src.
+    void vmult(VectorType &dst, const VectorType &src) const;
+
+private:
+    /// Matrix that was factored.
+    const BlockSparseMatrix *matrix = nullptr;
+    /// Whether the off-diagonal blocks are factored.
+    bool is_ilu = false;
+    /// Factored values, laid out as BlockSparseMatrix::values.
+    std::vector<double> factors;
+    /// Work vector of the size of the locally owned degrees of freedom.
+    mutable std::vector<double> work;
+};
+
+} // PHiLiP namespace
+
+#endif
@@ -287,5 +287,56 @@ solve_linear (
     return {-1.0, -1.0};
 }
 
+std::pair<unsigned int, double>
+solve_linear (
+    const BlockSparseMatrix &system_matrix,
+    dealii::LinearAlgebra::distributed::Vector<double> &right_hand_side,
+    dealii::LinearAlgebra::distributed::Vector<double> &solution,
+    const Parameters::LinearSolverParam &param)
+{
+    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+    if (param.linear_solver_type != Parameters::LinearSolverParam::LinearSolverEnum::gmres) {
+        pcout << "The block_csr Jacobian storage can only be solved with gmres. Aborting..." << std::endl;
+        std::abort();
+    }
+
+    PreconditionBlockILU preconditioner;
+    const bool use_ilu = (param.block_preconditioner == Parameters::LinearSolverParam::BlockPreconditionerEnum::block_ilu);
+    preconditioner.initialize(system_matrix, use_ilu);
+
+    // Solver convergence settings
+    const double rhs_norm = right_hand_side.l2_norm();
+    const double linear_residual_tolerance = param.linear_residual * rhs_norm;
+    const int max_iterations = param.max_iterations;
+    pcout << " Solving block_csr linear system with max_iterations = " << max_iterations
+          << " and linear residual tolerance: " << linear_residual_tolerance << std::endl;
+
+    const bool log_history = (param.linear_solver_output == Parameters::OutputEnum::verbose);
+    const bool log_result = false;
+    dealii::SolverControl solver_control(max_iterations, linear_residual_tolerance, log_history, log_result);
+
+    const bool     right_preconditioning = false; // default: false
+    const bool     use_default_residual = true; // default: true
+    const bool     force_re_orthogonalization = false; // default: false
+    using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+    typedef typename dealii::SolverGMRES<VectorType>::AdditionalData AddiData_GMRES;
+    AddiData_GMRES add_data_gmres( param.restart_number, right_preconditioning, use_default_residual, force_re_orthogonalization);
+    dealii::SolverGMRES<VectorType> solver_gmres(solver_control, add_data_gmres);
+
+    solution = 0.0;
+    try {
+        solver_gmres.solve(system_matrix, solution, right_hand_side, preconditioner);
+    } catch (const dealii::SolverControl::NoConvergence &) {
+        // Same as AztecOO, the last iterate is used as the update.
+    }
+    pcout << " Linear solver took " << solver_control.last_step()
+          << " iterations resulting in a linear residual of " << solver_control.last_value() << std::endl;
+
+    n_vmult += solver_control.last_step();
+    dRdW_mult += solver_control.last_step();
+
+    return {solver_control.last_step(), solver_control.last_value()};
+}
+
 
 } // PHiLiP namespace
@@ -1,9 +1,15 @@
 #ifndef __LINEAR_SOLVER_H__
 #define __LINEAR_SOLVER_H__
 
+#include <deal.II/base/conditional_ostream.h>
+
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 #include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
 #include "parameters/all_parameters.h"
+#include "block_sparse_matrix.h"
+#include "global_counter.hpp"
 
 namespace PHiLiP {
 
@@ -18,6 +24,88 @@ namespace PHiLiP {
                        dealii::LinearAlgebra::distributed::Vector<double> &solution,
                        const Parameters::LinearSolverParam &param);
 
+    /// Solves the block_csr Jacobian system with GMRES and the block preconditioner of the parameters.
+    std::pair<unsigned int, double>
+        solve_linear ( const BlockSparseMatrix &system_matrix,
+                       dealii::LinearAlgebra::distributed::Vector<double> &right_hand_side,
+                       dealii::LinearAlgebra::distributed::Vector<double> &solution,
+                       const Parameters::LinearSolverParam &param);
+
+    /// Solves a system with GMRES and a preconditioner prepared by the caller.
+    /** Lets the caller keep the preconditioner across solves, as ImplicitODESolver does with a lagged dRdW.
+     *  The preconditioner is applied on the right such that the linear residual tolerance
+     *  applies to the unpreconditioned residual, as for the AztecOO solves.
+     *  A preconditioner that is not a fixed linear operator, such as one with inner iterations
+     *  stopped at a tolerance, requires is_variable_preconditioner, which solves with flexible GMRES.
+     *  Only the products of the system count themselves in n_vmult.
+     */
+    template <typename OperatorType, typename PreconditionerType>
+    std::pair<unsigned int, double>
+        solve_linear_preconditioned ( const OperatorType &system_operator,
+                                      const dealii::LinearAlgebra::distributed::Vector<double> &right_hand_side,
+                                      dealii::LinearAlgebra::distributed::Vector<double> &solution,
+                                      const PreconditionerType &preconditioner,
+                                      const Parameters::LinearSolverParam &param,
+                                      const bool is_variable_preconditioner = false)
+    {
+        dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+
+        const double linear_residual_tolerance = param.linear_residual * right_hand_side.l2_norm();
+        const int max_iterations = param.max_iterations;
+        pcout << " Solving preconditioned linear system with max_iterations = " << max_iterations
+              << " and linear residual tolerance: " << linear_residual_tolerance << std::endl;
+
+        const bool log_history = (param.linear_solver_output == Parameters::OutputEnum::verbose);
+        const bool log_result = false;
+        dealii::SolverControl solver_control(max_iterations, linear_residual_tolerance, log_history, log_result);
+
+        using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+        solution = 0.0;
+        try {
+            if (is_variable_preconditioner) {
+                typedef typename dealii::SolverFGMRES<VectorType>::AdditionalData AddiData_FGMRES;
+                AddiData_FGMRES add_data_fgmres( param.restart_number );
+                dealii::SolverFGMRES<VectorType> solver_fgmres(solver_control, add_data_fgmres);
+                solver_fgmres.solve(system_operator, solution, right_hand_side, preconditioner);
+            } else {
+                const bool     right_preconditioning = true;
+                const bool     use_default_residual = true; // default: true
+                const bool     force_re_orthogonalization = false; // default: false
+                typedef typename dealii::SolverGMRES<VectorType>::AdditionalData AddiData_GMRES;
+                AddiData_GMRES add_data_gmres( param.restart_number, right_preconditioning, use_default_residual, force_re_orthogonalization);
+                dealii::SolverGMRES<VectorType> solver_gmres(solver_control, add_data_gmres);
+                solver_gmres.solve(system_operator, solution, right_hand_side, preconditioner);
+            }
+        } catch (const dealii::SolverControl::NoConvergence &) {
+            // Same as AztecOO, the last iterate is used as the update.
+        }
+        pcout << " Linear solver took " << solver_control.last_step()
+              << " iterations resulting in a linear residual of " << solver_control.last_value() << std::endl;
+
+        n_vmult += solver_control.last_step();
+
+        return {solver_control.last_step(), solver_control.last_value()};
+    }
+
+    /// Solves a system only known through its products, such as DGBase::dRdW_vmult(), with GMRES.
+    /** See solve_linear_preconditioned(). The dRdW products count themselves in dRdW_mult.
+     */
+    template <typename OperatorType, typename PreconditionerType>
+    std::pair<unsigned int, double>
+        solve_linear_matrix_free ( const OperatorType &system_operator,
+                                   const dealii::LinearAlgebra::distributed::Vector<double> &right_hand_side,
+                                   dealii::LinearAlgebra::distributed::Vector<double> &solution,
+                                   const PreconditionerType &preconditioner,
+                                   const Parameters::LinearSolverParam &param)
+    {
+        if (param.linear_solver_type != Parameters::LinearSolverParam::LinearSolverEnum::gmres) {
+            dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+            pcout << "The matrix_free Jacobian can only be solved with gmres. Aborting..." << std::endl;
+            std::abort();
+        }
+        return solve_linear_preconditioned(system_operator, right_hand_side, solution, preconditioner, param);
+    }
+
     std::pair<unsigned int, double>
     solve_linear_2 ( const dealii::TrilinosWrappers::SparseMatrix &system_matrix,
                    const dealii::LinearAlgebra::distributed::Vector<double> &right_hand_side,
@@ -1,4 +1,5 @@
 #include <deal.II/base/utilities.h>
+#include <deal.II/base/multithread_info.h>
 
 #include <deal.II/base/logstream.h>
 #include <deal.II/base/parameter_handler.h>
@@ -59,6 +60,9 @@ int main (int argc, char *argv[])
 
         AssertDimension(all_parameters.dimension, PHILIP_DIM);
 
+        // MPI_InitFinalize limits each process to a single thread. Lift it if the residual assembly is threaded.
+        dealii::MultithreadInfo::set_thread_limit(all_parameters.n_threads_per_process);
+
         const int max_dim = PHILIP_DIM;
         const int max_nstate = 5;
 
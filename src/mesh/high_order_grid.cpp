@@ -55,7 +55,8 @@ HighOrderGrid<dim,real,MeshType,VectorType,DoFHandlerType>::HighOrderGrid(
         const std::shared_ptr<MeshType> triangulation_input,
         const bool check_valid_metric_Jacobian_input,
         const bool renumber_dof_handler_Cuthill_Mckee_input,
-        const bool output_high_order_grid)
+        const bool output_high_order_grid,
+        const MPI_Comm mpi_communicator_input)
     : max_degree(max_degree)
     , triangulation(triangulation_input)
     , check_valid_metric_Jacobian(check_valid_metric_Jacobian_input)
@@ -68,11 +69,11 @@ HighOrderGrid<dim,real,MeshType,VectorType,DoFHandlerType>::HighOrderGrid(
     , oneD_grid_nodes(max_degree+1)
     , dim_grid_nodes(max_degree+1)
     , solution_transfer(dof_handler_grid)
-    , mpi_communicator(MPI_COMM_WORLD)
+    , mpi_communicator(mpi_communicator_input)
     , pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_communicator)==0)
 {
-    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
-    MPI_Comm_size(MPI_COMM_WORLD, &n_mpi);
+    MPI_Comm_rank(mpi_communicator, &mpi_rank);
+    MPI_Comm_size(mpi_communicator, &n_mpi);
 
     Assert(max_degree > 0, dealii::ExcMessage("Grid must be at least order 1."));
 
@@ -215,6 +216,19 @@ HighOrderGrid<dim,real,MeshType,VectorType,DoFHandlerType>::allocate()
         mpi_communicator);
 }
 
+template <int dim, typename real, typename MeshType, typename VectorType, typename DoFHandlerType>
+bool HighOrderGrid<dim,real,MeshType,VectorType,DoFHandlerType>::update_metric_terms_cache()
+{
+    const VectorFingerprint volume_nodes_fingerprint(volume_nodes);
+    const bool locally_valid = (metric_terms_cache.size() == triangulation->n_active_cells())
+                               && (volume_nodes_fingerprint == volume_nodes_metric_terms_cache);
+    if (VectorFingerprint::up_to_date_on_all_processors(locally_valid, mpi_communicator)) return false;
+
+    metric_terms_cache.reinit(triangulation->n_active_cells());
+    volume_nodes_metric_terms_cache = volume_nodes_fingerprint;
+    return true;
+}
+
 //template <int dim, typename real, typename MeshType, typename VectorType, typename DoFHandlerType>
 //dealii::MappingFEField<dim,dim,VectorType,DoFHandlerType> 
 //HighOrderGrid<dim,real,MeshType,VectorType,DoFHandlerType>::get_MappingFEField() {
@@ -1101,7 +1115,7 @@ void HighOrderGrid<dim,real,MeshType,VectorType,DoFHandlerType>::update_surface_
 
         n_locally_owned_surface_nodes_per_mpi.clear();
         n_locally_owned_surface_nodes_per_mpi.resize(n_mpi);
-        MPI_Allgather(&n_locally_owned_surface_nodes, 1, MPI_UNSIGNED, &(n_locally_owned_surface_nodes_per_mpi[0]), 1, MPI_UNSIGNED, MPI_COMM_WORLD);
+        MPI_Allgather(&n_locally_owned_surface_nodes, 1, MPI_UNSIGNED, &(n_locally_owned_surface_nodes_per_mpi[0]), 1, MPI_UNSIGNED, mpi_communicator);
 
         std::vector<std::vector<real>> vector_locally_owned_surface_nodes(n_mpi);
         std::vector<std::vector<unsigned int>> vector_locally_owned_surface_indices(n_mpi);
@@ -1116,8 +1130,8 @@ void HighOrderGrid<dim,real,MeshType,VectorType,DoFHandlerType>::update_surface_
         }
 
         for (int i_mpi=0; i_mpi<n_mpi; ++i_mpi) {
-            MPI_Bcast(&(vector_locally_owned_surface_nodes[i_mpi][0]), n_locally_owned_surface_nodes_per_mpi[i_mpi], MPI_DOUBLE, i_mpi, MPI_COMM_WORLD);
-            MPI_Bcast(&(vector_locally_owned_surface_indices[i_mpi][0]), n_locally_owned_surface_nodes_per_mpi[i_mpi], MPI_UNSIGNED, i_mpi, MPI_COMM_WORLD);
+            MPI_Bcast(&(vector_locally_owned_surface_nodes[i_mpi][0]), n_locally_owned_surface_nodes_per_mpi[i_mpi], MPI_DOUBLE, i_mpi, mpi_communicator);
+            MPI_Bcast(&(vector_locally_owned_surface_indices[i_mpi][0]), n_locally_owned_surface_nodes_per_mpi[i_mpi], MPI_UNSIGNED, i_mpi, mpi_communicator);
         }
 
         all_surface_nodes = flatten(vector_locally_owned_surface_nodes);
@@ -1147,7 +1161,7 @@ void HighOrderGrid<dim,real,MeshType,VectorType,DoFHandlerType>::update_surface_
         }
 
         std::vector<unsigned int> n_locally_relevant_surface_nodes_per_mpi(n_mpi);
-        MPI_Allgather(&n_locally_relevant_surface_nodes, 1, MPI_UNSIGNED, &(n_locally_relevant_surface_nodes_per_mpi[0]), 1, MPI_UNSIGNED, MPI_COMM_WORLD);
+        MPI_Allgather(&n_locally_relevant_surface_nodes, 1, MPI_UNSIGNED, &(n_locally_relevant_surface_nodes_per_mpi[0]), 1, MPI_UNSIGNED, mpi_communicator);
 
     }
 
@@ -1189,8 +1203,8 @@ void HighOrderGrid<dim,real,MeshType,VectorType,DoFHandlerType>::update_surface_
         }
     }
 
-    surface_nodes.reinit(locally_owned_surface_nodes_indexset, ghost_surface_nodes_indexset, MPI_COMM_WORLD);
-    surface_to_volume_indices.reinit(locally_owned_surface_nodes_indexset, ghost_surface_nodes_indexset, MPI_COMM_WORLD);
+    surface_nodes.reinit(locally_owned_surface_nodes_indexset, ghost_surface_nodes_indexset, mpi_communicator);
+    surface_to_volume_indices.reinit(locally_owned_surface_nodes_indexset, ghost_surface_nodes_indexset, mpi_communicator);
     unsigned int i = 0;
     auto index = surface_to_volume_indices.begin();
     AssertDimension(locally_owned_surface_nodes_indexset.n_elements(), locally_owned_surface_nodes.size());
@@ -28,6 +28,8 @@
 #include <deal.II/lac/trilinos_vector.h>
 
 #include "parameters/all_parameters.h"
+#include "metric_terms_cache.h"
+#include "vector_fingerprint.hpp"
 
 namespace PHiLiP {
 
@@ -137,7 +139,8 @@ public:
         const std::shared_ptr<MeshType> triangulation_input,
         const bool                      check_valid_metric_Jacobian_input=true,
         const bool                      renumber_dof_handler_Cuthill_Mckee_input=true,
-        const bool                      output_high_order_grid=true);
+        const bool                      output_high_order_grid=true,
+        const MPI_Comm                  mpi_communicator_input=MPI_COMM_WORLD);
 
     /// Reinitialize high_order_grid after a change in triangulation
     void reinit();
@@ -420,6 +423,18 @@ public:
     dealii::IndexSet locally_relevant_dofs_grid; ///< Union of locally owned degrees of freedom and relevant ghost degrees of freedom for the grid
 
     static unsigned int nth_refinement; ///< Used to name the various files outputted.
+
+    /// Metric terms of the cells at their flux nodes.
+    /** Filled lazily by the residual assembly when Parameters::AllParameters::use_metric_terms_cache is set.
+     *  Call update_metric_terms_cache() before using it.
+     */
+    MetricTermsCache<dim,real> metric_terms_cache;
+
+    /// Clears the metric_terms_cache if the volume_nodes or the mesh changed since it was last cleared.
+    /** Must be called by all MPI processes.
+     *  @return True if the cache has been cleared and needs to be refilled.
+     */
+    bool update_metric_terms_cache();
 protected:
     int n_mpi; ///< Number of MPI processes.
     int mpi_rank; ///< This processor's MPI rank.
@@ -429,6 +444,9 @@ protected:
     /// Used for the SolutionTransfer when performing grid adaptation.
     VectorType old_volume_nodes;
 
+    /// Fingerprint of the volume_nodes for which the metric_terms_cache has been filled.
+    VectorFingerprint volume_nodes_metric_terms_cache;
+
     /** Transfers the coarse curved curve onto the fine curved grid.
      *  Used in prepare_for_coarsening_and_refinement() and execute_coarsening_and_refinement()
      */
@@ -325,7 +325,7 @@ void AnisotropicMeshAdaptation<dim, nstate, real, MeshType> :: compute_goal_orie
     VectorType adjoint(dg->solution); 
     dg->assemble_residual(true);
     functional->evaluate_functional(true);
-    solve_linear(dg->system_matrix_transpose, functional->dIdw, adjoint, dg->all_parameters->linear_solver_param);
+    solve_linear(dg->get_system_matrix_transpose(), functional->dIdw, adjoint, dg->all_parameters->linear_solver_param);
     adjoint *= -1.0;
     adjoint.update_ghost_values();
     //==========================================================================================
@@ -294,9 +294,9 @@ dealii::LinearAlgebra::distributed::Vector<real> DualWeightedResidualError<dim,
     this->dg->assemble_residual(true);
     
     AssertDimension(derivative_functional_wrt_solution.size(), adjoint_variable.size());
-    AssertDimension(this->dg->system_matrix_transpose.n(), adjoint_variable.size());
+    AssertDimension(this->dg->get_system_matrix_transpose().n(), adjoint_variable.size());
    
-    solve_linear(this->dg->system_matrix_transpose, derivative_functional_wrt_solution, adjoint_variable, this->dg->all_parameters->linear_solver_param);
+    solve_linear(this->dg->get_system_matrix_transpose(), derivative_functional_wrt_solution, adjoint_variable, this->dg->all_parameters->linear_solver_param);
     adjoint_variable *= -1.0;
     
     adjoint_variable.compress(dealii::VectorOperation::add);
@@ -0,0 +1,47 @@
+#include "metric_terms_cache.h"
+
+namespace PHiLiP {
+
+template <int dim, typename real>
+void MetricTermsCache<dim,real>::CellMetricTerms::reset(const unsigned int poly_degree_input)
+{
+    poly_degree = poly_degree_input;
+    volume_is_cached = false;
+    facet_is_cached.fill(false);
+}
+
+template <int dim, typename real>
+void MetricTermsCache<dim,real>::reinit(const unsigned int n_active_cells)
+{
+    cell_metric_terms.clear();
+    cell_metric_terms.resize(n_active_cells);
+}
+
+template <int dim, typename real>
+std::size_t MetricTermsCache<dim,real>::memory_consumption() const
+{
+    std::size_t n_values = 0;
+    for (const auto &cell : cell_metric_terms) {
+        n_values += cell.det_Jac_vol.capacity();
+        for (int idim=0; idim<dim; ++idim) {
+            n_values += cell.flux_nodes_vol[idim].capacity();
+            for (int jdim=0; jdim<dim; ++jdim) {
+                n_values += cell.metric_cofactor_vol[idim][jdim].capacity();
+            }
+        }
+        for (unsigned int iface=0; iface<n_faces; ++iface) {
+            n_values += cell.det_Jac_surf[iface].capacity();
+            for (int idim=0; idim<dim; ++idim) {
+                n_values += cell.flux_nodes_surf[iface][idim].capacity();
+                for (int jdim=0; jdim<dim; ++jdim) {
+                    n_values += cell.metric_cofactor_surf[iface][idim][jdim].capacity();
+                }
+            }
+        }
+    }
+    return n_values * sizeof(real) + cell_metric_terms.capacity() * sizeof(CellMetricTerms);
+}
+
+template class MetricTermsCache <PHILIP_DIM, double>;
+
+} // PHiLiP namespace
@@ -0,0 +1,78 @@
+#ifndef __METRIC_TERMS_CACHE_H__
+#define __METRIC_TERMS_CACHE_H__
+
+#include <array>
+#include <vector>
+
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/types.h>
+
+namespace PHiLiP {
+
+/// Stores the metric terms of every locally relevant cell at its volume and facet flux nodes.
+/** The metric cofactor matrix, the determinant of the metric Jacobian and the physical flux nodes
+ *  only depend on the grid nodes and on the polynomial degree of the cell.
+ *  For grids that do not move, they can be evaluated once and re-used on every residual evaluation.
+ *  The entries are filled lazily by the residual assembly and are indexed by the active cell index.
+ *  The physical unit normals are not stored since they are recovered from the facet metric cofactor
+ *  with a single matrix-vector product.
+ *
+ *  Owned by HighOrderGrid, which clears it whenever its volume_nodes change.
+ */
+template <int dim, typename real>
+class MetricTermsCache
+{
+public:
+    /// Number of faces of a cell.
+    static constexpr unsigned int n_faces = 2*dim;
+
+    /// Metric terms of one cell.
+    struct CellMetricTerms
+    {
+        /// Polynomial degree of the flux nodes at which the terms are stored.
+        unsigned int poly_degree = 0;
+
+        /// Flag whether the volume terms are stored.
+        bool volume_is_cached = false;
+        /// Volume metric cofactor matrix.
+        dealii::Tensor<2,dim,std::vector<real>> metric_cofactor_vol;
+        /// Determinant of the metric Jacobian at the volume flux nodes.
+        std::vector<real> det_Jac_vol;
+        /// Physical volume flux nodes.
+        dealii::Tensor<1,dim,std::vector<real>> flux_nodes_vol;
+
+        /// Flag whether the terms of each face are stored.
+        std::array<bool,n_faces> facet_is_cached = {};
+        /// Facet metric cofactor matrix of each face.
+        std::array<dealii::Tensor<2,dim,std::vector<real>>,n_faces> metric_cofactor_surf;
+        /// Determinant of the metric Jacobian at the facet flux nodes of each face.
+        std::array<std::vector<real>,n_faces> det_Jac_surf;
+        /// Physical facet flux nodes of each face.
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,n_faces> flux_nodes_surf;
+
+        /// Resets the cell entry for the given polynomial degree, keeping the allocated memory.
+        void reset(const unsigned int poly_degree_input);
+    };
+
+    /// Clears all the entries and resizes the cache for the given number of active cells.
+    void reinit(const unsigned int n_active_cells);
+
+    /// Returns the metric terms of the cell with the given active cell index.
+    CellMetricTerms &operator[](const dealii::types::global_dof_index cell_index)
+    { return cell_metric_terms[cell_index]; }
+
+    /// Number of cells the cache has been sized for.
+    unsigned int size() const
+    { return cell_metric_terms.size(); }
+
+    /// Memory consumption of the stored metric terms in bytes.
+    std::size_t memory_consumption() const;
+
+protected:
+    /// Metric terms indexed by the active cell index.
+    std::vector<CellMetricTerms> cell_metric_terms;
+};
+
+} // PHiLiP namespace
+
+#endif
@@ -0,0 +1,300 @@
+#include "JFNK_preconditioner.h"
+#include "dg/dg_factory.hpp"
+#include "linear_solver/linear_solver.h"
+
+namespace PHiLiP{
+namespace ODE{
+
+template <int dim, typename real, typename MeshType>
+void LaggedImplicitOperator<dim,real,MeshType>::assemble(
+    std::shared_ptr<DGBase<dim,real,MeshType>> dg_input,
+    const double dt,
+    const bool pseudotime,
+    const InverseType inverse_type_input)
+{
+    dg = dg_input;
+    uses_block_storage = dg->jacobian_uses_block_storage();
+    inverse_type = inverse_type_input;
+    if (inverse_type == InverseType::p_multigrid && uses_block_storage) {
+        dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+        pcout << "The p-multigrid preconditioner requires the trilinos_csr Jacobian storage. Aborting..." << std::endl;
+        std::abort();
+    }
+
+    if (inverse_type == InverseType::cell_block_jacobi) {
+        dg->assemble_cell_diagonal_blocks(cell_dRdW_blocks);
+    } else {
+        const bool compute_dRdW = true;
+        dg->assemble_residual(compute_dRdW);
+
+        // Copied, such that the DG storage may be re-assembled in between.
+        if (uses_block_storage) {
+            block_matrix = dg->block_system_matrix;
+            block_matrix *= -1.0;
+        } else {
+            matrix.copy_from(dg->system_matrix);
+            matrix *= -1.0;
+        }
+    }
+    n_assembled_dofs = dg->dof_handler.n_dofs();
+
+    current_dt = 0.0;
+    shift_is_pseudotime = false;
+    shift_mass_term(dt, pseudotime);
+
+    if (inverse_type == InverseType::p_multigrid) {
+        // The coarse levels assemble their own dRdW at the projection of the solution.
+        if (!p_multigrid) p_multigrid = std::make_unique<PMultigridPreconditioner<dim,real,MeshType>>(dg);
+        p_multigrid->initialize(matrix, dt, pseudotime);
+        return;
+    }
+    factor();
+}
+
+template <int dim, typename real, typename MeshType>
+void LaggedImplicitOperator<dim,real,MeshType>::set_time_step(const double dt, const bool pseudotime)
+{
+    // The local time steps of the time-scaled mass matrix may have changed since the last step.
+    if (!pseudotime && !shift_is_pseudotime && dt == current_dt) return;
+
+    shift_mass_term(dt, pseudotime);
+    factor();
+}
+
+template <int dim, typename real, typename MeshType>
+void LaggedImplicitOperator<dim,real,MeshType>::shift_mass_term(const double dt, const bool pseudotime)
+{
+    // Removes the mass term of the previous time step.
+    if (shift_is_pseudotime) {
+        add_to_operator(-1.0, mass_shift);
+    } else if (current_dt != 0.0) {
+        add_to_operator(-1.0/current_dt, dg->global_mass_matrix);
+    }
+
+    if (pseudotime) {
+        const double CFL = dt;
+        dg->time_scaled_mass_matrices(CFL);
+        mass_shift.copy_from(dg->time_scaled_global_mass_matrix);
+        add_to_operator(1.0, mass_shift);
+    } else {
+        add_to_operator(1.0/dt, dg->global_mass_matrix);
+    }
+    current_dt = dt;
+    shift_is_pseudotime = pseudotime;
+}
+
+template <int dim, typename real, typename MeshType>
+void LaggedImplicitOperator<dim,real,MeshType>::add_to_operator(const double scale, const dealii::TrilinosWrappers::SparseMatrix &shift_matrix)
+{
+    // The mass term of the cell diagonal blocks is added when they are inverted.
+    if (inverse_type == InverseType::cell_block_jacobi) return;
+
+    if (uses_block_storage) {
+        block_matrix.add(scale, shift_matrix);
+    } else {
+        matrix.add(scale, shift_matrix);
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+void LaggedImplicitOperator<dim,real,MeshType>::factor()
+{
+    const Parameters::LinearSolverParam &param = dg->all_parameters->linear_solver_param;
+
+    if (inverse_type == InverseType::cell_block_jacobi) {
+        // M_dt - dRdW
+        const double dRdW_scale = -1.0;
+        if (shift_is_pseudotime) {
+            cell_block_jacobi.initialize(dg->dof_handler, cell_dRdW_blocks, dRdW_scale, 1.0, mass_shift);
+        } else {
+            cell_block_jacobi.initialize(dg->dof_handler, cell_dRdW_blocks, dRdW_scale, 1.0/current_dt, dg->global_mass_matrix);
+        }
+        return;
+    }
+
+    if (inverse_type == InverseType::p_multigrid) {
+        // The coarse operators and the smoothers follow the mass term of the fine operator.
+        p_multigrid->update_mass_shift(current_dt, shift_is_pseudotime);
+        return;
+    }
+
+    if (uses_block_storage) {
+        using BlockPreconditionerEnum = Parameters::LinearSolverParam::BlockPreconditionerEnum;
+        const bool use_ilu = (param.block_preconditioner == BlockPreconditionerEnum::block_ilu);
+        block_matrix_preconditioner.initialize(block_matrix, use_ilu);
+        return;
+    }
+
+    const unsigned int overlap = 1;
+    const dealii::TrilinosWrappers::PreconditionILU::AdditionalData ilu_settings(std::abs(param.ilut_fill), param.ilut_atol, param.ilut_rtol, overlap);
+    matrix_ilu.initialize(matrix, ilu_settings);
+}
+
+template <int dim, typename real, typename MeshType>
+void LaggedImplicitOperator<dim,real,MeshType>::vmult(VectorType &dst, const VectorType &src) const
+{
+    if (inverse_type == InverseType::cell_block_jacobi) {
+        cell_block_jacobi.vmult(dst, src);
+        return;
+    }
+
+    if (inverse_type == InverseType::p_multigrid) {
+        p_multigrid->vmult(dst, src);
+        return;
+    }
+
+    if (uses_block_storage) {
+        block_matrix_preconditioner.vmult(dst, src);
+        return;
+    }
+
+    matrix_ilu.vmult(dst, src);
+}
+
+template <int dim, typename real, typename MeshType>
+std::pair<unsigned int, double> LaggedImplicitOperator<dim,real,MeshType>::solve(VectorType &right_hand_side, VectorType &solution) const
+{
+    Assert(inverse_type != InverseType::cell_block_jacobi, dealii::ExcMessage("Only the cell diagonal blocks of the operator are assembled."));
+    const Parameters::LinearSolverParam &param = dg->all_parameters->linear_solver_param;
+
+    if (uses_block_storage) {
+        return solve_linear_preconditioned(block_matrix, right_hand_side, solution, *this, param);
+    }
+    if (inverse_type == InverseType::factorization && param.linear_solver_type == Parameters::LinearSolverParam::LinearSolverEnum::direct) {
+        return solve_linear(matrix, right_hand_side, solution, param);
+    }
+    // The coarsest level of the V-cycle is solved to a tolerance, such that the V-cycle is not a fixed linear operator.
+    const bool is_variable_preconditioner = (inverse_type == InverseType::p_multigrid);
+    return solve_linear_preconditioned(matrix, right_hand_side, solution, *this, param, is_variable_preconditioner);
+}
+
+template <int dim, typename real, typename MeshType>
+bool LaggedImplicitOperator<dim,real,MeshType>::is_assembled() const
+{
+    return dg && n_assembled_dofs == dg->dof_handler.n_dofs();
+}
+
+template <int dim, typename real, typename MeshType>
+JFNKPreconditioner<dim,real,MeshType>::JFNKPreconditioner(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input)
+    : pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0)
+    , dg(dg_input)
+    , preconditioner_type(dg_input->all_parameters->linear_solver_param.jfnk_preconditioner)
+    , refresh_interval(dg_input->all_parameters->linear_solver_param.jfnk_preconditioner_refresh_interval)
+    , n_solves_since_refresh(0)
+    , refresh_count(0)
+    , dt(0.0)
+{}
+
+template <int dim, typename real, typename MeshType>
+bool JFNKPreconditioner<dim,real,MeshType>::is_identity() const
+{
+    return preconditioner_type == Parameters::LinearSolverParam::JFNKPreconditionerEnum::none;
+}
+
+template <int dim, typename real, typename MeshType>
+void JFNKPreconditioner<dim,real,MeshType>::reinit_for_next_timestep(const double dt_input, const VectorType &solution)
+{
+    dt = dt_input;
+    if (is_identity()) return;
+
+    using PreconditionerEnum = Parameters::LinearSolverParam::JFNKPreconditionerEnum;
+    const bool use_coarse_degree = (preconditioner_type == PreconditionerEnum::coarse_degree);
+
+    const bool do_refresh = (refresh_count == 0) || (n_solves_since_refresh >= refresh_interval);
+    if (!do_refresh) {
+        ++n_solves_since_refresh;
+        const bool pseudotime = false;
+        lagged_operator.set_time_step(dt, pseudotime);
+        return;
+    }
+
+    if (refresh_count == 0) {
+        const bool requires_dRdW = (preconditioner_type == PreconditionerEnum::lagged_jacobian);
+        if (requires_dRdW && dg->sparsity_pattern.n_rows() != dg->dof_handler.n_dofs()) {
+            pcout << "The JFNK preconditioner requires the DG to be allocated with dRdW. Aborting..." << std::endl;
+            std::abort();
+        }
+        if (dg->global_mass_matrix.m() != dg->dof_handler.n_dofs()) dg->evaluate_mass_matrices(false);
+        if (use_coarse_degree) allocate_coarse_degree();
+    }
+
+    using InverseType = typename LaggedImplicitOperator<dim,real,MeshType>::InverseType;
+    const bool pseudotime = false;
+    if (use_coarse_degree) {
+        coarse_transfer->restrict_solution(solution, coarse_dg->solution);
+        coarse_dg->solution.update_ghost_values();
+        lagged_operator.assemble(coarse_dg, dt, pseudotime, InverseType::factorization);
+    } else {
+        dg->solution = solution;
+        const InverseType inverse_type = (preconditioner_type == PreconditionerEnum::cell_block_jacobi)
+                                         ? InverseType::cell_block_jacobi : InverseType::factorization;
+        lagged_operator.assemble(dg, dt, pseudotime, inverse_type);
+    }
+
+    n_solves_since_refresh = 1;
+    ++refresh_count;
+}
+
+template <int dim, typename real, typename MeshType>
+void JFNKPreconditioner<dim,real,MeshType>::vmult(VectorType &dst, const VectorType &src) const
+{
+    if (is_identity()) {
+        dst = src;
+        return;
+    }
+
+    using PreconditionerEnum = Parameters::LinearSolverParam::JFNKPreconditionerEnum;
+    if (preconditioner_type != PreconditionerEnum::coarse_degree) {
+        // J^{-1} src = (M/dt - dRdW)^{-1} M src
+        if (fine_work.size() != src.size()) fine_work.reinit(src);
+        dg->global_mass_matrix.vmult(fine_work, src);
+        lagged_operator.vmult(dst, fine_work);
+        return;
+    }
+
+    // Coarse modes: (M_c/dt - dRdW_c)^{-1} M_c Pi src
+    coarse_transfer->restrict_solution(src, coarse_residual);
+    coarse_dg->global_mass_matrix.vmult(coarse_right_hand_side, coarse_residual);
+    lagged_operator.vmult(coarse_update, coarse_right_hand_side);
+    coarse_transfer->prolongate(coarse_update, dst);
+
+    // Higher modes: dt (src - I Pi src)
+    if (fine_work.size() != src.size()) fine_work.reinit(src);
+    coarse_transfer->prolongate(coarse_residual, fine_work);
+    fine_work.sadd(-1.0, 1.0, src);
+    dst.add(dt, fine_work);
+}
+
+template <int dim, typename real, typename MeshType>
+void JFNKPreconditioner<dim,real,MeshType>::allocate_coarse_degree()
+{
+    const unsigned int coarse_degree = dg->all_parameters->linear_solver_param.jfnk_preconditioner_coarse_degree;
+    const unsigned int grid_degree = dg->high_order_grid->fe_system.tensor_degree();
+    pcout << "Allocating the degree " << coarse_degree << " discretization of the JFNK preconditioner..." << std::endl;
+
+    coarse_dg = DGFactory<dim,real,MeshType>::create_discontinuous_galerkin(dg->all_parameters, coarse_degree, coarse_degree, grid_degree, dg->triangulation);
+    coarse_dg->set_high_order_grid(dg->high_order_grid);
+    coarse_dg->allocate_system(true, false, false);
+    coarse_dg->evaluate_mass_matrices(false);
+
+    coarse_residual.reinit(coarse_dg->solution);
+    coarse_right_hand_side.reinit(coarse_dg->right_hand_side);
+    coarse_update.reinit(coarse_dg->solution);
+
+    coarse_transfer = std::make_unique<PolynomialDegreeTransfer<dim,real,MeshType>>(dg, coarse_dg);
+}
+
+template class LaggedImplicitOperator<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM>>;
+template class LaggedImplicitOperator<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>;
+#if PHILIP_DIM != 1
+template class LaggedImplicitOperator<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>;
+#endif
+
+template class JFNKPreconditioner<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM>>;
+template class JFNKPreconditioner<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>;
+#if PHILIP_DIM != 1
+template class JFNKPreconditioner<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>;
+#endif
+
+}
+}
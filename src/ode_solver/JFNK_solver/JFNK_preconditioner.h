@@ -0,0 +1,200 @@
+#ifndef __JFNK_PRECONDITIONER__
+#define __JFNK_PRECONDITIONER__
+
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/trilinos_precondition.h>
+
+#include "dg/dg_base.hpp"
+#include "linear_solver/block_sparse_matrix.h"
+#include "ode_solver/p_multigrid/p_multigrid.h"
+
+namespace PHiLiP {
+namespace ODE{
+
+/// Operator M_dt - dRdW of a DG discretization, assembled at a lagged state, and its approximate inverse.
+/** dRdW is assembled in the storage of the DG, DGBase::system_matrix or DGBase::block_system_matrix,
+ *  and copied such that later assemblies of the DG do not alter the operator. A change of time step
+ *  only replaces the mass term M_dt of the copied operator, which is M/dt for physical time steps and
+ *  the time-scaled mass matrix of the local time steps, DGBase::time_scaled_global_mass_matrix, for pseudotime steps.
+ *
+ *  The approximate inverse is selected by InverseType. With cell_block_jacobi, dRdW is not assembled:
+ *  only the derivatives of each cell residual with respect to its own solution are evaluated,
+ *  see DGBase::assemble_cell_diagonal_blocks(), and the cell diagonal blocks of the operator are inverted.
+ *
+ *  Used by JFNKPreconditioner, and by ImplicitODESolver to lag dRdW over several steps.
+ */
+template <int dim, typename real, typename MeshType>
+class LaggedImplicitOperator
+{
+public:
+    /// Vector type the operator applies to.
+    using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+
+    /// Approximate inverses of the operator.
+    enum class InverseType {
+        factorization,     ///< ILU of the Trilinos matrix, or the block preconditioner of the parameters for the block storage.
+        cell_block_jacobi, ///< Inverse of the cell diagonal blocks of the operator.
+        p_multigrid        ///< V-cycle of PMultigridPreconditioner, which requires the Trilinos storage.
+    };
+
+    /// Assembles dRdW, or its cell diagonal blocks, at the current solution of dg, forms M_dt - dRdW and sets up its inverse.
+    /** Except with cell_block_jacobi, the residual of dg is assembled as well.
+     *  The global mass matrix of dg must be evaluated.
+     *  @param dt         CFL number if pseudotime, otherwise the time step.
+     *  @param pseudotime Whether the mass term is the time-scaled mass matrix of the local time steps.
+     */
+    void assemble(
+        std::shared_ptr<DGBase<dim,real,MeshType>> dg,
+        const double dt,
+        const bool pseudotime,
+        const InverseType inverse_type);
+
+    /// Replaces the mass term of the operator by the one of dt and sets up its inverse again.
+    /** Same arguments as assemble(). The time-scaled mass matrix uses the local time steps of the
+     *  last residual assembly of the DG.
+     */
+    void set_time_step(const double dt, const bool pseudotime);
+
+    /// Applies the approximate inverse, dst = A^{-1} src.
+    void vmult(VectorType &dst, const VectorType &src) const;
+
+    /// Solves A x = b with GMRES preconditioned by the approximate inverse.
+    /** Flexible GMRES is used with the p-multigrid inverse, see PMultigridPreconditioner.
+     *  The Trilinos storage is solved directly with the direct linear_solver_type of the parameters.
+     *  Not available with cell_block_jacobi, which does not assemble the operator.
+     */
+    std::pair<unsigned int, double> solve(VectorType &right_hand_side, VectorType &solution) const;
+
+    /// Whether the operator was assembled for the current degrees of freedom of the DG.
+    bool is_assembled() const;
+
+private:
+    /// Replaces the mass term of the operator by the one of dt.
+    void shift_mass_term(const double dt, const bool pseudotime);
+
+    /// Adds scale*shift_matrix to the assembled operator.
+    void add_to_operator(const double scale, const dealii::TrilinosWrappers::SparseMatrix &shift_matrix);
+
+    /// Sets up the approximate inverse of the operator.
+    void factor();
+
+    /// DG the operator was assembled from.
+    std::shared_ptr<DGBase<dim,real,MeshType>> dg;
+    /// Whether the operator is stored as a BlockSparseMatrix.
+    bool uses_block_storage = false;
+    /// Approximate inverse of the operator.
+    InverseType inverse_type = InverseType::factorization;
+    /// Number of degrees of freedom of the DG when the operator was assembled.
+    dealii::types::global_dof_index n_assembled_dofs = 0;
+
+    /// CFL number or time step of the mass term of the operator, zero if there is none.
+    double current_dt = 0.0;
+    /// Whether the mass term of the operator is mass_shift.
+    bool shift_is_pseudotime = false;
+    /// Time-scaled mass matrix of the operator, for pseudotime steps.
+    dealii::TrilinosWrappers::SparseMatrix mass_shift;
+
+    /// Operator with the Trilinos storage.
+    dealii::TrilinosWrappers::SparseMatrix matrix;
+    /// ILU of matrix.
+    dealii::TrilinosWrappers::PreconditionILU matrix_ilu;
+    /// Operator with the block storage.
+    BlockSparseMatrix block_matrix;
+    /// Block-ILU or block-Jacobi of block_matrix.
+    PreconditionBlockILU block_matrix_preconditioner;
+
+    /// Derivatives of the residual of each locally owned cell with respect to its own solution.
+    std::vector<dealii::FullMatrix<double>> cell_dRdW_blocks;
+    /// Inverses of the cell diagonal blocks of the operator.
+    CellBlockJacobi<dim> cell_block_jacobi;
+
+    /// p-multigrid V-cycle of matrix, kept across assemblies with its coarse levels.
+    std::unique_ptr<PMultigridPreconditioner<dim,real,MeshType>> p_multigrid;
+};
+
+/// Preconditioner of the GMRES iterations of JFNKSolver.
+/** Approximates the inverse of the Jacobian J = I/dt - M^{-1} dRdW of the unsteady residual
+ *  R* = (w - w_prev)/dt - M^{-1} R(w), as used by the implicit stages of DIRK methods, through
+ *  J^{-1} = (M/dt - dRdW)^{-1} M. The operator M/dt - dRdW is assembled from dRdW at a lagged
+ *  state and re-assembled every LinearSolverParam::jfnk_preconditioner_refresh_interval solves.
+ *  In between, only its mass term follows the time step, which for example changes between
+ *  the stages of a DIRK method with different diagonal coefficients.
+ *
+ *  The available sources are selected by LinearSolverParam::jfnk_preconditioner:
+ *  - lagged_jacobian: incomplete factorization of the complete operator;
+ *  - cell_block_jacobi: inverse of its cell diagonal blocks, from the derivatives of the local cell residuals;
+ *  - coarse_degree: incomplete factorization of the operator of the same problem discretized with
+ *    LinearSolverParam::jfnk_preconditioner_coarse_degree. The L2 projection of the residual onto
+ *    the coarse degree is solved with it and interpolated back, while the remaining higher modes
+ *    are only scaled by dt, that is J is approximated by I/dt for them.
+ */
+template <int dim, typename real, typename MeshType>
+class JFNKPreconditioner
+{
+public:
+    /// Vector type the preconditioner applies to.
+    using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+
+    /// Constructor.
+    explicit JFNKPreconditioner(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input);
+
+    /// Whether GMRES is preconditioned.
+    bool is_identity() const;
+
+    /// Prepares the preconditioner for the implicit solve of time step dt.
+    /** dRdW is re-assembled at the given solution if the refresh interval has been reached,
+     *  otherwise the lagged operator is only shifted to the new time step.
+     *  The solution of the DG is overwritten.
+     */
+    void reinit_for_next_timestep(const double dt, const VectorType &solution);
+
+    /// Applies the preconditioner, dst = P^{-1} src with P^{-1} approximating J^{-1}.
+    void vmult(VectorType &dst, const VectorType &src) const;
+
+    /// Number of assemblies of dRdW since construction.
+    unsigned int n_refreshes() const { return refresh_count; }
+
+protected:
+    /// Allocates the coarse degree discretization and its transfers.
+    void allocate_coarse_degree();
+
+    /// output on processor 0
+    dealii::ConditionalOStream pcout;
+
+    /// pointer to dg
+    std::shared_ptr<DGBase<dim,real,MeshType>> dg;
+
+    /// Source of the preconditioner.
+    const Parameters::LinearSolverParam::JFNKPreconditionerEnum preconditioner_type;
+
+    /// Number of solves between the assemblies of dRdW.
+    const unsigned int refresh_interval;
+
+    /// Number of calls to reinit_for_next_timestep() since the last assembly of dRdW.
+    unsigned int n_solves_since_refresh;
+
+    /// Number of assemblies of dRdW.
+    unsigned int refresh_count;
+
+    /// Time step of the current solve.
+    double dt;
+
+    /// Lagged operator of the fine discretization, or of the coarse one.
+    LaggedImplicitOperator<dim,real,MeshType> lagged_operator;
+
+    /// Coarse degree discretization of the coarse_degree preconditioner.
+    std::shared_ptr<DGBase<dim,real,MeshType>> coarse_dg;
+
+    /// L2 projection onto the coarse degree and interpolation back.
+    std::unique_ptr<PolynomialDegreeTransfer<dim,real,MeshType>> coarse_transfer;
+
+    /// Work vector of the size of the fine solution.
+    mutable VectorType fine_work;
+    /// Work vectors of the size of the coarse solution.
+    mutable VectorType coarse_residual, coarse_right_hand_side, coarse_update;
+};
+
+}
+}
+#endif
@@ -1,5 +1,4 @@
 #include "JFNK_solver.h"
-#include <deal.II/lac/precondition.h>
 
 namespace PHiLiP{
 namespace ODE{
@@ -17,13 +16,22 @@ JFNKSolver<dim,real,MeshType>::JFNKSolver(std::shared_ptr< DGBase<dim, real, Mes
     , max_Newton_iter(linear_param.newton_max_iterations)
     , do_output(linear_param.linear_solver_output == Parameters::OutputEnum::verbose)
     , jacobian_vector_product(dg_input)
+    , preconditioner(dg_input)
     , solver_control(max_GMRES_iter, 
                      epsilon_GMRES,
                      false,         //log_history 
                      do_output)     //log_result 
     , solver_GMRES(solver_control,
-            dealii::SolverGMRES<dealii::LinearAlgebra::distributed::Vector<double>>::AdditionalData(max_num_temp_vectors))
-{}
+            // Right preconditioning, such that epsilon_GMRES applies to the unpreconditioned residual.
+            dealii::SolverGMRES<dealii::LinearAlgebra::distributed::Vector<double>>::AdditionalData(max_num_temp_vectors, true))
+    , linear_iteration_count(0)
+{
+    using JVPEnum = Parameters::LinearSolverParam::JacobianVectorProductEnum;
+    if (linear_param.jacobian_vector_product == JVPEnum::automatic_differentiation && !dg_input->supports_dRdW_vmult()) {
+        pcout << "The automatic_differentiation Jacobian-vector product requires the weak DG form. Aborting..." << std::endl;
+        std::abort();
+    }
+}
 
 template <int dim, typename real, typename MeshType>
 void JFNKSolver<dim,real,MeshType>::solve (real dt,
@@ -33,6 +41,7 @@ void JFNKSolver<dim,real,MeshType>::solve (real dt,
     int Newton_iter_counter = 0;
     
     jacobian_vector_product.reinit_for_next_timestep(dt, perturbation_magnitude, previous_step_solution);
+    preconditioner.reinit_for_next_timestep(dt, previous_step_solution);
     current_solution_estimate = previous_step_solution;
     solution_update_newton.reinit(previous_step_solution);
 
@@ -42,7 +51,8 @@ void JFNKSolver<dim,real,MeshType>::solve (real dt,
         solver_GMRES.solve(jacobian_vector_product,
                      solution_update_newton, 
                      jacobian_vector_product.compute_unsteady_residual(current_solution_estimate, true), //do_negate = true
-                     dealii::PreconditionIdentity());
+                     preconditioner);
+        linear_iteration_count += solver_control.last_step();
 
         update_norm = solution_update_newton.l2_norm();
         current_solution_estimate += solution_update_newton;
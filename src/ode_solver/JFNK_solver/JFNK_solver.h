@@ -6,6 +6,7 @@
 
 #include "dg/dg_base.hpp"
 #include "jacobian_vector_product.h"
+#include "JFNK_preconditioner.h"
 
 namespace PHiLiP {
 namespace ODE{
@@ -22,13 +23,17 @@ public:
     /** See for example Knoll & Keyes 2004 "Jacobian-free Newton-Krylov methods; a survey of approaches and applications
      * Solves J(wk) * dwk = -R*(wk), where R*= dw/dt - R is unsteady residual and J is its Jacobian
      * Consists of outer loop (Newton iteration)
-     * Calls solver_GMRES.solve(...) for inner loop (GMRES iterations)
+     * Calls solver_GMRES.solve(...) for inner loop (GMRES iterations),
+     * right-preconditioned by the JFNKPreconditioner selected in the parameters.
      */
     void solve(real dt,
                dealii::LinearAlgebra::distributed::Vector<double> &previous_step_solution);
 
     /// current estimate for the solution
     dealii::LinearAlgebra::distributed::Vector<double> current_solution_estimate;
+
+    /// Number of GMRES iterations of all the solves since construction.
+    unsigned int n_linear_iterations() const { return linear_iteration_count; }
     
 protected:
 
@@ -65,6 +70,9 @@ protected:
     /// Jacobian-vector product utilities
     JacobianVectorProduct<dim,real,MeshType> jacobian_vector_product;
 
+    /// Preconditioner of the GMRES iterations
+    JFNKPreconditioner<dim,real,MeshType> preconditioner;
+
     /// Solver control object
     dealii::SolverControl solver_control;
     
@@ -73,6 +81,9 @@ protected:
     
     /// Update to solution during Newton iterations
     dealii::LinearAlgebra::distributed::Vector<double> solution_update_newton;
+
+    /// Number of GMRES iterations of all the solves since construction.
+    unsigned int linear_iteration_count;
 };
 
 }
@@ -65,6 +65,21 @@ template <int dim, typename real, typename MeshType>
 void JacobianVectorProduct<dim,real,MeshType>::vmult (dealii::LinearAlgebra::distributed::Vector<double> &destination,
                 const dealii::LinearAlgebra::distributed::Vector<double> &w) const
 {
+    using JVPEnum = Parameters::LinearSolverParam::JacobianVectorProductEnum;
+    if (dg->all_parameters->linear_solver_param.jacobian_vector_product == JVPEnum::automatic_differentiation) {
+        // Exact product J w = w/dt - IMM * dRdW w, without perturbation error nor residual evaluations of R*.
+        dg->solution = *current_solution_estimate;
+        if (dRdW_w.size() != dg->right_hand_side.size()) dRdW_w.reinit(dg->right_hand_side);
+        dg->dRdW_vmult(dRdW_w, w);
+        if(dg->all_parameters->use_inverse_mass_on_the_fly){
+            dg->apply_inverse_global_mass_matrix(dRdW_w, destination);
+        } else{
+            dg->global_inverse_mass_matrix.vmult(destination, dRdW_w);
+        }
+        destination.sadd(-1.0, 1.0/dt, w);
+        return;
+    }
+
     destination = w;
     destination *= fd_perturbation; 
     destination += (*current_solution_estimate);
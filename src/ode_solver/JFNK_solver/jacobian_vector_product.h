@@ -22,7 +22,10 @@ public:
     void reinit_for_next_Newton_iter(const dealii::LinearAlgebra::distributed::Vector<double> &current_solution_estimate_input);
 
     /// Returns the product of the Jacobian with vector w, computed with a matrix-free finite difference approximation
-    /** Write the results into destination. */
+    /** Write the results into destination.
+     *  The product is instead evaluated exactly through DGBase::dRdW_vmult() when the
+     *  automatic_differentiation Jacobian-vector product is requested, which JFNKSolver only allows with the weak form.
+     */
     void vmult (dealii::LinearAlgebra::distributed::Vector<double> &destination,
                 const dealii::LinearAlgebra::distributed::Vector<double> &w) const;
     
@@ -48,6 +51,9 @@ protected:
     
     /// residual of current estimate for the solution
     dealii::LinearAlgebra::distributed::Vector<double> current_solution_estimate_residual;
+
+    /// dRdW w of the automatic_differentiation products, kept across calls of vmult()
+    mutable dealii::LinearAlgebra::distributed::Vector<double> dRdW_w;
     
     /// Compute residual from dg,  R(w) = IMM * RHS where RHS is evaluated using solution=w, and store in destination
     void compute_dg_residual(dealii::LinearAlgebra::distributed::Vector<double> &destination,
@@ -0,0 +1,130 @@
+#include "imex_runge_kutta_ode_solver.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+template <int dim, typename real, typename MeshType>
+IMEXRungeKuttaODESolver<dim,real,MeshType>::IMEXRungeKuttaODESolver(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input,
+        std::shared_ptr<AdditiveRKTableauBase<dim,real,MeshType>> rk_tableau_input)
+        : ODESolverBase<dim,real,MeshType>(dg_input)
+        , butcher_tableau(rk_tableau_input)
+        , solver(dg_input)
+{}
+
+template <int dim, typename real, typename MeshType>
+void IMEXRungeKuttaODESolver<dim,real,MeshType>::step_in_time (real dt, const bool pseudotime)
+{
+    if (pseudotime) {
+        this->pcout << "Error: the IMEX Runge-Kutta solver does not support pseudotime stepping. Aborting..." << std::endl;
+        std::abort();
+    }
+    using ResidualPart = typename DGBase<dim,real,MeshType>::ResidualPart;
+
+    this->original_time_step = dt;
+    this->solution_update = this->dg->solution; //storing u_n
+
+    const int n_stages = butcher_tableau->n_rk_stages;
+    for (int i = 0; i < n_stages; ++i){
+        // u^(i) = u_n + dt * sum(aE_ij * kE_j + aI_ij * kI_j), without the implicit diagonal term
+        this->dg->solution = this->solution_update;
+        for (int j = 0; j < i; ++j){
+            const double a_explicit = butcher_tableau->get_a_explicit(i,j);
+            const double a_implicit = butcher_tableau->get_a(i,j);
+            if (a_explicit != 0.0) this->dg->solution.add(dt*a_explicit, this->explicit_stage[j]);
+            if (a_implicit != 0.0) this->dg->solution.add(dt*a_implicit, this->implicit_stage[j]);
+        }
+
+        //set the DG current time for unsteady source terms
+        this->dg->set_current_time(this->current_time + butcher_tableau->get_c(i)*dt);
+
+        const double dt_times_a_ii = dt*butcher_tableau->get_a(i,i);
+        this->dg->set_residual_part(ResidualPart::dissipative);
+        if (dt_times_a_ii != 0.0) {
+            // Solve u^(i) - dt * a_ii * IMM*R_dissipative(u^(i)) = u_n + dt * sum(...)
+            this->implicit_stage[i] = this->dg->solution;
+            solver.solve(dt_times_a_ii, this->implicit_stage[i]);
+            this->dg->solution = solver.current_solution_estimate;
+        }
+
+        // Apply limiter at every RK stage, before the stage derivatives are formed from u^(i)
+        apply_limiter();
+
+        if (dt_times_a_ii != 0.0) {
+            // kI_i = (u^(i) - u_n - dt * sum(...)) / (dt * a_ii) with the limited u^(i),
+            // which satisfies the stage equation up to the Newton tolerance when the limiter does not act
+            this->implicit_stage[i].sadd(-1.0/dt_times_a_ii, 1.0/dt_times_a_ii, this->dg->solution);
+        } else {
+            this->dg->assemble_residual_and_apply_inverse_mass_matrix(this->implicit_stage[i]);
+        }
+        this->dg->set_residual_part(ResidualPart::convective);
+        this->dg->assemble_residual_and_apply_inverse_mass_matrix(this->explicit_stage[i]);
+    }
+    this->dg->set_residual_part(ResidualPart::full);
+
+    this->modified_time_step = dt;
+
+    // u_np1 = u_n + dt * sum(b_i * (kE_i + kI_i))
+    this->dg->solution = this->solution_update;
+    for (int i = 0; i < n_stages; ++i){
+        const double b_i = butcher_tableau->get_b(i);
+        if (b_i == 0.0) continue;
+        this->dg->solution.add(dt*b_i, this->explicit_stage[i], dt*b_i, this->implicit_stage[i]);
+    }
+
+    apply_limiter();
+
+    ++(this->current_iteration);
+    this->current_time += dt;
+}
+
+template <int dim, typename real, typename MeshType>
+void IMEXRungeKuttaODESolver<dim,real,MeshType>::apply_limiter ()
+{
+    if (this->limiter) {
+        this->limiter->limit(this->dg->solution,
+            this->dg->dof_handler,
+            this->dg->fe_collection,
+            this->dg->volume_quadrature_collection,
+            this->dg->high_order_grid->fe_system.tensor_degree(),
+            this->dg->max_degree,
+            this->dg->oneD_fe_collection_1state,
+            this->dg->oneD_quadrature_collection);
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+void IMEXRungeKuttaODESolver<dim,real,MeshType>::allocate_ode_system ()
+{
+    this->pcout << "Allocating ODE system..." << std::flush;
+    this->solution_update.reinit(this->dg->right_hand_side);
+    if(this->all_parameters->use_inverse_mass_on_the_fly == false) {
+        this->pcout << " evaluating inverse mass matrix..." << std::flush;
+        this->dg->evaluate_mass_matrices(true); // creates and stores global inverse mass matrix
+    }
+    this->pcout << std::endl;
+
+    if (!this->dg->supports_residual_splitting()) {
+        this->pcout << "Error: the IMEX Runge-Kutta solver requires a DG discretization that splits its residual. "
+                    << "Use the strong form (use_weak_form = false). Aborting..." << std::endl;
+        std::abort();
+    }
+
+    this->butcher_tableau->set_tableau();
+
+    const int n_stages = this->butcher_tableau->n_rk_stages;
+    this->explicit_stage.resize(n_stages);
+    this->implicit_stage.resize(n_stages);
+    for (int i=0; i<n_stages; ++i) {
+        this->explicit_stage[i].reinit(this->dg->solution);
+        this->implicit_stage[i].reinit(this->dg->solution);
+    }
+}
+
+template class IMEXRungeKuttaODESolver<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM> >;
+template class IMEXRungeKuttaODESolver<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
+#if PHILIP_DIM != 1
+    template class IMEXRungeKuttaODESolver<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
+#endif
+
+} // ODESolver namespace
+} // PHiLiP namespace
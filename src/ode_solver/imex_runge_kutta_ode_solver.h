@@ -0,0 +1,58 @@
+#ifndef __IMEX_RUNGE_KUTTA_ODESOLVER__
+#define __IMEX_RUNGE_KUTTA_ODESOLVER__
+
+#include "JFNK_solver/JFNK_solver.h"
+#include "dg/dg_base.hpp"
+#include "ode_solver_base.h"
+#include "runge_kutta_methods/additive_rk_tableau_base.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+/// Implicit-explicit additive Runge-Kutta (IMEX ARK) ODE solver derived from ODESolver.
+/** The convective part of the residual is integrated with the explicit tableau of AdditiveRKTableauBase,
+ *  and its dissipative part and source terms with the diagonally-implicit one, see DGBase::set_residual_part().
+ *  The time step is then limited by the convective CFL condition only.
+ *
+ *  The implicit stages are solved with the Jacobian-free Newton-Krylov solver of RungeKuttaODESolver,
+ *  on the dissipative residual, whose stage derivative is recovered from the stage equation
+ *  instead of an additional residual evaluation.
+ */
+#if PHILIP_DIM==1
+template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
+#else
+template <int dim, typename real, typename MeshType = dealii::parallel::distributed::Triangulation<dim>>
+#endif
+class IMEXRungeKuttaODESolver: public ODESolverBase <dim, real, MeshType>
+{
+public:
+    IMEXRungeKuttaODESolver(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input,
+            std::shared_ptr<AdditiveRKTableauBase<dim,real,MeshType>> rk_tableau_input); ///< Constructor.
+
+    /// Function to evaluate solution update
+    void step_in_time(real dt, const bool pseudotime);
+
+    /// Function to allocate the ODE system
+    void allocate_ode_system ();
+
+protected:
+    /// Stores the explicit and implicit Butcher tableaux of the additive RK method
+    std::shared_ptr<AdditiveRKTableauBase<dim,real,MeshType>> butcher_tableau;
+
+    /// Implicit solver for the dissipative part, using Jacobian-free Newton-Krylov
+    JFNKSolver<dim,real,MeshType> solver;
+
+    /// Storage for the derivative of the convective part at each stage
+    std::vector<dealii::LinearAlgebra::distributed::Vector<double>> explicit_stage;
+
+    /// Storage for the derivative of the dissipative part at each stage
+    std::vector<dealii::LinearAlgebra::distributed::Vector<double>> implicit_stage;
+
+    /// Applies the limiter, if any, to the DG solution
+    void apply_limiter();
+};
+
+} // ODE namespace
+} // PHiLiP namespace
+
+#endif
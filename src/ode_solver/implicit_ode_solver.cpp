@@ -1,24 +1,78 @@
+#include <cmath>
+
 #include "implicit_ode_solver.h"
 
 
 namespace PHiLiP {
 namespace ODE {
 
+template <int dim, typename real, typename MeshType>
+MatrixFreeImplicitOperator<dim,real,MeshType>::MatrixFreeImplicitOperator(
+    std::shared_ptr< DGBase<dim, real, MeshType> > dg_input,
+    const dealii::TrilinosWrappers::SparseMatrix &mass_matrix_input,
+    const double mass_scale_input)
+    : dg(dg_input)
+    , mass_matrix(mass_matrix_input)
+    , mass_scale(mass_scale_input)
+{}
+
+template <int dim, typename real, typename MeshType>
+void MatrixFreeImplicitOperator<dim,real,MeshType>::vmult (
+    dealii::LinearAlgebra::distributed::Vector<double> &dst,
+    const dealii::LinearAlgebra::distributed::Vector<double> &src) const
+{
+    if (mass_product.size() != dst.size()) mass_product.reinit(dst);
+    mass_matrix.vmult(mass_product, src);
+    dg->dRdW_vmult(dst, src);
+    dst.sadd(-1.0, mass_scale, mass_product);
+}
+
 template <int dim, typename real, typename MeshType>
 ImplicitODESolver<dim,real,MeshType>::ImplicitODESolver(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input)
         : ODESolverBase<dim,real,MeshType>(dg_input)
+        , n_steps_since_refresh(0)
+        , last_linear_iterations(0)
+        , last_residual_reduction(0.0)
         {}
 
 template <int dim, typename real, typename MeshType>
 void ImplicitODESolver<dim,real,MeshType>::step_in_time (real dt, const bool pseudotime)
 {
+    if (this->dg->jacobian_is_matrix_free()) {
+        solve_matrix_free_update(dt, pseudotime);
+        this->current_time += dt;
+
+        linesearch();
+
+        this->update_norm = this->solution_update.l2_norm();
+        ++(this->current_iteration);
+        return;
+    }
+
+    if (this->ode_param.jacobian_refresh_interval > 1 || this->all_parameters->p_multigrid_param.use_as_implicit_preconditioner) {
+        last_linear_iterations = solve_lagged_jacobian_update(dt, pseudotime);
+        this->current_time += dt;
+
+        const double residual_norm_before_step = this->dg->get_residual_l2norm();
+        linesearch();
+        last_residual_reduction = this->dg->get_residual_l2norm() / residual_norm_before_step;
+
+        this->update_norm = this->solution_update.l2_norm();
+        ++(this->current_iteration);
+        return;
+    }
+
     const bool compute_dRdW = true;
     this->dg->assemble_residual(compute_dRdW);
     this->current_time += dt;
     // Solve (M/dt - dRdW) dw = R
     // w = w + dw
 
-    this->dg->system_matrix *= -1.0;
+    if (this->dg->jacobian_uses_block_storage()) {
+        this->dg->block_system_matrix *= -1.0;
+    } else {
+        this->dg->system_matrix *= -1.0;
+    }
 
     if (pseudotime) {
         const double CFL = dt;
@@ -33,11 +87,19 @@ void ImplicitODESolver<dim,real,MeshType>::step_in_time (real dt, const bool pse
         this->pcout << " Evaluating system update... " << std::endl;
     }
 
-    solve_linear (
-            this->dg->system_matrix,
-            this->dg->right_hand_side,
-            this->solution_update,
-            this->ODESolverBase<dim,real,MeshType>::all_parameters->linear_solver_param);
+    if (this->dg->jacobian_uses_block_storage()) {
+        solve_linear (
+                this->dg->block_system_matrix,
+                this->dg->right_hand_side,
+                this->solution_update,
+                this->ODESolverBase<dim,real,MeshType>::all_parameters->linear_solver_param);
+    } else {
+        solve_linear (
+                this->dg->system_matrix,
+                this->dg->right_hand_side,
+                this->solution_update,
+                this->ODESolverBase<dim,real,MeshType>::all_parameters->linear_solver_param);
+    }
 
     linesearch();
 
@@ -45,6 +107,86 @@ void ImplicitODESolver<dim,real,MeshType>::step_in_time (real dt, const bool pse
     ++(this->current_iteration);
 }
 
+template <int dim, typename real, typename MeshType>
+void ImplicitODESolver<dim,real,MeshType>::solve_matrix_free_update (const real dt, const bool pseudotime)
+{
+    this->dg->assemble_residual();
+
+    // Solve (M/dt - dRdW) dw = R, with dRdW only applied through its products.
+    const dealii::TrilinosWrappers::SparseMatrix *mass_matrix = &(this->dg->global_mass_matrix);
+    double mass_scale = 1.0/dt;
+    if (pseudotime) {
+        const double CFL = dt;
+        this->dg->time_scaled_mass_matrices(CFL);
+        mass_matrix = &(this->dg->time_scaled_global_mass_matrix);
+        mass_scale = 1.0;
+    }
+    const MatrixFreeImplicitOperator<dim,real,MeshType> system_operator(this->dg, *mass_matrix, mass_scale);
+
+    // The scaled mass matrix dominates the operator for small time steps.
+    dealii::TrilinosWrappers::PreconditionJacobi preconditioner;
+    preconditioner.initialize(*mass_matrix);
+
+    if ((this->ode_param.ode_output) == Parameters::OutputEnum::verbose &&
+        (this->current_iteration%this->ode_param.print_iteration_modulo) == 0 ) {
+        this->pcout << " Evaluating matrix-free system update... " << std::endl;
+    }
+
+    solve_linear_matrix_free (
+            system_operator,
+            this->dg->right_hand_side,
+            this->solution_update,
+            preconditioner,
+            this->ODESolverBase<dim,real,MeshType>::all_parameters->linear_solver_param);
+}
+
+template <int dim, typename real, typename MeshType>
+bool ImplicitODESolver<dim,real,MeshType>::jacobian_needs_refresh () const
+{
+    if (!lagged_operator.is_assembled()) return true;
+
+    if (n_steps_since_refresh >= static_cast<unsigned int>(this->ode_param.jacobian_refresh_interval)) return true;
+
+    const int max_linear_iterations = this->ode_param.jacobian_refresh_linear_iterations;
+    if (max_linear_iterations > 0 && last_linear_iterations > static_cast<unsigned int>(max_linear_iterations)) return true;
+
+    // A step that did not reduce the residual, for example a failed linesearch, always refreshes.
+    const double stall_reduction = this->ode_param.jacobian_refresh_residual_stall;
+    if (last_residual_reduction >= 1.0 || std::isnan(last_residual_reduction)) return true;
+    if (stall_reduction > 0.0 && last_residual_reduction > stall_reduction) return true;
+
+    return false;
+}
+
+template <int dim, typename real, typename MeshType>
+unsigned int ImplicitODESolver<dim,real,MeshType>::solve_lagged_jacobian_update (const real dt, const bool pseudotime)
+{
+    // Solve (M/dt - dRdW) dw = R, with dRdW and the preconditioner of the last refresh.
+    const bool do_refresh = jacobian_needs_refresh();
+    if (do_refresh) {
+        using InverseType = typename LaggedImplicitOperator<dim,real,MeshType>::InverseType;
+        const InverseType inverse_type = this->all_parameters->p_multigrid_param.use_as_implicit_preconditioner
+                                         ? InverseType::p_multigrid : InverseType::factorization;
+        lagged_operator.assemble(this->dg, dt, pseudotime, inverse_type);
+        n_steps_since_refresh = 0;
+    } else {
+        this->dg->assemble_residual();
+        lagged_operator.set_time_step(dt, pseudotime);
+    }
+    ++n_steps_since_refresh;
+
+    if ((this->ode_param.ode_output) == Parameters::OutputEnum::verbose &&
+        (this->current_iteration%this->ode_param.print_iteration_modulo) == 0 ) {
+        if (do_refresh) this->pcout << " Evaluating system update with a new Jacobian... " << std::endl;
+        else this->pcout << " Evaluating system update with the Jacobian of " << n_steps_since_refresh - 1 << " steps ago... " << std::endl;
+    }
+
+    const std::pair<unsigned int, double> linear_result = lagged_operator.solve(this->dg->right_hand_side, this->solution_update);
+    dRdW_mult += linear_result.first;
+
+    return linear_result.first;
+}
+
 template <int dim, typename real, typename MeshType>
 double ImplicitODESolver<dim,real,MeshType>::linesearch ()
 {
@@ -151,6 +293,12 @@ void ImplicitODESolver<dim,real,MeshType>::allocate_ode_system ()
     this->solution_update.reinit(this->dg->right_hand_side);
 }
 
+template class MatrixFreeImplicitOperator<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM>>;
+template class MatrixFreeImplicitOperator<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>;
+#if PHILIP_DIM != 1
+template class MatrixFreeImplicitOperator<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>;
+#endif
+
 template class ImplicitODESolver<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM>>;
 template class ImplicitODESolver<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>;
 #if PHILIP_DIM != 1
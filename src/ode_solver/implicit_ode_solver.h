@@ -1,13 +1,48 @@
 #ifndef __IMPLICIT_ODESOLVER__
 #define __IMPLICIT_ODESOLVER__
 
+#include <deal.II/lac/trilinos_sparse_matrix.h>
+
 #include "dg/dg_base.hpp"
 #include "linear_solver/linear_solver.h"
 #include "ode_solver_base.h"
+#include "JFNK_solver/JFNK_preconditioner.h"
 
 namespace PHiLiP {
 namespace ODE {
 
+/// Backward-Euler operator (scaled mass - dRdW) applied without storing dRdW.
+/** Used with the matrix_free Jacobian storage, see DGBase::jacobian_is_matrix_free().
+ *  The products of dRdW are evaluated at the current DGBase::solution by DGBase::dRdW_vmult().
+ */
+template <int dim, typename real, typename MeshType>
+class MatrixFreeImplicitOperator
+{
+public:
+    /// Constructor.
+    /** @param dg_input    Discretization evaluating the dRdW products.
+     *  @param mass_matrix Mass matrix, possibly time-scaled, which must outlive the operator.
+     *  @param mass_scale  Factor multiplying the mass matrix.
+     */
+    MatrixFreeImplicitOperator(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input,
+                               const dealii::TrilinosWrappers::SparseMatrix &mass_matrix,
+                               const double mass_scale);
+
+    /// Product dst = (mass_scale * mass_matrix - dRdW) src.
+    void vmult (dealii::LinearAlgebra::distributed::Vector<double> &dst,
+                const dealii::LinearAlgebra::distributed::Vector<double> &src) const;
+
+private:
+    /// Discretization evaluating the dRdW products.
+    std::shared_ptr< DGBase<dim, real, MeshType> > dg;
+    /// Mass matrix added to the negated Jacobian.
+    const dealii::TrilinosWrappers::SparseMatrix &mass_matrix;
+    /// Factor multiplying the mass matrix.
+    const double mass_scale;
+    /// Work vector holding the mass matrix product.
+    mutable dealii::LinearAlgebra::distributed::Vector<double> mass_product;
+};
+
 /// Implicit ODE solver derived from ODESolver.
 /** Currently works to find steady state of linear problems.
  *  Need to add mass matrix to operator to handle nonlinear problems
@@ -25,6 +60,12 @@ namespace ODE {
  *      \frac{\mathbf{u}^{n+1} - \mathbf{u}^{n}}{\Delta t} = \mathbf{R}(\mathbf{u}^{n}) +
  *      \left. \frac{\partial \mathbf{R}}{\partial \mathbf{u}} \right|_{\mathbf{u}^{n}} (\mathbf{u}^{n+1} - \mathbf{u}^{n})
  *  \f]
+ *
+ *  With ODESolverParam::jacobian_refresh_interval above 1, dRdW and the preconditioner of
+ *  the linear solve are lagged: they are assembled at some steps only, see jacobian_needs_refresh(),
+ *  while the other steps only assemble the residual and shift the lagged operator to their mass term,
+ *  see LaggedImplicitOperator. The same path is taken with PMultigridParam::use_as_implicit_preconditioner,
+ *  which replaces the incomplete factorization of the lagged operator by PMultigridPreconditioner.
  */
 #if PHILIP_DIM==1
 template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
@@ -46,6 +87,35 @@ public:
     /// Line search algorithm
     double linesearch ();
 
+protected:
+    /// Solves for the solution_update without assembling dRdW, see MatrixFreeImplicitOperator.
+    void solve_matrix_free_update (const real dt, const bool pseudotime);
+
+    /// Solves for the solution_update with dRdW and its preconditioner assembled at a lagged state.
+    /** Only used with a stored Jacobian, and ODESolverParam::jacobian_refresh_interval above 1
+     *  or PMultigridParam::use_as_implicit_preconditioner.
+     *  Returns the number of linear iterations.
+     */
+    unsigned int solve_lagged_jacobian_update (const real dt, const bool pseudotime);
+
+    /// Whether dRdW and its preconditioner have to be assembled at the current step.
+    /** True at the first step, once the number of degrees of freedom changed, after
+     *  ODESolverParam::jacobian_refresh_interval steps, once the last linear solve took more than
+     *  ODESolverParam::jacobian_refresh_linear_iterations iterations, or once the last step reduced
+     *  the residual norm by a ratio above ODESolverParam::jacobian_refresh_residual_stall or above 1.
+     */
+    bool jacobian_needs_refresh () const;
+
+    /// Lagged M_dt - dRdW, with the incomplete factorization or the p-multigrid preconditioner.
+    LaggedImplicitOperator<dim,real,MeshType> lagged_operator;
+
+    /// Number of steps since dRdW was last assembled.
+    unsigned int n_steps_since_refresh;
+    /// Number of iterations of the last linear solve.
+    unsigned int last_linear_iterations;
+    /// Ratio of the residual norms after and before the last step.
+    double last_residual_reduction;
+
 };
 
 } // ODE namespace
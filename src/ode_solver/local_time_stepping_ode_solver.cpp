@@ -0,0 +1,191 @@
+#include "local_time_stepping_ode_solver.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+template <int dim, typename real, typename MeshType>
+LocalTimeSteppingODESolver<dim,real,MeshType>::LocalTimeSteppingODESolver(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input,
+        std::shared_ptr<RKTableauBase<dim,real,MeshType>> rk_tableau_input)
+        : ODESolverBase<dim,real,MeshType>(dg_input)
+        , butcher_tableau(rk_tableau_input)
+{}
+
+template <int dim, typename real, typename MeshType>
+void LocalTimeSteppingODESolver<dim,real,MeshType>::step_in_time (real dt, const bool pseudotime)
+{
+    if (pseudotime) {
+        this->pcout << "Error: the local time stepping solver does not support pseudotime stepping. Aborting..." << std::endl;
+        std::abort();
+    }
+    this->original_time_step = dt;
+
+    assign_time_levels(dt);
+
+    // Level 0 takes two substeps of dt/2, see advance_time_level()
+    advance_time_level(0, 0.5*dt, this->current_time);
+    this->dg->set_active_time_level(-1);
+
+    this->modified_time_step = dt;
+    ++(this->current_iteration);
+    this->current_time += dt;
+}
+
+template <int dim, typename real, typename MeshType>
+void LocalTimeSteppingODESolver<dim,real,MeshType>::advance_time_level (const int level, const real substep, const real time)
+{
+    // Strang splitting of the level's terms around the finer levels
+    step_time_level(level, substep, time);
+    if (level+1 < n_time_levels_in_use) {
+        advance_time_level(level+1, 0.5*substep, time);
+        advance_time_level(level+1, 0.5*substep, time + substep);
+    }
+    step_time_level(level, substep, time + substep);
+}
+
+template <int dim, typename real, typename MeshType>
+void LocalTimeSteppingODESolver<dim,real,MeshType>::step_time_level (const int level, const real substep, const real time)
+{
+    // The residual only holds the terms of the level, such that the other cells are not modified,
+    // except for the numerical fluxes of the level on the faces of its coarser neighbors
+    this->dg->set_active_time_level(level);
+    this->solution_update = this->dg->solution; //storing u at the start of the substep
+
+    const int n_rk_stages = butcher_tableau->n_rk_stages;
+    for (int i = 0; i < n_rk_stages; ++i){
+        if (i > 0) {
+            this->dg->solution = this->solution_update;
+            for (int j = 0; j < i; ++j){
+                const double a_ij = butcher_tableau->get_a(i,j);
+                if (a_ij != 0.0) this->dg->solution.add(substep*a_ij, this->rk_stage[j]);
+            } //u_n + dt * sum(a_ij * k_j)
+        }
+
+        //set the DG current time for unsteady source terms
+        this->dg->set_current_time(time + butcher_tableau->get_c(i)*substep);
+
+        //rk_stage[i] = IMM*RHS of the level
+        this->dg->assemble_residual_and_apply_inverse_mass_matrix(this->rk_stage[i]);
+    }
+
+    this->dg->solution = this->solution_update;
+    for (int i = 0; i < n_rk_stages; ++i){
+        const double b_i = butcher_tableau->get_b(i);
+        if (b_i != 0.0) this->dg->solution.add(substep*b_i, this->rk_stage[i]);
+    } // u_np1 = u_n + dt* sum(k_i * b_i)
+
+    apply_limiter();
+}
+
+template <int dim, typename real, typename MeshType>
+void LocalTimeSteppingODESolver<dim,real,MeshType>::assign_time_levels (const real dt)
+{
+    const double courant_number = this->ode_param.local_time_stepping_courant_number;
+    const int maximum_levels = this->ode_param.local_time_stepping_maximum_levels;
+
+    // Coarsest level whose substep does not exceed the stable time step of the cell,
+    // from max_dt_cell of the last residual assembly
+    std::vector<dealii::types::global_dof_index> dofs_indices;
+    int local_finest_level = 0;
+    int local_n_unstable_cells = 0;
+    for (auto cell = this->dg->dof_handler.begin_active(); cell != this->dg->dof_handler.end(); ++cell) {
+        if (!cell->is_locally_owned()) continue;
+
+        const double cell_time_step = courant_number * this->dg->max_dt_cell[cell->active_cell_index()];
+        int level = 0;
+        double substep = 0.5*dt;
+        while (substep > cell_time_step && level < maximum_levels-1) {
+            substep *= 0.5;
+            ++level;
+        }
+        if (substep > cell_time_step) ++local_n_unstable_cells;
+        local_finest_level = std::max(local_finest_level, level);
+
+        dofs_indices.resize(cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_indices(dofs_indices);
+        for (const auto dof_index : dofs_indices) {
+            this->time_level_at_dofs[dof_index] = level;
+        }
+    }
+
+    const int n_unstable_cells = dealii::Utilities::MPI::sum(local_n_unstable_cells, this->mpi_communicator);
+    if (n_unstable_cells > 0) {
+        this->pcout << "Error: " << n_unstable_cells << " cell(s) need more than maximum_time_levels = " << maximum_levels
+                    << " time levels for the time step " << dt << ". Aborting..." << std::endl;
+        std::abort();
+    }
+    this->n_time_levels_in_use = 1 + dealii::Utilities::MPI::max(local_finest_level, this->mpi_communicator);
+
+    // The levels of the ghost cells are needed for the faces between processors
+    this->time_level_at_dofs.update_ghost_values();
+    this->dg->cell_time_level.assign(this->dg->triangulation->n_active_cells(), 0);
+    for (auto cell = this->dg->dof_handler.begin_active(); cell != this->dg->dof_handler.end(); ++cell) {
+        if (!(cell->is_locally_owned() || cell->is_ghost())) continue;
+
+        dofs_indices.resize(cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_indices(dofs_indices);
+        this->dg->cell_time_level[cell->active_cell_index()] = static_cast<int>(this->time_level_at_dofs[dofs_indices[0]]);
+    }
+
+    if ((this->ode_param.ode_output) == Parameters::OutputEnum::verbose) {
+        this->pcout << "Local time stepping with " << this->n_time_levels_in_use << " time level(s)" << std::endl;
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+void LocalTimeSteppingODESolver<dim,real,MeshType>::apply_limiter ()
+{
+    if (this->limiter) {
+        this->limiter->limit(this->dg->solution,
+            this->dg->dof_handler,
+            this->dg->fe_collection,
+            this->dg->volume_quadrature_collection,
+            this->dg->high_order_grid->fe_system.tensor_degree(),
+            this->dg->max_degree,
+            this->dg->oneD_fe_collection_1state,
+            this->dg->oneD_quadrature_collection);
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+void LocalTimeSteppingODESolver<dim,real,MeshType>::allocate_ode_system ()
+{
+    this->pcout << "Allocating ODE system..." << std::flush;
+    this->solution_update.reinit(this->dg->right_hand_side);
+    if(this->all_parameters->use_inverse_mass_on_the_fly == false) {
+        this->pcout << " evaluating inverse mass matrix..." << std::flush;
+        this->dg->evaluate_mass_matrices(true); // creates and stores global inverse mass matrix
+    }
+    this->pcout << std::endl;
+
+    if (!this->dg->supports_local_time_stepping()) {
+        this->pcout << "Error: the local time stepping solver requires a DG discretization that assembles the residual of a time level. "
+                    << "Use the strong form (use_weak_form = false). Aborting..." << std::endl;
+        std::abort();
+    }
+
+    this->butcher_tableau->set_tableau();
+    for (int i = 0; i < this->butcher_tableau->n_rk_stages; ++i) {
+        if (this->butcher_tableau->get_a(i,i) != 0.0) {
+            this->pcout << "Error: the local time stepping solver requires an explicit runge_kutta_method. Aborting..." << std::endl;
+            std::abort();
+        }
+    }
+
+    this->rk_stage.resize(this->butcher_tableau->n_rk_stages);
+    for (int i = 0; i < this->butcher_tableau->n_rk_stages; ++i) {
+        this->rk_stage[i].reinit(this->dg->solution);
+    }
+    this->time_level_at_dofs.reinit(this->dg->solution);
+
+    // The time levels of the first step are assigned from max_dt_cell of the initial solution
+    this->dg->assemble_residual();
+}
+
+template class LocalTimeSteppingODESolver<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM> >;
+template class LocalTimeSteppingODESolver<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
+#if PHILIP_DIM != 1
+    template class LocalTimeSteppingODESolver<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
+#endif
+
+} // ODESolver namespace
+} // PHiLiP namespace
@@ -0,0 +1,69 @@
+#ifndef __LOCAL_TIME_STEPPING_ODESOLVER__
+#define __LOCAL_TIME_STEPPING_ODESOLVER__
+
+#include "dg/dg_base.hpp"
+#include "ode_solver_base.h"
+#include "runge_kutta_methods/rk_tableau_base.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+/// Explicit Runge-Kutta ODE solver with local time stepping, derived from ODESolver.
+/** The cells are grouped into time levels from their stable time step DGBase::max_dt_cell, level l advancing with
+ *  substeps of dt/2^(l+1) for the time step dt of the flow solver. The residual is split into the terms of each level,
+ *  see DGBase::set_active_time_level(), such that a substep of a level only assembles the cells of that level
+ *  and their neighbors, and the numerical flux of a face between two levels is applied at the rate of the finer one
+ *  on both of its sides, which conserves the cell averages.
+ *
+ *  The levels are coupled by Strang splitting: a level takes a substep, the finer levels advance over two of
+ *  its substeps, then the level takes its second substep. The scheme is then of order min(2, rk_order)
+ *  when there are several levels, and of the order of the RK method with a single one.
+ *  The levels are reassigned at every time step.
+ */
+#if PHILIP_DIM==1
+template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
+#else
+template <int dim, typename real, typename MeshType = dealii::parallel::distributed::Triangulation<dim>>
+#endif
+class LocalTimeSteppingODESolver: public ODESolverBase <dim, real, MeshType>
+{
+public:
+    LocalTimeSteppingODESolver(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input,
+            std::shared_ptr<RKTableauBase<dim,real,MeshType>> rk_tableau_input); ///< Constructor.
+
+    /// Function to evaluate solution update
+    void step_in_time(real dt, const bool pseudotime);
+
+    /// Function to allocate the ODE system
+    void allocate_ode_system ();
+
+protected:
+    /// Stores Butcher tableau a and b of the explicit RK method of every level
+    std::shared_ptr<RKTableauBase<dim,real,MeshType>> butcher_tableau;
+
+    /// Storage for the derivative at each Runge-Kutta stage
+    std::vector<dealii::LinearAlgebra::distributed::Vector<double>> rk_stage;
+
+    /// Time level of each cell at its degrees of freedom, used to communicate the levels of the ghost cells
+    dealii::LinearAlgebra::distributed::Vector<double> time_level_at_dofs;
+
+    /// Number of levels holding cells in the current time step
+    int n_time_levels_in_use = 1;
+
+    /// Assigns the time levels of DGBase::cell_time_level for the time step dt
+    void assign_time_levels(const real dt);
+
+    /// Advances the level and the finer ones over two substeps of the level, starting at time
+    void advance_time_level(const int level, const real substep, const real time);
+
+    /// Takes one step of the RK method with the residual of the level only
+    void step_time_level(const int level, const real substep, const real time);
+
+    /// Applies the limiter, if any, to the DG solution
+    void apply_limiter();
+};
+
+} // ODE namespace
+} // PHiLiP namespace
+
+#endif
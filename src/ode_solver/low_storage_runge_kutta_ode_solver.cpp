@@ -0,0 +1,141 @@
+#include "low_storage_runge_kutta_ode_solver.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+template <int dim, typename real, typename MeshType>
+LowStorageRungeKuttaODESolver<dim,real,MeshType>::LowStorageRungeKuttaODESolver(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input,
+        std::shared_ptr<LowStorageRKTableauBase<dim,real,MeshType>> rk_tableau_input,
+        const bool use_relaxation_input)
+        : ODESolverBase<dim,real,MeshType>(dg_input)
+        , low_storage_tableau(rk_tableau_input)
+        , use_relaxation(use_relaxation_input)
+{}
+
+template <int dim, typename real, typename MeshType>
+void LowStorageRungeKuttaODESolver<dim,real,MeshType>::step_in_time (real dt, const bool pseudotime)
+{
+    this->original_time_step = dt;
+    const bool stores_initial_solution = (low_storage_tableau->uses_third_register() || use_relaxation);
+    if (stores_initial_solution) this->third_register = this->dg->solution; //storing u_n
+    this->second_register = 0.0;
+
+    // Sum of b_i * R(u^(i)) . (u^(i) - u_n), for the RRK parameter
+    double relaxation_numerator = 0.0;
+
+    for (int i = 0; i < low_storage_tableau->n_rk_stages; ++i){
+        //set the DG current time for unsteady source terms
+        this->dg->set_current_time(this->current_time + low_storage_tableau->get_c(i)*dt);
+
+        //solve the system's right hand side at the stage solution S1 = u^(i), and apply the inverse mass matrix to it
+        this->dg->assemble_residual_and_apply_inverse_mass_matrix(this->stage_derivative);
+
+        if (use_relaxation) {
+            // M^{-1}R is not stored, but M (M^{-1}R) is the right-hand side itself
+            relaxation_numerator += low_storage_tableau->get_b(i)
+                                    * (this->dg->right_hand_side * this->dg->solution - this->dg->right_hand_side * this->third_register);
+        }
+
+        if(pseudotime) {
+            const double CFL = dt;
+            this->dg->time_scale_solution_update(this->stage_derivative, CFL);
+        } else {
+            this->stage_derivative *= dt;
+        }
+
+        // S2 = A_i*S2 + delta_i*S1 + theta_i*dt*F(S1)
+        const double A_i = low_storage_tableau->get_A(i);
+        const double delta_i = low_storage_tableau->get_delta(i);
+        const double theta_i = low_storage_tableau->get_theta(i);
+        if (A_i != 1.0 || delta_i != 0.0) this->second_register.sadd(A_i, delta_i, this->dg->solution);
+        if (theta_i != 0.0) this->second_register.add(theta_i, this->stage_derivative);
+
+        // S1 = gamma_i1*S1 + gamma_i2*S2 + gamma_i3*S3 + beta_i*dt*F(S1)
+        const double gamma_i2 = low_storage_tableau->get_gamma(i,1);
+        const double gamma_i3 = low_storage_tableau->get_gamma(i,2);
+        const double beta_i = low_storage_tableau->get_beta(i);
+        this->dg->solution.sadd(low_storage_tableau->get_gamma(i,0), gamma_i2, this->second_register);
+        if (gamma_i3 != 0.0) this->dg->solution.add(gamma_i3, this->third_register);
+        if (beta_i != 0.0) this->dg->solution.add(beta_i, this->stage_derivative);
+
+        // Apply limiter at every RK stage, the last one being the solution u_np1
+        apply_limiter();
+    }
+
+    if (use_relaxation) {
+        // See Ketcheson 2019, Eq. 2.4, with the stage sums of a_ij*k_j and b_j*k_j being u^(i) - u_n and u_np1 - u_n
+        this->second_register = this->dg->solution;
+        this->second_register -= this->third_register;
+        if(this->all_parameters->use_inverse_mass_on_the_fly){
+            this->dg->apply_global_mass_matrix(this->second_register, this->stage_derivative);
+        } else{
+            this->dg->global_mass_matrix.vmult(this->stage_derivative, this->second_register);
+        }
+        const double denominator = (this->stage_derivative * this->second_register) / (dt*dt);
+        const double numerator = 2.0 * relaxation_numerator / dt;
+        this->relaxation_parameter_RRK_solver = (denominator < 1E-8) ? 1.0 : numerator/denominator;
+
+        if (this->relaxation_parameter_RRK_solver < 0.5 ){
+            this->pcout << "RRK failed to find a reasonable relaxation factor. Aborting..." << std::endl;
+            std::abort();
+        }
+
+        // u_np1 = u_n + gamma*(u_np1 - u_n)
+        this->dg->solution = this->third_register;
+        this->dg->solution.add(this->relaxation_parameter_RRK_solver, this->second_register);
+        dt *= this->relaxation_parameter_RRK_solver;
+    }
+    this->modified_time_step = dt;
+
+    ++(this->current_iteration);
+    this->current_time += dt;
+}
+
+template <int dim, typename real, typename MeshType>
+void LowStorageRungeKuttaODESolver<dim,real,MeshType>::apply_limiter ()
+{
+    if (this->limiter) {
+        this->limiter->limit(this->dg->solution,
+            this->dg->dof_handler,
+            this->dg->fe_collection,
+            this->dg->volume_quadrature_collection,
+            this->dg->high_order_grid->fe_system.tensor_degree(),
+            this->dg->max_degree,
+            this->dg->oneD_fe_collection_1state,
+            this->dg->oneD_quadrature_collection);
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+void LowStorageRungeKuttaODESolver<dim,real,MeshType>::allocate_ode_system ()
+{
+    this->pcout << "Allocating ODE system..." << std::flush;
+    if(this->all_parameters->use_inverse_mass_on_the_fly == false) {
+        this->pcout << " evaluating inverse mass matrix..." << std::flush;
+        this->dg->evaluate_mass_matrices(true); // creates and stores global inverse mass matrix
+        //RRK needs both mass matrix and inverse mass matrix
+        if (use_relaxation){
+            this->dg->evaluate_mass_matrices(false); // creates and stores global mass matrix
+        }
+    }
+    this->pcout << std::endl;
+
+    this->low_storage_tableau->set_tableau();
+
+    this->second_register.reinit(this->dg->solution);
+    this->stage_derivative.reinit(this->dg->solution);
+    if (this->low_storage_tableau->uses_third_register() || use_relaxation) {
+        this->third_register.reinit(this->dg->solution);
+    } else {
+        this->third_register.reinit(0);
+    }
+}
+
+template class LowStorageRungeKuttaODESolver<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM> >;
+template class LowStorageRungeKuttaODESolver<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
+#if PHILIP_DIM != 1
+    template class LowStorageRungeKuttaODESolver<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
+#endif
+
+} // ODESolver namespace
+} // PHiLiP namespace
@@ -0,0 +1,62 @@
+#ifndef __LOW_STORAGE_RUNGE_KUTTA_ODESOLVER__
+#define __LOW_STORAGE_RUNGE_KUTTA_ODESOLVER__
+
+#include "dg/dg_base.hpp"
+#include "ode_solver_base.h"
+#include "runge_kutta_methods/low_storage_rk_tableau_base.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+/// Explicit low-storage Runge-Kutta ODE solver derived from ODESolver.
+/** Performs the stages of LowStorageRKTableauBase with the DG solution as register S1, so that
+ *  it stores the registers S2, S3 if the method uses it, and the stage derivative,
+ *  instead of one derivative per stage and the solution update of RungeKuttaODESolver.
+ *
+ *  The limiter is applied after every stage, as in RungeKuttaODESolver.
+ *  With use_relaxation, the step is relaxed with the algebraic relaxation Runge-Kutta (RRK)
+ *  parameter of the energy (Ketcheson 2019, Eq. 2.4), whose stage inner products are accumulated
+ *  during the stages from the equivalent Butcher tableau, as the stage derivatives are not stored.
+ */
+#if PHILIP_DIM==1
+template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
+#else
+template <int dim, typename real, typename MeshType = dealii::parallel::distributed::Triangulation<dim>>
+#endif
+class LowStorageRungeKuttaODESolver: public ODESolverBase <dim, real, MeshType>
+{
+public:
+    LowStorageRungeKuttaODESolver(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input,
+            std::shared_ptr<LowStorageRKTableauBase<dim,real,MeshType>> rk_tableau_input,
+            const bool use_relaxation_input); ///< Constructor.
+
+    /// Function to evaluate solution update
+    void step_in_time(real dt, const bool pseudotime);
+
+    /// Function to allocate the ODE system
+    void allocate_ode_system ();
+
+protected:
+    /// Stores the low-storage coefficients of the RK method
+    std::shared_ptr<LowStorageRKTableauBase<dim,real,MeshType>> low_storage_tableau;
+
+    /// Whether the step is relaxed by the algebraic RRK parameter of the energy
+    const bool use_relaxation;
+
+    /// Register S2 of the low-storage form
+    dealii::LinearAlgebra::distributed::Vector<double> second_register;
+
+    /// Register S3 of the low-storage form, holding u^n; only allocated if used by the method or RRK
+    dealii::LinearAlgebra::distributed::Vector<double> third_register;
+
+    /// dt times the inverse mass matrix applied to the right-hand side at the current stage
+    dealii::LinearAlgebra::distributed::Vector<double> stage_derivative;
+
+    /// Applies the limiter, if any, to the DG solution
+    void apply_limiter();
+};
+
+} // ODE namespace
+} // PHiLiP namespace
+
+#endif
@@ -132,8 +132,17 @@ public:
      ** This is stored in ode_solver_base such that both flow solver case and ode solver can access it. */
     double relaxation_parameter_RRK_solver=1;
 
+    /// Time step proposed for the next step by the embedded error controller
+    /** Used in RungeKuttaODESolver with the embedded_error adaptive time step policy.
+     ** This is stored in ode_solver_base such that both flow solver case and ode solver can access it. */
+    double error_controlled_time_step = 0;
+
+    /// Number of steps rejected by the embedded error controller
+    /** Each retry of a step with a smaller time step counts as one rejection. */
+    unsigned int n_rejected_steps = 0;
+
 protected:
-    const MPI_Comm mpi_communicator; ///< MPI communicator.
+    const MPI_Comm mpi_communicator; ///< MPI communicator of the DG discretization.
     const int mpi_rank; ///< MPI rank.
     dealii::ConditionalOStream pcout; ///< Parallel std::cout that only outputs on mpi_rank==0
 };
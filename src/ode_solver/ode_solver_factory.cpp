@@ -2,7 +2,11 @@
 #include "parameters/all_parameters.h"
 #include "ode_solver_base.h"
 #include "runge_kutta_ode_solver.h"
+#include "low_storage_runge_kutta_ode_solver.h"
+#include "imex_runge_kutta_ode_solver.h"
+#include "local_time_stepping_ode_solver.h"
 #include "implicit_ode_solver.h"
+#include "p_multigrid/p_multigrid_ode_solver.h"
 #include "relaxation_runge_kutta/algebraic_rrk_ode_solver.h"
 #include "relaxation_runge_kutta/root_finding_rrk_ode_solver.h"
 #include "pod_galerkin_ode_solver.h"
@@ -10,6 +14,8 @@
 #include <deal.II/distributed/solution_transfer.h>
 #include "runge_kutta_methods/runge_kutta_methods.h"
 #include "runge_kutta_methods/rk_tableau_base.h"
+#include "runge_kutta_methods/low_storage_runge_kutta_methods.h"
+#include "runge_kutta_methods/additive_runge_kutta_methods.h"
 #include "relaxation_runge_kutta/empty_RRK_base.h"
 
 namespace PHiLiP {
@@ -26,6 +32,14 @@ std::shared_ptr<ODESolverBase<dim,real,MeshType>> ODESolverFactory<dim,real,Mesh
         return create_RungeKuttaODESolver(dg_input);
     if(ode_solver_type == ODEEnum::implicit_solver)         
         return std::make_shared<ImplicitODESolver<dim,real,MeshType>>(dg_input);
+    if(ode_solver_type == ODEEnum::p_multigrid_solver)
+        return std::make_shared<PMultigridODESolver<dim,real,MeshType>>(dg_input);
+    if(ode_solver_type == ODEEnum::low_storage_runge_kutta_solver)
+        return create_LowStorageRungeKuttaODESolver(dg_input);
+    if(ode_solver_type == ODEEnum::imex_runge_kutta_solver)
+        return create_IMEXRungeKuttaODESolver(dg_input);
+    if(ode_solver_type == ODEEnum::local_time_stepping_solver)
+        return std::make_shared<LocalTimeSteppingODESolver<dim,real,MeshType>>(dg_input, create_RKTableau(dg_input));
     else {
         display_error_ode_solver_factory(ode_solver_type, false);
         return nullptr;
@@ -59,6 +73,14 @@ std::shared_ptr<ODESolverBase<dim,real,MeshType>> ODESolverFactory<dim,real,Mesh
         return create_RungeKuttaODESolver(dg_input);
     if(ode_solver_type == ODEEnum::implicit_solver)         
         return std::make_shared<ImplicitODESolver<dim,real,MeshType>>(dg_input);
+    if(ode_solver_type == ODEEnum::p_multigrid_solver)
+        return std::make_shared<PMultigridODESolver<dim,real,MeshType>>(dg_input);
+    if(ode_solver_type == ODEEnum::low_storage_runge_kutta_solver)
+        return create_LowStorageRungeKuttaODESolver(dg_input);
+    if(ode_solver_type == ODEEnum::imex_runge_kutta_solver)
+        return create_IMEXRungeKuttaODESolver(dg_input);
+    if(ode_solver_type == ODEEnum::local_time_stepping_solver)
+        return std::make_shared<LocalTimeSteppingODESolver<dim,real,MeshType>>(dg_input, create_RKTableau(dg_input));
     else {
         display_error_ode_solver_factory(ode_solver_type, false);
         return nullptr;
@@ -91,6 +113,10 @@ void ODESolverFactory<dim,real,MeshType>::display_error_ode_solver_factory(Param
     if (ode_solver_type == ODEEnum::runge_kutta_solver)                 solver_string = "runge_kutta";
     else if (ode_solver_type == ODEEnum::implicit_solver)               solver_string = "implicit";
     else if (ode_solver_type == ODEEnum::rrk_explicit_solver)           solver_string = "rrk_explicit";
+    else if (ode_solver_type == ODEEnum::p_multigrid_solver)            solver_string = "p_multigrid";
+    else if (ode_solver_type == ODEEnum::low_storage_runge_kutta_solver) solver_string = "low_storage_runge_kutta";
+    else if (ode_solver_type == ODEEnum::imex_runge_kutta_solver)       solver_string = "imex_runge_kutta";
+    else if (ode_solver_type == ODEEnum::local_time_stepping_solver)    solver_string = "local_time_stepping";
     else if (ode_solver_type == ODEEnum::pod_galerkin_solver)           solver_string = "pod_galerkin";
     else if (ode_solver_type == ODEEnum::pod_petrov_galerkin_solver)    solver_string = "pod_petrov_galerkin";
     else solver_string = "undefined";
@@ -108,6 +134,10 @@ void ODESolverFactory<dim,real,MeshType>::display_error_ode_solver_factory(Param
         pcout <<  "runge_kutta" << std::endl;
         pcout <<  "implicit" << std::endl;
         pcout <<  "rrk_explicit" << std::endl;
+        pcout <<  "p_multigrid" << std::endl;
+        pcout <<  "low_storage_runge_kutta" << std::endl;
+        pcout <<  "imex_runge_kutta" << std::endl;
+        pcout <<  "local_time_stepping" << std::endl;
         pcout << "    With rrk_explicit only being valid for " <<std::endl;
         pcout << "    pde_type = burgers, flux_nodes_type = GLL, overintegration = 0, and dim = 1" <<std::endl;
     }
@@ -142,6 +172,9 @@ std::shared_ptr<ODESolverBase<dim,real,MeshType>> ODESolverFactory<dim,real,Mesh
         else if (n_rk_stages == 4){
             return std::make_shared<RungeKuttaODESolver<dim,real,4,MeshType>>(dg_input,rk_tableau,RRK_object);
         }
+        else if (n_rk_stages == 7){
+            return std::make_shared<RungeKuttaODESolver<dim,real,7,MeshType>>(dg_input,rk_tableau,RRK_object);
+        }
         else{
             pcout << "Error: invalid number of stages. Aborting..." << std::endl;
             std::abort();
@@ -154,6 +187,75 @@ std::shared_ptr<ODESolverBase<dim,real,MeshType>> ODESolverFactory<dim,real,Mesh
     }
 }
 
+template <int dim, typename real, typename MeshType>
+std::shared_ptr<ODESolverBase<dim,real,MeshType>> ODESolverFactory<dim,real,MeshType>::create_LowStorageRungeKuttaODESolver(std::shared_ptr< DGBase<dim,real,MeshType> > dg_input)
+{
+    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+
+    std::shared_ptr<LowStorageRKTableauBase<dim,real,MeshType>> rk_tableau = create_LowStorageRKTableau(dg_input);
+
+    const bool use_relaxation = dg_input->all_parameters->ode_solver_param.use_low_storage_relaxation;
+    if (use_relaxation) {
+        // The stage derivatives are not stored, such that only the algebraic RRK of the energy is available
+        using PDEEnum = Parameters::AllParameters::PartialDifferentialEquation;
+        if (dg_input->all_parameters->pde_type != PDEEnum::burgers_inviscid) {
+            pcout << "Error: low-storage RRK is only valid for the energy of burgers_inviscid. Aborting..." << std::endl;
+            std::abort();
+            return nullptr;
+        }
+        pcout << "Adding Algebraic Relaxation Runge Kutta to the ODE solver..." << std::endl;
+    }
+
+    pcout << "Creating Low-Storage Runge Kutta ODE Solver with "
+          << rk_tableau->n_rk_stages << " stage(s)..." << std::endl;
+    return std::make_shared<LowStorageRungeKuttaODESolver<dim,real,MeshType>>(dg_input, rk_tableau, use_relaxation);
+}
+
+template <int dim, typename real, typename MeshType>
+std::shared_ptr<LowStorageRKTableauBase<dim,real,MeshType>> ODESolverFactory<dim,real,MeshType>::create_LowStorageRKTableau(std::shared_ptr< DGBase<dim,real,MeshType> > dg_input)
+{
+    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+    using LowStorageRKMethodEnum = Parameters::ODESolverParam::LowStorageRKMethodEnum;
+    const LowStorageRKMethodEnum rk_method = dg_input->all_parameters->ode_solver_param.low_storage_rk_method;
+
+    if (rk_method == LowStorageRKMethodEnum::carpenter_kennedy_lsrk4_5) return std::make_shared<CarpenterKennedyLSRK54<dim, real, MeshType>> (5, "4th order 5-stage 2N-storage, Carpenter-Kennedy (explicit)");
+    if (rk_method == LowStorageRKMethodEnum::ssprk3_low_storage)        return std::make_shared<SSPRK3LowStorage<dim, real, MeshType>>       (3, "3rd order SSP, low-storage (explicit)");
+    if (rk_method == LowStorageRKMethodEnum::ketcheson_ssprk4_10)       return std::make_shared<KetchesonSSPRK104<dim, real, MeshType>>      (10, "4th order 10-stage SSP, Ketcheson (explicit)");
+    else {
+        pcout << "Error: invalid low-storage RK method. Aborting..." << std::endl;
+        std::abort();
+        return nullptr;
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+std::shared_ptr<ODESolverBase<dim,real,MeshType>> ODESolverFactory<dim,real,MeshType>::create_IMEXRungeKuttaODESolver(std::shared_ptr< DGBase<dim,real,MeshType> > dg_input)
+{
+    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+
+    std::shared_ptr<AdditiveRKTableauBase<dim,real,MeshType>> rk_tableau = create_AdditiveRKTableau(dg_input);
+
+    pcout << "Creating IMEX Runge Kutta ODE Solver with "
+          << rk_tableau->n_rk_stages << " stage(s)..." << std::endl;
+    return std::make_shared<IMEXRungeKuttaODESolver<dim,real,MeshType>>(dg_input, rk_tableau);
+}
+
+template <int dim, typename real, typename MeshType>
+std::shared_ptr<AdditiveRKTableauBase<dim,real,MeshType>> ODESolverFactory<dim,real,MeshType>::create_AdditiveRKTableau(std::shared_ptr< DGBase<dim,real,MeshType> > dg_input)
+{
+    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+    using IMEXRKMethodEnum = Parameters::ODESolverParam::IMEXRKMethodEnum;
+    const IMEXRKMethodEnum rk_method = dg_input->all_parameters->ode_solver_param.imex_rk_method;
+
+    if (rk_method == IMEXRKMethodEnum::ark3_2_4l_2sa) return std::make_shared<ARK3AdditiveRK<dim, real, MeshType>> (4, "3rd order ARK3(2)4L[2]SA, Kennedy-Carpenter (IMEX)");
+    if (rk_method == IMEXRKMethodEnum::ark4_3_6l_2sa) return std::make_shared<ARK4AdditiveRK<dim, real, MeshType>> (6, "4th order ARK4(3)6L[2]SA, Kennedy-Carpenter (IMEX)");
+    else {
+        pcout << "Error: invalid IMEX RK method. Aborting..." << std::endl;
+        std::abort();
+        return nullptr;
+    }
+}
+
 template <int dim, typename real, typename MeshType>
 std::shared_ptr<RKTableauBase<dim,real,MeshType>> ODESolverFactory<dim,real,MeshType>::create_RKTableau(std::shared_ptr< DGBase<dim,real,MeshType> > dg_input)
 {
@@ -179,6 +281,8 @@ std::shared_ptr<RKTableauBase<dim,real,MeshType>> ODESolverFactory<dim,real,Mesh
     if (rk_method == RKMethodEnum::euler_im)    return std::make_shared<EulerImplicit<dim, real, MeshType>>  (n_rk_stages, "Implicit Euler (implicit)");
     if (rk_method == RKMethodEnum::dirk_2_im)   return std::make_shared<DIRK2Implicit<dim, real, MeshType>>  (n_rk_stages, "2nd order diagonally-implicit (implicit)");
     if (rk_method == RKMethodEnum::dirk_3_im)   return std::make_shared<DIRK3Implicit<dim, real, MeshType>>  (n_rk_stages, "3nd order diagonally-implicit (implicit)");
+    if (rk_method == RKMethodEnum::bogacki_shampine3_ex) return std::make_shared<BogackiShampine32Explicit<dim, real, MeshType>> (n_rk_stages, "3rd order Bogacki-Shampine with embedded 2nd order (explicit)");
+    if (rk_method == RKMethodEnum::dormand_prince5_ex)   return std::make_shared<DormandPrince54Explicit<dim, real, MeshType>>   (n_rk_stages, "5th order Dormand-Prince with embedded 4th order (explicit)");
     else {
         pcout << "Error: invalid RK method. Aborting..." << std::endl;
         std::abort();
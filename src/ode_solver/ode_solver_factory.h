@@ -6,6 +6,8 @@
 #include "parameters/all_parameters.h"
 #include "reduced_order/pod_basis_base.h"
 #include "runge_kutta_methods/rk_tableau_base.h"
+#include "runge_kutta_methods/low_storage_rk_tableau_base.h"
+#include "runge_kutta_methods/additive_rk_tableau_base.h"
 #include "relaxation_runge_kutta/empty_RRK_base.h"
 
 namespace PHiLiP {
@@ -39,6 +41,18 @@ public:
     /// Creates an ODESolver object based on the specified RK method, including derived classes
     static std::shared_ptr<ODESolverBase<dim,real,MeshType>> create_RungeKuttaODESolver(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input);
 
+    /// Creates a low-storage RK ODE solver based on the specified low-storage RK method
+    static std::shared_ptr<ODESolverBase<dim,real,MeshType>> create_LowStorageRungeKuttaODESolver(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input);
+
+    /// Creates a LowStorageRKTableau object based on the specified low-storage RK method
+    static std::shared_ptr<LowStorageRKTableauBase<dim,real,MeshType>> create_LowStorageRKTableau(std::shared_ptr< DGBase<dim,real,MeshType> > dg_input);
+
+    /// Creates an IMEX additive RK ODE solver based on the specified IMEX RK method
+    static std::shared_ptr<ODESolverBase<dim,real,MeshType>> create_IMEXRungeKuttaODESolver(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input);
+
+    /// Creates an AdditiveRKTableau object based on the specified IMEX RK method
+    static std::shared_ptr<AdditiveRKTableauBase<dim,real,MeshType>> create_AdditiveRKTableau(std::shared_ptr< DGBase<dim,real,MeshType> > dg_input);
+
     /// Creates an RKTableau object based on the specified RK method
     static std::shared_ptr<RKTableauBase<dim,real,MeshType>> create_RKTableau(std::shared_ptr< DGBase<dim,real,MeshType> > dg_input);
     
@@ -0,0 +1,381 @@
+#include <algorithm>
+
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
+#include <deal.II/lac/vector.h>
+
+#include "p_multigrid.h"
+#include "dg/dg_factory.hpp"
+
+namespace PHiLiP {
+namespace ODE {
+
+template <int dim>
+void CellBlockJacobi<dim>::initialize_cell_dofs(const dealii::DoFHandler<dim> &dof_handler)
+{
+    cell_dofs.clear();
+    for (const auto &cell : dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned()) continue;
+        std::vector<dealii::types::global_dof_index> dofs_indices(cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_indices(dofs_indices);
+        cell_dofs.push_back(dofs_indices);
+    }
+}
+
+template <int dim>
+void CellBlockJacobi<dim>::initialize(
+    const dealii::DoFHandler<dim> &dof_handler,
+    const dealii::TrilinosWrappers::SparseMatrix &matrix,
+    const double matrix_scale,
+    const dealii::TrilinosWrappers::SparseMatrix *shift_matrix)
+{
+    initialize_cell_dofs(dof_handler);
+
+    cell_inverse_blocks.resize(cell_dofs.size());
+    for (unsigned int icell = 0; icell < cell_dofs.size(); ++icell) {
+        const std::vector<dealii::types::global_dof_index> &dofs_indices = cell_dofs[icell];
+        const unsigned int n_dofs_cell = dofs_indices.size();
+        dealii::FullMatrix<double> &block = cell_inverse_blocks[icell];
+        block.reinit(n_dofs_cell, n_dofs_cell);
+        for (unsigned int itest=0; itest<n_dofs_cell; ++itest) {
+            for (unsigned int itrial=0; itrial<n_dofs_cell; ++itrial) {
+                block(itest,itrial) = matrix_scale * matrix.el(dofs_indices[itest], dofs_indices[itrial]);
+                if (shift_matrix) block(itest,itrial) += shift_matrix->el(dofs_indices[itest], dofs_indices[itrial]);
+            }
+        }
+        block.gauss_jordan();
+    }
+}
+
+template <int dim>
+void CellBlockJacobi<dim>::initialize(
+    const dealii::DoFHandler<dim> &dof_handler,
+    const std::vector<dealii::FullMatrix<double>> &blocks,
+    const double matrix_scale,
+    const double shift_scale,
+    const dealii::TrilinosWrappers::SparseMatrix &shift_matrix)
+{
+    initialize_cell_dofs(dof_handler);
+    AssertDimension(blocks.size(), cell_dofs.size());
+
+    cell_inverse_blocks.resize(cell_dofs.size());
+    for (unsigned int icell = 0; icell < cell_dofs.size(); ++icell) {
+        const std::vector<dealii::types::global_dof_index> &dofs_indices = cell_dofs[icell];
+        const unsigned int n_dofs_cell = dofs_indices.size();
+        dealii::FullMatrix<double> &block = cell_inverse_blocks[icell];
+        block.reinit(n_dofs_cell, n_dofs_cell);
+        for (unsigned int itest=0; itest<n_dofs_cell; ++itest) {
+            for (unsigned int itrial=0; itrial<n_dofs_cell; ++itrial) {
+                block(itest,itrial) = matrix_scale * blocks[icell](itest,itrial)
+                                      + shift_scale * shift_matrix.el(dofs_indices[itest], dofs_indices[itrial]);
+            }
+        }
+        block.gauss_jordan();
+    }
+}
+
+template <int dim>
+void CellBlockJacobi<dim>::vmult(VectorType &dst, const VectorType &src) const
+{
+    dealii::Vector<double> local_src, local_dst;
+    for (unsigned int icell = 0; icell < cell_dofs.size(); ++icell) {
+        const std::vector<dealii::types::global_dof_index> &dofs_indices = cell_dofs[icell];
+        const unsigned int n_dofs_cell = dofs_indices.size();
+        local_src.reinit(n_dofs_cell);
+        local_dst.reinit(n_dofs_cell);
+        for (unsigned int idof=0; idof<n_dofs_cell; ++idof) {
+            local_src[idof] = src[dofs_indices[idof]];
+        }
+        cell_inverse_blocks[icell].vmult(local_dst, local_src);
+        for (unsigned int idof=0; idof<n_dofs_cell; ++idof) {
+            dst[dofs_indices[idof]] = local_dst[idof];
+        }
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+PolynomialDegreeTransfer<dim,real,MeshType>::PolynomialDegreeTransfer(
+    std::shared_ptr<DGBase<dim,real,MeshType>> fine_dg_input,
+    std::shared_ptr<DGBase<dim,real,MeshType>> coarse_dg_input)
+    : fine_dg(fine_dg_input)
+    , coarse_dg(coarse_dg_input)
+    , sum_factorization(1, fine_dg_input->max_degree, fine_dg_input->max_grid_degree)
+{
+    const unsigned int coarse_degree = coarse_dg->max_degree;
+    const unsigned int grid_degree = fine_dg->max_grid_degree;
+    const unsigned int n_fine_degrees = fine_dg->fe_collection.size();
+    oneD_projection.resize(n_fine_degrees);
+    oneD_interpolation.resize(n_fine_degrees);
+    oneD_interpolation_transpose.resize(n_fine_degrees);
+    for (unsigned int fine_degree = 0; fine_degree < n_fine_degrees; ++fine_degree) {
+        // The products of the fine and coarse bases are integrated exactly by the quadrature of the higher degree.
+        const dealii::Quadrature<1> &quadrature = fine_dg->oneD_quadrature_collection[std::max(fine_degree, coarse_degree)];
+        const dealii::FiniteElement<1> &fine_fe = fine_dg->oneD_fe_collection_1state[fine_degree];
+        const dealii::FiniteElement<1> &coarse_fe = fine_dg->oneD_fe_collection_1state[coarse_degree];
+
+        OPERATOR::basis_functions<dim,2*dim,double> fine_basis(1, fine_dg->max_degree, grid_degree);
+        fine_basis.build_1D_volume_operator(fine_dg->oneD_fe_collection_1state[fine_degree], quadrature);
+        OPERATOR::basis_functions<dim,2*dim,double> coarse_basis(1, fine_dg->max_degree, grid_degree);
+        coarse_basis.build_1D_volume_operator(fine_dg->oneD_fe_collection_1state[coarse_degree], quadrature);
+        OPERATOR::vol_projection_operator<dim,2*dim,double> fine_projection(1, fine_dg->max_degree, grid_degree);
+        fine_projection.build_1D_volume_operator(fine_dg->oneD_fe_collection_1state[fine_degree], quadrature);
+        OPERATOR::vol_projection_operator<dim,2*dim,double> coarse_projection(1, fine_dg->max_degree, grid_degree);
+        coarse_projection.build_1D_volume_operator(fine_dg->oneD_fe_collection_1state[coarse_degree], quadrature);
+
+        oneD_projection[fine_degree].reinit(coarse_fe.dofs_per_cell, fine_fe.dofs_per_cell);
+        coarse_projection.oneD_vol_operator.mmult(oneD_projection[fine_degree], fine_basis.oneD_vol_operator);
+        oneD_interpolation[fine_degree].reinit(fine_fe.dofs_per_cell, coarse_fe.dofs_per_cell);
+        fine_projection.oneD_vol_operator.mmult(oneD_interpolation[fine_degree], coarse_basis.oneD_vol_operator);
+        oneD_interpolation_transpose[fine_degree].copy_transposed(oneD_interpolation[fine_degree]);
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+void PolynomialDegreeTransfer<dim,real,MeshType>::apply_cellwise(
+    const VectorType &input_vector,
+    VectorType &output_vector,
+    const std::vector<dealii::FullMatrix<double>> &oneD_operators,
+    const bool to_fine) const
+{
+    const unsigned int nstate = fine_dg->nstate;
+    std::vector<dealii::types::global_dof_index> fine_dofs_indices, coarse_dofs_indices;
+    std::vector<double> input_values, output_values;
+
+    // Both DoFHandlers share the triangulation, hence traverse the same cells.
+    auto coarse_cell = coarse_dg->dof_handler.begin_active();
+    for (auto cell = fine_dg->dof_handler.begin_active(); cell != fine_dg->dof_handler.end(); ++cell, ++coarse_cell) {
+        if (!cell->is_locally_owned()) continue;
+
+        fine_dofs_indices.resize(cell->get_fe().n_dofs_per_cell());
+        coarse_dofs_indices.resize(coarse_cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_indices(fine_dofs_indices);
+        coarse_cell->get_dof_indices(coarse_dofs_indices);
+        const std::vector<dealii::types::global_dof_index> &input_dofs_indices = to_fine ? coarse_dofs_indices : fine_dofs_indices;
+        const std::vector<dealii::types::global_dof_index> &output_dofs_indices = to_fine ? fine_dofs_indices : coarse_dofs_indices;
+
+        const unsigned int n_input_shape_fns = input_dofs_indices.size() / nstate;
+        const unsigned int n_output_shape_fns = output_dofs_indices.size() / nstate;
+        input_values.resize(n_input_shape_fns);
+        output_values.resize(n_output_shape_fns);
+        const dealii::FullMatrix<double> &oneD_operator = oneD_operators[cell->active_fe_index()];
+        for (unsigned int istate = 0; istate < nstate; ++istate) {
+            for (unsigned int ishape = 0; ishape < n_input_shape_fns; ++ishape) {
+                input_values[ishape] = input_vector[input_dofs_indices[ishape + istate*n_input_shape_fns]];
+            }
+            sum_factorization.matrix_vector_mult_1D(input_values, output_values, oneD_operator);
+            for (unsigned int ishape = 0; ishape < n_output_shape_fns; ++ishape) {
+                output_vector[output_dofs_indices[ishape + istate*n_output_shape_fns]] = output_values[ishape];
+            }
+        }
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+void PolynomialDegreeTransfer<dim,real,MeshType>::restrict_solution(const VectorType &fine_vector, VectorType &coarse_vector) const
+{
+    const bool to_fine = false;
+    apply_cellwise(fine_vector, coarse_vector, oneD_projection, to_fine);
+}
+
+template <int dim, typename real, typename MeshType>
+void PolynomialDegreeTransfer<dim,real,MeshType>::restrict_residual(const VectorType &fine_vector, VectorType &coarse_vector) const
+{
+    const bool to_fine = false;
+    apply_cellwise(fine_vector, coarse_vector, oneD_interpolation_transpose, to_fine);
+}
+
+template <int dim, typename real, typename MeshType>
+void PolynomialDegreeTransfer<dim,real,MeshType>::prolongate(const VectorType &coarse_vector, VectorType &fine_vector) const
+{
+    const bool to_fine = true;
+    apply_cellwise(coarse_vector, fine_vector, oneD_interpolation, to_fine);
+}
+
+template <int dim, typename real, typename MeshType>
+PMultigridHierarchy<dim,real,MeshType>::PMultigridHierarchy(std::shared_ptr<DGBase<dim,real,MeshType>> fine_dg)
+    : n_fine_dofs(fine_dg->dof_handler.n_dofs())
+{
+    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+
+    const int coarse_degree = fine_dg->all_parameters->p_multigrid_param.coarse_degree;
+    const int fine_degree = fine_dg->get_max_fe_degree();
+    const unsigned int grid_degree = fine_dg->high_order_grid->fe_system.tensor_degree();
+
+    levels.push_back(fine_dg);
+    for (int degree = fine_degree-1; degree >= coarse_degree; --degree) {
+        pcout << "Allocating the degree " << degree << " level of the p-multigrid..." << std::endl;
+        std::shared_ptr<DGBase<dim,real,MeshType>> coarse_dg
+            = DGFactory<dim,real,MeshType>::create_discontinuous_galerkin(fine_dg->all_parameters, degree, degree, grid_degree, fine_dg->triangulation);
+        coarse_dg->set_high_order_grid(fine_dg->high_order_grid);
+        coarse_dg->allocate_system(true, false, false);
+
+        transfers.push_back(std::make_unique<PolynomialDegreeTransfer<dim,real,MeshType>>(levels.back(), coarse_dg));
+        levels.push_back(coarse_dg);
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+bool PMultigridHierarchy<dim,real,MeshType>::is_up_to_date() const
+{
+    return levels[0]->dof_handler.n_dofs() == n_fine_dofs;
+}
+
+template <int dim, typename real, typename MeshType>
+PMultigridPreconditioner<dim,real,MeshType>::PMultigridPreconditioner(std::shared_ptr<DGBase<dim,real,MeshType>> dg_input)
+    : dg(dg_input)
+{}
+
+template <int dim, typename real, typename MeshType>
+void PMultigridPreconditioner<dim,real,MeshType>::initialize(
+    const dealii::TrilinosWrappers::SparseMatrix &fine_operator,
+    const double dt,
+    const bool pseudotime)
+{
+    if (!hierarchy || !hierarchy->is_up_to_date()) {
+        hierarchy = std::make_unique<PMultigridHierarchy<dim,real,MeshType>>(dg);
+        const unsigned int n_levels = hierarchy->n_levels();
+        level_operators.resize(n_levels);
+        coarse_jacobians.clear();
+        coarse_jacobians.resize(n_levels);
+        coarse_operators.clear();
+        coarse_operators.resize(n_levels);
+        smoothers.resize(n_levels);
+        level_residual.resize(n_levels);
+        level_correction.resize(n_levels);
+        level_rhs.resize(n_levels);
+        level_solution.resize(n_levels);
+        for (unsigned int ilevel = 0; ilevel < n_levels; ++ilevel) {
+            const std::shared_ptr<DGBase<dim,real,MeshType>> level_dg = hierarchy->levels[ilevel];
+            if (ilevel > 0) level_dg->evaluate_mass_matrices(false);
+            level_residual[ilevel].reinit(level_dg->right_hand_side);
+            level_correction[ilevel].reinit(level_dg->right_hand_side);
+            level_rhs[ilevel].reinit(level_dg->right_hand_side);
+            level_solution[ilevel].reinit(level_dg->right_hand_side);
+        }
+    }
+    const unsigned int n_levels = hierarchy->n_levels();
+
+    level_operators[0] = &fine_operator;
+    for (unsigned int ilevel = 1; ilevel < n_levels; ++ilevel) {
+        const std::shared_ptr<DGBase<dim,real,MeshType>> coarse_dg = hierarchy->levels[ilevel];
+        hierarchy->transfers[ilevel-1]->restrict_solution(hierarchy->levels[ilevel-1]->solution, coarse_dg->solution);
+        coarse_dg->solution.update_ghost_values();
+
+        const bool compute_dRdW = true;
+        coarse_dg->assemble_residual(compute_dRdW);
+
+        coarse_jacobians[ilevel].copy_from(coarse_dg->system_matrix);
+        coarse_jacobians[ilevel] *= -1.0;
+        level_operators[ilevel] = &coarse_operators[ilevel];
+    }
+
+    update_mass_shift(dt, pseudotime);
+}
+
+template <int dim, typename real, typename MeshType>
+void PMultigridPreconditioner<dim,real,MeshType>::update_mass_shift(const double dt, const bool pseudotime)
+{
+    const unsigned int n_levels = hierarchy->n_levels();
+    for (unsigned int ilevel = 1; ilevel < n_levels; ++ilevel) {
+        const std::shared_ptr<DGBase<dim,real,MeshType>> coarse_dg = hierarchy->levels[ilevel];
+        dealii::TrilinosWrappers::SparseMatrix &coarse_operator = coarse_operators[ilevel];
+        coarse_operator.copy_from(coarse_jacobians[ilevel]);
+        if (pseudotime) {
+            // The local time steps are the ones of the last assembly of the coarse level.
+            const double CFL = dt;
+            coarse_dg->time_scaled_mass_matrices(CFL);
+            coarse_operator.add(1.0, coarse_dg->time_scaled_global_mass_matrix);
+        } else {
+            coarse_operator.add(1.0/dt, coarse_dg->global_mass_matrix);
+        }
+    }
+
+    for (unsigned int ilevel = 0; ilevel+1 < n_levels; ++ilevel) {
+        smoothers[ilevel].initialize(hierarchy->levels[ilevel]->dof_handler, *level_operators[ilevel]);
+    }
+
+    const Parameters::LinearSolverParam &param = dg->all_parameters->linear_solver_param;
+    const unsigned int ilu_fill = 0;
+    const unsigned int overlap = 1;
+    const dealii::TrilinosWrappers::PreconditionILU::AdditionalData ilu_settings(ilu_fill, param.ilut_atol, param.ilut_rtol, overlap);
+    coarsest_ilu.initialize(*level_operators[n_levels-1], ilu_settings);
+}
+
+template <int dim, typename real, typename MeshType>
+void PMultigridPreconditioner<dim,real,MeshType>::vmult(VectorType &dst, const VectorType &src) const
+{
+    dst = 0.0;
+    v_cycle(0, dst, src);
+}
+
+template <int dim, typename real, typename MeshType>
+void PMultigridPreconditioner<dim,real,MeshType>::v_cycle(const unsigned int ilevel, VectorType &x, const VectorType &b) const
+{
+    const Parameters::PMultigridParam &mg_param = dg->all_parameters->p_multigrid_param;
+
+    if (ilevel+1 == hierarchy->n_levels()) {
+        const Parameters::LinearSolverParam &param = dg->all_parameters->linear_solver_param;
+        dealii::SolverControl solver_control(param.max_iterations, mg_param.coarse_linear_residual * b.l2_norm());
+        typename dealii::SolverGMRES<VectorType>::AdditionalData gmres_settings(param.restart_number);
+        dealii::SolverGMRES<VectorType> solver_gmres(solver_control, gmres_settings);
+        x = 0.0;
+        try {
+            solver_gmres.solve(*level_operators[ilevel], x, b, coarsest_ilu);
+        } catch (const dealii::SolverControl::NoConvergence &) {
+            // The last iterate is a sufficient coarse correction.
+        }
+        return;
+    }
+
+    smooth(ilevel, x, b, mg_param.n_pre_smoothing);
+
+    // Coarse level correction of the residual b - A x.
+    level_operators[ilevel]->vmult(level_residual[ilevel], x);
+    level_residual[ilevel].sadd(-1.0, 1.0, b);
+    hierarchy->transfers[ilevel]->restrict_residual(level_residual[ilevel], level_rhs[ilevel+1]);
+    level_solution[ilevel+1] = 0.0;
+    v_cycle(ilevel+1, level_solution[ilevel+1], level_rhs[ilevel+1]);
+    hierarchy->transfers[ilevel]->prolongate(level_solution[ilevel+1], level_correction[ilevel]);
+    x += level_correction[ilevel];
+
+    smooth(ilevel, x, b, mg_param.n_post_smoothing);
+}
+
+template <int dim, typename real, typename MeshType>
+void PMultigridPreconditioner<dim,real,MeshType>::smooth(
+    const unsigned int ilevel,
+    VectorType &x,
+    const VectorType &b,
+    const unsigned int n_iterations) const
+{
+    const double relaxation = dg->all_parameters->p_multigrid_param.block_jacobi_relaxation;
+    for (unsigned int iteration = 0; iteration < n_iterations; ++iteration) {
+        level_operators[ilevel]->vmult(level_residual[ilevel], x);
+        level_residual[ilevel].sadd(-1.0, 1.0, b);
+        smoothers[ilevel].vmult(level_correction[ilevel], level_residual[ilevel]);
+        x.add(relaxation, level_correction[ilevel]);
+    }
+}
+
+template class CellBlockJacobi<PHILIP_DIM>;
+
+template class PolynomialDegreeTransfer<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM>>;
+template class PolynomialDegreeTransfer<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>;
+#if PHILIP_DIM != 1
+template class PolynomialDegreeTransfer<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>;
+#endif
+
+template class PMultigridHierarchy<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM>>;
+template class PMultigridHierarchy<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>;
+#if PHILIP_DIM != 1
+template class PMultigridHierarchy<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>;
+#endif
+
+template class PMultigridPreconditioner<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM>>;
+template class PMultigridPreconditioner<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>;
+#if PHILIP_DIM != 1
+template class PMultigridPreconditioner<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>;
+#endif
+
+} // ODE namespace
+} // PHiLiP namespace
@@ -0,0 +1,214 @@
+#ifndef __P_MULTIGRID__
+#define __P_MULTIGRID__
+
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/trilinos_precondition.h>
+#include <deal.II/lac/trilinos_sparse_matrix.h>
+
+#include "dg/dg_base.hpp"
+
+namespace PHiLiP {
+namespace ODE {
+
+/// Inverses of the cell diagonal blocks of a matrix assembled on the degrees of freedom of a DG.
+template <int dim>
+class CellBlockJacobi
+{
+public:
+    /// Vector type the preconditioner applies to.
+    using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+
+    /// Inverts the cell diagonal blocks of matrix_scale*matrix + shift_matrix.
+    /** The shift_matrix, for example a time-scaled mass matrix, is omitted if nullptr.
+     */
+    void initialize(
+        const dealii::DoFHandler<dim> &dof_handler,
+        const dealii::TrilinosWrappers::SparseMatrix &matrix,
+        const double matrix_scale = 1.0,
+        const dealii::TrilinosWrappers::SparseMatrix *shift_matrix = nullptr);
+
+    /// Inverts matrix_scale*blocks + shift_scale*shift_matrix, restricted to the cell diagonal blocks.
+    /** The blocks are ordered as the locally owned cells of dof_handler,
+     *  see DGBase::assemble_cell_diagonal_blocks().
+     */
+    void initialize(
+        const dealii::DoFHandler<dim> &dof_handler,
+        const std::vector<dealii::FullMatrix<double>> &blocks,
+        const double matrix_scale,
+        const double shift_scale,
+        const dealii::TrilinosWrappers::SparseMatrix &shift_matrix);
+
+    /// Applies the inverse blocks, dst = D^{-1} src.
+    void vmult(VectorType &dst, const VectorType &src) const;
+
+private:
+    /// Stores the degrees of freedom of the locally owned cells of dof_handler.
+    void initialize_cell_dofs(const dealii::DoFHandler<dim> &dof_handler);
+
+    /// Degrees of freedom of the locally owned cells.
+    std::vector<std::vector<dealii::types::global_dof_index>> cell_dofs;
+    /// Inverses of the cell diagonal blocks.
+    std::vector<dealii::FullMatrix<double>> cell_inverse_blocks;
+};
+
+/// Transfers vectors between two discretizations of different polynomial degrees on the same grid.
+/** The coarse discretization has the same degree on all cells, while the fine one may vary.
+ *  The one-dimensional operators are built per fine degree with the OPERATOR classes of the DG,
+ *  on the one-dimensional volume quadrature of the fine degree:
+ *  the vol_projection_operator of the coarse degree applied to the fine basis_functions restricts solutions,
+ *  the vol_projection_operator of the fine degree applied to the coarse basis_functions, which is exact,
+ *  prolongates corrections, and its transpose restricts residuals such that the coarse problems are
+ *  consistent with a Galerkin coarsening. They are applied to each state by sum factorization.
+ */
+template <int dim, typename real, typename MeshType>
+class PolynomialDegreeTransfer
+{
+public:
+    /// Vector type of the transfers.
+    using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+
+    /// Constructor.
+    PolynomialDegreeTransfer(
+        std::shared_ptr<DGBase<dim,real,MeshType>> fine_dg,
+        std::shared_ptr<DGBase<dim,real,MeshType>> coarse_dg);
+
+    /// Cell-wise L2 projection of a fine solution onto the coarse degree.
+    void restrict_solution(const VectorType &fine_vector, VectorType &coarse_vector) const;
+
+    /// Cell-wise transpose of prolongate(), for residuals.
+    void restrict_residual(const VectorType &fine_vector, VectorType &coarse_vector) const;
+
+    /// Cell-wise interpolation of a coarse vector onto the fine degree.
+    void prolongate(const VectorType &coarse_vector, VectorType &fine_vector) const;
+
+private:
+    /// Applies the tensor product of the one-dimensional operator of each fine degree to every state of each cell.
+    /** The operators map the coarse degree onto the fine ones if to_fine, and the fine degrees onto the coarse one otherwise.
+     */
+    void apply_cellwise(
+        const VectorType &input_vector,
+        VectorType &output_vector,
+        const std::vector<dealii::FullMatrix<double>> &oneD_operators,
+        const bool to_fine) const;
+
+    /// Fine discretization.
+    std::shared_ptr<DGBase<dim,real,MeshType>> fine_dg;
+    /// Coarse discretization.
+    std::shared_ptr<DGBase<dim,real,MeshType>> coarse_dg;
+
+    /// One-dimensional L2 projection of each fine degree onto the coarse one, indexed by active_fe_index.
+    std::vector<dealii::FullMatrix<double>> oneD_projection;
+    /// One-dimensional interpolation of the coarse degree onto each fine one, indexed by active_fe_index.
+    std::vector<dealii::FullMatrix<double>> oneD_interpolation;
+    /// Transposes of oneD_interpolation.
+    std::vector<dealii::FullMatrix<double>> oneD_interpolation_transpose;
+
+    /// Sum factorization of the one-dimensional operators.
+    mutable OPERATOR::basis_functions<dim,2*dim,double> sum_factorization;
+};
+
+/// Discretizations of decreasing polynomial degrees on the grid of a fine DG.
+/** Level 0 is the fine DG itself. The following levels decrease the maximum degree of the fine DG
+ *  by one until PMultigridParam::coarse_degree, and share its triangulation and high-order grid.
+ */
+template <int dim, typename real, typename MeshType>
+class PMultigridHierarchy
+{
+public:
+    /// Allocates the coarse levels of fine_dg, with dRdW.
+    explicit PMultigridHierarchy(std::shared_ptr<DGBase<dim,real,MeshType>> fine_dg);
+
+    /// Number of levels, including the fine one.
+    unsigned int n_levels() const { return levels.size(); }
+
+    /// Whether the hierarchy was built for the current degrees of freedom of the fine DG.
+    bool is_up_to_date() const;
+
+    /// Discretizations of the levels, from the fine one to the coarsest.
+    std::vector<std::shared_ptr<DGBase<dim,real,MeshType>>> levels;
+
+    /// Transfers between the levels ilevel and ilevel+1.
+    std::vector<std::unique_ptr<PolynomialDegreeTransfer<dim,real,MeshType>>> transfers;
+
+private:
+    /// Number of degrees of freedom of the fine DG when the hierarchy was built.
+    dealii::types::global_dof_index n_fine_dofs;
+};
+
+/// p-multigrid V-cycle approximating the inverse of the implicit operator A = M_dt - dRdW.
+/** The coarse operators are re-discretized: dRdW of each coarse level is assembled at the
+ *  projection of the fine solution and shifted by its own mass term of the same time step.
+ *  When the caller shifts the fine operator to another time step, update_mass_shift() shifts
+ *  the coarse operators accordingly and sets up the smoothers and the coarsest ILU again.
+ *  The levels above the coarsest are smoothed with damped cell block-Jacobi iterations,
+ *  while the coarsest level is solved with ILU-preconditioned GMRES to PMultigridParam::coarse_linear_residual.
+ *  The V-cycle then depends on the vector it is applied to, so that it must precondition a flexible
+ *  Krylov method such as dealii::SolverFGMRES, see solve_linear_preconditioned().
+ *
+ *  Used by ImplicitODESolver with PMultigridParam::use_as_implicit_preconditioner.
+ */
+template <int dim, typename real, typename MeshType>
+class PMultigridPreconditioner
+{
+public:
+    /// Vector type the preconditioner applies to.
+    using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+
+    /// Constructor.
+    explicit PMultigridPreconditioner(std::shared_ptr<DGBase<dim,real,MeshType>> dg_input);
+
+    /// Sets up the levels for the fine operator, which must outlive the preconditioner.
+    /** @param fine_operator Assembled M_dt - dRdW at the current solution of the DG.
+     *  @param dt            CFL number if pseudotime, otherwise the time step.
+     *  @param pseudotime    Whether the mass term is the time-scaled mass matrix of the local time steps.
+     */
+    void initialize(
+        const dealii::TrilinosWrappers::SparseMatrix &fine_operator,
+        const double dt,
+        const bool pseudotime);
+
+    /// Shifts the coarse operators to the mass term of dt, without assembling their dRdW again.
+    /** The fine operator passed to initialize() must already be shifted to the same mass term.
+     *  Same arguments as initialize().
+     */
+    void update_mass_shift(const double dt, const bool pseudotime);
+
+    /// Applies one V-cycle to src from a zero initial guess.
+    void vmult(VectorType &dst, const VectorType &src) const;
+
+private:
+    /// V-cycle on A_l x = b from level ilevel.
+    void v_cycle(const unsigned int ilevel, VectorType &x, const VectorType &b) const;
+
+    /// Damped block-Jacobi iterations x += w D^{-1} (b - A_l x).
+    void smooth(const unsigned int ilevel, VectorType &x, const VectorType &b, const unsigned int n_iterations) const;
+
+    /// Discretization of the fine level.
+    std::shared_ptr<DGBase<dim,real,MeshType>> dg;
+    /// Discretizations and transfers of the levels.
+    std::unique_ptr<PMultigridHierarchy<dim,real,MeshType>> hierarchy;
+
+    /// Operators of the levels, the fine one being owned by the caller.
+    std::vector<const dealii::TrilinosWrappers::SparseMatrix *> level_operators;
+    /// Negated dRdW of the coarse levels, indexed by level.
+    std::vector<dealii::TrilinosWrappers::SparseMatrix> coarse_jacobians;
+    /// Re-discretized operators of the coarse levels, indexed by level.
+    std::vector<dealii::TrilinosWrappers::SparseMatrix> coarse_operators;
+    /// Smoothers of the levels above the coarsest.
+    std::vector<CellBlockJacobi<dim>> smoothers;
+    /// ILU of the coarsest operator.
+    dealii::TrilinosWrappers::PreconditionILU coarsest_ilu;
+
+    /// Residual b - A_l x of each level.
+    mutable std::vector<VectorType> level_residual;
+    /// Smoothing or prolongated correction of each level.
+    mutable std::vector<VectorType> level_correction;
+    /// Right-hand side b and solution x of the coarse levels.
+    mutable std::vector<VectorType> level_rhs, level_solution;
+};
+
+} // ODE namespace
+} // PHiLiP namespace
+
+#endif
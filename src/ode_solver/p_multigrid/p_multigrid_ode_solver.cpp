@@ -0,0 +1,205 @@
+#include "p_multigrid_ode_solver.h"
+#include "linear_solver/linear_solver.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+template <int dim, typename real, typename MeshType>
+PMultigridODESolver<dim,real,MeshType>::PMultigridODESolver(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input)
+        : ODESolverBase<dim,real,MeshType>(dg_input)
+        {}
+
+template <int dim, typename real, typename MeshType>
+void PMultigridODESolver<dim,real,MeshType>::allocate_ode_system ()
+{
+    this->pcout << "Allocating p-multigrid levels and evaluating their mass matrices..." << std::endl;
+    if (!hierarchy || !hierarchy->is_up_to_date()) {
+        hierarchy = std::make_unique<PMultigridHierarchy<dim,real,MeshType>>(this->dg);
+    }
+
+    const bool use_runge_kutta = (this->all_parameters->p_multigrid_param.smoother == Parameters::PMultigridParam::SmootherEnum::runge_kutta);
+    const unsigned int n_levels = hierarchy->n_levels();
+    level_forcing.resize(n_levels);
+    level_residual.resize(n_levels);
+    level_update.resize(n_levels);
+    level_initial_solution.resize(n_levels);
+    for (unsigned int ilevel = 0; ilevel < n_levels; ++ilevel) {
+        const std::shared_ptr<DGBase<dim,real,MeshType>> level_dg = hierarchy->levels[ilevel];
+        level_dg->evaluate_mass_matrices(false);
+        // The inverse is only applied by the explicit smoother, which the coarsest level does not use.
+        if (use_runge_kutta && ilevel+1 < n_levels) level_dg->evaluate_mass_matrices(true);
+
+        level_forcing[ilevel].reinit(level_dg->right_hand_side);
+        level_residual[ilevel].reinit(level_dg->right_hand_side);
+        level_update[ilevel].reinit(level_dg->solution);
+        level_initial_solution[ilevel].reinit(level_dg->solution);
+    }
+
+    this->solution_update.reinit(this->dg->solution);
+}
+
+template <int dim, typename real, typename MeshType>
+void PMultigridODESolver<dim,real,MeshType>::step_in_time (real dt, const bool pseudotime)
+{
+    if (!pseudotime) {
+        this->pcout << "The p_multigrid ODE solver only converges steady states. Aborting..." << std::endl;
+        std::abort();
+    }
+
+    const VectorType old_solution = this->dg->solution;
+
+    level_forcing[0] = 0.0;
+    const double CFL = dt;
+    fas_cycle(0, CFL);
+
+    this->solution_update = this->dg->solution;
+    this->solution_update -= old_solution;
+
+    this->current_time += dt;
+    this->update_norm = this->solution_update.l2_norm();
+    ++(this->current_iteration);
+}
+
+template <int dim, typename real, typename MeshType>
+void PMultigridODESolver<dim,real,MeshType>::fas_cycle(const unsigned int ilevel, const double CFL)
+{
+    const Parameters::PMultigridParam &mg_param = this->all_parameters->p_multigrid_param;
+
+    if (ilevel+1 == hierarchy->n_levels()) {
+        solve_coarsest(ilevel, CFL);
+        return;
+    }
+
+    const bool use_runge_kutta = (mg_param.smoother == Parameters::PMultigridParam::SmootherEnum::runge_kutta);
+    if (use_runge_kutta) smooth_runge_kutta(ilevel, mg_param.n_pre_smoothing);
+    else smooth_block_jacobi(ilevel, CFL, mg_param.n_pre_smoothing);
+
+    // Coarse level problem with the FAS forcing s_c = R_c(P u) - I^T (R(u) - s).
+    const std::shared_ptr<DGBase<dim,real,MeshType>> level_dg = hierarchy->levels[ilevel];
+    const std::shared_ptr<DGBase<dim,real,MeshType>> coarse_dg = hierarchy->levels[ilevel+1];
+    evaluate_level_residual(ilevel);
+    hierarchy->transfers[ilevel]->restrict_solution(level_dg->solution, coarse_dg->solution);
+    coarse_dg->solution.update_ghost_values();
+    level_initial_solution[ilevel+1] = coarse_dg->solution;
+    coarse_dg->assemble_residual();
+    hierarchy->transfers[ilevel]->restrict_residual(level_residual[ilevel], level_forcing[ilevel+1]);
+    level_forcing[ilevel+1].sadd(-1.0, 1.0, coarse_dg->right_hand_side);
+
+    fas_cycle(ilevel+1, CFL);
+
+    // Coarse correction I (u_c - P u).
+    level_update[ilevel+1] = coarse_dg->solution;
+    level_update[ilevel+1] -= level_initial_solution[ilevel+1];
+    hierarchy->transfers[ilevel]->prolongate(level_update[ilevel+1], level_update[ilevel]);
+    level_dg->solution += level_update[ilevel];
+    level_dg->solution.update_ghost_values();
+
+    if (use_runge_kutta) smooth_runge_kutta(ilevel, mg_param.n_post_smoothing);
+    else smooth_block_jacobi(ilevel, CFL, mg_param.n_post_smoothing);
+}
+
+template <int dim, typename real, typename MeshType>
+void PMultigridODESolver<dim,real,MeshType>::evaluate_level_residual(const unsigned int ilevel)
+{
+    const std::shared_ptr<DGBase<dim,real,MeshType>> level_dg = hierarchy->levels[ilevel];
+    level_dg->assemble_residual();
+    level_residual[ilevel] = level_dg->right_hand_side;
+    if (ilevel > 0) level_residual[ilevel] -= level_forcing[ilevel];
+}
+
+template <int dim, typename real, typename MeshType>
+void PMultigridODESolver<dim,real,MeshType>::smooth_runge_kutta(const unsigned int ilevel, const unsigned int n_steps)
+{
+    const std::shared_ptr<DGBase<dim,real,MeshType>> level_dg = hierarchy->levels[ilevel];
+    const double smoother_cfl = this->all_parameters->p_multigrid_param.smoother_cfl;
+
+    // Stage coefficients of the three-stage scheme u_k = u_0 + alpha_k dt M^{-1} (R(u_{k-1}) - s).
+    const std::array<double,3> stage_coefficients = {{1.0/3.0, 0.5, 1.0}};
+
+    std::vector<dealii::types::global_dof_index> dofs_indices;
+    for (unsigned int istep = 0; istep < n_steps; ++istep) {
+        level_initial_solution[ilevel] = level_dg->solution;
+        for (const double alpha : stage_coefficients) {
+            evaluate_level_residual(ilevel);
+            level_dg->global_inverse_mass_matrix.vmult(level_update[ilevel], level_residual[ilevel]);
+
+            // Local time steps evaluated by the residual assembly.
+            for (const auto &cell : level_dg->dof_handler.active_cell_iterators()) {
+                if (!cell->is_locally_owned()) continue;
+                const double local_dt = alpha * smoother_cfl * level_dg->max_dt_cell[cell->active_cell_index()];
+                dofs_indices.resize(cell->get_fe().n_dofs_per_cell());
+                cell->get_dof_indices(dofs_indices);
+                for (const auto idof : dofs_indices) level_update[ilevel][idof] *= local_dt;
+            }
+
+            level_dg->solution = level_initial_solution[ilevel];
+            level_dg->solution += level_update[ilevel];
+            level_dg->solution.update_ghost_values();
+        }
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+void PMultigridODESolver<dim,real,MeshType>::smooth_block_jacobi(const unsigned int ilevel, const double CFL, const unsigned int n_steps)
+{
+    const std::shared_ptr<DGBase<dim,real,MeshType>> level_dg = hierarchy->levels[ilevel];
+    const double relaxation = this->all_parameters->p_multigrid_param.block_jacobi_relaxation;
+
+    for (unsigned int istep = 0; istep < n_steps; ++istep) {
+        // (M/dt - dRdW)_cell du = R - s, with only the cell diagonal blocks of dRdW evaluated.
+        level_dg->assemble_cell_diagonal_blocks(cell_dRdW_blocks);
+        level_residual[ilevel] = level_dg->right_hand_side;
+        if (ilevel > 0) level_residual[ilevel] -= level_forcing[ilevel];
+
+        level_dg->time_scaled_mass_matrices(CFL);
+        const double dRdW_scale = -1.0;
+        const double mass_scale = 1.0;
+        block_jacobi.initialize(level_dg->dof_handler, cell_dRdW_blocks, dRdW_scale, mass_scale, level_dg->time_scaled_global_mass_matrix);
+        block_jacobi.vmult(level_update[ilevel], level_residual[ilevel]);
+
+        level_dg->solution.add(relaxation, level_update[ilevel]);
+        level_dg->solution.update_ghost_values();
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+void PMultigridODESolver<dim,real,MeshType>::solve_coarsest(const unsigned int ilevel, const double CFL)
+{
+    const std::shared_ptr<DGBase<dim,real,MeshType>> level_dg = hierarchy->levels[ilevel];
+
+    Parameters::LinearSolverParam coarse_param = this->all_parameters->linear_solver_param;
+    coarse_param.linear_residual = this->all_parameters->p_multigrid_param.coarse_linear_residual;
+
+    for (unsigned int istep = 0; istep < this->all_parameters->p_multigrid_param.n_coarse_steps; ++istep) {
+        // Solve (M/dt - dRdW) du = R - s
+        const bool compute_dRdW = true;
+        level_dg->assemble_residual(compute_dRdW);
+        level_residual[ilevel] = level_dg->right_hand_side;
+        if (ilevel > 0) level_residual[ilevel] -= level_forcing[ilevel];
+
+        coarsest_operator.copy_from(level_dg->system_matrix);
+        coarsest_operator *= -1.0;
+        level_dg->time_scaled_mass_matrices(CFL);
+        coarsest_operator.add(1.0, level_dg->time_scaled_global_mass_matrix);
+
+        const unsigned int ilu_fill = 0;
+        const unsigned int overlap = 1;
+        const dealii::TrilinosWrappers::PreconditionILU::AdditionalData ilu_settings(ilu_fill, coarse_param.ilut_atol, coarse_param.ilut_rtol, overlap);
+        coarsest_ilu.initialize(coarsest_operator, ilu_settings);
+
+        solve_linear_preconditioned(coarsest_operator, level_residual[ilevel], level_update[ilevel], coarsest_ilu, coarse_param);
+        dRdW_mult += 1;
+
+        level_dg->solution += level_update[ilevel];
+        level_dg->solution.update_ghost_values();
+    }
+}
+
+template class PMultigridODESolver<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM>>;
+template class PMultigridODESolver<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>;
+#if PHILIP_DIM != 1
+template class PMultigridODESolver<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>;
+#endif
+
+} // ODE namespace
+} // PHiLiP namespace
@@ -0,0 +1,87 @@
+#ifndef __P_MULTIGRID_ODE_SOLVER__
+#define __P_MULTIGRID_ODE_SOLVER__
+
+#include "dg/dg_base.hpp"
+#include "ode_solver/ode_solver_base.h"
+#include "p_multigrid.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+/// Steady state solver by nonlinear p-multigrid V-cycles with the full approximation scheme (FAS).
+/** Each step_in_time() performs one V-cycle over the levels of PMultigridHierarchy.
+ *  Level l solves R_l(u_l) = s_l, where the fine level has s_0 = 0 and the coarser ones the FAS forcing
+ *  \f[
+ *      s_{l+1} = R_{l+1}(P u_l) - I^T \left( R_l(u_l) - s_l \right),
+ *  \f]
+ *  with P the L2 projection and I the interpolation between the degrees, see PolynomialDegreeTransfer.
+ *  The coarse correction I (u_{l+1} - P u_l) is added to u_l.
+ *
+ *  The levels above the coarsest are smoothed by PMultigridParam::smoother, either explicit
+ *  three-stage Runge-Kutta steps with the local time steps of PMultigridParam::smoother_cfl, or damped
+ *  cell block-Jacobi steps of the linearized backward-Euler operator. The coarsest level takes
+ *  PMultigridParam::n_coarse_steps linearized backward-Euler steps with the pseudo-time CFL of
+ *  ODESolverBase::steady_state(), solved by ILU-preconditioned GMRES.
+ */
+#if PHILIP_DIM==1
+template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
+#else
+template <int dim, typename real, typename MeshType = dealii::parallel::distributed::Triangulation<dim>>
+#endif
+class PMultigridODESolver: public ODESolverBase <dim, real, MeshType>
+{
+public:
+    /// Vector type of the levels.
+    using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+
+    /// Constructor.
+    explicit PMultigridODESolver(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input);
+
+    /// Performs one FAS V-cycle with the pseudo-time CFL dt.
+    void step_in_time(real dt, const bool pseudotime);
+
+    /// Allocates the levels and evaluates their mass matrices.
+    void allocate_ode_system ();
+
+protected:
+    /// FAS V-cycle from level ilevel.
+    void fas_cycle(const unsigned int ilevel, const double CFL);
+
+    /// Assembles R_l(u_l) - s_l into level_residual.
+    void evaluate_level_residual(const unsigned int ilevel);
+
+    /// Explicit three-stage Runge-Kutta steps of M du/dt = R_l(u) - s_l with local time steps.
+    void smooth_runge_kutta(const unsigned int ilevel, const unsigned int n_steps);
+
+    /// Damped cell block-Jacobi steps of the linearized backward-Euler operator with the given CFL.
+    void smooth_block_jacobi(const unsigned int ilevel, const double CFL, const unsigned int n_steps);
+
+    /// Linearized backward-Euler steps on the coarsest level.
+    void solve_coarsest(const unsigned int ilevel, const double CFL);
+
+    /// Discretizations and transfers of the levels.
+    std::unique_ptr<PMultigridHierarchy<dim,real,MeshType>> hierarchy;
+
+    /// FAS forcing s_l of each level, zero on the fine one.
+    std::vector<VectorType> level_forcing;
+    /// Residual R_l(u_l) - s_l of each level.
+    std::vector<VectorType> level_residual;
+    /// Smoothing update or coarse correction of each level.
+    std::vector<VectorType> level_update;
+    /// Projection P u_l of the finer solution onto each coarse level, before its cycle.
+    std::vector<VectorType> level_initial_solution;
+
+    /// Derivatives of the residual of each locally owned cell of the smoothed level with respect to its own solution.
+    std::vector<dealii::FullMatrix<double>> cell_dRdW_blocks;
+    /// Block-Jacobi smoother, set up at every block_jacobi step.
+    CellBlockJacobi<dim> block_jacobi;
+    /// Linearized backward-Euler operator of the coarsest level.
+    dealii::TrilinosWrappers::SparseMatrix coarsest_operator;
+    /// ILU of coarsest_operator.
+    dealii::TrilinosWrappers::PreconditionILU coarsest_ilu;
+};
+
+} // ODE namespace
+} // PHiLiP namespace
+
+#endif
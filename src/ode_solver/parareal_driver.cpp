@@ -0,0 +1,196 @@
+#include "parareal_driver.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+template <int dim, typename real, typename MeshType>
+PararealDriver<dim,real,MeshType>::PararealDriver(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input,
+        std::shared_ptr< ODESolverBase<dim, real, MeshType> > fine_solver_input,
+        std::shared_ptr< ODESolverBase<dim, real, MeshType> > coarse_solver_input,
+        const int n_time_slices_input,
+        const int maximum_iterations_input,
+        const double tolerance_input,
+        const MPI_Comm time_communicator_input)
+        : last_iteration_change(0.0)
+        , dg(dg_input)
+        , fine_solver(fine_solver_input)
+        , coarse_solver(coarse_solver_input)
+        , n_time_slices(n_time_slices_input)
+        , maximum_iterations(maximum_iterations_input)
+        , tolerance(tolerance_input)
+        , time_communicator(time_communicator_input)
+        , pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(time_communicator)==0)
+{
+    const unsigned int n_group_processes = dealii::Utilities::MPI::n_mpi_processes(dg->mpi_communicator);
+    if (dealii::Utilities::MPI::min(n_group_processes, time_communicator) != dealii::Utilities::MPI::max(n_group_processes, time_communicator)) {
+        pcout << "Error: the slice groups of the Parareal iterations must have the same number of processes. Aborting..." << std::endl;
+        std::abort();
+    }
+
+    // The slice groups are ranked by the rank in time_communicator of their first process,
+    // such that the processes of a group agree on its rank in every slice_group_peers_communicator
+    int group_leader = dealii::Utilities::MPI::this_mpi_process(time_communicator);
+    MPI_Bcast(&group_leader, 1, MPI_INT, 0, dg->mpi_communicator);
+    const int group_rank = dealii::Utilities::MPI::this_mpi_process(dg->mpi_communicator);
+    MPI_Comm_split(time_communicator, group_rank, group_leader, &slice_group_peers_communicator);
+    n_slice_groups = dealii::Utilities::MPI::n_mpi_processes(slice_group_peers_communicator);
+    slice_group = dealii::Utilities::MPI::this_mpi_process(slice_group_peers_communicator);
+}
+
+template <int dim, typename real, typename MeshType>
+PararealDriver<dim,real,MeshType>::~PararealDriver()
+{
+    MPI_Comm_free(&slice_group_peers_communicator);
+}
+
+template <int dim, typename real, typename MeshType>
+MPI_Comm PararealDriver<dim,real,MeshType>::create_slice_group_communicator (const MPI_Comm time_communicator, const int n_slice_groups)
+{
+    const int n_mpi = dealii::Utilities::MPI::n_mpi_processes(time_communicator);
+    const int mpi_rank = dealii::Utilities::MPI::this_mpi_process(time_communicator);
+    if (n_slice_groups < 1 || n_mpi % n_slice_groups != 0) {
+        if (mpi_rank == 0) {
+            std::cout << "Error: the " << n_mpi << " processes cannot be split into " << n_slice_groups
+                      << " Parareal slice groups of the same size. Aborting..." << std::endl;
+        }
+        std::abort();
+    }
+    const int n_group_processes = n_mpi / n_slice_groups;
+
+    MPI_Comm slice_group_communicator;
+    MPI_Comm_split(time_communicator, mpi_rank / n_group_processes, mpi_rank, &slice_group_communicator);
+    return slice_group_communicator;
+}
+
+template <int dim, typename real, typename MeshType>
+int PararealDriver<dim,real,MeshType>::advance (const real initial_time, const real final_time, const real fine_time_step, const real coarse_time_step)
+{
+    slice_times.resize(n_time_slices+1);
+    for (int n = 0; n <= n_time_slices; ++n) {
+        slice_times[n] = initial_time + (final_time - initial_time) * n / n_time_slices;
+    }
+    slice_iterations.resize(n_time_slices+1);
+    slice_iterations[0] = fine_solver->current_iteration;
+    for (int n = 0; n < n_time_slices; ++n) {
+        slice_iterations[n+1] = slice_iterations[n] + get_number_of_steps(slice_times[n], slice_times[n+1], fine_time_step);
+    }
+    slice_solutions.assign(n_time_slices+1, dg->solution);
+    fine_propagations.assign(n_time_slices+1, dg->solution);
+    coarse_propagations.assign(n_time_slices+1, dg->solution);
+    dealii::LinearAlgebra::distributed::Vector<double> coarse_propagation(dg->solution);
+    dealii::LinearAlgebra::distributed::Vector<double> slice_change(dg->solution);
+
+    // Initial guess from the coarse propagator
+    for (int n = 0; n < n_time_slices; ++n) {
+        propagate(*coarse_solver, slice_solutions[n], coarse_propagations[n+1], slice_times[n], slice_times[n+1], coarse_time_step);
+        slice_solutions[n+1] = coarse_propagations[n+1];
+    }
+
+    int iteration = 0;
+    while (iteration < maximum_iterations) {
+        ++iteration;
+        // Slices before first_slice have the fine solution at their start since the previous iteration
+        const int first_slice = iteration-1;
+
+        // Fine propagations, independent between the slices and spread over the slice groups
+        for (int n = first_slice; n < n_time_slices; ++n) {
+            if (get_slice_group(n, first_slice) != slice_group) continue;
+            propagate(*fine_solver, slice_solutions[n], fine_propagations[n+1], slice_times[n], slice_times[n+1], fine_time_step);
+        }
+        for (int n = first_slice; n < n_time_slices; ++n) {
+            broadcast_from_slice_group(fine_propagations[n+1], get_slice_group(n, first_slice));
+        }
+
+        // Sequential coarse correction U_{n+1} = G(U_n) + F(U_n^old) - G(U_n^old)
+        last_iteration_change = 0.0;
+        for (int n = first_slice; n < n_time_slices; ++n) {
+            if (n == first_slice) {
+                // U_n is unchanged, such that the correction is the fine propagation
+                coarse_propagation = coarse_propagations[n+1];
+            } else {
+                propagate(*coarse_solver, slice_solutions[n], coarse_propagation, slice_times[n], slice_times[n+1], coarse_time_step);
+            }
+            slice_change = coarse_propagation;
+            slice_change += fine_propagations[n+1];
+            slice_change -= coarse_propagations[n+1];
+            coarse_propagations[n+1] = coarse_propagation;
+
+            // slice_change holds the new U_{n+1}, and then its change
+            slice_change.swap(slice_solutions[n+1]);
+            slice_change -= slice_solutions[n+1];
+            const double solution_norm = slice_solutions[n+1].l2_norm();
+            const double relative_change = (solution_norm > 0.0) ? slice_change.l2_norm()/solution_norm : slice_change.l2_norm();
+            last_iteration_change = std::max(last_iteration_change, relative_change);
+        }
+
+        pcout << " Parareal iteration: " << iteration
+              << " Largest relative change of the slice solutions: " << last_iteration_change
+              << std::endl;
+
+        if (last_iteration_change < tolerance || iteration >= n_time_slices) break;
+    }
+
+    if (last_iteration_change >= tolerance && iteration < n_time_slices) {
+        pcout << " Parareal iterations stopped at maximum_iterations = " << maximum_iterations
+              << " before reaching the tolerance " << tolerance << std::endl;
+    }
+
+    dg->solution = slice_solutions[n_time_slices];
+    dg->solution.update_ghost_values();
+    fine_solver->current_time = final_time;
+    fine_solver->current_iteration = slice_iterations[n_time_slices];
+    return iteration;
+}
+
+template <int dim, typename real, typename MeshType>
+int PararealDriver<dim,real,MeshType>::get_number_of_steps (const real start_time, const real end_time, const real time_step) const
+{
+    return std::max(1, static_cast<int>(std::ceil((end_time - start_time)/time_step - 1E-10)));
+}
+
+template <int dim, typename real, typename MeshType>
+int PararealDriver<dim,real,MeshType>::get_slice_group (const int n, const int first_slice) const
+{
+    return (n - first_slice) % n_slice_groups;
+}
+
+template <int dim, typename real, typename MeshType>
+void PararealDriver<dim,real,MeshType>::broadcast_from_slice_group (
+        dealii::LinearAlgebra::distributed::Vector<double> &vector,
+        const int source_slice_group) const
+{
+    if (n_slice_groups == 1) return;
+    const int n_locally_owned = vector.locally_owned_elements().n_elements();
+    MPI_Bcast(vector.begin(), n_locally_owned, MPI_DOUBLE, source_slice_group, slice_group_peers_communicator);
+}
+
+template <int dim, typename real, typename MeshType>
+void PararealDriver<dim,real,MeshType>::propagate (ODESolverBase<dim,real,MeshType> &ode_solver,
+        const dealii::LinearAlgebra::distributed::Vector<double> &initial_solution,
+        dealii::LinearAlgebra::distributed::Vector<double> &end_solution,
+        const real start_time,
+        const real end_time,
+        const real time_step)
+{
+    // Equal steps ending exactly at end_time
+    const int n_steps = get_number_of_steps(start_time, end_time, time_step);
+    const real step = (end_time - start_time) / n_steps;
+
+    dg->solution = initial_solution;
+    dg->solution.update_ghost_values();
+    ode_solver.current_time = start_time;
+    for (int i = 0; i < n_steps; ++i) {
+        ode_solver.step_in_time(step, false); // pseudotime==false
+    }
+    ode_solver.current_time = end_time;
+    end_solution = dg->solution;
+}
+
+template class PararealDriver<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM> >;
+template class PararealDriver<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
+#if PHILIP_DIM != 1
+    template class PararealDriver<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
+#endif
+
+} // ODESolver namespace
+} // PHiLiP namespace
@@ -0,0 +1,117 @@
+#ifndef __PARAREAL_DRIVER__
+#define __PARAREAL_DRIVER__
+
+#include "dg/dg_base.hpp"
+#include "ode_solver_base.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+/// Parareal parallel-in-time iterations with ODE solvers as coarse and fine propagators.
+/** Splits the time interval into time slices of equal length, and iterates on the solutions U_n at the slice ends with
+ *  U_{n+1}^{k+1} = G(U_n^{k+1}) + F(U_n^k) - G(U_n^k),
+ *  where the coarse propagator G and the fine propagator F advance the DG solution over a slice
+ *  with their own ODE solver and time step (Lions, Maday and Turinici 2001; Gander and Vandewalle 2007).
+ *
+ *  After k iterations, the solutions of the first k slices are the fine ones, such that these slices are not
+ *  propagated again, and the iterations stop at the number of slices at the latest, or once the largest
+ *  relative L2 change of the slice end solutions is below the tolerance.
+ *
+ *  The fine propagations of an iteration are independent from one slice to the next, and are spread over the
+ *  slice groups of time_communicator. Each group holds its own DG discretization, distributed over the communicator
+ *  of the group given to DGBase, and propagates every n_slice_groups-th slice. The fine propagations are then
+ *  broadcast to the other groups, while the sequential coarse propagations are repeated by every group,
+ *  such that all groups hold the slice end solutions. The groups must have the same number of processes and
+ *  the same mesh, such that the processes of the same rank in each group own the same degrees of freedom,
+ *  see create_slice_group_communicator(). With a DG distributed over time_communicator, there is a single group.
+ */
+#if PHILIP_DIM==1
+template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
+#else
+template <int dim, typename real, typename MeshType = dealii::parallel::distributed::Triangulation<dim>>
+#endif
+class PararealDriver
+{
+public:
+    PararealDriver(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input,
+            std::shared_ptr< ODESolverBase<dim, real, MeshType> > fine_solver_input,
+            std::shared_ptr< ODESolverBase<dim, real, MeshType> > coarse_solver_input,
+            const int n_time_slices_input,
+            const int maximum_iterations_input,
+            const double tolerance_input,
+            const MPI_Comm time_communicator_input = MPI_COMM_WORLD); ///< Constructor.
+
+    ~PararealDriver(); ///< Destructor, frees slice_group_peers_communicator.
+
+    /// Splits time_communicator into n_slice_groups groups of consecutive ranks, to distribute the DG of each group
+    /** The number of processes of time_communicator must be a multiple of n_slice_groups.
+     *  The returned communicator is to be freed with MPI_Comm_free() by the caller.
+     */
+    static MPI_Comm create_slice_group_communicator(const MPI_Comm time_communicator, const int n_slice_groups);
+
+    /// Advances the DG solution from initial_time to final_time, and returns the number of iterations
+    /** The fine solver is left at final_time and at the iteration of the last slice end.
+     */
+    int advance(const real initial_time, const real final_time, const real fine_time_step, const real coarse_time_step);
+
+    /// Solutions at the slice ends from the last iteration, starting with the initial solution
+    std::vector<dealii::LinearAlgebra::distributed::Vector<double>> slice_solutions;
+
+    /// Times at the slice ends, starting with the initial time
+    std::vector<real> slice_times;
+
+    /// Iterations of the fine solver at the slice ends, as if it had advanced the solution sequentially
+    std::vector<unsigned int> slice_iterations;
+
+    /// Largest relative L2 change of the slice end solutions at the last iteration
+    double last_iteration_change;
+
+protected:
+    /// DG discretization advanced by both propagators
+    std::shared_ptr<DGBase<dim,real,MeshType>> dg;
+
+    /// ODE solver of the fine propagator
+    std::shared_ptr<ODESolverBase<dim,real,MeshType>> fine_solver;
+
+    /// ODE solver of the coarse propagator
+    std::shared_ptr<ODESolverBase<dim,real,MeshType>> coarse_solver;
+
+    const int n_time_slices; ///< Number of time slices
+    const int maximum_iterations; ///< Maximum number of iterations
+    const double tolerance; ///< Tolerance on the largest relative L2 change of the slice end solutions
+
+    /// Fine propagation F(U_n) of each slice at the current iteration, indexed by its end
+    std::vector<dealii::LinearAlgebra::distributed::Vector<double>> fine_propagations;
+
+    /// Coarse propagation G(U_n) of each slice at the previous iteration, indexed by its end
+    std::vector<dealii::LinearAlgebra::distributed::Vector<double>> coarse_propagations;
+
+    /// Number of equal steps of at most time_step over [start_time, end_time]
+    int get_number_of_steps(const real start_time, const real end_time, const real time_step) const;
+
+    /// Slice group propagating the slice n at the iteration whose first propagated slice is first_slice
+    int get_slice_group(const int n, const int first_slice) const;
+
+    /// Copies the locally owned entries of the vector of the slice group to the other groups
+    void broadcast_from_slice_group(dealii::LinearAlgebra::distributed::Vector<double> &vector, const int source_slice_group) const;
+
+    /// Advances initial_solution over [start_time, end_time] with the solver, in steps of at most time_step
+    void propagate(ODESolverBase<dim,real,MeshType> &ode_solver,
+                   const dealii::LinearAlgebra::distributed::Vector<double> &initial_solution,
+                   dealii::LinearAlgebra::distributed::Vector<double> &end_solution,
+                   const real start_time,
+                   const real end_time,
+                   const real time_step);
+
+    const MPI_Comm time_communicator; ///< MPI communicator of the processes of all the slice groups.
+    /// MPI communicator of the processes of the same rank in every slice group, ranked by slice group
+    MPI_Comm slice_group_peers_communicator;
+    int n_slice_groups; ///< Number of slice groups
+    int slice_group; ///< Slice group of this process
+    dealii::ConditionalOStream pcout; ///< Parallel std::cout that only outputs on the rank 0 of time_communicator
+};
+
+} // ODE namespace
+} // PHiLiP namespace
+
+#endif
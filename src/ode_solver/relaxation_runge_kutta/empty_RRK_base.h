@@ -33,7 +33,7 @@ public:
     /// Update stored quantities at the current stage
     /** Does nothing here */
     virtual void store_stage_solutions(const int /*istage*/,
-            const dealii::LinearAlgebra::distributed::Vector<double> /*rk_stage_i*/) {
+            const dealii::LinearAlgebra::distributed::Vector<double> &/*rk_stage_i*/) {
         // Do not store anything
     };
 
@@ -346,7 +346,7 @@ real RootFindingRRKODESolver<dim,real,MeshType>::compute_integrated_numerical_en
         }
     }
     //MPI
-    integrated_quantity = dealii::Utilities::MPI::sum(integrated_quantity, this->mpi_communicator);
+    integrated_quantity = dealii::Utilities::MPI::sum(integrated_quantity, dg->mpi_communicator);
 
     return integrated_quantity;
 }
@@ -20,7 +20,7 @@ RKNumEntropy<dim,real,MeshType>::RKNumEntropy(
 }
 
 template <int dim, typename real, typename MeshType>
-void RKNumEntropy<dim,real,MeshType>::store_stage_solutions(const int istage, const dealii::LinearAlgebra::distributed::Vector<double> rk_stage_i)
+void RKNumEntropy<dim,real,MeshType>::store_stage_solutions(const int istage, const dealii::LinearAlgebra::distributed::Vector<double> &rk_stage_i)
 {
     //Store the solution value
     //This function is called before rk_stage is modified to hold the time-derivative
@@ -56,7 +56,7 @@ protected:
     /// Update stored quantities at the current stage
     /** Stores solution at stage, rk_stage_solution */
     void store_stage_solutions(const int istage,
-            const dealii::LinearAlgebra::distributed::Vector<double> rk_stage_i) override;
+            const dealii::LinearAlgebra::distributed::Vector<double> &rk_stage_i) override;
     
     /// Return the entropy variables from a solution vector u
     dealii::LinearAlgebra::distributed::Vector<double> compute_entropy_vars(
@@ -0,0 +1,34 @@
+#include "additive_rk_tableau_base.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+template <int dim, typename real, typename MeshType> 
+AdditiveRKTableauBase<dim,real, MeshType> :: AdditiveRKTableauBase (const int n_rk_stages_input, 
+        const std::string rk_method_string_input)
+    : RKTableauBase<dim,real,MeshType>(n_rk_stages_input, rk_method_string_input)
+{
+    this->butcher_tableau_a_explicit.reinit(n_rk_stages_input,n_rk_stages_input);
+}
+
+template <int dim, typename real, typename MeshType> 
+void AdditiveRKTableauBase<dim,real, MeshType> :: set_a ()
+{
+    set_a_implicit();
+    set_a_explicit();
+}
+
+template <int dim, typename real, typename MeshType> 
+double AdditiveRKTableauBase<dim,real, MeshType> :: get_a_explicit (const int i, const int j) const
+{
+    return butcher_tableau_a_explicit[i][j];
+}
+
+template class AdditiveRKTableauBase<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM>>;
+template class AdditiveRKTableauBase<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>;
+#if PHILIP_DIM != 1
+template class AdditiveRKTableauBase<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>;
+#endif
+
+} // ODE namespace
+} // PHiLiP namespace
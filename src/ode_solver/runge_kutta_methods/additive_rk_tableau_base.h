@@ -0,0 +1,47 @@
+#ifndef __ADDITIVE_RK_TABLEAU_BASE__
+#define __ADDITIVE_RK_TABLEAU_BASE__
+
+#include <deal.II/base/table.h>
+
+#include "rk_tableau_base.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+/// Base class for storing an additive (IMEX) RK method
+/** The implicit tableau is stored as the "a" of RKTableauBase, such that get_a() returns
+ *  the diagonally-implicit coefficients, and the explicit tableau is stored separately.
+ *  Both tableaux share the "b" and "c" coefficients.
+ */
+#if PHILIP_DIM==1
+template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
+#else
+template <int dim, typename real, typename MeshType = dealii::parallel::distributed::Triangulation<dim>>
+#endif
+class AdditiveRKTableauBase: public RKTableauBase <dim, real, MeshType>
+{
+public:
+    /// Default constructor that will set the constants.
+    AdditiveRKTableauBase(const int n_rk_stages, const std::string rk_method_string_input);
+
+    /// Returns the explicit Butcher tableau "a" coefficient at position [i][j]
+    double get_a_explicit(const int i, const int j) const;
+
+protected:
+    /// Explicit Butcher tableau "a"
+    dealii::Table<2,double> butcher_tableau_a_explicit;
+
+    /// Calls the setters of the implicit and explicit Butcher tableaux "a"
+    void set_a() override;
+
+    /// Setter for butcher_tableau_a, the implicit tableau
+    virtual void set_a_implicit() = 0;
+
+    /// Setter for butcher_tableau_a_explicit
+    virtual void set_a_explicit() = 0;
+};
+
+} // ODE namespace
+} // PHiLiP namespace
+
+#endif
@@ -0,0 +1,100 @@
+#include "additive_runge_kutta_methods.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+//##################################################################
+template <int dim, typename real, typename MeshType>
+void ARK3AdditiveRK<dim,real,MeshType> :: set_a_implicit()
+{
+    // ESDIRK with gamma = 1767732205903/4055673282236, Kennedy & Carpenter 2003, Table 4
+    const double gam = 1767732205903.0/4055673282236.0;
+    const double butcher_tableau_a_values[16] = {0, 0, 0, 0,
+                                                 gam, gam, 0, 0,
+                                                 2746238789719.0/10658868560708.0, -640167445237.0/6845629431997.0, gam, 0,
+                                                 1471266399579.0/7840856788654.0, -4482444167858.0/7529755066697.0, 11266239266428.0/11593286722821.0, gam};
+    this->butcher_tableau_a.fill(butcher_tableau_a_values);
+}
+
+template <int dim, typename real, typename MeshType>
+void ARK3AdditiveRK<dim,real,MeshType> :: set_a_explicit()
+{
+    const double butcher_tableau_a_values[16] = {0, 0, 0, 0,
+                                                 1767732205903.0/2027836641118.0, 0, 0, 0,
+                                                 5535828885825.0/10492691773637.0, 788022342437.0/10882634858940.0, 0, 0,
+                                                 6485989280629.0/16251701735622.0, -4246266847089.0/9704473918619.0, 10755448449292.0/10357097424841.0, 0};
+    this->butcher_tableau_a_explicit.fill(butcher_tableau_a_values);
+}
+
+template <int dim, typename real, typename MeshType>
+void ARK3AdditiveRK<dim,real,MeshType> :: set_b()
+{
+    // Stiffly accurate: b is the last row of the implicit tableau
+    const double butcher_tableau_b_values[4] = {1471266399579.0/7840856788654.0, -4482444167858.0/7529755066697.0,
+                                                11266239266428.0/11593286722821.0, 1767732205903.0/4055673282236.0};
+    this->butcher_tableau_b.fill(butcher_tableau_b_values);
+}
+
+template <int dim, typename real, typename MeshType>
+void ARK3AdditiveRK<dim,real,MeshType> :: set_c()
+{
+    const double butcher_tableau_c_values[4] = {0, 1767732205903.0/2027836641118.0, 3.0/5.0, 1};
+    this->butcher_tableau_c.fill(butcher_tableau_c_values);
+}
+
+//##################################################################
+template <int dim, typename real, typename MeshType>
+void ARK4AdditiveRK<dim,real,MeshType> :: set_a_implicit()
+{
+    // ESDIRK with gamma = 1/4, Kennedy & Carpenter 2003, Table 6
+    const double gam = 0.25;
+    const double butcher_tableau_a_values[36] = {0, 0, 0, 0, 0, 0,
+                                                 gam, gam, 0, 0, 0, 0,
+                                                 8611.0/62500.0, -1743.0/31250.0, gam, 0, 0, 0,
+                                                 5012029.0/34652500.0, -654441.0/2922500.0, 174375.0/388108.0, gam, 0, 0,
+                                                 15267082809.0/155376265600.0, -71443401.0/120774400.0, 730878875.0/902184768.0, 2285395.0/8070912.0, gam, 0,
+                                                 82889.0/524892.0, 0, 15625.0/83664.0, 69875.0/102672.0, -2260.0/8211.0, gam};
+    this->butcher_tableau_a.fill(butcher_tableau_a_values);
+}
+
+template <int dim, typename real, typename MeshType>
+void ARK4AdditiveRK<dim,real,MeshType> :: set_a_explicit()
+{
+    const double butcher_tableau_a_values[36] = {0, 0, 0, 0, 0, 0,
+                                                 0.5, 0, 0, 0, 0, 0,
+                                                 13861.0/62500.0, 6889.0/62500.0, 0, 0, 0, 0,
+                                                 -116923316275.0/2393684061468.0, -2731218467317.0/15368042101831.0, 9408046702089.0/11113171139209.0, 0, 0, 0,
+                                                 -451086348788.0/2902428689909.0, -2682348792572.0/7519795681897.0, 12662868775082.0/11960479115383.0, 3355817975965.0/11060851509271.0, 0, 0,
+                                                 647845179188.0/3216320057751.0, 73281519250.0/8382639484533.0, 552539513391.0/3454668386233.0, 3354512671639.0/8306763924573.0, 4040.0/17871.0, 0};
+    this->butcher_tableau_a_explicit.fill(butcher_tableau_a_values);
+}
+
+template <int dim, typename real, typename MeshType>
+void ARK4AdditiveRK<dim,real,MeshType> :: set_b()
+{
+    // Stiffly accurate: b is the last row of the implicit tableau
+    const double butcher_tableau_b_values[6] = {82889.0/524892.0, 0, 15625.0/83664.0, 69875.0/102672.0, -2260.0/8211.0, 0.25};
+    this->butcher_tableau_b.fill(butcher_tableau_b_values);
+}
+
+template <int dim, typename real, typename MeshType>
+void ARK4AdditiveRK<dim,real,MeshType> :: set_c()
+{
+    const double butcher_tableau_c_values[6] = {0, 0.5, 83.0/250.0, 31.0/50.0, 17.0/20.0, 1};
+    this->butcher_tableau_c.fill(butcher_tableau_c_values);
+}
+
+template class ARK3AdditiveRK<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM> >;
+template class ARK3AdditiveRK<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
+#if PHILIP_DIM != 1
+    template class ARK3AdditiveRK<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
+#endif
+
+template class ARK4AdditiveRK<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM> >;
+template class ARK4AdditiveRK<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
+#if PHILIP_DIM != 1
+    template class ARK4AdditiveRK<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
+#endif
+
+} // ODESolver namespace
+} // PHiLiP namespace
@@ -0,0 +1,70 @@
+#ifndef __ADDITIVE_RUNGE_KUTTA_METHODS__
+#define __ADDITIVE_RUNGE_KUTTA_METHODS__
+
+#include "additive_rk_tableau_base.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+/// Four-stage third-order stiffly-accurate additive RK, ARK3(2)4L[2]SA
+/** see
+ *  Kennedy, Christopher A., and Mark H. Carpenter. "Additive Runge–Kutta schemes for convection–diffusion–reaction equations." Applied Numerical Mathematics 44.1-2 (2003): 139-181. */
+#if PHILIP_DIM==1
+template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
+#else
+template <int dim, typename real, typename MeshType = dealii::parallel::distributed::Triangulation<dim>>
+#endif
+class ARK3AdditiveRK: public AdditiveRKTableauBase <dim, real, MeshType>
+{
+public:
+    /// Constructor
+    ARK3AdditiveRK(const int n_rk_stages, const std::string rk_method_string_input) 
+        : AdditiveRKTableauBase<dim,real,MeshType>(n_rk_stages, rk_method_string_input) { }
+
+protected:
+    /// Setter for butcher_tableau_a
+    void set_a_implicit() override;
+
+    /// Setter for butcher_tableau_a_explicit
+    void set_a_explicit() override;
+
+    /// Setter for butcher_tableau_b
+    void set_b() override;
+
+    /// Setter for butcher_tableau_c
+    void set_c() override;
+};
+
+/// Six-stage fourth-order stiffly-accurate additive RK, ARK4(3)6L[2]SA
+/** see
+ *  Kennedy, Christopher A., and Mark H. Carpenter. "Additive Runge–Kutta schemes for convection–diffusion–reaction equations." Applied Numerical Mathematics 44.1-2 (2003): 139-181. */
+#if PHILIP_DIM==1
+template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
+#else
+template <int dim, typename real, typename MeshType = dealii::parallel::distributed::Triangulation<dim>>
+#endif
+class ARK4AdditiveRK: public AdditiveRKTableauBase <dim, real, MeshType>
+{
+public:
+    /// Constructor
+    ARK4AdditiveRK(const int n_rk_stages, const std::string rk_method_string_input) 
+        : AdditiveRKTableauBase<dim,real,MeshType>(n_rk_stages, rk_method_string_input) { }
+
+protected:
+    /// Setter for butcher_tableau_a
+    void set_a_implicit() override;
+
+    /// Setter for butcher_tableau_a_explicit
+    void set_a_explicit() override;
+
+    /// Setter for butcher_tableau_b
+    void set_b() override;
+
+    /// Setter for butcher_tableau_c
+    void set_c() override;
+};
+
+} // ODE namespace
+} // PHiLiP namespace
+
+#endif
@@ -0,0 +1,109 @@
+#include "low_storage_rk_tableau_base.h"
+
+#include <vector>
+
+namespace PHiLiP {
+namespace ODE {
+
+template <int dim, typename real, typename MeshType>
+LowStorageRKTableauBase<dim,real, MeshType> :: LowStorageRKTableauBase (const int n_rk_stages_input,
+        const std::string rk_method_string_input)
+    : n_rk_stages(n_rk_stages_input)
+    , pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0)
+    , rk_method_string(rk_method_string_input)
+{
+    this->low_storage_A.reinit(n_rk_stages);
+    this->low_storage_delta.reinit(n_rk_stages);
+    this->low_storage_theta.reinit(n_rk_stages);
+    this->low_storage_gamma.reinit(n_rk_stages,3);
+    this->low_storage_beta.reinit(n_rk_stages);
+    this->butcher_tableau_b.reinit(n_rk_stages);
+    this->butcher_tableau_c.reinit(n_rk_stages);
+}
+
+template <int dim, typename real, typename MeshType>
+void LowStorageRKTableauBase<dim,real, MeshType> :: set_tableau ()
+{
+    set_coefficients();
+
+    // Performs the stages on the coefficients of dt*F(stage j) held by each register.
+    // The stage values are u^n + dt*sum(a_ij*F_j), hence c_i = sum(a_ij), and S1 ends as u^n + dt*sum(b_j*F_j).
+    std::vector<double> register_1(n_rk_stages, 0.0), register_2(n_rk_stages, 0.0);
+    for (int i = 0; i < n_rk_stages; ++i) {
+        double c_i = 0.0;
+        for (int j = 0; j < i; ++j) c_i += register_1[j];
+        butcher_tableau_c[i] = c_i;
+
+        for (int j = 0; j < n_rk_stages; ++j) {
+            register_2[j] = get_A(i) * register_2[j] + get_delta(i) * register_1[j];
+        }
+        register_2[i] += get_theta(i);
+        for (int j = 0; j < n_rk_stages; ++j) {
+            register_1[j] = get_gamma(i,0) * register_1[j] + get_gamma(i,1) * register_2[j];
+        }
+        register_1[i] += get_beta(i);
+    }
+    for (int j = 0; j < n_rk_stages; ++j) butcher_tableau_b[j] = register_1[j];
+
+    pcout << "Assigned low-storage RK method: " << rk_method_string << std::endl;
+}
+
+template <int dim, typename real, typename MeshType>
+double LowStorageRKTableauBase<dim,real, MeshType> :: get_A (const int i) const
+{
+    return low_storage_A[i];
+}
+
+template <int dim, typename real, typename MeshType>
+double LowStorageRKTableauBase<dim,real, MeshType> :: get_delta (const int i) const
+{
+    return low_storage_delta[i];
+}
+
+template <int dim, typename real, typename MeshType>
+double LowStorageRKTableauBase<dim,real, MeshType> :: get_theta (const int i) const
+{
+    return low_storage_theta[i];
+}
+
+template <int dim, typename real, typename MeshType>
+double LowStorageRKTableauBase<dim,real, MeshType> :: get_gamma (const int i, const int j) const
+{
+    return low_storage_gamma[i][j];
+}
+
+template <int dim, typename real, typename MeshType>
+double LowStorageRKTableauBase<dim,real, MeshType> :: get_beta (const int i) const
+{
+    return low_storage_beta[i];
+}
+
+template <int dim, typename real, typename MeshType>
+double LowStorageRKTableauBase<dim,real, MeshType> :: get_b (const int i) const
+{
+    return butcher_tableau_b[i];
+}
+
+template <int dim, typename real, typename MeshType>
+double LowStorageRKTableauBase<dim,real, MeshType> :: get_c (const int i) const
+{
+    return butcher_tableau_c[i];
+}
+
+template <int dim, typename real, typename MeshType>
+bool LowStorageRKTableauBase<dim,real, MeshType> :: uses_third_register () const
+{
+    for (int i = 0; i < n_rk_stages; ++i) {
+        if (get_gamma(i,2) != 0.0) return true;
+    }
+    return false;
+}
+
+template class LowStorageRKTableauBase<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM>>;
+template class LowStorageRKTableauBase<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>;
+#if PHILIP_DIM != 1
+template class LowStorageRKTableauBase<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>;
+#endif
+
+} // ODE namespace
+} // PHiLiP namespace
@@ -0,0 +1,103 @@
+#ifndef __LOW_STORAGE_RK_TABLEAU_BASE__
+#define __LOW_STORAGE_RK_TABLEAU_BASE__
+
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/table.h>
+
+#include <deal.II/grid/tria.h>
+#include <deal.II/distributed/shared_tria.h>
+#include <deal.II/distributed/tria.h>
+
+namespace PHiLiP {
+namespace ODE {
+
+/// Base class for storing a low-storage RK method
+/** The methods are stored in a form combining the Williamson 2N and the Ketcheson 2S/3S* forms.
+ *  With the registers S1 = u^n, S2 = 0 and S3 = u^n at the start of the step, stage i updates
+ *  \f[
+ *      S_2 \leftarrow A_i S_2 + \delta_i S_1 + \theta_i \Delta t F(S_1), \qquad
+ *      S_1 \leftarrow \gamma_{i1} S_1 + \gamma_{i2} S_2 + \gamma_{i3} S_3 + \beta_i \Delta t F(S_1),
+ *  \f]
+ *  with F evaluated once per stage, at S1 before the stage, and u^{n+1} = S1 after the last stage.
+ *  2N methods use A, theta = 1 and gamma_i2, while 2S and 3S* methods use delta, gamma and beta.
+ *  S3 is only needed by methods with a nonzero gamma_i3.
+ *
+ *  See
+ *  Williamson, John H. "Low-storage Runge-Kutta schemes." Journal of Computational Physics 35.1 (1980): 48-56.
+ *  Ketcheson, David I. "Runge–Kutta methods with minimum storage implementations." Journal of Computational Physics 229.5 (2010): 1763-1773.
+ */
+#if PHILIP_DIM==1
+template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
+#else
+template <int dim, typename real, typename MeshType = dealii::parallel::distributed::Triangulation<dim>>
+#endif
+class LowStorageRKTableauBase
+{
+public:
+    /// Default constructor that will set the constants.
+    LowStorageRKTableauBase(const int n_rk_stages, const std::string rk_method_string_input);
+
+    /// Destructor
+    virtual ~LowStorageRKTableauBase() = default;
+
+    /// Returns the coefficient A of S2 in the update of S2 at stage i
+    double get_A(const int i) const;
+
+    /// Returns the coefficient delta of S1 in the update of S2 at stage i
+    double get_delta(const int i) const;
+
+    /// Returns the coefficient theta of dt*F in the update of S2 at stage i
+    double get_theta(const int i) const;
+
+    /// Returns the coefficient gamma of register j+1 in the update of S1 at stage i
+    double get_gamma(const int i, const int j) const;
+
+    /// Returns the coefficient beta of dt*F in the update of S1 at stage i
+    double get_beta(const int i) const;
+
+    /// Returns the "b" coefficient of the equivalent Butcher tableau at position [i]
+    double get_b(const int i) const;
+
+    /// Returns the "c" coefficient of the equivalent Butcher tableau at position [i]
+    double get_c(const int i) const;
+
+    /// Whether the method needs the third register S3
+    bool uses_third_register() const;
+
+    /// Calls the setter of the coefficients and evaluates the equivalent Butcher tableau
+    void set_tableau();
+
+    /// Store number of stages
+    const int n_rk_stages;
+
+protected:
+
+    dealii::ConditionalOStream pcout; ///< Parallel std::cout that only outputs on mpi_rank==0
+
+    /// String identifying the RK method
+    const std::string rk_method_string;
+
+    /// Coefficients A of the update of S2, zero by default
+    dealii::Table<1,double> low_storage_A;
+    /// Coefficients delta of the update of S2, zero by default
+    dealii::Table<1,double> low_storage_delta;
+    /// Coefficients theta of the update of S2, zero by default
+    dealii::Table<1,double> low_storage_theta;
+    /// Coefficients gamma of the update of S1, of size n_rk_stages x 3, zero by default
+    dealii::Table<2,double> low_storage_gamma;
+    /// Coefficients beta of the update of S1, zero by default
+    dealii::Table<1,double> low_storage_beta;
+
+    /// Equivalent Butcher tableau "b"
+    dealii::Table<1,double> butcher_tableau_b;
+    /// Equivalent Butcher tableau "c"
+    dealii::Table<1,double> butcher_tableau_c;
+
+    /// Setter for the low-storage coefficients
+    virtual void set_coefficients() = 0;
+};
+
+} // ODE namespace
+} // PHiLiP namespace
+
+#endif
@@ -0,0 +1,90 @@
+#include "low_storage_runge_kutta_methods.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+//##################################################################
+template <int dim, typename real, typename MeshType>
+void CarpenterKennedyLSRK54<dim,real,MeshType> :: set_coefficients()
+{
+    // 2N form: S2 = A_i*S2 + dt*F(S1), S1 = S1 + B_i*S2
+    const double A_values[5] = {0.0,
+                                -567301805773.0/1357537059087.0,
+                                -2404267990393.0/2016746695238.0,
+                                -3550918686646.0/2091501179385.0,
+                                -1275806237668.0/842570457699.0};
+    const double B_values[5] = {1432997174477.0/9575080441755.0,
+                                5161836677717.0/13612068292357.0,
+                                1720146321549.0/2090206949498.0,
+                                3134564353537.0/4481467310338.0,
+                                2277821191437.0/14882151754819.0};
+    for (int i = 0; i < 5; ++i) {
+        this->low_storage_A[i] = A_values[i];
+        this->low_storage_theta[i] = 1.0;
+        this->low_storage_gamma[i][0] = 1.0;
+        this->low_storage_gamma[i][1] = B_values[i];
+    }
+}
+
+//##################################################################
+template <int dim, typename real, typename MeshType>
+void SSPRK3LowStorage<dim,real,MeshType> :: set_coefficients()
+{
+    // u1 = u + dt*F(u), u2 = 3/4*u + 1/4*(u1 + dt*F(u1)), u^{n+1} = 1/3*u + 2/3*(u2 + dt*F(u2))
+    const double gamma_values[9] = {1.0, 0, 0,
+                                    0.25, 0, 0.75,
+                                    2.0/3.0, 0, 1.0/3.0};
+    this->low_storage_gamma.fill(gamma_values);
+    const double beta_values[3] = {1.0, 0.25, 2.0/3.0};
+    this->low_storage_beta.fill(beta_values);
+}
+
+//##################################################################
+template <int dim, typename real, typename MeshType>
+void KetchesonSSPRK104<dim,real,MeshType> :: set_coefficients()
+{
+    // q1 = u; q2 = u
+    // q1 = q1 + dt/6*F(q1), 5 times
+    // q2 = 1/25*q2 + 9/25*q1; q1 = 15*q2 - 5*q1
+    // q1 = q1 + dt/6*F(q1), 4 times
+    // u^{n+1} = q2 + 3/5*q1 + 1/10*dt*F(q1)
+    // The combination after the 5th stage is merged into it, and S2 stores 9/10 of its result,
+    // such that q2 = S2 - 1/2*S3.
+    const double gamma_values[30] = {1.0, 0, 0,
+                                     1.0, 0, 0,
+                                     1.0, 0, 0,
+                                     1.0, 0, 0,
+                                     0.4, 0, 0.6,
+                                     1.0, 0, 0,
+                                     1.0, 0, 0,
+                                     1.0, 0, 0,
+                                     1.0, 0, 0,
+                                     0.6, 1.0, -0.5};
+    this->low_storage_gamma.fill(gamma_values);
+    const double beta_values[10] = {1.0/6.0, 1.0/6.0, 1.0/6.0, 1.0/6.0, 1.0/15.0,
+                                    1.0/6.0, 1.0/6.0, 1.0/6.0, 1.0/6.0, 0.1};
+    this->low_storage_beta.fill(beta_values);
+    this->low_storage_delta[5] = 0.9;
+    for (int i = 0; i < 10; ++i) this->low_storage_A[i] = 1.0;
+}
+
+template class CarpenterKennedyLSRK54<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM> >;
+template class CarpenterKennedyLSRK54<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
+#if PHILIP_DIM != 1
+    template class CarpenterKennedyLSRK54<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
+#endif
+
+template class SSPRK3LowStorage<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM> >;
+template class SSPRK3LowStorage<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
+#if PHILIP_DIM != 1
+    template class SSPRK3LowStorage<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
+#endif
+
+template class KetchesonSSPRK104<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM> >;
+template class KetchesonSSPRK104<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
+#if PHILIP_DIM != 1
+    template class KetchesonSSPRK104<PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
+#endif
+
+} // ODESolver namespace
+} // PHiLiP namespace
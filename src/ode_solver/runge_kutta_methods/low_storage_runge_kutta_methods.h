@@ -0,0 +1,72 @@
+#ifndef __LOW_STORAGE_RUNGE_KUTTA_METHODS__
+#define __LOW_STORAGE_RUNGE_KUTTA_METHODS__
+
+#include "low_storage_rk_tableau_base.h"
+
+namespace PHiLiP {
+namespace ODE {
+
+/// Five-stage fourth-order 2N-storage explicit RK, solution 3 in
+/** Carpenter, Mark H., and Christopher A. Kennedy. "Fourth-order 2N-storage Runge-Kutta schemes." NASA TM 109112 (1994). */
+#if PHILIP_DIM==1
+template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
+#else
+template <int dim, typename real, typename MeshType = dealii::parallel::distributed::Triangulation<dim>>
+#endif
+class CarpenterKennedyLSRK54: public LowStorageRKTableauBase <dim, real, MeshType>
+{
+public:
+    /// Constructor
+    CarpenterKennedyLSRK54(const int n_rk_stages, const std::string rk_method_string_input)
+        : LowStorageRKTableauBase<dim,real,MeshType>(n_rk_stages, rk_method_string_input) { }
+
+protected:
+    /// Setter for the low-storage coefficients
+    void set_coefficients() override;
+};
+
+/// Third-order strong stability preserving explicit RK in its Shu-Osher form, with two registers and u^n
+/** see
+ *  Shu, Chi-Wang, and Stanley Osher. "Efficient implementation of essentially non-oscillatory shock-capturing schemes." Journal of computational physics 77.2 (1988): 439-471. */
+#if PHILIP_DIM==1
+template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
+#else
+template <int dim, typename real, typename MeshType = dealii::parallel::distributed::Triangulation<dim>>
+#endif
+class SSPRK3LowStorage: public LowStorageRKTableauBase <dim, real, MeshType>
+{
+public:
+    /// Constructor
+    SSPRK3LowStorage(const int n_rk_stages, const std::string rk_method_string_input)
+        : LowStorageRKTableauBase<dim,real,MeshType>(n_rk_stages, rk_method_string_input) { }
+
+protected:
+    /// Setter for the low-storage coefficients
+    void set_coefficients() override;
+};
+
+/// Ten-stage fourth-order strong stability preserving explicit RK, SSP coefficient 6
+/** see
+ *  Ketcheson, David I. "Highly efficient strong stability-preserving Runge–Kutta methods with low-storage implementations." SIAM Journal on Scientific Computing 30.4 (2008): 2113-2136.
+ *  The combinations of its low-storage implementation are merged into the 5th and 10th stages. */
+#if PHILIP_DIM==1
+template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
+#else
+template <int dim, typename real, typename MeshType = dealii::parallel::distributed::Triangulation<dim>>
+#endif
+class KetchesonSSPRK104: public LowStorageRKTableauBase <dim, real, MeshType>
+{
+public:
+    /// Constructor
+    KetchesonSSPRK104(const int n_rk_stages, const std::string rk_method_string_input)
+        : LowStorageRKTableauBase<dim,real,MeshType>(n_rk_stages, rk_method_string_input) { }
+
+protected:
+    /// Setter for the low-storage coefficients
+    void set_coefficients() override;
+};
+
+} // ODE namespace
+} // PHiLiP namespace
+
+#endif
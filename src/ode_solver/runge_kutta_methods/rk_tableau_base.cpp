@@ -14,6 +14,7 @@ RKTableauBase<dim,real, MeshType> :: RKTableauBase (const int n_rk_stages_input,
     this->butcher_tableau_a.reinit(n_rk_stages,n_rk_stages);
     this->butcher_tableau_b.reinit(n_rk_stages);
     this->butcher_tableau_c.reinit(n_rk_stages);
+    this->butcher_tableau_b_hat.reinit(n_rk_stages);
 }
 
 template <int dim, typename real, typename MeshType> 
@@ -22,6 +23,17 @@ void RKTableauBase<dim,real, MeshType> :: set_tableau ()
     set_a();
     set_b();
     set_c();
+    set_b_hat();
+
+    // The last stage is at u_np1 if the method is explicit, its last row of "a" is "b" and its last "b" is zero
+    const int last_stage = n_rk_stages - 1;
+    first_same_as_last = (n_rk_stages > 1) && (butcher_tableau_b[last_stage] == 0.0) && (butcher_tableau_c[last_stage] == 1.0);
+    for (int i = 0; i < n_rk_stages; ++i) {
+        if (butcher_tableau_a[i][i] != 0.0) first_same_as_last = false;
+    }
+    for (int j = 0; j < last_stage; ++j) {
+        if (butcher_tableau_a[last_stage][j] != butcher_tableau_b[j]) first_same_as_last = false;
+    }
     pcout << "Assigned RK method: " << rk_method_string << std::endl;
 }
 
@@ -43,6 +55,30 @@ double RKTableauBase<dim,real, MeshType> :: get_c (const int i) const
     return butcher_tableau_c[i];
 }
 
+template <int dim, typename real, typename MeshType> 
+double RKTableauBase<dim,real, MeshType> :: get_b_hat (const int i) const
+{
+    return butcher_tableau_b_hat[i];
+}
+
+template <int dim, typename real, typename MeshType> 
+bool RKTableauBase<dim,real, MeshType> :: has_embedded_method () const
+{
+    return (embedded_order > 0);
+}
+
+template <int dim, typename real, typename MeshType> 
+int RKTableauBase<dim,real, MeshType> :: get_embedded_order () const
+{
+    return embedded_order;
+}
+
+template <int dim, typename real, typename MeshType> 
+bool RKTableauBase<dim,real, MeshType> :: is_first_same_as_last () const
+{
+    return first_same_as_last;
+}
+
 template class RKTableauBase<PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM>>;
 template class RKTableauBase<PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>;
 #if PHILIP_DIM != 1
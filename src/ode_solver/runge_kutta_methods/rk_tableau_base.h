@@ -34,6 +34,19 @@ public:
     /// Returns Butcher tableau "c" coefficient at position [i]
     double get_c(const int i) const;
 
+    /// Returns the "b_hat" coefficient of the embedded method at position [i]
+    double get_b_hat(const int i) const;
+
+    /// Returns whether the method has an embedded method for error estimation
+    bool has_embedded_method() const;
+
+    /// Returns the order of the embedded method, 0 if there is none
+    int get_embedded_order() const;
+
+    /// Returns whether the last stage of an explicit method is evaluated at the solution of the step
+    /** The last stage of a step is then the first stage of the next step ("first same as last"). */
+    bool is_first_same_as_last() const;
+
     /// Calls setters for butcher tableau
     void set_tableau();
 
@@ -55,6 +68,15 @@ protected:
     
     /// Butcher tableau "c"
     dealii::Table<1,double> butcher_tableau_c;
+
+    /// Weights "b_hat" of the embedded method, sharing "a" and "c"
+    dealii::Table<1,double> butcher_tableau_b_hat;
+
+    /// Order of the embedded method; assigned by set_b_hat()
+    int embedded_order = 0;
+
+    /// Whether the method is first same as last; assigned by set_tableau() from the tableau
+    bool first_same_as_last = false;
     
     /// Setter for butcher_tableau_a
     virtual void set_a() = 0;
@@ -65,6 +87,10 @@ protected:
     /// Setter for butcher_tableau_c
     virtual void set_c() = 0;
 
+    /// Setter for butcher_tableau_b_hat and embedded_order
+    /** Does nothing by default, for methods without an embedded pair. */
+    virtual void set_b_hat() {}
+
 
 };
 
@@ -199,6 +199,64 @@ protected:
     void set_c() override;
 };
 
+/// Third-order explicit RK with an embedded second-order method, first same as last
+/** see
+ *  Bogacki, Przemyslaw, and Lawrence F. Shampine. "A 3(2) pair of Runge-Kutta formulas." Applied Mathematics Letters 2.4 (1989): 321-325. */
+#if PHILIP_DIM==1
+template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
+#else
+template <int dim, typename real, typename MeshType = dealii::parallel::distributed::Triangulation<dim>>
+#endif
+class BogackiShampine32Explicit: public RKTableauBase <dim, real, MeshType>
+{
+public:
+    /// Constructor
+    BogackiShampine32Explicit(const int n_rk_stages, const std::string rk_method_string_input) 
+        : RKTableauBase<dim,real,MeshType>(n_rk_stages, rk_method_string_input) { }
+
+protected:
+    /// Setter for butcher_tableau_a
+    void set_a() override;
+
+    /// Setter for butcher_tableau_b
+    void set_b() override;
+
+    /// Setter for butcher_tableau_c
+    void set_c() override;
+
+    /// Setter for butcher_tableau_b_hat, of the embedded method
+    void set_b_hat() override;
+};
+
+/// Fifth-order explicit RK with an embedded fourth-order method, first same as last
+/** see
+ *  Dormand, John R., and Peter J. Prince. "A family of embedded Runge-Kutta formulae." Journal of computational and applied mathematics 6.1 (1980): 19-26. */
+#if PHILIP_DIM==1
+template <int dim, typename real, typename MeshType = dealii::Triangulation<dim>>
+#else
+template <int dim, typename real, typename MeshType = dealii::parallel::distributed::Triangulation<dim>>
+#endif
+class DormandPrince54Explicit: public RKTableauBase <dim, real, MeshType>
+{
+public:
+    /// Constructor
+    DormandPrince54Explicit(const int n_rk_stages, const std::string rk_method_string_input) 
+        : RKTableauBase<dim,real,MeshType>(n_rk_stages, rk_method_string_input) { }
+
+protected:
+    /// Setter for butcher_tableau_a
+    void set_a() override;
+
+    /// Setter for butcher_tableau_b
+    void set_b() override;
+
+    /// Setter for butcher_tableau_c
+    void set_c() override;
+
+    /// Setter for butcher_tableau_b_hat, of the embedded method
+    void set_b_hat() override;
+};
+
 } // ODE namespace
 } // PHiLiP namespace
 
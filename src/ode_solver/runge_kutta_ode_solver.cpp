@@ -1,3 +1,5 @@
+#include <cmath>
+
 #include "runge_kutta_ode_solver.h"
 
 namespace PHiLiP {
@@ -19,27 +21,115 @@ void RungeKuttaODESolver<dim,real,n_rk_stages,MeshType>::step_in_time (real dt,
     this->original_time_step = dt;
     this->solution_update = this->dg->solution; //storing u_n
 
-    //calculating stages **Note that rk_stage[i] stores the RHS at a partial time-step (not solution u)
-    for (int i = 0; i < n_rk_stages; ++i){
+    int first_stage = 0;
+    if (use_first_same_as_last && !pseudotime) {
+        const bool last_stage_is_at_u_n = (this->current_time == last_stage_time)
+                                          && (VectorFingerprint(this->dg->solution) == last_stage_solution_fingerprint);
+        if (VectorFingerprint::up_to_date_on_all_processors(last_stage_is_at_u_n, this->mpi_communicator)) {
+            // First same as last: the derivative at u_n is the last stage of the previous step
+            this->rk_stage[0].swap(this->rk_stage[n_rk_stages-1]);
+            relaxation_runge_kutta->store_stage_solutions(0, this->dg->solution);
+            first_stage = 1;
+        }
+    }
+    compute_stages(dt, pseudotime, first_stage);
 
-        this->rk_stage[i]=0.0; //resets all entries to zero
-        
-        for (int j = 0; j < i; ++j){
-            if (this->butcher_tableau->get_a(i,j) != 0){
-                this->rk_stage[i].add(this->butcher_tableau->get_a(i,j), this->rk_stage[j]);
+    if (use_embedded_error_control && !pseudotime) {
+        const double safety_factor = this->ode_param.embedded_error_safety_factor;
+        const double minimum_step_factor = this->ode_param.embedded_error_minimum_step_factor;
+        const double maximum_step_factor = this->ode_param.embedded_error_maximum_step_factor;
+        // Exponent of the controller, from the order of the embedded method
+        const double k = this->butcher_tableau->get_embedded_order() + 1.0;
+
+        double error_estimate = compute_embedded_error_estimate(dt);
+        int n_rejections = 0;
+        while (error_estimate > 1.0) {
+            ++n_rejections;
+            ++(this->n_rejected_steps);
+            if (n_rejections > this->ode_param.embedded_error_maximum_rejections) {
+                this->pcout << "Error: RK step rejected " << n_rejections - 1 << " times by the embedded error estimate. Aborting..." << std::endl;
+                std::abort();
             }
-        } //sum(a_ij *k_j), explicit part
+            const double step_factor = std::max(minimum_step_factor, safety_factor*pow(error_estimate, -1.0/k));
+            this->pcout << "Rejected RK step with error estimate " << error_estimate
+                        << ", retrying with time step " << step_factor*dt << std::endl;
+            dt *= step_factor;
+
+            // Restore u_n; the first stage of an explicit method does not depend on dt and is kept
+            this->dg->solution = this->solution_update;
+            const int first_stage = (this->butcher_tableau_aii_is_zero[0]) ? 1 : 0;
+            compute_stages(dt, pseudotime, first_stage);
+            error_estimate = compute_embedded_error_estimate(dt);
+        }
+
+        // PI controller, see Hairer & Wanner, Solving ODEs II, Sec. IV.2
+        const double error_for_controller = std::max(error_estimate, 1E-10);
+        double step_factor = safety_factor * pow(error_for_controller, -0.7/k) * pow(previous_error_estimate, 0.4/k);
+        // Do not increase the step right after a rejection
+        if (n_rejections > 0) step_factor = std::min(step_factor, 1.0);
+        step_factor = std::min(maximum_step_factor, std::max(minimum_step_factor, step_factor));
+        this->error_controlled_time_step = step_factor * dt;
+        previous_error_estimate = error_for_controller;
+    }
+
+    // Calculates relaxation parameter and modify the time step size as dt*=relaxation_parameter.
+    // if not using RRK, the relaxation parameter will be set to 1, such that dt is not modified.
+    this->relaxation_parameter_RRK_solver = relaxation_runge_kutta->update_relaxation_parameter(dt, this->dg, this->rk_stage, this->solution_update);
+    dt *= this->relaxation_parameter_RRK_solver;
+    this->modified_time_step = dt;
+
+    //assemble solution from stages
+    if (pseudotime){
+        for (int i = 0; i < n_rk_stages; ++i){
+            const double CFL = this->butcher_tableau->get_b(i) * dt;
+            this->dg->time_scale_solution_update(this->rk_stage[i], CFL);
+            this->solution_update.add(1.0, this->rk_stage[i]);
+        }
+        this->dg->solution = this->solution_update; // u_np1 = u_n + dt* sum(k_i * b_i)
+    } else {
+        std::array<double, n_rk_stages> dt_times_b;
+        for (int i = 0; i < n_rk_stages; ++i) dt_times_b[i] = dt * this->butcher_tableau->get_b(i);
+        add_stages_to_previous_solution(this->dg->solution, dt_times_b, n_rk_stages); // u_np1 = u_n + dt* sum(k_i * b_i)
+    }
+
+    // Calculate numerical entropy with FR correction. Does nothing if use has not selected param.
+    this->FR_entropy_contribution_RRK_solver = relaxation_runge_kutta->compute_FR_entropy_contribution(dt, this->dg, this->rk_stage, true);
+
+    // Apply limiter at every RK stage
+    apply_limiter();
+    
+    ++(this->current_iteration);
+    this->current_time += dt;
+}
+
+template <int dim, typename real, int n_rk_stages, typename MeshType> 
+void RungeKuttaODESolver<dim,real,n_rk_stages,MeshType>::compute_stages (const real dt, const bool pseudotime, const int first_stage)
+{
+    //calculating stages **Note that rk_stage[i] stores the RHS at a partial time-step (not solution u)
+    for (int i = first_stage; i < n_rk_stages; ++i){
 
-        
         if(pseudotime) {
+            this->rk_stage[i]=0.0; //resets all entries to zero
+
+            for (int j = 0; j < i; ++j){
+                if (this->butcher_tableau->get_a(i,j) != 0){
+                    this->rk_stage[i].add(this->butcher_tableau->get_a(i,j), this->rk_stage[j]);
+                }
+            } //sum(a_ij *k_j), explicit part
+
             const double CFL = dt;
-            this->dg->time_scale_solution_update(rk_stage[i], CFL);
-        }else {
-            this->rk_stage[i]*=dt; 
-        }//dt * sum(a_ij * k_j)
-        
-        this->rk_stage[i].add(1.0,this->solution_update); //u_n + dt * sum(a_ij * k_j)
-       
+            this->dg->time_scale_solution_update(rk_stage[i], CFL); //dt * sum(a_ij * k_j)
+
+            this->rk_stage[i].add(1.0,this->solution_update); //u_n + dt * sum(a_ij * k_j)
+        } else {
+            std::array<double, n_rk_stages> dt_times_a;
+            for (int j = 0; j < i; ++j) dt_times_a[j] = dt * this->butcher_tableau->get_a(i,j);
+            // Explicit stages are formed directly in the DG solution, as rk_stage[i] is overwritten by the derivative
+            dealii::LinearAlgebra::distributed::Vector<double> &stage_solution = 
+                (this->butcher_tableau_aii_is_zero[i]) ? this->dg->solution : this->rk_stage[i];
+            add_stages_to_previous_solution(stage_solution, dt_times_a, i); //u_n + dt * sum(a_ij * k_j)
+        }
+
         //implicit solve if there is a nonzero diagonal element
         if (!this->butcher_tableau_aii_is_zero[i]){
             /* // AD version - keeping in comments as it may be useful for future testing
@@ -67,59 +157,96 @@ void RungeKuttaODESolver<dim,real,n_rk_stages,MeshType>::step_in_time (real dt,
 
         } // u_n + dt * sum(a_ij * k_j) <explicit> + dt * a_ii * u^(i) <implicit>
         
-        // If using the entropy formulation of RRK, solutions must be stored.
-        // Call store_stage_solutions before overwriting rk_stage with the derivative.
-        relaxation_runge_kutta->store_stage_solutions(i, rk_stage[i]);
+        if (pseudotime || !this->butcher_tableau_aii_is_zero[i]) {
+            this->dg->solution = this->rk_stage[i];
+        }
 
-        this->dg->solution = this->rk_stage[i];
+        // If using the entropy formulation of RRK, solutions must be stored.
+        // Call store_stage_solutions before applying the limiter to the stage solution.
+        relaxation_runge_kutta->store_stage_solutions(i, this->dg->solution);
 
         // Apply limiter at every RK stage
-        if (this->limiter) {
-            this->limiter->limit(this->dg->solution,
-                this->dg->dof_handler,
-                this->dg->fe_collection,
-                this->dg->volume_quadrature_collection,
-                this->dg->high_order_grid->fe_system.tensor_degree(),
-                this->dg->max_degree,
-                this->dg->oneD_fe_collection_1state,
-                this->dg->oneD_quadrature_collection);
+        apply_limiter();
+
+        if (use_first_same_as_last && !pseudotime && i == n_rk_stages-1) {
+            last_stage_solution_fingerprint = VectorFingerprint(this->dg->solution);
+            last_stage_time = this->current_time + this->butcher_tableau->get_c(i)*dt;
         }
 
         //set the DG current time for unsteady source terms
         this->dg->set_current_time(this->current_time + this->butcher_tableau->get_c(i)*dt);
         
-        //solve the system's right hande side
-        this->dg->assemble_residual(); //RHS : du/dt = RHS = F(u_n + dt* sum(a_ij*k_j) + dt * a_ii * u^(i)))
+        //solve the system's right hande side, RHS : du/dt = RHS = F(u_n + dt* sum(a_ij*k_j) + dt * a_ii * u^(i)))
+        //and apply the inverse mass matrix to it: rk_stage[i] = IMM*RHS = F(u_n + dt*sum(a_ij*k_j))
+        this->dg->assemble_residual_and_apply_inverse_mass_matrix(this->rk_stage[i]);
+    }
+}
+
+template <int dim, typename real, int n_rk_stages, typename MeshType> 
+double RungeKuttaODESolver<dim,real,n_rk_stages,MeshType>::compute_embedded_error_estimate (const real dt) const
+{
+    const double absolute_tolerance = this->ode_param.embedded_error_absolute_tolerance;
+    const double relative_tolerance = this->ode_param.embedded_error_relative_tolerance;
 
-        if(this->all_parameters->use_inverse_mass_on_the_fly){
-            this->dg->apply_inverse_global_mass_matrix(this->dg->right_hand_side, this->rk_stage[i]); //rk_stage[i] = IMM*RHS = F(u_n + dt*sum(a_ij*k_j))
-        } else{
-            this->dg->global_inverse_mass_matrix.vmult(this->rk_stage[i], this->dg->right_hand_side); //rk_stage[i] = IMM*RHS = F(u_n + dt*sum(a_ij*k_j))
+    std::array<double, n_rk_stages> b;
+    std::array<double, n_rk_stages> b_minus_b_hat;
+    for (int i = 0; i < n_rk_stages; ++i) {
+        b[i] = dt * this->butcher_tableau->get_b(i);
+        b_minus_b_hat[i] = dt * (this->butcher_tableau->get_b(i) - this->butcher_tableau->get_b_hat(i));
+    }
+
+    // Single pass over the stages: u_np1 and the error are not stored
+    const unsigned int n_local_dofs = this->solution_update.locally_owned_elements().n_elements();
+    double local_sum = 0.0;
+    for (unsigned int idof = 0; idof < n_local_dofs; ++idof) {
+        const double u_n = this->solution_update.local_element(idof);
+        double u_np1 = u_n;
+        double error = 0.0;
+        for (int i = 0; i < n_rk_stages; ++i) {
+            const double k_i = this->rk_stage[i].local_element(idof);
+            u_np1 += b[i] * k_i;
+            error += b_minus_b_hat[i] * k_i;
         }
+        const double scale = absolute_tolerance + relative_tolerance * std::max(std::abs(u_n), std::abs(u_np1));
+        local_sum += (error/scale) * (error/scale);
     }
+    const double global_sum = dealii::Utilities::MPI::sum(local_sum, this->mpi_communicator);
+    return sqrt(global_sum / this->solution_update.size());
+}
 
-    // Calculates relaxation parameter and modify the time step size as dt*=relaxation_parameter.
-    // if not using RRK, the relaxation parameter will be set to 1, such that dt is not modified.
-    this->relaxation_parameter_RRK_solver = relaxation_runge_kutta->update_relaxation_parameter(dt, this->dg, this->rk_stage, this->solution_update);
-    dt *= this->relaxation_parameter_RRK_solver;
-    this->modified_time_step = dt;
+template <int dim, typename real, int n_rk_stages, typename MeshType> 
+void RungeKuttaODESolver<dim,real,n_rk_stages,MeshType>::add_stages_to_previous_solution (
+        dealii::LinearAlgebra::distributed::Vector<double> &dst,
+        const std::array<double, n_rk_stages> &coefficients,
+        const int n_terms) const
+{
+    // Gather the stages with nonzero coefficients, such that the inner loop only visits those
+    std::array<double, n_rk_stages> nonzero_coefficients;
+    std::array<const double*, n_rk_stages> stage_values;
+    int n_nonzero = 0;
+    for (int j = 0; j < n_terms; ++j) {
+        if (coefficients[j] == 0.0) continue;
+        nonzero_coefficients[n_nonzero] = coefficients[j];
+        stage_values[n_nonzero] = this->rk_stage[j].begin();
+        ++n_nonzero;
+    }
 
-    //assemble solution from stages
-    for (int i = 0; i < n_rk_stages; ++i){
-        if (pseudotime){
-            const double CFL = this->butcher_tableau->get_b(i) * dt;
-            this->dg->time_scale_solution_update(this->rk_stage[i], CFL);
-            this->solution_update.add(1.0, this->rk_stage[i]);
-        } else {
-            this->solution_update.add(dt* this->butcher_tableau->get_b(i),this->rk_stage[i]); 
+    const double *previous_solution = this->solution_update.begin();
+    double *dst_values = dst.begin();
+    const unsigned int n_local_dofs = this->solution_update.locally_owned_elements().n_elements();
+    for (unsigned int idof = 0; idof < n_local_dofs; ++idof) {
+        double value = previous_solution[idof];
+        for (int j = 0; j < n_nonzero; ++j) {
+            value += nonzero_coefficients[j] * stage_values[j][idof];
         }
+        dst_values[idof] = value;
     }
-    this->dg->solution = this->solution_update; // u_np1 = u_n + dt* sum(k_i * b_i)
-
-    // Calculate numerical entropy with FR correction. Does nothing if use has not selected param.
-    this->FR_entropy_contribution_RRK_solver = relaxation_runge_kutta->compute_FR_entropy_contribution(dt, this->dg, this->rk_stage, true);
+    dst.zero_out_ghosts();
+}
 
-    // Apply limiter at every RK stage
+template <int dim, typename real, int n_rk_stages, typename MeshType> 
+void RungeKuttaODESolver<dim,real,n_rk_stages,MeshType>::apply_limiter ()
+{
     if (this->limiter) {
         this->limiter->limit(this->dg->solution,
             this->dg->dof_handler,
@@ -130,9 +257,6 @@ void RungeKuttaODESolver<dim,real,n_rk_stages,MeshType>::step_in_time (real dt,
             this->dg->oneD_fe_collection_1state,
             this->dg->oneD_quadrature_collection);
     }
-    
-    ++(this->current_iteration);
-    this->current_time += dt;
 }
 
 template <int dim, typename real, int n_rk_stages, typename MeshType> 
@@ -166,21 +290,38 @@ void RungeKuttaODESolver<dim,real,n_rk_stages,MeshType>::allocate_ode_system ()
     for (int i=0; i<n_rk_stages; ++i) {
         if (this->butcher_tableau->get_a(i,i)==0.0)     this->butcher_tableau_aii_is_zero[i] = true;
     }
+
+    this->use_first_same_as_last = this->butcher_tableau->is_first_same_as_last();
+    this->last_stage_solution_fingerprint = VectorFingerprint();
+
+    using PolicyEnum = Parameters::FlowSolverParam::AdaptiveTimeStepPolicy;
+    const Parameters::FlowSolverParam &flow_solver_param = this->all_parameters->flow_solver_param;
+    if (flow_solver_param.adaptive_time_step && flow_solver_param.adaptive_time_step_policy == PolicyEnum::embedded_error) {
+        if (!this->butcher_tableau->has_embedded_method()) {
+            this->pcout << "Error: the embedded_error adaptive time step policy requires an RK method with an embedded method. Aborting..." << std::endl;
+            std::abort();
+        }
+        this->use_embedded_error_control = true;
+        this->previous_error_estimate = 1.0;
+    }
 }
 
 template class RungeKuttaODESolver<PHILIP_DIM, double,1, dealii::Triangulation<PHILIP_DIM> >;
 template class RungeKuttaODESolver<PHILIP_DIM, double,2, dealii::Triangulation<PHILIP_DIM> >;
 template class RungeKuttaODESolver<PHILIP_DIM, double,3, dealii::Triangulation<PHILIP_DIM> >;
 template class RungeKuttaODESolver<PHILIP_DIM, double,4, dealii::Triangulation<PHILIP_DIM> >;
+template class RungeKuttaODESolver<PHILIP_DIM, double,7, dealii::Triangulation<PHILIP_DIM> >;
 template class RungeKuttaODESolver<PHILIP_DIM, double,1, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
 template class RungeKuttaODESolver<PHILIP_DIM, double,2, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
 template class RungeKuttaODESolver<PHILIP_DIM, double,3, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
 template class RungeKuttaODESolver<PHILIP_DIM, double,4, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
+template class RungeKuttaODESolver<PHILIP_DIM, double,7, dealii::parallel::shared::Triangulation<PHILIP_DIM> >;
 #if PHILIP_DIM != 1
     template class RungeKuttaODESolver<PHILIP_DIM, double,1, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
     template class RungeKuttaODESolver<PHILIP_DIM, double,2, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
     template class RungeKuttaODESolver<PHILIP_DIM, double,3, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
     template class RungeKuttaODESolver<PHILIP_DIM, double,4, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
+    template class RungeKuttaODESolver<PHILIP_DIM, double,7, dealii::parallel::distributed::Triangulation<PHILIP_DIM> >;
 #endif
 
 } // ODESolver namespace
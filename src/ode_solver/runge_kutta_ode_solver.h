@@ -1,8 +1,11 @@
 #ifndef __RUNGE_KUTTA_ODESOLVER__
 #define __RUNGE_KUTTA_ODESOLVER__
 
+#include <array>
+
 #include "JFNK_solver/JFNK_solver.h"
 #include "dg/dg_base.hpp"
+#include "vector_fingerprint.hpp"
 #include "ode_solver_base.h"
 #include "runge_kutta_methods/rk_tableau_base.h"
 #include "relaxation_runge_kutta/empty_RRK_base.h"
@@ -11,6 +14,12 @@ namespace PHiLiP {
 namespace ODE {
 
 /// Runge-Kutta ODE solver (explicit or implicit) derived from ODESolver.
+/** For methods with an embedded method, and the embedded_error adaptive time step policy of the flow solver,
+ *  the step is rejected and retried with a smaller time step while its error estimate exceeds the tolerances,
+ *  and the next time step is set by a PI controller in ODESolverBase::error_controlled_time_step.
+ *  For first-same-as-last methods, the first stage of a step reuses the last stage of the previous
+ *  step when the solution has not changed since that stage was evaluated.
+ */
 #if PHILIP_DIM==1
 template <int dim, typename real, int n_rk_stages, typename MeshType = dealii::Triangulation<dim>>
 #else
@@ -48,6 +57,46 @@ protected:
     
     /// Indicator for zero diagonal elements; used to toggle implicit solve.
     std::vector<bool> butcher_tableau_aii_is_zero;
+
+    /// Whether the steps are controlled by the error estimate of the embedded method
+    bool use_embedded_error_control = false;
+
+    /// Error estimate of the last accepted step, for the integral part of the PI controller
+    double previous_error_estimate = 1.0;
+
+    /// Whether the method is first same as last, such that its last stage can be reused
+    bool use_first_same_as_last = false;
+
+    /// Solution at which the last stage was evaluated, for first-same-as-last methods
+    /** The last stage is only reused if the solution at the start of the step is the same,
+     *  i.e. neither the limiter, the relaxation nor the caller modified it since then.
+     */
+    VectorFingerprint last_stage_solution_fingerprint;
+
+    /// Time at which the last stage was evaluated, for first-same-as-last methods
+    double last_stage_time = 0.0;
+
+    /// Computes the stages from first_stage onwards, with u_n stored in solution_update
+    /** On return, rk_stage[i] stores the inverse mass matrix applied to the right-hand side at stage i. */
+    void compute_stages(const real dt, const bool pseudotime, const int first_stage);
+
+    /// Weighted RMS norm of the difference between the solutions of the method and of its embedded method
+    /** Computed entry by entry from the stored stages, with weights from u_n and u_np1,
+     *  such that a value below 1 satisfies the tolerances.
+     */
+    double compute_embedded_error_estimate(const real dt) const;
+
+    /// Applies the limiter, if any, to the DG solution
+    void apply_limiter();
+
+    /// Sets dst = u_n + sum_j coefficients[j] * rk_stage[j] over the first n_terms stages, in a single pass
+    /** u_n is read from solution_update. Each input is read once and each locally owned entry of dst
+     *  is written once, instead of one memory pass per vector operation. The ghost values of dst are zeroed.
+     */
+    void add_stages_to_previous_solution(
+            dealii::LinearAlgebra::distributed::Vector<double> &dst,
+            const std::array<double, n_rk_stages> &coefficients,
+            const int n_terms) const;
 };
 
 } // ODE namespace
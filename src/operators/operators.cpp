@@ -33,6 +33,7 @@
 #include <CoDiPack/include/codi.hpp>
 
 #include "operators.h"
+#include "sum_factorization_kernels.h"
 
 namespace PHiLiP {
 namespace OPERATOR {
@@ -222,86 +223,12 @@ void SumFactorizedOperators<dim,n_faces,real>::matrix_vector_mult(
         assert(columns_x * columns_y * columns_z == input_vect.size());
     }
 
-    if constexpr (dim==1){
-        for(unsigned int iquad=0; iquad<rows_x; iquad++){
-            if(!adding)
-                output_vect[iquad] = 0.0;
-            for(unsigned int jquad=0; jquad<columns_x; jquad++){
-                output_vect[iquad] += factor * basis_x[iquad][jquad] * input_vect[jquad];
-            }
-        }
-    }
-    if constexpr (dim==2){
-        //convert the input vector to matrix
-        dealii::FullMatrix<double> input_mat(columns_x, columns_y);
-        for(unsigned int idof=0; idof<columns_y; idof++){ 
-            for(unsigned int jdof=0; jdof<columns_x; jdof++){ 
-                input_mat[jdof][idof] = input_vect[idof * columns_x + jdof];//jdof runs fastest (x) idof slowest (y)
-            }
-        }
-        dealii::FullMatrix<double> temp(rows_x, columns_y);
-        basis_x.mmult(temp, input_mat);//apply x tensor product
-        dealii::FullMatrix<double> output_mat(rows_y, rows_x);
-        basis_y.mTmult(output_mat, temp);//apply y tensor product
-        //convert mat back to vect
-        for(unsigned int iquad=0; iquad<rows_y; iquad++){
-            for(unsigned int jquad=0; jquad<rows_x; jquad++){
-                if(adding)
-                    output_vect[iquad * rows_x + jquad] += factor * output_mat[iquad][jquad];
-                else
-                    output_vect[iquad * rows_x + jquad] = factor * output_mat[iquad][jquad];
-            }
-        }
-
-    }
-    if constexpr (dim==3){
-        //convert vect to mat first
-        dealii::FullMatrix<double> input_mat(columns_x, columns_y * columns_z);
-        for(unsigned int idof=0; idof<columns_z; idof++){ 
-            for(unsigned int jdof=0; jdof<columns_y; jdof++){ 
-                for(unsigned int kdof=0; kdof<columns_x; kdof++){
-                    const unsigned int dof_index = idof * columns_x * columns_y + jdof * columns_x + kdof;
-                    input_mat[kdof][idof * columns_y + jdof] = input_vect[dof_index];//kdof runs fastest (x) idof slowest (z)
-                }
-            }
-        }
-        dealii::FullMatrix<double> temp(rows_x, columns_y * columns_z);
-        basis_x.mmult(temp, input_mat);//apply x tensor product
-        //convert to have y dofs ie/ change the stride
-        dealii::FullMatrix<double> temp2(columns_y, rows_x * columns_z);
-        for(unsigned int iquad=0; iquad<rows_x; iquad++){
-            for(unsigned int idof=0; idof<columns_z; idof++){
-                for(unsigned int jdof=0; jdof<columns_y; jdof++){
-                    temp2[jdof][iquad * columns_z + idof] = temp[iquad][idof * columns_y + jdof];//extract y runs second fastest
-                }
-            }
-        }
-        dealii::FullMatrix<double> temp3(rows_y, rows_x * columns_z);
-        basis_y.mmult(temp3, temp2);//apply y tensor product
-        dealii::FullMatrix<double> temp4(columns_z, rows_x * rows_y);
-        //convert to have z dofs ie/ change the stride
-        for(unsigned int iquad=0; iquad<rows_x; iquad++){
-            for(unsigned int idof=0; idof<columns_z; idof++){
-                for(unsigned int jquad=0; jquad<rows_y; jquad++){
-                    temp4[idof][iquad * rows_y + jquad] = temp3[jquad][iquad * columns_z + idof];//extract z runs slowest
-                }
-            }
-        }
-        dealii::FullMatrix<double> output_mat(rows_z, rows_x * rows_y);
-        basis_z.mmult(output_mat, temp4);
-        //convert mat to vect
-        for(unsigned int iquad=0; iquad<rows_z; iquad++){
-            for(unsigned int jquad=0; jquad<rows_y; jquad++){
-                for(unsigned int kquad=0; kquad<rows_x; kquad++){
-                    const unsigned int quad_index = iquad * rows_x * rows_y + jquad * rows_x + kquad;
-                    if(adding)
-                        output_vect[quad_index] += factor * output_mat[iquad][kquad * rows_y + jquad];
-                    else
-                        output_vect[quad_index] = factor * output_mat[iquad][kquad * rows_y + jquad];
-                }
-            }
-        }
-    }
+    //contract one direction at a time with the compile-time-sized kernels;
+    //no temporaries are allocated after the first call on a thread
+    SumFactorizationKernels::tensor_product_mult<dim,false,real>(
+        input_vect.data(), output_vect.data(),
+        basis_x, basis_y, basis_z,
+        adding, factor);
 }
 
 template <int dim, int n_faces, typename real>  
@@ -490,34 +417,73 @@ void SumFactorizedOperators<dim,n_faces,real>::inner_product(
     }
     assert(weight_vect.size() == input_vect.size()); 
 
-    dealii::FullMatrix<double> basis_x_trans(columns_x, rows_x);
-    dealii::FullMatrix<double> basis_y_trans(columns_y, rows_y);
-    dealii::FullMatrix<double> basis_z_trans(columns_z, rows_z);
-
-    //set as the transpose as inputed basis
-    //found an issue with Tadd for arbitrary size so I manually do it here.
-    for(unsigned int row=0; row<rows_x; row++){
-        for(unsigned int col=0; col<columns_x; col++){
-            basis_x_trans[col][row] = basis_x[row][col];
-        }
-    }
-    for(unsigned int row=0; row<rows_y; row++){
-        for(unsigned int col=0; col<columns_y; col++){
-            basis_y_trans[col][row] = basis_y[row][col];
-        }
-    }
-    for(unsigned int row=0; row<rows_z; row++){
-        for(unsigned int col=0; col<columns_z; col++){
-            basis_z_trans[col][row] = basis_z[row][col];
-        }
+    //weight the input in a thread_local buffer, then apply the transposed basis
+    //directly in the kernels instead of building the transposed matrices
+    real *weighted_input = SumFactorizationKernels::scratch_buffer<real>(2, input_vect.size());
+    for(unsigned int iquad=0; iquad<input_vect.size(); iquad++){
+        weighted_input[iquad] = input_vect[iquad] * weight_vect[iquad];
     }
 
-    std::vector<double> new_input_vect(input_vect.size());
-    for(unsigned int iquad=0; iquad<input_vect.size(); iquad++){
-        new_input_vect[iquad] = input_vect[iquad] * weight_vect[iquad];
+    SumFactorizationKernels::tensor_product_mult<dim,true,real>(
+        weighted_input, output_vect.data(),
+        basis_x, basis_y, basis_z,
+        adding, factor);
+}
+
+template <int dim, int n_faces, typename real>  
+void SumFactorizedOperators<dim,n_faces,real>::matrix_vector_mult_interleaved(
+    const std::vector<real> &input_vect,
+    std::vector<real> &output_vect,
+    const dealii::FullMatrix<double> &basis_x,
+    const dealii::FullMatrix<double> &basis_y,
+    const dealii::FullMatrix<double> &basis_z,
+    const unsigned int n_lanes,
+    const bool adding,
+    const double factor)
+{
+    const unsigned int n_rows    = (dim == 1) ? basis_x.m() : ((dim == 2) ? basis_x.m() * basis_y.m() : basis_x.m() * basis_y.m() * basis_z.m());
+    const unsigned int n_columns = (dim == 1) ? basis_x.n() : ((dim == 2) ? basis_x.n() * basis_y.n() : basis_x.n() * basis_y.n() * basis_z.n());
+    assert(n_rows * n_lanes    == output_vect.size());
+    assert(n_columns * n_lanes == input_vect.size());
+    (void) n_rows;
+    (void) n_columns;
+
+    SumFactorizationKernels::tensor_product_mult<dim,false,real>(
+        input_vect.data(), output_vect.data(),
+        basis_x, basis_y, basis_z,
+        adding, factor, n_lanes);
+}
+
+template <int dim, int n_faces, typename real>  
+void SumFactorizedOperators<dim,n_faces,real>::inner_product_interleaved(
+    const std::vector<real> &input_vect,
+    const std::vector<real> &weight_vect,
+    std::vector<real> &output_vect,
+    const dealii::FullMatrix<double> &basis_x,
+    const dealii::FullMatrix<double> &basis_y,
+    const dealii::FullMatrix<double> &basis_z,
+    const unsigned int n_lanes,
+    const bool adding,
+    const double factor)
+{
+    const unsigned int n_points = weight_vect.size();
+    assert(n_points * n_lanes == input_vect.size());
+
+    //weight every lane of a point by the same weight in a thread_local buffer
+    real *weighted_input = SumFactorizationKernels::scratch_buffer<real>(2, input_vect.size());
+    for(unsigned int ipoint=0; ipoint<n_points; ipoint++){
+        const real weight = weight_vect[ipoint];
+        const real *input_point = &input_vect[ipoint * n_lanes];
+        real *weighted_point = weighted_input + ipoint * n_lanes;
+        for(unsigned int ilane=0; ilane<n_lanes; ilane++){
+            weighted_point[ilane] = input_point[ilane] * weight;
+        }
     }
 
-    this->matrix_vector_mult(new_input_vect, output_vect, basis_x_trans, basis_y_trans, basis_z_trans, adding, factor);
+    SumFactorizationKernels::tensor_product_mult<dim,true,real>(
+        weighted_input, output_vect.data(),
+        basis_x, basis_y, basis_z,
+        adding, factor, n_lanes);
 }
 
 template <int dim, int n_faces, typename real>  
@@ -1172,6 +1138,36 @@ void basis_functions<dim,n_faces,real>::build_1D_surface_gradient_operator(
     }
 }
 
+template <int dim, int n_faces, typename real>  
+void basis_functions<dim,n_faces,real>::build_surface_Hadamard_operators(
+    const dealii::Quadrature<1> &quadrature)
+{
+    const unsigned int n_quad_pts_1D   = quadrature.size();
+    const unsigned int n_face_quad_pts = pow(n_quad_pts_1D, dim-1);
+    const std::vector<double> &quad_weights = quadrature.get_weights ();
+    //loop and store
+    for(unsigned int iface=0; iface<n_faces; iface++){
+        const int dim_not_zero = iface / 2;//reference direction of face integer division
+        const int iface_1D = iface % 2;//the reference face number
+        //allocate
+        surf_Hadamard_rows_sparsity[iface].resize(n_face_quad_pts * n_quad_pts_1D);
+        surf_Hadamard_columns_sparsity[iface].resize(n_face_quad_pts * n_quad_pts_1D);
+        surf_oper_Hadamard_sparse[iface].reinit(n_face_quad_pts, n_quad_pts_1D);
+        //solve
+        this->sum_factorized_Hadamard_surface_sparsity_pattern(n_face_quad_pts, n_quad_pts_1D,
+                                                               surf_Hadamard_rows_sparsity[iface],
+                                                               surf_Hadamard_columns_sparsity[iface],
+                                                               dim_not_zero);
+        this->sum_factorized_Hadamard_surface_basis_assembly(n_face_quad_pts, n_quad_pts_1D,
+                                                             surf_Hadamard_rows_sparsity[iface],
+                                                             surf_Hadamard_columns_sparsity[iface],
+                                                             this->oneD_surf_operator[iface_1D],
+                                                             quad_weights,
+                                                             surf_oper_Hadamard_sparse[iface],
+                                                             dim_not_zero);
+    }
+}
+
 template <int dim, int n_faces, typename real>  
 vol_integral_basis<dim,n_faces,real>::vol_integral_basis(
     const int nstate_input,
@@ -1338,6 +1334,19 @@ void local_basis_stiffness<dim,n_faces,real>::build_1D_volume_operator(
                                                     - this->oneD_vol_operator[jdof][idof];
             }
         }
+        //store the "sum-factorized" Hadamard product form, it only depends on the number of 1D nodes.
+        const unsigned int n_quad_pts_dim = pow(n_quad_pts, dim);
+        Hadamard_rows_sparsity.resize(n_quad_pts_dim * n_quad_pts);
+        Hadamard_columns_sparsity.resize(n_quad_pts_dim * n_quad_pts);
+        this->sum_factorized_Hadamard_sparsity_pattern(n_quad_pts, n_quad_pts, Hadamard_rows_sparsity, Hadamard_columns_sparsity);
+        for(int idim=0; idim<dim; idim++){
+            skew_symm_vol_oper_Hadamard_sparse[idim].reinit(n_quad_pts_dim, n_quad_pts);
+        }
+        this->sum_factorized_Hadamard_basis_assembly(n_quad_pts, n_quad_pts,
+                                                     Hadamard_rows_sparsity, Hadamard_columns_sparsity,
+                                                     oneD_skew_symm_vol_oper,
+                                                     quad_weights,
+                                                     skew_symm_vol_oper_Hadamard_sparse);
     }
 }
 
@@ -340,6 +340,35 @@ public:
             const double factor = 1.0);
 
 
+    /// Applies matrix_vector_mult() to n_lanes vectors stored interleaved.
+    /** Entry ipoint * n_lanes + ilane of input_vect and output_vect belongs to the vector of lane ilane,
+    * as for the batches of cells assembled together in the style of deal.II's VectorizedArray.
+    * Every contraction then runs over contiguous rows of at least n_lanes values.
+    */
+    void matrix_vector_mult_interleaved(
+            const std::vector<real> &input_vect,
+            std::vector<real> &output_vect,
+            const dealii::FullMatrix<double> &basis_x,
+            const dealii::FullMatrix<double> &basis_y,
+            const dealii::FullMatrix<double> &basis_z,
+            const unsigned int n_lanes,
+            const bool adding = false,
+            const double factor = 1.0);
+
+    /// Applies inner_product() to n_lanes vectors stored interleaved as in matrix_vector_mult_interleaved().
+    /** The weights are not interleaved; each weight applies to the same point of all the lanes.
+    */
+    void inner_product_interleaved(
+            const std::vector<real> &input_vect,
+            const std::vector<real> &weight_vect,
+            std::vector<real> &output_vect,
+            const dealii::FullMatrix<double> &basis_x,
+            const dealii::FullMatrix<double> &basis_y,
+            const dealii::FullMatrix<double> &basis_z,
+            const unsigned int n_lanes,
+            const bool adding = false,
+            const double factor = 1.0);
+
     ///Computes a single Hadamard product. 
     /** For input mat1 \f$ A \f$ and input mat2 \f$ B \f$, this computes
     * \f$ A \circ B = C \implies \left( C \right)_{ij} = \left( A \right)_{ij}\left( B \right)_{ij}\f$.
@@ -409,6 +438,24 @@ public:
     void build_1D_surface_gradient_operator(
             const dealii::FESystem<1,1> &finite_element,
             const dealii::Quadrature<0> &quadrature);
+
+    /// Assembles the surface operators in the "sum-factorized" Hadamard product form for each face.
+    /** Requires oneD_surf_operator to be built first. The quadrature is the 1D volume quadrature
+    *   the basis was built on, whose weights scale the surface operator.
+    *   Since the tables only depend on the number of 1D quadrature nodes, they are built once per degree
+    *   instead of on every face of every cell.
+    */
+    void build_surface_Hadamard_operators(
+            const dealii::Quadrature<1> &quadrature);
+
+    /// Non-zero row indices of the surface "sum-factorized" Hadamard product for each face.
+    std::array<std::vector<unsigned int>,n_faces> surf_Hadamard_rows_sparsity;
+
+    /// Non-zero column indices of the surface "sum-factorized" Hadamard product for each face.
+    std::array<std::vector<unsigned int>,n_faces> surf_Hadamard_columns_sparsity;
+
+    /// The \f$ n^{d-1} \times n\f$ surface operator storing the non-zero entries of the "sum-factorized" Hadamard product for each face.
+    std::array<dealii::FullMatrix<double>,n_faces> surf_oper_Hadamard_sparse;
 };
 
 ///\f$ \mathbf{W}*\mathbf{\chi}(\mathbf{\xi}_v^r) \f$  That is Quadrature Weights multiplies with basis_at_vol_cubature.
@@ -492,6 +539,21 @@ public:
 
     /// Skew-symmetric volume operator \f$S-S^T\f$.
     dealii::FullMatrix<double> oneD_skew_symm_vol_oper;
+
+    /// Non-zero row indices of the volume "sum-factorized" Hadamard product, size \f$n^{d+1}\f$.
+    /** Only built with the skew-symmetric form.
+    */
+    std::vector<std::array<unsigned int,dim>> Hadamard_rows_sparsity;
+
+    /// Non-zero column indices of the volume "sum-factorized" Hadamard product, size \f$n^{d+1}\f$.
+    /** Only built with the skew-symmetric form.
+    */
+    std::vector<std::array<unsigned int,dim>> Hadamard_columns_sparsity;
+
+    /// Skew-symmetric volume operator in the \f$ n^d \times n\f$ "sum-factorized" Hadamard product form for each reference direction.
+    /** Only built with the skew-symmetric form.
+    */
+    std::array<dealii::FullMatrix<double>,dim> skew_symm_vol_oper_Hadamard_sparse;
 };
 
 ///This is the solution basis \f$\mathbf{D}_i\f$, the modal differential opertaor commonly seen in DG defined as \f$\mathbf{D}_i=\mathbf{M}^{-1}*\mathbf{S}_i\f$.
@@ -0,0 +1,191 @@
+#ifndef __SUM_FACTORIZATION_KERNELS_H__
+#define __SUM_FACTORIZATION_KERNELS_H__
+
+#include <array>
+#include <vector>
+
+#include <deal.II/lac/full_matrix.h>
+
+namespace PHiLiP {
+namespace OPERATOR {
+
+/// Allocation-free tensor-contraction kernels used by SumFactorizedOperators.
+/** A tensor-product operator \f$ B_z \otimes B_y \otimes B_x \f$ is applied one direction at a time.
+ *  Each direction is a contraction of the 1D basis against the index of that direction,
+ *  written straight into the layout expected by the next direction, so no strided re-ordering
+ *  copies of the data are made (x runs fastest, z slowest, as in the rest of the operators).
+ *
+ *  The 1D sizes are template parameters for the common square \f$ n \times n \f$ and facet
+ *  \f$ 1 \times n \f$ (or \f$ n \times 1 \f$) bases up to max_static_size_1D, selected at runtime from the
+ *  basis dimensions. For those the 1D basis is copied to the stack in the orientation it is
+ *  applied in, which also takes care of the transpose needed by the inner product, and the
+ *  contraction loops are fully unrolled by the compiler. Other sizes use the same loops with
+ *  runtime bounds. Intermediate results live in grow-only thread_local buffers, so that after
+ *  the first call on a thread no memory is allocated.
+ */
+namespace SumFactorizationKernels {
+
+/// Largest 1D size (number of 1D nodes or dofs) with a compile-time-sized kernel.
+constexpr unsigned int max_static_size_1D = 10;
+
+/// Returns a thread_local scratch buffer holding at least n_entries values.
+/** Three independent slots are available so that callers can keep an input buffer alive while
+ *  the contraction uses the other two.
+ */
+template <typename real>
+inline real * scratch_buffer(const unsigned int slot, const unsigned int n_entries)
+{
+    thread_local std::array<std::vector<real>,3> buffers;
+    std::vector<real> &buffer = buffers[slot];
+    if(buffer.size() < n_entries) buffer.resize(n_entries);
+    return buffer.data();
+}
+
+/// Contracts one direction of the tensor.
+/** With \f$ r,c \f$ the rows and columns of the (possibly transposed) 1D basis,
+ *  \f[ out[(post \cdot r_{tot} + r) \cdot n_{pre} + pre] = (adding ? out : 0) + factor \sum_c B(r,c)\, in[(post \cdot c_{tot} + c) \cdot n_{pre} + pre] \f]
+ *  where n_pre is the product of the sizes of the faster directions and n_post of the slower ones.
+ *  A static size of 0 means the size is only known at runtime.
+ */
+template <unsigned int n_rows_static, unsigned int n_columns_static, bool transpose, typename real>
+inline void contract_direction(
+    const dealii::FullMatrix<double> &basis,
+    const real *input,
+    real *output,
+    const unsigned int n_pre,
+    const unsigned int n_post,
+    const bool adding,
+    const double factor)
+{
+    const unsigned int n_rows    = (n_rows_static > 0)    ? n_rows_static    : (transpose ? basis.n() : basis.m());
+    const unsigned int n_columns = (n_columns_static > 0) ? n_columns_static : (transpose ? basis.m() : basis.n());
+    const unsigned int stride = basis.n();
+    const double *basis_ptr = &basis(0,0);
+
+    // Basis in the orientation it is applied in. Stack-allocated for the static sizes.
+    constexpr bool is_static = (n_rows_static > 0) && (n_columns_static > 0);
+    constexpr unsigned int n_static_entries = is_static ? n_rows_static * n_columns_static : 1;
+    std::array<double, n_static_entries> basis_static;
+    if constexpr (is_static) {
+        for(unsigned int r=0; r<n_rows; ++r){
+            for(unsigned int c=0; c<n_columns; ++c){
+                basis_static[r*n_columns + c] = transpose ? basis_ptr[c*stride + r] : basis_ptr[r*stride + c];
+            }
+        }
+    }
+    auto basis_entry = [&](const unsigned int r, const unsigned int c) -> double {
+        if constexpr (is_static) return basis_static[r*n_columns + c];
+        else return transpose ? basis_ptr[c*stride + r] : basis_ptr[r*stride + c];
+    };
+
+    if(n_pre == 1) {
+        // Contiguous contraction index: plain dot products.
+        for(unsigned int post=0; post<n_post; ++post){
+            const real *in_post = input + post * n_columns;
+            real *out_post = output + post * n_rows;
+            for(unsigned int r=0; r<n_rows; ++r){
+                real sum = 0.0;
+                for(unsigned int c=0; c<n_columns; ++c){
+                    sum += basis_entry(r,c) * in_post[c];
+                }
+                out_post[r] = adding ? out_post[r] + factor * sum : factor * sum;
+            }
+        }
+        return;
+    }
+    // Strided contraction index: accumulate whole contiguous rows of length n_pre.
+    for(unsigned int post=0; post<n_post; ++post){
+        const real *in_post = input + post * n_columns * n_pre;
+        real *out_post = output + post * n_rows * n_pre;
+        for(unsigned int r=0; r<n_rows; ++r){
+            real *out_row = out_post + r * n_pre;
+            if(!adding) {
+                for(unsigned int pre=0; pre<n_pre; ++pre) out_row[pre] = 0.0;
+            }
+            for(unsigned int c=0; c<n_columns; ++c){
+                const double scaled_entry = factor * basis_entry(r,c);
+                const real *in_row = in_post + c * n_pre;
+                for(unsigned int pre=0; pre<n_pre; ++pre){
+                    out_row[pre] += scaled_entry * in_row[pre];
+                }
+            }
+        }
+    }
+}
+
+/// Selects the compile-time-sized contraction matching the basis dimensions, or the runtime-sized one.
+template <unsigned int n_1D, bool transpose, typename real>
+inline void contract_direction_dispatch(
+    const dealii::FullMatrix<double> &basis,
+    const real *input,
+    real *output,
+    const unsigned int n_pre,
+    const unsigned int n_post,
+    const bool adding,
+    const double factor)
+{
+    if constexpr (n_1D > max_static_size_1D) {
+        contract_direction<0,0,transpose,real>(basis, input, output, n_pre, n_post, adding, factor);
+    } else {
+        const unsigned int n_rows    = transpose ? basis.n() : basis.m();
+        const unsigned int n_columns = transpose ? basis.m() : basis.n();
+        if(n_rows == n_1D && n_columns == n_1D)
+            contract_direction<n_1D,n_1D,transpose,real>(basis, input, output, n_pre, n_post, adding, factor);
+        else if(n_rows == 1 && n_columns == n_1D)
+            contract_direction<1,n_1D,transpose,real>(basis, input, output, n_pre, n_post, adding, factor);
+        else if(n_rows == n_1D && n_columns == 1)
+            contract_direction<n_1D,1,transpose,real>(basis, input, output, n_pre, n_post, adding, factor);
+        else
+            contract_direction_dispatch<n_1D+1,transpose,real>(basis, input, output, n_pre, n_post, adding, factor);
+    }
+}
+
+/// Applies the tensor-product operator built from basis_x, basis_y and basis_z to input.
+/** If transpose is true, the transposed 1D bases are applied (used by the inner product).
+ *  The output is overwritten, or added to if adding is true, and scaled by factor.
+ *  The input and output may be the same vector for dim > 1.
+ *
+ *  With n_lanes > 1, input and output hold n_lanes vectors interleaved, entry
+ *  ipoint * n_lanes + ilane belonging to lane ilane. The lanes are then the fastest index
+ *  of every contraction, such that all directions run over contiguous rows of at least
+ *  n_lanes values.
+ */
+template <int dim, bool transpose, typename real>
+inline void tensor_product_mult(
+    const real *input,
+    real *output,
+    const dealii::FullMatrix<double> &basis_x,
+    const dealii::FullMatrix<double> &basis_y,
+    const dealii::FullMatrix<double> &basis_z,
+    const bool adding,
+    const double factor,
+    const unsigned int n_lanes = 1)
+{
+    if constexpr (dim == 1) {
+        contract_direction_dispatch<1,transpose,real>(basis_x, input, output, n_lanes, 1, adding, factor);
+    }
+    if constexpr (dim == 2) {
+        const unsigned int rows_x    = transpose ? basis_x.n() : basis_x.m();
+        const unsigned int columns_y = transpose ? basis_y.m() : basis_y.n();
+        real *temp = scratch_buffer<real>(0, rows_x * columns_y * n_lanes);
+        contract_direction_dispatch<1,transpose,real>(basis_x, input, temp, n_lanes, columns_y, false, 1.0);
+        contract_direction_dispatch<1,transpose,real>(basis_y, temp, output, rows_x * n_lanes, 1, adding, factor);
+    }
+    if constexpr (dim == 3) {
+        const unsigned int rows_x    = transpose ? basis_x.n() : basis_x.m();
+        const unsigned int rows_y    = transpose ? basis_y.n() : basis_y.m();
+        const unsigned int columns_y = transpose ? basis_y.m() : basis_y.n();
+        const unsigned int columns_z = transpose ? basis_z.m() : basis_z.n();
+        real *temp_x  = scratch_buffer<real>(0, rows_x * columns_y * columns_z * n_lanes);
+        real *temp_xy = scratch_buffer<real>(1, rows_x * rows_y * columns_z * n_lanes);
+        contract_direction_dispatch<1,transpose,real>(basis_x, input, temp_x, n_lanes, columns_y * columns_z, false, 1.0);
+        contract_direction_dispatch<1,transpose,real>(basis_y, temp_x, temp_xy, rows_x * n_lanes, columns_z, false, 1.0);
+        contract_direction_dispatch<1,transpose,real>(basis_z, temp_xy, output, rows_x * rows_y * n_lanes, 1, adding, factor);
+    }
+}
+
+} /// SumFactorizationKernels namespace
+} /// OPERATOR namespace
+} /// PHiLiP namespace
+
+#endif
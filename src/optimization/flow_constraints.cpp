@@ -282,7 +282,7 @@ int FlowConstraints<dim>
     const bool compute_dRdW=true; const bool compute_dRdX=false; const bool compute_d2R=false;
     dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R, flow_CFL_);
 
-    Epetra_CrsMatrix * adjoint_jacobian = const_cast<Epetra_CrsMatrix *>(&(dg->system_matrix_transpose.trilinos_matrix()));
+    Epetra_CrsMatrix * adjoint_jacobian = const_cast<Epetra_CrsMatrix *>(&(dg->get_system_matrix_transpose().trilinos_matrix()));
 
     destroy_AdjointJacobianPreconditioner_1();
     Ifpack Factory;
@@ -361,10 +361,10 @@ void FlowConstraints<dim>
     auto &output_vector_v = ROL_vector_to_dealii_vector_reference(output_vector);
 
     Epetra_Vector input_trilinos(View,
-                    dg->system_matrix_transpose.trilinos_matrix().DomainMap(),
+                    dg->get_system_matrix_transpose().trilinos_matrix().DomainMap(),
                     input_vector_v.begin());
     Epetra_Vector output_trilinos(View,
-                    dg->system_matrix_transpose.trilinos_matrix().RangeMap(),
+                    dg->get_system_matrix_transpose().trilinos_matrix().RangeMap(),
                     output_vector_v.begin());
     adjoint_jacobian_prec->ApplyInverse (input_trilinos, output_trilinos);
 
@@ -394,7 +394,7 @@ double& /*tol*/ )
     auto input_vector_v = ROL_vector_to_dealii_vector_reference(input_vector);
     auto &output_vector_v = ROL_vector_to_dealii_vector_reference(output_vector);
 
-    solve_linear (dg->system_matrix_transpose, input_vector_v, output_vector_v, this->linear_solver_param);
+    solve_linear (dg->get_system_matrix_transpose(), input_vector_v, output_vector_v, this->linear_solver_param);
 
 }
 
@@ -145,6 +145,31 @@ void AllParameters::declare_parameters (dealii::ParameterHandler &prm)
                       dealii::Patterns::Bool(),
                       "Check validty of metric Jacobian when high-order grid is constructed by default. Do not check if false. Not checking is useful if the metric terms are built on the fly with operators, it reduces the memory cost for high polynomial grids. The metric Jacobian is never checked for strong form, regardless of the user input.");
 
+    prm.declare_entry("use_metric_terms_cache", "false",
+                      dealii::Patterns::Bool(),
+                      "Build the metric terms on-the-fly by default. If true, store the metric cofactor matrix, the determinant of the metric Jacobian and the flux nodes of every cell, and only rebuild them when the grid nodes change. Only used in strong form.");
+
+    prm.declare_entry("use_cell_batched_residual", "false",
+                      dealii::Patterns::Bool(),
+                      "Assemble the explicit strong-form residual cell by cell by default. "
+                      "If true, the locally owned cells of uniform-p Cartesian meshes with only interior or periodic faces are assembled in batches of cells "
+                      "with their solution and fluxes interleaved across the cells of a batch. Falls back to the cell-by-cell assembly for any other mesh or discretization.");
+
+    prm.declare_entry("overlap_ghost_exchange", "false",
+                      dealii::Patterns::Bool(),
+                      "Exchange the ghost values of the explicit residual assembly before and after the cell loop by default. "
+                      "If true, the locally owned cells without neighbors on other processors are assembled while the ghost values of the solution "
+                      "(or of the auxiliary solution) are exchanged, and the inverse mass matrix is applied to them while the right-hand side is compressed. "
+                      "Only used by the single-threaded cell-by-cell assembly without artificial dissipation or physics model.");
+
+    prm.declare_entry("n_threads_per_process", "1",
+                      dealii::Patterns::Integer(1, 1024),
+                      "Number of threads used by each MPI process to assemble the residual and its derivatives. "
+                      "A value larger than 1 colors the locally owned cells such that cells sharing a face have different colors. "
+                      "The colors are assembled one after the other, each color being split between the threads. "
+                      "The weak-form dRdW, dRdX and d2R are recorded on the global CoDiPack tape and assembled by a single thread. "
+                      "The threaded residual is equal to the serial one up to round-off since the summation order of the face contributions changes.");
+
     prm.declare_entry("energy_file", "energy_file",
                       dealii::Patterns::FileName(dealii::Patterns::FileName::FileType::input),
                       "Input file for energy test.");
@@ -336,6 +361,7 @@ void AllParameters::declare_parameters (dealii::ParameterHandler &prm)
                       "Note: Currently only used in weak dg.");
 
     Parameters::LinearSolverParam::declare_parameters (prm);
+    Parameters::PMultigridParam::declare_parameters (prm);
     Parameters::ManufacturedConvergenceStudyParam::declare_parameters (prm);
     Parameters::ODESolverParam::declare_parameters (prm);
     Parameters::EulerParam::declare_parameters (prm);
@@ -448,6 +474,10 @@ const std::string test_string = prm.get("test_type");
     if(!use_weak_form){
         check_valid_metric_Jacobian = false;
     }
+    use_metric_terms_cache = prm.get_bool("use_metric_terms_cache");
+    use_cell_batched_residual = prm.get_bool("use_cell_batched_residual");
+    overlap_ghost_exchange = prm.get_bool("overlap_ghost_exchange");
+    n_threads_per_process = prm.get_integer("n_threads_per_process");
 
     energy_file = prm.get("energy_file");
 
@@ -514,8 +544,16 @@ const std::string test_string = prm.get("test_type");
     pcout << "Parsing linear solver subsection..." << std::endl;
     linear_solver_param.parse_parameters (prm);
 
+    pcout << "Parsing p-multigrid subsection..." << std::endl;
+    p_multigrid_param.parse_parameters (prm);
+
     pcout << "Parsing ODE solver subsection..." << std::endl;
     ode_solver_param.parse_parameters (prm);
+    // The lagged_jacobian preconditioner assembles dRdW within the sparsity pattern allocated with it.
+    // The cell_block_jacobi one only evaluates the cell diagonal blocks, and coarse_degree allocates its own discretization.
+    if (linear_solver_param.jfnk_preconditioner == LinearSolverParam::JFNKPreconditionerEnum::lagged_jacobian) {
+        ode_solver_param.allocate_matrix_dRdW = true;
+    }
 
     pcout << "Parsing manufactured convergence study subsection..." << std::endl;
     manufactured_convergence_study_param.parse_parameters (prm);
@@ -8,6 +8,7 @@
 #include "parameters.h"
 #include "parameters/parameters_ode_solver.h"
 #include "parameters/parameters_linear_solver.h"
+#include "parameters/parameters_p_multigrid.h"
 #include "parameters/parameters_manufactured_convergence_study.h"
 
 #include "parameters/parameters_euler.h"
@@ -41,6 +42,8 @@ public:
     ODESolverParam ode_solver_param;
     /// Contains parameters for linear solver
     LinearSolverParam linear_solver_param;
+    /// Contains parameters for the polynomial multigrid
+    PMultigridParam p_multigrid_param;
     /// Contains parameters for the Euler equations non-dimensionalization
     EulerParam euler_param;
     /// Contains parameters for the Navier-Stokes equations non-dimensionalization
@@ -152,6 +155,18 @@ public:
     /// Flag to check if the metric Jacobian is valid when high-order grid is constructed.
     bool check_valid_metric_Jacobian;
 
+    /// Flag to store the metric terms of every cell instead of building them on-the-fly.
+    bool use_metric_terms_cache;
+
+    /// Flag to assemble the explicit strong-form residual of uniform-p Cartesian meshes in batches of cells.
+    bool use_cell_batched_residual;
+
+    /// Flag to overlap the ghost exchanges of the explicit residual with the assembly of the cells that do not need them.
+    bool overlap_ghost_exchange;
+
+    /// Number of threads used by each MPI process to assemble the residual.
+    unsigned int n_threads_per_process;
+
     /// Energy file.
     std::string energy_file;
 
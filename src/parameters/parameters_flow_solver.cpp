@@ -95,6 +95,17 @@ void FlowSolverParam::declare_parameters(dealii::ParameterHandler &prm)
                           dealii::Patterns::Bool(),
                           "Adapt the time step on the fly for unsteady flow simulations. False by default (i.e. constant time step by default).");
 
+        prm.declare_entry("adaptive_time_step_policy", "cfl",
+                          dealii::Patterns::Selection(
+                          " cfl | "
+                          " embedded_error"),
+                          "Policy for the adaptive time step. "
+                          "cfl uses the CFL number and the wave speeds of the flow case. "
+                          "embedded_error controls the error estimate of RK methods with an embedded method, "
+                          "and rejects the steps exceeding the tolerances of the ODE solver subsection embedded error control. "
+                          "The initial time step is still given by the flow case. "
+                          "Choices are <cfl | embedded_error>.");
+
         prm.declare_entry("steady_state_polynomial_ramping", "false",
                           dealii::Patterns::Bool(),
                           "For steady-state cases, does polynomial ramping if set to true. False by default.");
@@ -310,6 +321,33 @@ void FlowSolverParam::declare_parameters(dealii::ParameterHandler &prm)
                           dealii::Patterns::Bool(),
                           "Flag to adjust the last timestep such that the simulation "
                           "ends exactly at final_time. True by default.");
+
+        prm.enter_subsection("parareal");
+        {
+            prm.declare_entry("use_parareal", "false",
+                              dealii::Patterns::Bool(),
+                              "Advances the unsteady flow with Parareal iterations over time slices, "
+                              "using the ODE solver with the constant time step as fine propagator, "
+                              "and a second instance of it with a larger time step as coarse propagator. False by default.");
+
+            prm.declare_entry("number_of_time_slices", "4",
+                              dealii::Patterns::Integer(1, dealii::Patterns::Integer::max_int_value),
+                              "Number of time slices of equal length between the initial and final times.");
+
+            prm.declare_entry("maximum_iterations", "10",
+                              dealii::Patterns::Integer(1, dealii::Patterns::Integer::max_int_value),
+                              "Maximum number of Parareal iterations. "
+                              "The iterations also stop once they reach the number of time slices, as the solution is then the fine one.");
+
+            prm.declare_entry("tolerance", "1e-10",
+                              dealii::Patterns::Double(0, dealii::Patterns::Double::max_double_value),
+                              "Tolerance on the largest relative L2 change of the slice end solutions between two iterations.");
+
+            prm.declare_entry("coarse_time_step_factor", "10.0",
+                              dealii::Patterns::Double(1.0, dealii::Patterns::Double::max_double_value),
+                              "Time step of the coarse propagator divided by the constant time step of the flow case.");
+        }
+        prm.leave_subsection();
     }
     prm.leave_subsection();
 }
@@ -357,6 +395,9 @@ void FlowSolverParam::parse_parameters(dealii::ParameterHandler &prm)
         steady_state = prm.get_bool("steady_state");
         steady_state_polynomial_ramping = prm.get_bool("steady_state_polynomial_ramping");
         adaptive_time_step = prm.get_bool("adaptive_time_step");
+        const std::string adaptive_time_step_policy_string = prm.get("adaptive_time_step_policy");
+        if      (adaptive_time_step_policy_string == "cfl")            {adaptive_time_step_policy = cfl;}
+        else if (adaptive_time_step_policy_string == "embedded_error") {adaptive_time_step_policy = embedded_error;}
         sensitivity_table_filename = prm.get("sensitivity_table_filename");
         restart_computation_from_file = prm.get_bool("restart_computation_from_file");
         output_restart_files = prm.get_bool("output_restart_files");
@@ -453,6 +494,16 @@ void FlowSolverParam::parse_parameters(dealii::ParameterHandler &prm)
         prm.leave_subsection();
 
         end_exactly_at_final_time = prm.get_bool("end_exactly_at_final_time");
+
+        prm.enter_subsection("parareal");
+        {
+            use_parareal = prm.get_bool("use_parareal");
+            parareal_number_of_time_slices = prm.get_integer("number_of_time_slices");
+            parareal_maximum_iterations = prm.get_integer("maximum_iterations");
+            parareal_tolerance = prm.get_double("tolerance");
+            parareal_coarse_time_step_factor = prm.get_double("coarse_time_step_factor");
+        }
+        prm.leave_subsection();
     }
     prm.leave_subsection();
 }
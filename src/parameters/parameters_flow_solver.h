@@ -52,6 +52,14 @@ public:
 
     bool adaptive_time_step; ///< Flag for computing the time step on the fly
 
+    /// Policies for computing the adaptive time step
+    enum AdaptiveTimeStepPolicy{
+        cfl, ///< From the CFL number and the wave speeds of the flow case
+        embedded_error ///< From the embedded error estimate of the RK step, with step rejection
+        };
+    /// Selected policy for the adaptive time step
+    AdaptiveTimeStepPolicy adaptive_time_step_policy;
+
     /** Name of the output file for writing the sensitivity data;
      *   will be written to file: sensitivity_table_filename.txt */
     std::string sensitivity_table_filename;
@@ -146,6 +154,12 @@ public:
 
     bool end_exactly_at_final_time; ///< Flag to adjust the last timestep such that the simulation ends exactly at final_time
 
+    bool use_parareal; ///< Flag for advancing the unsteady flow with the Parareal parallel-in-time iterations
+    int parareal_number_of_time_slices; ///< Number of time slices of the Parareal iterations
+    int parareal_maximum_iterations; ///< Maximum number of Parareal iterations
+    double parareal_tolerance; ///< Tolerance on the relative change of the slice end solutions between Parareal iterations
+    double parareal_coarse_time_step_factor; ///< Ratio of the time steps of the coarse and fine propagators of Parareal
+
     /// Declares the possible variables and sets the defaults.
     static void declare_parameters (dealii::ParameterHandler &prm);
 
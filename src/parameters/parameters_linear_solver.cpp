@@ -17,6 +17,14 @@ void LinearSolverParam::declare_parameters (dealii::ParameterHandler &prm)
                           "Enum of linear solver"
                           "Choices are <direct|gmres>.");
 
+        prm.declare_entry("jacobian_storage", "trilinos_csr",
+                          dealii::Patterns::Selection("trilinos_csr|block_csr|matrix_free"),
+                          "Storage of the residual Jacobian. "
+                          "block_csr stores one dense block per pair of coupled cells and is only used with gmres. "
+                          "matrix_free stores no Jacobian and evaluates its products with automatic differentiation, "
+                          "it is only used with gmres and the weak DG form. "
+                          "Choices are <trilinos_csr|block_csr|matrix_free>.");
+
         prm.enter_subsection("gmres options");
         {
             prm.declare_entry("linear_residual_tolerance", "1e-4",
@@ -28,6 +36,10 @@ void LinearSolverParam::declare_parameters (dealii::ParameterHandler &prm)
             prm.declare_entry("restart_number", "30",
                               dealii::Patterns::Integer(),
                               "Number of iterations before restarting GMRES");
+            prm.declare_entry("block_preconditioner", "block_ilu",
+                              dealii::Patterns::Selection("block_jacobi|block_ilu"),
+                              "Preconditioner used with the block_csr Jacobian storage. "
+                              "Choices are <block_jacobi|block_ilu>.");
 
             // ILU with threshold parameters
             prm.declare_entry("ilut_fill", "1",
@@ -71,6 +83,29 @@ void LinearSolverParam::declare_parameters (dealii::ParameterHandler &prm)
                               dealii::Patterns::Double(),
                               "Small perturbation for Jacobian-free methods."
                               " Default value is the square root of machine epsilon.");
+            prm.declare_entry("jacobian_vector_product", "finite_difference",
+                              dealii::Patterns::Selection("finite_difference|automatic_differentiation"),
+                              "Evaluation of the Jacobian-vector products. "
+                              "finite_difference perturbs the residual, automatic_differentiation is exact "
+                              "and requires the weak DG form. "
+                              "Choices are <finite_difference|automatic_differentiation>.");
+            prm.declare_entry("preconditioner", "none",
+                              dealii::Patterns::Selection("none|lagged_jacobian|cell_block_jacobi|coarse_degree"),
+                              "Preconditioner of the GMRES iterations. "
+                              "lagged_jacobian factors M/dt - dRdW assembled at a lagged state, "
+                              "with ILU for the trilinos_csr storage and the block_preconditioner for the block_csr storage. "
+                              "cell_block_jacobi inverts the cell diagonal blocks of M/dt - dRdW, "
+                              "with the derivatives of each cell residual with respect to its own solution. "
+                              "coarse_degree factors M/dt - dRdW of the preconditioner_coarse_degree discretization "
+                              "and uses M/dt for the higher modes. "
+                              "Choices are <none|lagged_jacobian|cell_block_jacobi|coarse_degree>.");
+            prm.declare_entry("preconditioner_refresh_interval", "1",
+                              dealii::Patterns::Integer(1),
+                              "Number of JFNK solves, for example DIRK stages, between the assemblies of dRdW in the preconditioner. "
+                              "In between, only its mass term follows the time step.");
+            prm.declare_entry("preconditioner_coarse_degree", "0",
+                              dealii::Patterns::Integer(0,1),
+                              "Polynomial degree of the coarse_degree preconditioner.");
         }
         prm.leave_subsection();
 
@@ -89,6 +124,11 @@ void LinearSolverParam ::parse_parameters (dealii::ParameterHandler &prm)
         const std::string solver_string = prm.get("linear_solver_type");
         if (solver_string == "direct") linear_solver_type = LinearSolverEnum::direct;
 
+        const std::string storage_string = prm.get("jacobian_storage");
+        if (storage_string == "trilinos_csr") jacobian_storage = JacobianStorageEnum::trilinos_csr;
+        if (storage_string == "block_csr") jacobian_storage = JacobianStorageEnum::block_csr;
+        if (storage_string == "matrix_free") jacobian_storage = JacobianStorageEnum::matrix_free;
+
         if (solver_string == "gmres")
         {
             linear_solver_type = LinearSolverEnum::gmres;
@@ -102,6 +142,10 @@ void LinearSolverParam ::parse_parameters (dealii::ParameterHandler &prm)
                 ilut_drop = prm.get_double("ilut_drop");
                 ilut_rtol = prm.get_double("ilut_rtol");
                 ilut_atol = prm.get_double("ilut_atol");
+
+                const std::string block_preconditioner_string = prm.get("block_preconditioner");
+                if (block_preconditioner_string == "block_jacobi") block_preconditioner = BlockPreconditionerEnum::block_jacobi;
+                if (block_preconditioner_string == "block_ilu") block_preconditioner = BlockPreconditionerEnum::block_ilu;
             }
             prm.leave_subsection();
         }
@@ -111,6 +155,18 @@ void LinearSolverParam ::parse_parameters (dealii::ParameterHandler &prm)
             newton_residual = prm.get_double("newton_residual");
             newton_max_iterations = prm.get_integer("newton_max_iterations");
             perturbation_magnitude = prm.get_double("perturbation_magnitude");
+
+            const std::string jvp_string = prm.get("jacobian_vector_product");
+            if (jvp_string == "finite_difference") jacobian_vector_product = JacobianVectorProductEnum::finite_difference;
+            if (jvp_string == "automatic_differentiation") jacobian_vector_product = JacobianVectorProductEnum::automatic_differentiation;
+
+            const std::string jfnk_preconditioner_string = prm.get("preconditioner");
+            if (jfnk_preconditioner_string == "none") jfnk_preconditioner = JFNKPreconditionerEnum::none;
+            if (jfnk_preconditioner_string == "lagged_jacobian") jfnk_preconditioner = JFNKPreconditionerEnum::lagged_jacobian;
+            if (jfnk_preconditioner_string == "cell_block_jacobi") jfnk_preconditioner = JFNKPreconditionerEnum::cell_block_jacobi;
+            if (jfnk_preconditioner_string == "coarse_degree") jfnk_preconditioner = JFNKPreconditionerEnum::coarse_degree;
+            jfnk_preconditioner_refresh_interval = prm.get_integer("preconditioner_refresh_interval");
+            jfnk_preconditioner_coarse_degree = prm.get_integer("preconditioner_coarse_degree");
         }
         prm.leave_subsection();
 
@@ -19,12 +19,45 @@ public:
         gmres   /// GMRES.
     };
 
+    /// Storage of the residual Jacobian.
+    enum JacobianStorageEnum {
+        trilinos_csr, ///< Trilinos sparse matrix with one column index per entry.
+        block_csr,    ///< BlockSparseMatrix with one dense block per pair of coupled cells.
+        matrix_free   ///< No stored Jacobian, products are evaluated with AD directional derivatives.
+    };
+
+    /// Preconditioners available with the block_csr Jacobian.
+    enum BlockPreconditionerEnum {
+        block_jacobi, ///< Inverse of the cell diagonal blocks.
+        block_ilu     ///< Block ILU(0) of the locally owned blocks.
+    };
+
+    /// Evaluation of the Jacobian-vector products of the Jacobian-free Newton-Krylov solver.
+    enum JacobianVectorProductEnum {
+        finite_difference,        ///< First-order finite difference of the residual.
+        automatic_differentiation ///< Forward AD directional derivative, see DGBase::dRdW_vmult().
+    };
+
+    /// Preconditioners of the GMRES iterations of the Jacobian-free Newton-Krylov solver.
+    enum JFNKPreconditionerEnum {
+        none,              ///< Unpreconditioned GMRES.
+        lagged_jacobian,   ///< Incomplete factorization of M/dt - dRdW assembled at a lagged state.
+        cell_block_jacobi, ///< Inverse of the cell diagonal blocks of M/dt - dRdW at a lagged state, from the local residual derivatives.
+        coarse_degree      ///< M/dt - dRdW of a lower polynomial degree, with M/dt for the higher modes.
+    };
+
     /// Can either be verbose or quiet.
     /** Verbose will print the full dense matrix. Will not work for large matrices
      */
     OutputEnum linear_solver_output; ///< quiet or verbose.
     LinearSolverEnum linear_solver_type; ///< direct or gmres.
 
+    /// Storage of DGBase::system_matrix, or of DGBase::block_system_matrix instead.
+    /** The block_csr and matrix_free storages are only used with the gmres linear solver.
+     *  The matrix_free storage requires a DG operator supporting DGBase::dRdW_vmult().
+     */
+    JacobianStorageEnum jacobian_storage;
+
     // GMRES options
     double ilut_drop; ///< Threshold to drop terms close to zero.
     double ilut_rtol; ///< Multiplies diagonal by ilut_rtol for more diagonal dominance.
@@ -32,6 +65,8 @@ public:
 
     int ilut_fill; ///< ILU fill-in
 
+    BlockPreconditionerEnum block_preconditioner; ///< Preconditioner of the block_csr Jacobian.
+
     double linear_residual; ///< Tolerance for linear residual.
     int max_iterations; ///< Maximum number of linear iteration.
     int restart_number; ///< Number of iterations before restarting GMRES
@@ -39,6 +74,10 @@ public:
     double newton_residual; ///< Tolerance for Newton iteration residual (for Jacobian-free Newton-Krylov)
     int newton_max_iterations; ///< Maximum number of Newton iterations (for Jacobian-free Newton-Krylov)
     double perturbation_magnitude; ///<Small perturbation magnitude for Jacobian-free methods
+    JacobianVectorProductEnum jacobian_vector_product; ///< Jacobian-vector products of the JFNK solver.
+    JFNKPreconditionerEnum jfnk_preconditioner; ///< Preconditioner of the JFNK solver.
+    int jfnk_preconditioner_refresh_interval; ///< Number of JFNK solves between the assemblies of the preconditioner.
+    int jfnk_preconditioner_coarse_degree; ///< Polynomial degree of the coarse_degree preconditioner.
 
     /// Declares the possible variables and sets the defaults.
     static void declare_parameters (dealii::ParameterHandler &prm);
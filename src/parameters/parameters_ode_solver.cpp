@@ -40,14 +40,22 @@ void ODESolverParam::declare_parameters (dealii::ParameterHandler &prm)
                           " implicit | "
                           " rrk_explicit | "
                           " pod_galerkin | "
-                          " pod_petrov_galerkin"),
+                          " pod_petrov_galerkin | "
+                          " p_multigrid | "
+                          " low_storage_runge_kutta | "
+                          " imex_runge_kutta | "
+                          " local_time_stepping"),
                           "Type of ODE solver to use."
                           "Choices are "
                           " <runge_kutta | "
                           " implicit | "
                           " rrk_explicit | "
                           " pod_galerkin | "
-                          " pod_petrov_galerkin>.");
+                          " pod_petrov_galerkin | "
+                          " p_multigrid | "
+                          " low_storage_runge_kutta | "
+                          " imex_runge_kutta | "
+                          " local_time_stepping>.");
 
         prm.declare_entry("nonlinear_max_iterations", "500000",
                           dealii::Patterns::Integer(0,dealii::Patterns::Integer::max_int_value),
@@ -102,7 +110,9 @@ void ODESolverParam::declare_parameters (dealii::ParameterHandler &prm)
                           " euler_ex | "
                           " euler_im | "
                           " dirk_2_im | "
-                          " dirk_3_im"),
+                          " dirk_3_im | "
+                          " bogacki_shampine3_ex | "
+                          " dormand_prince5_ex"),
                           "Runge-kutta method to use. Methods with _ex are explicit, and with _im are implicit."
                           "Choices are "
                           " <rk4_ex | "
@@ -111,7 +121,10 @@ void ODESolverParam::declare_parameters (dealii::ParameterHandler &prm)
                           " euler_ex | "
                           " euler_im | "
                           " dirk_2_im | "
-                          " dirk_3_im>.");
+                          " dirk_3_im | "
+                          " bogacki_shampine3_ex | "
+                          " dormand_prince5_ex>. "
+                          "The last two have an embedded method, used by the embedded_error time step policy of the flow solver.");
         prm.enter_subsection("rrk root solver");
         {
             prm.declare_entry("rrk_root_solver_output", "quiet",
@@ -126,6 +139,94 @@ void ODESolverParam::declare_parameters (dealii::ParameterHandler &prm)
         }
         prm.leave_subsection();
 
+        prm.enter_subsection("low storage runge kutta");
+        {
+            prm.declare_entry("low_storage_rk_method", "carpenter_kennedy_lsrk4_5",
+                              dealii::Patterns::Selection(
+                              " carpenter_kennedy_lsrk4_5 | "
+                              " ssprk3_low_storage | "
+                              " ketcheson_ssprk4_10"),
+                              "Explicit low-storage RK method used by the low_storage_runge_kutta ODE solver. "
+                              "Choices are "
+                              " <carpenter_kennedy_lsrk4_5 | "
+                              " ssprk3_low_storage | "
+                              " ketcheson_ssprk4_10>.");
+
+            prm.declare_entry("use_relaxation_runge_kutta", "false",
+                              dealii::Patterns::Bool(),
+                              "Relaxes the steps with the algebraic relaxation Runge-Kutta parameter of the energy. "
+                              "Only valid for pde_type = burgers_inviscid. False by default.");
+        }
+        prm.leave_subsection();
+
+        prm.enter_subsection("imex runge kutta");
+        {
+            prm.declare_entry("imex_rk_method", "ark3_2_4l_2sa",
+                              dealii::Patterns::Selection(
+                              " ark3_2_4l_2sa | "
+                              " ark4_3_6l_2sa"),
+                              "Additive RK method used by the imex_runge_kutta ODE solver, which integrates "
+                              "the convective terms explicitly and the dissipative and source terms implicitly. "
+                              "Choices are "
+                              " <ark3_2_4l_2sa | "
+                              " ark4_3_6l_2sa>.");
+        }
+        prm.leave_subsection();
+
+        prm.enter_subsection("local time stepping");
+        {
+            prm.declare_entry("maximum_time_levels", "4",
+                              dealii::Patterns::Integer(1,30),
+                              "Number of time levels of the local_time_stepping ODE solver. "
+                              "Level 0 advances with half of the flow solver time step, and each level with half the time step of the previous one.");
+            prm.declare_entry("courant_number", "0.5",
+                              dealii::Patterns::Double(0.0),
+                              "Multiplies the stable time step of each cell, max_dt_cell, to assign it the coarsest time level "
+                              "whose time step does not exceed it.");
+        }
+        prm.leave_subsection();
+
+        prm.enter_subsection("embedded error control");
+        {
+            prm.declare_entry("absolute_tolerance", "1e-6",
+                              dealii::Patterns::Double(0.0),
+                              "Absolute tolerance on the error estimate of RK methods with an embedded method.");
+            prm.declare_entry("relative_tolerance", "1e-6",
+                              dealii::Patterns::Double(0.0),
+                              "Relative tolerance on the error estimate of RK methods with an embedded method.");
+            prm.declare_entry("safety_factor", "0.9",
+                              dealii::Patterns::Double(0.0, 1.0),
+                              "Safety factor multiplying the time step proposed by the error controller.");
+            prm.declare_entry("minimum_step_factor", "0.2",
+                              dealii::Patterns::Double(0.0, 1.0),
+                              "Smallest ratio of the new and current time steps, also used after a rejected step.");
+            prm.declare_entry("maximum_step_factor", "5.0",
+                              dealii::Patterns::Double(1.0),
+                              "Largest ratio of the new and current time steps.");
+            prm.declare_entry("maximum_rejections", "20",
+                              dealii::Patterns::Integer(1),
+                              "Number of rejected attempts of a step after which the solver aborts.");
+        }
+        prm.leave_subsection();
+
+        prm.enter_subsection("implicit jacobian reuse");
+        {
+            prm.declare_entry("jacobian_refresh_interval", "1",
+                              dealii::Patterns::Integer(1),
+                              "Number of implicit steps between the assemblies of dRdW and of its preconditioner. "
+                              "In between, only the residual is assembled and the mass term of the lagged operator "
+                              "follows the time step. The default 1 assembles dRdW at every step.");
+            prm.declare_entry("jacobian_refresh_linear_iterations", "0",
+                              dealii::Patterns::Integer(0),
+                              "Assembles the lagged dRdW again when the last linear solve took more iterations. "
+                              "0 disables this criterion.");
+            prm.declare_entry("jacobian_refresh_residual_stall", "0.0",
+                              dealii::Patterns::Double(0.0),
+                              "Assembles the lagged dRdW again when the last step reduced the residual norm "
+                              "by a ratio larger than this value, for example 0.9. 0 disables this criterion.");
+        }
+        prm.leave_subsection();
+
     }
     prm.leave_subsection();
 }
@@ -157,6 +258,14 @@ void ODESolverParam::parse_parameters (dealii::ParameterHandler &prm)
                                                            allocate_matrix_dRdW = true; }
         else if (solver_string == "pod_petrov_galerkin") { ode_solver_type = ODESolverEnum::pod_petrov_galerkin_solver;
                                                            allocate_matrix_dRdW = true; }
+        else if (solver_string == "p_multigrid")         { ode_solver_type = ODESolverEnum::p_multigrid_solver;
+                                                           allocate_matrix_dRdW = true; }
+        else if (solver_string == "low_storage_runge_kutta") { ode_solver_type = ODESolverEnum::low_storage_runge_kutta_solver;
+                                                               allocate_matrix_dRdW = false; }
+        else if (solver_string == "imex_runge_kutta") { ode_solver_type = ODESolverEnum::imex_runge_kutta_solver;
+                                                        allocate_matrix_dRdW = false; }
+        else if (solver_string == "local_time_stepping") { ode_solver_type = ODESolverEnum::local_time_stepping_solver;
+                                                           allocate_matrix_dRdW = false; }
 
         nonlinear_steady_residual_tolerance  = prm.get_double("nonlinear_steady_residual_tolerance");
         nonlinear_max_iterations = prm.get_integer("nonlinear_max_iterations");
@@ -209,6 +318,18 @@ void ODESolverParam::parse_parameters (dealii::ParameterHandler &prm)
             n_rk_stages  = 3;
             rk_order = 3;
         }
+        else if (rk_method_string == "bogacki_shampine3_ex"){
+            runge_kutta_method = RKMethodEnum::bogacki_shampine3_ex;
+            n_rk_stages  = 4;
+            rk_order = 3;
+        }
+        else if (rk_method_string == "dormand_prince5_ex"){
+            runge_kutta_method = RKMethodEnum::dormand_prince5_ex;
+            n_rk_stages  = 7;
+            rk_order = 5;
+        }
+        runge_kutta_n_rk_stages = n_rk_stages;
+        runge_kutta_rk_order = rk_order;
         prm.enter_subsection("rrk root solver");
         {
             const std::string output_string_rrk = prm.get("rrk_root_solver_output");
@@ -219,6 +340,84 @@ void ODESolverParam::parse_parameters (dealii::ParameterHandler &prm)
         }
         prm.leave_subsection();
 
+        prm.enter_subsection("low storage runge kutta");
+        {
+            const std::string low_storage_rk_method_string = prm.get("low_storage_rk_method");
+            int low_storage_n_rk_stages = 0;
+            int low_storage_rk_order = 0;
+            if (low_storage_rk_method_string == "carpenter_kennedy_lsrk4_5"){
+                low_storage_rk_method = LowStorageRKMethodEnum::carpenter_kennedy_lsrk4_5;
+                low_storage_n_rk_stages = 5;
+                low_storage_rk_order = 4;
+            }
+            else if (low_storage_rk_method_string == "ssprk3_low_storage"){
+                low_storage_rk_method = LowStorageRKMethodEnum::ssprk3_low_storage;
+                low_storage_n_rk_stages = 3;
+                low_storage_rk_order = 3;
+            }
+            else if (low_storage_rk_method_string == "ketcheson_ssprk4_10"){
+                low_storage_rk_method = LowStorageRKMethodEnum::ketcheson_ssprk4_10;
+                low_storage_n_rk_stages = 10;
+                low_storage_rk_order = 4;
+            }
+            // The stages and order of the solver are those of the low-storage method
+            if (ode_solver_type == ODESolverEnum::low_storage_runge_kutta_solver) {
+                n_rk_stages = low_storage_n_rk_stages;
+                rk_order = low_storage_rk_order;
+            }
+            use_low_storage_relaxation = prm.get_bool("use_relaxation_runge_kutta");
+        }
+        prm.leave_subsection();
+
+        prm.enter_subsection("imex runge kutta");
+        {
+            const std::string imex_rk_method_string = prm.get("imex_rk_method");
+            int imex_n_rk_stages = 0;
+            int imex_rk_order = 0;
+            if (imex_rk_method_string == "ark3_2_4l_2sa"){
+                imex_rk_method = IMEXRKMethodEnum::ark3_2_4l_2sa;
+                imex_n_rk_stages = 4;
+                imex_rk_order = 3;
+            }
+            else if (imex_rk_method_string == "ark4_3_6l_2sa"){
+                imex_rk_method = IMEXRKMethodEnum::ark4_3_6l_2sa;
+                imex_n_rk_stages = 6;
+                imex_rk_order = 4;
+            }
+            // The stages and order of the solver are those of the additive method
+            if (ode_solver_type == ODESolverEnum::imex_runge_kutta_solver) {
+                n_rk_stages = imex_n_rk_stages;
+                rk_order = imex_rk_order;
+            }
+        }
+        prm.leave_subsection();
+
+        prm.enter_subsection("local time stepping");
+        {
+            local_time_stepping_maximum_levels = prm.get_integer("maximum_time_levels");
+            local_time_stepping_courant_number = prm.get_double("courant_number");
+        }
+        prm.leave_subsection();
+
+        prm.enter_subsection("embedded error control");
+        {
+            embedded_error_absolute_tolerance = prm.get_double("absolute_tolerance");
+            embedded_error_relative_tolerance = prm.get_double("relative_tolerance");
+            embedded_error_safety_factor = prm.get_double("safety_factor");
+            embedded_error_minimum_step_factor = prm.get_double("minimum_step_factor");
+            embedded_error_maximum_step_factor = prm.get_double("maximum_step_factor");
+            embedded_error_maximum_rejections = prm.get_integer("maximum_rejections");
+        }
+        prm.leave_subsection();
+
+        prm.enter_subsection("implicit jacobian reuse");
+        {
+            jacobian_refresh_interval = prm.get_integer("jacobian_refresh_interval");
+            jacobian_refresh_linear_iterations = prm.get_integer("jacobian_refresh_linear_iterations");
+            jacobian_refresh_residual_stall = prm.get_double("jacobian_refresh_residual_stall");
+        }
+        prm.leave_subsection();
+
     }
     prm.leave_subsection();
 }
@@ -17,7 +17,11 @@ public:
         implicit_solver,  /// Backward-Euler
         rrk_explicit_solver, /// Explicit RK using the relaxation Runge-Kutta method (Ketcheson, 2019)
         pod_galerkin_solver, ///Proper Orthogonal Decomposition with Galerkin projection
-        pod_petrov_galerkin_solver ///Proper Orthogonal Decomposition with Petrov-Galerkin projection (LSPG)
+        pod_petrov_galerkin_solver, ///Proper Orthogonal Decomposition with Petrov-Galerkin projection (LSPG)
+        p_multigrid_solver, ///Steady state by FAS cycles over the polynomial degrees, see PMultigridParam
+        low_storage_runge_kutta_solver, ///Explicit low-storage RK, see LowStorageRKMethodEnum
+        imex_runge_kutta_solver, ///Additive RK, explicit in the convective terms and implicit in the others, see IMEXRKMethodEnum
+        local_time_stepping_solver ///Explicit RK of runge_kutta_method with a time step per level of cells
     };
 
     OutputEnum ode_output; ///< verbose or quiet.
@@ -61,12 +65,55 @@ public:
         euler_ex, ///Forward Euler
         euler_im, ///Implicit Euler
         dirk_2_im, ///Second-order diagonally-implicit RK
-        dirk_3_im ///Third-order diagonally-implicit RK
+        dirk_3_im, ///Third-order diagonally-implicit RK
+        bogacki_shampine3_ex, ///Third-order Bogacki-Shampine with an embedded second-order method
+        dormand_prince5_ex ///Fifth-order Dormand-Prince with an embedded fourth-order method
     };
 
     RKMethodEnum runge_kutta_method; ///< Runge-kutta method.
     int n_rk_stages; ///< Number of stages for an RK method; assigned based on runge_kutta_method
     int rk_order; ///< Order of the RK method; assigned based on runge_kutta_method
+    int runge_kutta_n_rk_stages; ///< Number of stages of runge_kutta_method, whichever solver type assigns n_rk_stages
+    int runge_kutta_rk_order; ///< Order of runge_kutta_method, whichever solver type assigns rk_order
+
+    /// Types of low-storage RK method
+    enum LowStorageRKMethodEnum {
+        carpenter_kennedy_lsrk4_5, ///Fourth-order five-stage 2N method of Carpenter and Kennedy
+        ssprk3_low_storage, ///Third-order strong-stability preserving, in its Shu-Osher form
+        ketcheson_ssprk4_10 ///Fourth-order ten-stage strong-stability preserving method of Ketcheson
+    };
+
+    /// Low-storage RK method; with this solver type, also assigns n_rk_stages and rk_order
+    LowStorageRKMethodEnum low_storage_rk_method;
+    /// Relaxes the low-storage RK steps with the algebraic RRK parameter of the energy
+    bool use_low_storage_relaxation;
+
+    /// Types of additive implicit-explicit (IMEX) RK method
+    enum IMEXRKMethodEnum {
+        ark3_2_4l_2sa, ///Third-order four-stage ARK3(2)4L[2]SA of Kennedy and Carpenter
+        ark4_3_6l_2sa ///Fourth-order six-stage ARK4(3)6L[2]SA of Kennedy and Carpenter
+    };
+
+    /// IMEX RK method; with this solver type, also assigns n_rk_stages and rk_order
+    IMEXRKMethodEnum imex_rk_method;
+
+    /// Number of time levels of local time stepping, whose time steps are halved from one level to the next
+    int local_time_stepping_maximum_levels;
+    /// Courant number multiplying the stable time step of each cell to assign its time level
+    double local_time_stepping_courant_number;
+
+    /// Absolute tolerance on the embedded error estimate of the RK step
+    double embedded_error_absolute_tolerance;
+    /// Relative tolerance on the embedded error estimate of the RK step
+    double embedded_error_relative_tolerance;
+    /// Safety factor multiplying the time step proposed by the error controller
+    double embedded_error_safety_factor;
+    /// Lower bound on the ratio of the new and current time steps, also used after a rejected step
+    double embedded_error_minimum_step_factor;
+    /// Upper bound on the ratio of the new and current time steps
+    double embedded_error_maximum_step_factor;
+    /// Number of rejected attempts of a step after which the solver aborts
+    int embedded_error_maximum_rejections;
 
     /// Flag to signal that automatic differentiation (AD) matrix dRdW must be allocated
     bool allocate_matrix_dRdW;
@@ -77,6 +124,15 @@ public:
     /// Tolerance for RRK root solver, default value 5E-10
     double relaxation_runge_kutta_root_tolerance;
 
+    /// Number of implicit steps between the assemblies of dRdW, where 1 assembles it at every step.
+    /** Above 1, ImplicitODESolver lags dRdW and its preconditioner, see ImplicitODESolver::jacobian_needs_refresh().
+     */
+    int jacobian_refresh_interval;
+    /// Linear iteration count above which the lagged dRdW is assembled again, 0 to disable.
+    int jacobian_refresh_linear_iterations;
+    /// Residual reduction of a step above which the lagged dRdW is assembled again, 0 to disable.
+    double jacobian_refresh_residual_stall;
+
     static void declare_parameters (dealii::ParameterHandler &prm); ///< Declares the possible variables and sets the defaults.
     void parse_parameters (dealii::ParameterHandler &prm); ///< Parses input file and sets the variables.
 };
@@ -0,0 +1,75 @@
+#include "parameters/parameters_p_multigrid.h"
+
+namespace PHiLiP {
+namespace Parameters {
+
+void PMultigridParam::declare_parameters (dealii::ParameterHandler &prm)
+{
+    prm.enter_subsection("p-multigrid");
+    {
+        prm.declare_entry("coarse_degree", "0",
+                          dealii::Patterns::Integer(0),
+                          "Polynomial degree of the coarsest level. "
+                          "The levels between the solution degree and this one decrease the degree by one.");
+
+        prm.declare_entry("n_pre_smoothing", "2",
+                          dealii::Patterns::Integer(0),
+                          "Number of smoothing steps before the coarse level correction.");
+        prm.declare_entry("n_post_smoothing", "2",
+                          dealii::Patterns::Integer(0),
+                          "Number of smoothing steps after the coarse level correction.");
+
+        prm.declare_entry("smoother", "runge_kutta",
+                          dealii::Patterns::Selection("runge_kutta|block_jacobi"),
+                          "Smoother of the levels above the coarsest for the p_multigrid ODE solver. "
+                          "runge_kutta takes explicit three-stage steps with local time steps. "
+                          "block_jacobi inverts the cell diagonal blocks of the linearized implicit operator. "
+                          "The preconditioner of the implicit solver always uses block_jacobi. "
+                          "Choices are <runge_kutta|block_jacobi>.");
+        prm.declare_entry("smoother_cfl", "1.0",
+                          dealii::Patterns::Double(0.0),
+                          "CFL number of the local time steps of the runge_kutta smoother.");
+        prm.declare_entry("block_jacobi_relaxation", "0.8",
+                          dealii::Patterns::Double(0.0, 1.0),
+                          "Damping factor of the block_jacobi smoother.");
+
+        prm.declare_entry("n_coarse_steps", "1",
+                          dealii::Patterns::Integer(1),
+                          "Number of linearized implicit steps on the coarsest level of the p_multigrid ODE solver.");
+        prm.declare_entry("coarse_linear_residual", "1e-6",
+                          dealii::Patterns::Double(0.0),
+                          "Relative tolerance of the ILU-preconditioned GMRES solves of the coarsest level.");
+
+        prm.declare_entry("use_as_implicit_preconditioner", "false",
+                          dealii::Patterns::Bool(),
+                          "Preconditions the GMRES solves of the implicit ODE solver with a p-multigrid V-cycle "
+                          "instead of an ILU. Requires the trilinos_csr Jacobian storage.");
+    }
+    prm.leave_subsection();
+}
+
+void PMultigridParam::parse_parameters (dealii::ParameterHandler &prm)
+{
+    prm.enter_subsection("p-multigrid");
+    {
+        coarse_degree = prm.get_integer("coarse_degree");
+
+        n_pre_smoothing = prm.get_integer("n_pre_smoothing");
+        n_post_smoothing = prm.get_integer("n_post_smoothing");
+
+        const std::string smoother_string = prm.get("smoother");
+        if (smoother_string == "runge_kutta") smoother = SmootherEnum::runge_kutta;
+        if (smoother_string == "block_jacobi") smoother = SmootherEnum::block_jacobi;
+        smoother_cfl = prm.get_double("smoother_cfl");
+        block_jacobi_relaxation = prm.get_double("block_jacobi_relaxation");
+
+        n_coarse_steps = prm.get_integer("n_coarse_steps");
+        coarse_linear_residual = prm.get_double("coarse_linear_residual");
+
+        use_as_implicit_preconditioner = prm.get_bool("use_as_implicit_preconditioner");
+    }
+    prm.leave_subsection();
+}
+
+} // Parameters namespace
+} // PHiLiP namespace
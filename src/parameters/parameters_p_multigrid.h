@@ -0,0 +1,42 @@
+#ifndef __PARAMETERS_P_MULTIGRID_H__
+#define __PARAMETERS_P_MULTIGRID_H__
+
+#include <deal.II/base/parameter_handler.h>
+
+namespace PHiLiP {
+namespace Parameters {
+
+/// Parameters of the polynomial multigrid, as a steady solver or as a preconditioner of the implicit solver.
+class PMultigridParam
+{
+public:
+    /// Smoothers of the levels above the coarsest.
+    enum SmootherEnum {
+        runge_kutta, ///< Three-stage explicit Runge-Kutta with local time steps.
+        block_jacobi ///< Damped cell block-Jacobi of the linearized operator.
+    };
+
+    unsigned int coarse_degree; ///< Polynomial degree of the coarsest level.
+
+    unsigned int n_pre_smoothing; ///< Number of smoothing steps before the coarse level correction.
+    unsigned int n_post_smoothing; ///< Number of smoothing steps after the coarse level correction.
+
+    SmootherEnum smoother; ///< Smoother of the nonlinear levels, the linear levels always use block_jacobi.
+    double smoother_cfl; ///< CFL of the local time steps of the runge_kutta smoother.
+    double block_jacobi_relaxation; ///< Damping of the block_jacobi smoother.
+
+    unsigned int n_coarse_steps; ///< Number of linearized implicit steps of the nonlinear coarsest level.
+    double coarse_linear_residual; ///< Relative tolerance of the GMRES solves of the coarsest level.
+
+    /// Whether ImplicitODESolver preconditions its GMRES solves with a p-multigrid V-cycle.
+    bool use_as_implicit_preconditioner;
+
+    /// Declares the possible variables and sets the defaults.
+    static void declare_parameters (dealii::ParameterHandler &prm);
+    /// Parses input file and sets the variables.
+    void parse_parameters (dealii::ParameterHandler &prm);
+};
+
+} // Parameters namespace
+} // PHiLiP namespace
+#endif
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cmath>
 #include <vector>
 
@@ -497,22 +498,19 @@ std::array<real,nstate> Euler<dim, nstate, real>
 }
 
 template <int dim, int nstate, typename real>
-real Euler<dim, nstate, real>
+inline real Euler<dim, nstate, real>
 ::compute_ismail_roe_logarithmic_mean(const real val1, const real val2) const
 {
     // See Appendix B [Ismail and Roe, 2009, Entropy-Consistent Euler Flux Functions II]
-    // -- Numerically stable algorithm for computing the logarithmic mean
-    const real zeta = val1/val2;
-    const real f = (zeta-1.0)/(zeta+1.0);
-    const real u = f*f;
-    
-    real F;
-    if(u<1.0e-2){ F = 1.0 + u/3.0 + u*u/5.0 + u*u*u/7.0; } 
-    else { 
-        if constexpr(std::is_same<real,double>::value) F = std::log(zeta)/2.0/f; 
-    }
-    
-    const real log_mean_val = (val1+val2)/(2.0*F);
+    // -- Numerically stable algorithm for computing the logarithmic mean,
+    // with the cut-off and polynomial of [Ranocha et al., 2021] such that the series is
+    // exact to machine precision and only a single division is needed for f^2.
+    // f^2 = ((val1-val2)/(val1+val2))^2
+    const real f2 = (val1*(val1-2.0*val2) + val2*val2) / (val1*(val1+2.0*val2) + val2*val2);
+
+    real log_mean_val;
+    if(f2<1.0e-4){ log_mean_val = (val1+val2) / (2.0 + f2*(2.0/3.0 + f2*(2.0/5.0 + f2*(2.0/7.0)))); }
+    else { log_mean_val = (val1-val2) / log(val1/val2); }
 
     return log_mean_val;
 }
@@ -677,6 +675,191 @@ std::array<dealii::Tensor<1,dim,real>,nstate> Euler<dim, nstate, real>
 
 }
 
+template <int dim, int nstate, typename real>
+bool Euler<dim, nstate, real>
+::is_physical_batch (const std::array<std::vector<real>,nstate> &conservative_soln) const
+{
+    const unsigned int n_points = conservative_soln[0].size();
+    bool is_physical = true;
+    for(unsigned int ipoint=0; ipoint<n_points; ipoint++){
+        // Same pressure as the vectorized kernels
+        const real density = conservative_soln[0][ipoint];
+        real vel_sqr = 0.0;
+        for(int idim=0; idim<dim; idim++){
+            const real vel = conservative_soln[1+idim][ipoint]/density;
+            vel_sqr += vel*vel;
+        }
+        const real pressure = gamm1*(conservative_soln[nstate-1][ipoint] - 0.5*density*vel_sqr);
+        is_physical = is_physical & (density > 0.0) & (pressure > 0.0);
+    }
+    return is_physical;
+}
+
+template <int dim, int nstate, typename real>
+void Euler<dim, nstate, real>
+::convective_numerical_split_flux_batch(const std::array<real,nstate> &conservative_soln1,
+                                        const std::array<std::vector<real>,nstate> &conservative_soln2,
+                                        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &conv_num_split_flux) const
+{
+    for(int istate=0; istate<nstate; istate++){
+        AssertDimension(conservative_soln2[istate].size(), conservative_soln2[0].size());
+        for(int idim=0; idim<dim; idim++){
+            AssertDimension(conv_num_split_flux[istate][idim].size(), conservative_soln2[0].size());
+        }
+    }
+
+    if constexpr(std::is_same<real,double>::value) {
+        // The vectorized kernel is only used on physical states, the point-wise flux
+        // applies the selected non-physical behavior otherwise.
+        real vel1_sqr = 0.0;
+        for(int idim=0; idim<dim; idim++){
+            const real vel1 = conservative_soln1[1+idim]/conservative_soln1[0];
+            vel1_sqr += vel1*vel1;
+        }
+        const real pressure1 = gamm1*(conservative_soln1[nstate-1] - 0.5*conservative_soln1[0]*vel1_sqr);
+        const bool is_physical = (conservative_soln1[0] > 0.0) && (pressure1 > 0.0) && is_physical_batch(conservative_soln2);
+        if(!is_physical) {
+            PhysicsBase<dim,nstate,real>::convective_numerical_split_flux_batch(conservative_soln1, conservative_soln2, conv_num_split_flux);
+            return;
+        }
+
+        // Select the flux once per batch such that the loop over the points does not branch.
+        if(two_point_num_flux_type == two_point_num_flux_enum::KG) {
+            convective_numerical_split_flux_batch_kernel<two_point_num_flux_enum::KG>(conservative_soln1, conservative_soln2, conv_num_split_flux);
+        } else if(two_point_num_flux_type == two_point_num_flux_enum::IR) {
+            convective_numerical_split_flux_batch_kernel<two_point_num_flux_enum::IR>(conservative_soln1, conservative_soln2, conv_num_split_flux);
+        } else if(two_point_num_flux_type == two_point_num_flux_enum::CH) {
+            convective_numerical_split_flux_batch_kernel<two_point_num_flux_enum::CH>(conservative_soln1, conservative_soln2, conv_num_split_flux);
+        } else if(two_point_num_flux_type == two_point_num_flux_enum::Ra) {
+            convective_numerical_split_flux_batch_kernel<two_point_num_flux_enum::Ra>(conservative_soln1, conservative_soln2, conv_num_split_flux);
+        }
+    } else {
+        PhysicsBase<dim,nstate,real>::convective_numerical_split_flux_batch(conservative_soln1, conservative_soln2, conv_num_split_flux);
+    }
+}
+
+template <int dim, int nstate, typename real>
+template <Parameters::AllParameters::TwoPointNumericalFlux flux_type>
+void Euler<dim, nstate, real>
+::convective_numerical_split_flux_batch_kernel(const std::array<real,nstate> &conservative_soln1,
+                                               const std::array<std::vector<real>,nstate> &conservative_soln2,
+                                               std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &conv_num_split_flux) const
+{
+    const unsigned int n_points = conservative_soln2[0].size();
+
+    // Quantities of the first state, shared by the whole batch.
+    const real density1 = conservative_soln1[0];
+    std::array<real,dim> vel1;
+    real vel1_sqr = 0.0;
+    for(int idim=0; idim<dim; idim++){
+        vel1[idim] = conservative_soln1[1+idim]/density1;
+        vel1_sqr += vel1[idim]*vel1[idim];
+    }
+    const real pressure1 = gamm1*(conservative_soln1[nstate-1] - 0.5*density1*vel1_sqr);
+
+    // Raw pointers such that the compiler does not have to reload the vector data in the loop.
+    std::array<const real*,nstate> soln2;
+    std::array<std::array<real*,dim>,nstate> flux;
+    for(int istate=0; istate<nstate; istate++){
+        soln2[istate] = conservative_soln2[istate].data();
+        for(int idim=0; idim<dim; idim++){
+            flux[istate][idim] = conv_num_split_flux[istate][idim].data();
+        }
+    }
+
+    DEAL_II_OPENMP_SIMD_PRAGMA
+    for(unsigned int ipoint=0; ipoint<n_points; ipoint++){
+        const real density2 = soln2[0][ipoint];
+        std::array<real,dim> vel2;
+        real vel2_sqr = 0.0;
+        for(int idim=0; idim<dim; idim++){
+            vel2[idim] = soln2[1+idim][ipoint]/density2;
+            vel2_sqr += vel2[idim]*vel2[idim];
+        }
+        const real pressure2 = gamm1*(soln2[nstate-1][ipoint] - 0.5*density2*vel2_sqr);
+
+        // Mass flux, velocity transported by it, pressure and energy flux per unit mass flux.
+        real mass_flux_density;
+        std::array<real,dim> mean_vel;
+        real mean_pressure;
+        real mean_enthalpy;
+        std::array<real,dim> energy_flux_correction;
+        for(int idim=0; idim<dim; idim++){
+            energy_flux_correction[idim] = 0.0;
+        }
+        if constexpr(flux_type == two_point_num_flux_enum::KG) {
+            // Gassner's paper (2016) Eq. 3.10
+            mass_flux_density = 0.5*(density1 + density2);
+            for(int idim=0; idim<dim; idim++){
+                mean_vel[idim] = 0.5*(vel1[idim] + vel2[idim]);
+            }
+            mean_pressure = 0.5*(pressure1 + pressure2);
+            const real mean_specific_total_energy = 0.5*(conservative_soln1[nstate-1]/density1 + soln2[nstate-1][ipoint]/density2);
+            mean_enthalpy = mean_specific_total_energy + mean_pressure/mass_flux_density;
+        }
+        if constexpr(flux_type == two_point_num_flux_enum::IR) {
+            // Gassner's paper (2016) Eq. 3.15 and 3.17, with the parameter vector of Eq. (3.14)
+            const real z1_first = sqrt(density1/pressure1);
+            const real z1_last = sqrt(density1*pressure1);
+            const real z2_first = sqrt(density2/pressure2);
+            const real z2_last = sqrt(density2*pressure2);
+            const real avg_z_first = 0.5*(z1_first + z2_first);
+            const real avg_z_last = 0.5*(z1_last + z2_last);
+            const real log_mean_z_first = compute_ismail_roe_logarithmic_mean(z1_first, z2_first);
+            const real log_mean_z_last = compute_ismail_roe_logarithmic_mean(z1_last, z2_last);
+            mass_flux_density = avg_z_first*log_mean_z_last;
+            real mean_vel_sqr = 0.0;
+            for(int idim=0; idim<dim; idim++){
+                mean_vel[idim] = 0.5*(z1_first*vel1[idim] + z2_first*vel2[idim])/avg_z_first;
+                mean_vel_sqr += mean_vel[idim]*mean_vel[idim];
+            }
+            mean_pressure = avg_z_last/avg_z_first;
+            mean_enthalpy = (gam+1.0)*(log_mean_z_last/log_mean_z_first) + gamm1*mean_pressure;
+            mean_enthalpy /= 2.0*gam;
+            mean_enthalpy *= gam/(mass_flux_density*gamm1);
+            mean_enthalpy += 0.5*mean_vel_sqr;
+        }
+        if constexpr(flux_type == two_point_num_flux_enum::CH || flux_type == two_point_num_flux_enum::Ra) {
+            // Chandrashekar's beta is half of Ranocha's, which changes the mean pressure and enthalpy.
+            const bool is_ranocha = (flux_type == two_point_num_flux_enum::Ra);
+            const real beta_scaling = is_ranocha ? 1.0 : 0.5;
+            mass_flux_density = compute_ismail_roe_logarithmic_mean(density1, density2);
+            const real beta1 = beta_scaling*density1/pressure1;
+            const real beta2 = beta_scaling*density2/pressure2;
+            const real beta_log = compute_ismail_roe_logarithmic_mean(beta1, beta2);
+            real mean_vel_sqr = 0.0;
+            for(int idim=0; idim<dim; idim++){
+                mean_vel[idim] = 0.5*(vel1[idim] + vel2[idim]);
+                mean_vel_sqr += mean_vel[idim]*mean_vel[idim];
+            }
+            if constexpr(flux_type == two_point_num_flux_enum::Ra) {
+                mean_pressure = 0.5*(pressure1 + pressure2);
+                mean_enthalpy = 1.0/(beta_log*gamm1) + mean_vel_sqr + 2.0*mean_pressure/mass_flux_density;
+                for(int idim=0; idim<dim; idim++){
+                    energy_flux_correction[idim] = 0.5*(pressure1*vel1[idim] + pressure2*vel2[idim]);
+                }
+            } else {
+                mean_pressure = 0.5*(density1 + density2)/(2.0*0.5*(beta1 + beta2));
+                mean_enthalpy = 1.0/(2.0*beta_log*gamm1) + mean_vel_sqr + mean_pressure/mass_flux_density;
+            }
+            mean_enthalpy -= 0.5*(0.5*(vel1_sqr + vel2_sqr));
+        }
+
+        for(int flux_dim=0; flux_dim<dim; flux_dim++){
+            const real mass_flux = mass_flux_density*mean_vel[flux_dim];
+            // Density equation
+            flux[0][flux_dim][ipoint] = mass_flux;
+            // Momentum equation
+            for(int velocity_dim=0; velocity_dim<dim; velocity_dim++){
+                flux[1+velocity_dim][flux_dim][ipoint] = mass_flux*mean_vel[velocity_dim];
+            }
+            flux[1+flux_dim][flux_dim][ipoint] += mean_pressure; // Add diagonal of pressure
+            // Energy equation
+            flux[nstate-1][flux_dim][ipoint] = mass_flux*mean_enthalpy - energy_flux_correction[flux_dim];
+        }
+    }
+}
+
 template <int dim, int nstate, typename real>
 std::array<real,nstate> Euler<dim, nstate, real>
 ::compute_entropy_variables (
@@ -699,6 +882,53 @@ std::array<real,nstate> Euler<dim, nstate, real>
     return entropy_var;
 }
 
+template <int dim, int nstate, typename real>
+void Euler<dim, nstate, real>
+::compute_entropy_variables_batch (
+    const std::array<std::vector<real>,nstate> &conservative_soln,
+    std::array<std::vector<real>,nstate> &entropy_var) const
+{
+    for(int istate=0; istate<nstate; istate++){
+        AssertDimension(conservative_soln[istate].size(), conservative_soln[0].size());
+        AssertDimension(entropy_var[istate].size(), conservative_soln[0].size());
+    }
+
+    if constexpr(std::is_same<real,double>::value) {
+        if(!is_physical_batch(conservative_soln)) {
+            PhysicsBase<dim,nstate,real>::compute_entropy_variables_batch(conservative_soln, entropy_var);
+            return;
+        }
+        const unsigned int n_points = conservative_soln[0].size();
+        std::array<const real*,nstate> soln;
+        std::array<real*,nstate> entropy;
+        for(int istate=0; istate<nstate; istate++){
+            soln[istate] = conservative_soln[istate].data();
+            entropy[istate] = entropy_var[istate].data();
+        }
+        DEAL_II_OPENMP_SIMD_PRAGMA
+        for(unsigned int ipoint=0; ipoint<n_points; ipoint++){
+            // Same operations as compute_entropy_variables() on a physical state.
+            const real density = soln[0][ipoint];
+            real vel_sqr = 0.0;
+            for(int idim=0; idim<dim; idim++){
+                const real vel = soln[1+idim][ipoint]/density;
+                vel_sqr += vel*vel;
+            }
+            const real pressure = gamm1*(soln[nstate-1][ipoint] - 0.5*density*vel_sqr);
+            const real entropy_value = log(pressure * pow(density, -gam));
+            const real rho_theta = pressure / gamm1;
+
+            entropy[0][ipoint] = (rho_theta *(gam + 1.0 - entropy_value) - soln[nstate-1][ipoint])/rho_theta;
+            for(int idim=0; idim<dim; idim++){
+                entropy[idim+1][ipoint] = soln[idim+1][ipoint] / rho_theta;
+            }
+            entropy[nstate-1][ipoint] = - density / rho_theta;
+        }
+    } else {
+        PhysicsBase<dim,nstate,real>::compute_entropy_variables_batch(conservative_soln, entropy_var);
+    }
+}
+
 template <int dim, int nstate, typename real>
 std::array<real,nstate> Euler<dim, nstate, real>
 ::compute_conservative_variables_from_entropy_variables (
@@ -807,6 +1037,63 @@ std::array<dealii::Tensor<1,dim,real>,nstate> Euler<dim,nstate,real>
     return conv_flux;
 }
 
+template <int dim, int nstate, typename real>
+void Euler<dim,nstate,real>
+::convective_flux_batch (
+    const std::array<std::vector<real>,nstate> &conservative_soln,
+    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &conv_flux) const
+{
+    for(int istate=0; istate<nstate; istate++){
+        AssertDimension(conservative_soln[istate].size(), conservative_soln[0].size());
+        for(int idim=0; idim<dim; idim++){
+            AssertDimension(conv_flux[istate][idim].size(), conservative_soln[0].size());
+        }
+    }
+
+    if constexpr(std::is_same<real,double>::value) {
+        if(!is_physical_batch(conservative_soln)) {
+            PhysicsBase<dim,nstate,real>::convective_flux_batch(conservative_soln, conv_flux);
+            return;
+        }
+        const unsigned int n_points = conservative_soln[0].size();
+        std::array<const real*,nstate> soln;
+        std::array<std::array<real*,dim>,nstate> flux;
+        for(int istate=0; istate<nstate; istate++){
+            soln[istate] = conservative_soln[istate].data();
+            for(int idim=0; idim<dim; idim++){
+                flux[istate][idim] = conv_flux[istate][idim].data();
+            }
+        }
+        DEAL_II_OPENMP_SIMD_PRAGMA
+        for(unsigned int ipoint=0; ipoint<n_points; ipoint++){
+            // Same operations as convective_flux() on a physical state.
+            const real density = soln[0][ipoint];
+            std::array<real,dim> vel;
+            real vel_sqr = 0.0;
+            for(int idim=0; idim<dim; idim++){
+                vel[idim] = soln[1+idim][ipoint]/density;
+                vel_sqr += vel[idim]*vel[idim];
+            }
+            const real pressure = gamm1*(soln[nstate-1][ipoint] - 0.5*density*vel_sqr);
+            const real specific_total_enthalpy = soln[nstate-1][ipoint]/density + pressure/density;
+
+            for(int flux_dim=0; flux_dim<dim; flux_dim++){
+                // Density equation
+                flux[0][flux_dim][ipoint] = soln[1+flux_dim][ipoint];
+                // Momentum equation
+                for(int velocity_dim=0; velocity_dim<dim; velocity_dim++){
+                    flux[1+velocity_dim][flux_dim][ipoint] = density*vel[flux_dim]*vel[velocity_dim];
+                }
+                flux[1+flux_dim][flux_dim][ipoint] += pressure; // Add diagonal of pressure
+                // Energy equation
+                flux[nstate-1][flux_dim][ipoint] = density*vel[flux_dim]*specific_total_enthalpy;
+            }
+        }
+    } else {
+        PhysicsBase<dim,nstate,real>::convective_flux_batch(conservative_soln, conv_flux);
+    }
+}
+
 template <int dim, int nstate, typename real>
 std::array<real,nstate> Euler<dim,nstate,real>
 ::convective_normal_flux (const std::array<real,nstate> &conservative_soln, const dealii::Tensor<1,dim,real> &normal) const
@@ -916,6 +1203,39 @@ real Euler<dim,nstate,real>
     return max_eig;
 }
 
+template <int dim, int nstate, typename real>
+real Euler<dim,nstate,real>
+::max_convective_eigenvalue_batch (const std::array<std::vector<real>,nstate> &conservative_soln) const
+{
+    if constexpr(std::is_same<real,double>::value) {
+        if(!is_physical_batch(conservative_soln)) {
+            return PhysicsBase<dim,nstate,real>::max_convective_eigenvalue_batch(conservative_soln);
+        }
+        const unsigned int n_points = conservative_soln[0].size();
+        std::array<const real*,nstate> soln;
+        for(int istate=0; istate<nstate; istate++){
+            AssertDimension(conservative_soln[istate].size(), conservative_soln[0].size());
+            soln[istate] = conservative_soln[istate].data();
+        }
+        real max_eig = 0.0;
+        for(unsigned int ipoint=0; ipoint<n_points; ipoint++){
+            // Same operations as max_convective_eigenvalue() on a physical state.
+            const real density = soln[0][ipoint];
+            real vel_sqr = 0.0;
+            for(int idim=0; idim<dim; idim++){
+                const real vel = soln[1+idim][ipoint]/density;
+                vel_sqr += vel*vel;
+            }
+            const real pressure = gamm1*(soln[nstate-1][ipoint] - 0.5*density*vel_sqr);
+            const real eig = sqrt(vel_sqr) + sqrt(pressure*gam/density);
+            max_eig = std::max(max_eig, eig);
+        }
+        return max_eig;
+    } else {
+        return PhysicsBase<dim,nstate,real>::max_convective_eigenvalue_batch(conservative_soln);
+    }
+}
+
 template <int dim, int nstate, typename real>
 real Euler<dim,nstate,real>
 ::max_convective_normal_eigenvalue (
@@ -963,6 +1283,33 @@ std::array<dealii::Tensor<1,dim,real>,nstate> Euler<dim,nstate,real>
     return diss_flux;
 }
 
+template <int dim, int nstate, typename real>
+void Euler<dim,nstate,real>
+::dissipative_flux_batch (
+    const std::array<std::vector<real>,nstate> &/*conservative_soln*/,
+    const std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &/*solution_gradient*/,
+    const dealii::types::global_dof_index /*cell_index*/,
+    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &diss_flux) const
+{
+    // No dissipation for Euler
+    for (int istate=0; istate<nstate; istate++) {
+        for (int idim=0; idim<dim; idim++) {
+            std::fill(diss_flux[istate][idim].begin(), diss_flux[istate][idim].end(), real(0.0));
+        }
+    }
+}
+
+template <int dim, int nstate, typename real>
+void Euler<dim,nstate,real>
+::dissipative_flux_interleaved_batch (
+    const std::array<std::vector<real>,nstate> &conservative_soln,
+    const std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &solution_gradient,
+    const std::vector<dealii::types::global_dof_index> &cell_indices,
+    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &diss_flux) const
+{
+    dissipative_flux_batch(conservative_soln, solution_gradient, cell_indices[0], diss_flux);
+}
+
 template <int dim, int nstate, typename real>
 void Euler<dim,nstate,real>
 ::boundary_riemann (
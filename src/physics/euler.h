@@ -144,6 +144,11 @@ public:
     std::array<dealii::Tensor<1,dim,real>,nstate> convective_flux (
         const std::array<real,nstate> &conservative_soln) const override;
 
+    /// Convective flux of a batch of points, vectorized for double on physical states.
+    void convective_flux_batch (
+        const std::array<std::vector<real>,nstate> &conservative_soln,
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &conv_flux) const override;
+
     /// Convective normal flux: \f$ \mathbf{F}_{conv} \cdot \hat{n} \f$
     std::array<real,nstate> convective_normal_flux (const std::array<real,nstate> &conservative_soln, const dealii::Tensor<1,dim,real> &normal) const;
 
@@ -160,6 +165,9 @@ public:
     /// Maximum convective eigenvalue
     real max_convective_eigenvalue (const std::array<real,nstate> &soln) const override;
 
+    /// Largest maximum convective eigenvalue of a batch of points, vectorized for double on physical states.
+    real max_convective_eigenvalue_batch (const std::array<std::vector<real>,nstate> &soln) const override;
+
     /// Maximum convective normal eigenvalue (used in Lax-Friedrichs)
     /** See the book I do like CFD, equation 3.6.18 */
     real max_convective_normal_eigenvalue (
@@ -180,6 +188,20 @@ public:
         const std::array<real,nstate> &conservative_soln,
         const std::array<dealii::Tensor<1,dim,real>,nstate> &solution_gradient) const;
 
+    /// Dissipative flux of a batch of points: 0
+    void dissipative_flux_batch (
+        const std::array<std::vector<real>,nstate> &conservative_soln,
+        const std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &solution_gradient,
+        const dealii::types::global_dof_index cell_index,
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &diss_flux) const override;
+
+    /// Dissipative flux of a batch of points interleaved across cells: 0
+    void dissipative_flux_interleaved_batch (
+        const std::array<std::vector<real>,nstate> &conservative_soln,
+        const std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &solution_gradient,
+        const std::vector<dealii::types::global_dof_index> &cell_indices,
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &diss_flux) const override;
+
     /// Source term is zero or depends on manufactured solution
     std::array<real,nstate> source_term (
         const dealii::Point<dim,real> &pos,
@@ -298,12 +320,26 @@ public:
         const std::array<real,nstate> &conservative_soln1,
         const std::array<real,nstate> &conservative_soln2) const override;
 
+    ///  Evaluates convective flux based on the chosen split form between one state and a batch of states.
+    /** The loop over the batch is branch-free and vectorized over the points for double,
+     *  falling back to the point-wise flux for AD types or if the batch holds a non-physical state.
+     */
+    void convective_numerical_split_flux_batch (
+        const std::array<real,nstate> &conservative_soln1,
+        const std::array<std::vector<real>,nstate> &conservative_soln2,
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &conv_num_split_flux) const override;
+
     /// Computes the entropy variables.
     /// Given conservative variables [density, [momentum], total energy],
     /// Computes entropy variables according to Chan 2018, eq. 119
     std::array<real,nstate> compute_entropy_variables (
                 const std::array<real,nstate> &conservative_soln) const;
 
+    /// Computes the entropy variables of a batch of points, vectorized for double on physical states.
+    void compute_entropy_variables_batch (
+                const std::array<std::vector<real>,nstate> &conservative_soln,
+                std::array<std::vector<real>,nstate> &entropy_var) const override;
+
     /// Computes the conservative variables [density, [momentum], total energy
     /// from the entropy variables according to Chan 2018, eq. 120
     std::array<real,nstate> compute_conservative_variables_from_entropy_variables (
@@ -446,6 +482,10 @@ protected:
         const std::array<real,nstate> &primitive_soln) const;
 
     /// Compute Ismail-Roe logarithmic mean
+    /** Uses a single logarithm, and a polynomial close to val1 == val2 such that it is accurate to machine precision.
+     *  See Ranocha, Hendrik, et al. "Efficient implementation of modern entropy stable and kinetic energy preserving
+     *  discontinuous Galerkin methods for conservation laws." arXiv:2112.10517 (2021).
+     */
     real compute_ismail_roe_logarithmic_mean(const real val1, const real val2) const;
 
     /** Entropy conserving split form flux of Ismail & Roe.
@@ -463,6 +503,19 @@ protected:
     std::array<dealii::Tensor<1,dim,real>,nstate> convective_numerical_split_flux_ranocha (
         const std::array<real,nstate> &conservative_soln1,
         const std::array<real,nstate> &conservative_soln2) const;
+
+    /// Whether all the states of a batch have a positive density and pressure.
+    /** The vectorized batches are only evaluated on physical states, such that the point-wise
+     *  functions apply the selected non-physical behavior otherwise.
+     */
+    bool is_physical_batch (const std::array<std::vector<real>,nstate> &conservative_soln) const;
+
+    /// Batched split form flux of the given type, see convective_numerical_split_flux_batch().
+    template <two_point_num_flux_enum flux_type>
+    void convective_numerical_split_flux_batch_kernel (
+        const std::array<real,nstate> &conservative_soln1,
+        const std::array<std::vector<real>,nstate> &conservative_soln2,
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &conv_num_split_flux) const;
 };
 
 } // Physics namespace
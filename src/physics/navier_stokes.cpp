@@ -535,6 +535,44 @@ std::array<dealii::Tensor<1,dim,real>,nstate> NavierStokes<dim,nstate,real>
     return viscous_flux;
 }
 
+template <int dim, int nstate, typename real>
+void NavierStokes<dim,nstate,real>
+::dissipative_flux_batch (
+    const std::array<std::vector<real>,nstate> &conservative_soln,
+    const std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &solution_gradient,
+    const dealii::types::global_dof_index /*cell_index*/,
+    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &diss_flux) const
+{
+    const unsigned int n_points = conservative_soln[0].size();
+    for(unsigned int ipoint=0; ipoint<n_points; ipoint++){
+        std::array<real,nstate> soln;
+        std::array<dealii::Tensor<1,dim,real>,nstate> soln_grad;
+        for(int istate=0; istate<nstate; istate++){
+            soln[istate] = conservative_soln[istate][ipoint];
+            for(int idim=0; idim<dim; idim++){
+                soln_grad[istate][idim] = solution_gradient[istate][idim][ipoint];
+            }
+        }
+        const std::array<dealii::Tensor<1,dim,real>,nstate> viscous_flux = dissipative_flux_templated<real>(soln, soln_grad);
+        for(int istate=0; istate<nstate; istate++){
+            for(int idim=0; idim<dim; idim++){
+                diss_flux[istate][idim][ipoint] = viscous_flux[istate][idim];
+            }
+        }
+    }
+}
+
+template <int dim, int nstate, typename real>
+void NavierStokes<dim,nstate,real>
+::dissipative_flux_interleaved_batch (
+    const std::array<std::vector<real>,nstate> &conservative_soln,
+    const std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &solution_gradient,
+    const std::vector<dealii::types::global_dof_index> &cell_indices,
+    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &diss_flux) const
+{
+    dissipative_flux_batch(conservative_soln, solution_gradient, cell_indices[0], diss_flux);
+}
+
 template <int dim, int nstate, typename real>
 dealii::Tensor<1,dim,real> NavierStokes<dim,nstate,real>
 ::compute_scaled_viscosity_gradient (
@@ -260,6 +260,20 @@ public:
         const std::array<real,nstate> &conservative_soln,
         const std::array<dealii::Tensor<1,dim,real>,nstate> &solution_gradient) const override;
 
+    /// Dissipative flux of a batch of points, without a virtual call per point.
+    void dissipative_flux_batch (
+        const std::array<std::vector<real>,nstate> &conservative_soln,
+        const std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &solution_gradient,
+        const dealii::types::global_dof_index cell_index,
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &diss_flux) const override;
+
+    /// Dissipative flux of a batch of points interleaved across cells, which does not depend on the cells.
+    void dissipative_flux_interleaved_batch (
+        const std::array<std::vector<real>,nstate> &conservative_soln,
+        const std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &solution_gradient,
+        const std::vector<dealii::types::global_dof_index> &cell_indices,
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &diss_flux) const override;
+
     /** Gradient of the scaled nondimensionalized viscosity coefficient
      *  Reference: Masatsuka 2018 "I do like CFD", p.148, eq.(4.14.14 and 4.14.17)
      */
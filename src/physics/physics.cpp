@@ -61,6 +61,156 @@ PhysicsBase<dim,nstate,real>::PhysicsBase(
         manufactured_solution_function_input)
 { }
 
+template <int dim, int nstate, typename real>
+void PhysicsBase<dim,nstate,real>::convective_flux_batch (
+    const std::array<std::vector<real>,nstate> &solution,
+    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &conv_flux) const
+{
+    const unsigned int n_points = solution[0].size();
+    for(unsigned int ipoint=0; ipoint<n_points; ipoint++){
+        std::array<real,nstate> soln;
+        for(int istate=0; istate<nstate; istate++){
+            soln[istate] = solution[istate][ipoint];
+        }
+        const std::array<dealii::Tensor<1,dim,real>,nstate> flux = convective_flux(soln);
+        for(int istate=0; istate<nstate; istate++){
+            for(int idim=0; idim<dim; idim++){
+                conv_flux[istate][idim][ipoint] = flux[istate][idim];
+            }
+        }
+    }
+}
+
+template <int dim, int nstate, typename real>
+void PhysicsBase<dim,nstate,real>::dissipative_flux_batch (
+    const std::array<std::vector<real>,nstate> &solution,
+    const std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &solution_gradient,
+    const dealii::types::global_dof_index cell_index,
+    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &diss_flux) const
+{
+    const unsigned int n_points = solution[0].size();
+    for(unsigned int ipoint=0; ipoint<n_points; ipoint++){
+        std::array<real,nstate> soln;
+        std::array<dealii::Tensor<1,dim,real>,nstate> soln_grad;
+        for(int istate=0; istate<nstate; istate++){
+            soln[istate] = solution[istate][ipoint];
+            for(int idim=0; idim<dim; idim++){
+                soln_grad[istate][idim] = solution_gradient[istate][idim][ipoint];
+            }
+        }
+        const std::array<dealii::Tensor<1,dim,real>,nstate> flux = dissipative_flux(soln, soln_grad, cell_index);
+        for(int istate=0; istate<nstate; istate++){
+            for(int idim=0; idim<dim; idim++){
+                diss_flux[istate][idim][ipoint] = flux[istate][idim];
+            }
+        }
+    }
+}
+
+template <int dim, int nstate, typename real>
+void PhysicsBase<dim,nstate,real>::dissipative_flux_interleaved_batch (
+    const std::array<std::vector<real>,nstate> &solution,
+    const std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &solution_gradient,
+    const std::vector<dealii::types::global_dof_index> &cell_indices,
+    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &diss_flux) const
+{
+    const unsigned int n_points = solution[0].size();
+    const unsigned int n_cells = cell_indices.size();
+    for(unsigned int ipoint=0; ipoint<n_points; ipoint++){
+        std::array<real,nstate> soln;
+        std::array<dealii::Tensor<1,dim,real>,nstate> soln_grad;
+        for(int istate=0; istate<nstate; istate++){
+            soln[istate] = solution[istate][ipoint];
+            for(int idim=0; idim<dim; idim++){
+                soln_grad[istate][idim] = solution_gradient[istate][idim][ipoint];
+            }
+        }
+        const std::array<dealii::Tensor<1,dim,real>,nstate> flux = dissipative_flux(soln, soln_grad, cell_indices[ipoint % n_cells]);
+        for(int istate=0; istate<nstate; istate++){
+            for(int idim=0; idim<dim; idim++){
+                diss_flux[istate][idim][ipoint] = flux[istate][idim];
+            }
+        }
+    }
+}
+
+template <int dim, int nstate, typename real>
+void PhysicsBase<dim,nstate,real>::source_term_batch (
+    const dealii::Tensor<1,dim,std::vector<real>> &pos,
+    const std::array<std::vector<real>,nstate> &solution,
+    const real current_time,
+    const dealii::types::global_dof_index cell_index,
+    std::array<std::vector<real>,nstate> &source) const
+{
+    const unsigned int n_points = solution[0].size();
+    for(unsigned int ipoint=0; ipoint<n_points; ipoint++){
+        dealii::Point<dim,real> point;
+        for(int idim=0; idim<dim; idim++){
+            point[idim] = pos[idim][ipoint];
+        }
+        std::array<real,nstate> soln;
+        for(int istate=0; istate<nstate; istate++){
+            soln[istate] = solution[istate][ipoint];
+        }
+        const std::array<real,nstate> source_at_point = source_term(point, soln, current_time, cell_index);
+        for(int istate=0; istate<nstate; istate++){
+            source[istate][ipoint] = source_at_point[istate];
+        }
+    }
+}
+
+template <int dim, int nstate, typename real>
+void PhysicsBase<dim,nstate,real>::compute_entropy_variables_batch (
+    const std::array<std::vector<real>,nstate> &conservative_soln,
+    std::array<std::vector<real>,nstate> &entropy_var) const
+{
+    const unsigned int n_points = conservative_soln[0].size();
+    for(unsigned int ipoint=0; ipoint<n_points; ipoint++){
+        std::array<real,nstate> soln;
+        for(int istate=0; istate<nstate; istate++){
+            soln[istate] = conservative_soln[istate][ipoint];
+        }
+        const std::array<real,nstate> entropy_var_at_point = compute_entropy_variables(soln);
+        for(int istate=0; istate<nstate; istate++){
+            entropy_var[istate][ipoint] = entropy_var_at_point[istate];
+        }
+    }
+}
+
+template <int dim, int nstate, typename real>
+real PhysicsBase<dim,nstate,real>::max_convective_eigenvalue_batch (
+    const std::array<std::vector<real>,nstate> &soln) const
+{
+    const unsigned int n_points = soln[0].size();
+    real max_eig = 0.0;
+    for(unsigned int ipoint=0; ipoint<n_points; ipoint++){
+        std::array<real,nstate> soln_at_point;
+        for(int istate=0; istate<nstate; istate++){
+            soln_at_point[istate] = soln[istate][ipoint];
+        }
+        const real eig = max_convective_eigenvalue(soln_at_point);
+        if(ipoint == 0 || eig > max_eig) max_eig = eig;
+    }
+    return max_eig;
+}
+
+template <int dim, int nstate, typename real>
+real PhysicsBase<dim,nstate,real>::max_viscous_eigenvalue_batch (
+    const std::array<std::vector<real>,nstate> &soln) const
+{
+    const unsigned int n_points = soln[0].size();
+    real max_eig = 0.0;
+    for(unsigned int ipoint=0; ipoint<n_points; ipoint++){
+        std::array<real,nstate> soln_at_point;
+        for(int istate=0; istate<nstate; istate++){
+            soln_at_point[istate] = soln[istate][ipoint];
+        }
+        const real eig = max_viscous_eigenvalue(soln_at_point);
+        if(ipoint == 0 || eig > max_eig) max_eig = eig;
+    }
+    return max_eig;
+}
+
 template <int dim, int nstate, typename real>
 std::array<dealii::Tensor<1,dim,real>,nstate> PhysicsBase<dim,nstate,real>::convective_numerical_split_flux (
     const std::array<real,nstate> &/*conservative_soln1*/,
@@ -72,6 +222,27 @@ std::array<dealii::Tensor<1,dim,real>,nstate> PhysicsBase<dim,nstate,real>::conv
     return dummy;
 }
 
+template <int dim, int nstate, typename real>
+void PhysicsBase<dim,nstate,real>::convective_numerical_split_flux_batch (
+    const std::array<real,nstate> &conservative_soln1,
+    const std::array<std::vector<real>,nstate> &conservative_soln2,
+    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &conv_num_split_flux) const
+{
+    const unsigned int n_points = conservative_soln2[0].size();
+    for(unsigned int ipoint=0; ipoint<n_points; ipoint++){
+        std::array<real,nstate> soln2;
+        for(int istate=0; istate<nstate; istate++){
+            soln2[istate] = conservative_soln2[istate][ipoint];
+        }
+        const std::array<dealii::Tensor<1,dim,real>,nstate> flux = convective_numerical_split_flux(conservative_soln1, soln2);
+        for(int istate=0; istate<nstate; istate++){
+            for(int idim=0; idim<dim; idim++){
+                conv_num_split_flux[istate][idim][ipoint] = flux[istate][idim];
+            }
+        }
+    }
+}
+
 template <int dim, int nstate, typename real>
 real PhysicsBase<dim,nstate,real>
 ::max_convective_normal_eigenvalue (
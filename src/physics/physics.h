@@ -74,15 +74,42 @@ public:
     virtual std::array<dealii::Tensor<1,dim,real>,nstate> convective_flux (
         const std::array<real,nstate> &solution) const = 0;
 
+    /// Convective fluxes of a batch of points.
+    /** The batch and the fluxes are stored by component, one vector of size n_points per state
+     *  (and direction), such that physics can vectorize over the points of a cell and is
+     *  dispatched once per cell. The default implementation loops over convective_flux().
+     */
+    virtual void convective_flux_batch (
+        const std::array<std::vector<real>,nstate> &solution,
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &conv_flux) const;
+
     /// Convective Numerical Split Flux for split form
     virtual std::array<dealii::Tensor<1,dim,real>,nstate> convective_numerical_split_flux (
         const std::array<real,nstate> &conservative_soln1,
         const std::array<real,nstate> &conservative_soln2) const;
 
+    /// Convective Numerical Split Flux between one state and a batch of states.
+    /** Evaluates convective_numerical_split_flux() of conservative_soln1 with each point of the batch,
+     *  that is a full row of the split form Hadamard product. The batch and the fluxes are stored
+     *  by component, one vector of size n_points per state (and direction), such that physics
+     *  can vectorize over the points. The default implementation loops over the points.
+     */
+    virtual void convective_numerical_split_flux_batch (
+        const std::array<real,nstate> &conservative_soln1,
+        const std::array<std::vector<real>,nstate> &conservative_soln2,
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &conv_num_split_flux) const;
+
     /// Computes the entropy variables.
     virtual std::array<real,nstate> compute_entropy_variables (
                 const std::array<real,nstate> &conservative_soln) const = 0;
 
+    /// Computes the entropy variables of a batch of points.
+    /** Stored by component as in convective_flux_batch(). The default implementation loops over compute_entropy_variables().
+     */
+    virtual void compute_entropy_variables_batch (
+                const std::array<std::vector<real>,nstate> &conservative_soln,
+                std::array<std::vector<real>,nstate> &entropy_var) const;
+
     /// Computes the conservative variables from the entropy variables.
     virtual std::array<real,nstate> compute_conservative_variables_from_entropy_variables (
                 const std::array<real,nstate> &entropy_var) const = 0;
@@ -97,6 +124,11 @@ public:
     /// Maximum convective eigenvalue
     virtual real max_convective_eigenvalue (const std::array<real,nstate> &soln) const = 0;
 
+    /// Largest maximum convective eigenvalue of a batch of points.
+    /** Stored by component as in convective_flux_batch(). The default implementation loops over max_convective_eigenvalue().
+     */
+    virtual real max_convective_eigenvalue_batch (const std::array<std::vector<real>,nstate> &soln) const;
+
     /// Maximum convective normal eigenvalue (used in Lax-Friedrichs)
     virtual real max_convective_normal_eigenvalue (
         const std::array<real,nstate> &soln,
@@ -105,6 +137,11 @@ public:
     /// Maximum viscous eigenvalue.
     virtual real max_viscous_eigenvalue (const std::array<real,nstate> &soln) const = 0;
 
+    /// Largest maximum viscous eigenvalue of a batch of points.
+    /** Stored by component as in convective_flux_batch(). The default implementation loops over max_viscous_eigenvalue().
+     */
+    virtual real max_viscous_eigenvalue_batch (const std::array<std::vector<real>,nstate> &soln) const;
+
     // /// Evaluate the diffusion matrix \f$ A \f$ such that \f$F_v = A \nabla u\f$.
     // virtual std::array<dealii::Tensor<1,dim,real>,nstate> apply_diffusion_matrix (
     //     const std::array<real,nstate> &solution,
@@ -116,6 +153,25 @@ public:
         const std::array<dealii::Tensor<1,dim,real>,nstate> &solution_gradient,
         const dealii::types::global_dof_index cell_index) const = 0;
 
+    /// Dissipative fluxes of a batch of points.
+    /** Stored by component as in convective_flux_batch(). The default implementation loops over dissipative_flux().
+     */
+    virtual void dissipative_flux_batch (
+        const std::array<std::vector<real>,nstate> &solution,
+        const std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &solution_gradient,
+        const dealii::types::global_dof_index cell_index,
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &diss_flux) const;
+
+    /// Dissipative fluxes of a batch of points interleaved across cells.
+    /** Point ipoint belongs to the cell cell_indices[ipoint % cell_indices.size()], as in the cell batches of DGStrong.
+     *  Stored by component as in convective_flux_batch(). The default implementation loops over dissipative_flux().
+     */
+    virtual void dissipative_flux_interleaved_batch (
+        const std::array<std::vector<real>,nstate> &solution,
+        const std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &solution_gradient,
+        const std::vector<dealii::types::global_dof_index> &cell_indices,
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &diss_flux) const;
+
     /// Artificial dissipative fluxes that will be differentiated ONCE in space.
     /** Stems from the Persson2006 paper on subcell shock capturing */
 /*    virtual std::array<dealii::Tensor<1,dim,real>,nstate> artificial_dissipative_flux (
@@ -130,6 +186,17 @@ public:
         const real current_time,
         const dealii::types::global_dof_index cell_index) const = 0;
 
+    /// Source term of a batch of points.
+    /** The coordinates of the points are stored by direction, and the solution and source by component
+     *  as in convective_flux_batch(). The default implementation loops over source_term().
+     */
+    virtual void source_term_batch (
+        const dealii::Tensor<1,dim,std::vector<real>> &pos,
+        const std::array<std::vector<real>,nstate> &solution,
+        const real current_time,
+        const dealii::types::global_dof_index cell_index,
+        std::array<std::vector<real>,nstate> &source) const;
+
     /// Physical source term that does require differentiation.
     virtual std::array<real,nstate> physical_source_term (
         const dealii::Point<dim,real> &pos,
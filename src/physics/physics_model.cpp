@@ -98,6 +98,106 @@ std::array<dealii::Tensor<1,dim,real>,nstate> PhysicsModel<dim,nstate,real,nstat
     return diss_flux;
 }
 
+template <int dim, int nstate, typename real, int nstate_baseline_physics>
+void PhysicsModel<dim,nstate,real,nstate_baseline_physics>
+::convective_flux_batch (
+    const std::array<std::vector<real>,nstate> &conservative_soln,
+    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &conv_flux) const
+{
+    if constexpr(nstate==nstate_baseline_physics) {
+        // Baseline convective flux of the whole batch
+        physics_baseline->convective_flux_batch(conservative_soln, conv_flux);
+
+        // Add the model convective flux
+        const unsigned int n_points = conservative_soln[0].size();
+        for(unsigned int ipoint=0; ipoint<n_points; ipoint++){
+            std::array<real,nstate> soln;
+            for(int s=0; s<nstate; ++s){
+                soln[s] = conservative_soln[s][ipoint];
+            }
+            const std::array<dealii::Tensor<1,dim,real>,nstate> model_conv_flux = model->convective_flux(soln);
+            for(int s=0; s<nstate; ++s){
+                for (int d=0; d<dim; ++d) {
+                    conv_flux[s][d][ipoint] += model_conv_flux[s][d];
+                }
+            }
+        }
+    } else {
+        PhysicsBase<dim,nstate,real>::convective_flux_batch(conservative_soln, conv_flux);
+    }
+}
+
+template <int dim, int nstate, typename real, int nstate_baseline_physics>
+void PhysicsModel<dim,nstate,real,nstate_baseline_physics>
+::dissipative_flux_batch (
+    const std::array<std::vector<real>,nstate> &conservative_soln,
+    const std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &solution_gradient,
+    const dealii::types::global_dof_index cell_index,
+    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &diss_flux) const
+{
+    if constexpr(nstate==nstate_baseline_physics) {
+        // Baseline dissipative flux of the whole batch
+        physics_baseline->dissipative_flux_batch(conservative_soln, solution_gradient, cell_index, diss_flux);
+
+        // Add the model dissipative flux
+        const unsigned int n_points = conservative_soln[0].size();
+        for(unsigned int ipoint=0; ipoint<n_points; ipoint++){
+            std::array<real,nstate> soln;
+            std::array<dealii::Tensor<1,dim,real>,nstate> soln_grad;
+            for(int s=0; s<nstate; ++s){
+                soln[s] = conservative_soln[s][ipoint];
+                for (int d=0; d<dim; ++d) {
+                    soln_grad[s][d] = solution_gradient[s][d][ipoint];
+                }
+            }
+            const std::array<dealii::Tensor<1,dim,real>,nstate> model_diss_flux = model->dissipative_flux(soln, soln_grad, cell_index);
+            for(int s=0; s<nstate; ++s){
+                for (int d=0; d<dim; ++d) {
+                    diss_flux[s][d][ipoint] += model_diss_flux[s][d];
+                }
+            }
+        }
+    } else {
+        PhysicsBase<dim,nstate,real>::dissipative_flux_batch(conservative_soln, solution_gradient, cell_index, diss_flux);
+    }
+}
+
+template <int dim, int nstate, typename real, int nstate_baseline_physics>
+void PhysicsModel<dim,nstate,real,nstate_baseline_physics>
+::dissipative_flux_interleaved_batch (
+    const std::array<std::vector<real>,nstate> &conservative_soln,
+    const std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &solution_gradient,
+    const std::vector<dealii::types::global_dof_index> &cell_indices,
+    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &diss_flux) const
+{
+    if constexpr(nstate==nstate_baseline_physics) {
+        // Baseline dissipative flux of the whole batch
+        physics_baseline->dissipative_flux_interleaved_batch(conservative_soln, solution_gradient, cell_indices, diss_flux);
+
+        // Add the model dissipative flux, which depends on the cell of each point
+        const unsigned int n_points = conservative_soln[0].size();
+        const unsigned int n_cells = cell_indices.size();
+        for(unsigned int ipoint=0; ipoint<n_points; ipoint++){
+            std::array<real,nstate> soln;
+            std::array<dealii::Tensor<1,dim,real>,nstate> soln_grad;
+            for(int s=0; s<nstate; ++s){
+                soln[s] = conservative_soln[s][ipoint];
+                for (int d=0; d<dim; ++d) {
+                    soln_grad[s][d] = solution_gradient[s][d][ipoint];
+                }
+            }
+            const std::array<dealii::Tensor<1,dim,real>,nstate> model_diss_flux = model->dissipative_flux(soln, soln_grad, cell_indices[ipoint % n_cells]);
+            for(int s=0; s<nstate; ++s){
+                for (int d=0; d<dim; ++d) {
+                    diss_flux[s][d][ipoint] += model_diss_flux[s][d];
+                }
+            }
+        }
+    } else {
+        PhysicsBase<dim,nstate,real>::dissipative_flux_interleaved_batch(conservative_soln, solution_gradient, cell_indices, diss_flux);
+    }
+}
+
 template <int dim, int nstate, typename real, int nstate_baseline_physics>
 std::array<real,nstate> PhysicsModel<dim,nstate,real,nstate_baseline_physics>
 ::physical_source_term (
@@ -184,6 +284,21 @@ std::array<dealii::Tensor<1,dim,real>,nstate> PhysicsModel<dim,nstate,real,nstat
     return conv_num_split_flux;
 }
 
+template <int dim, int nstate, typename real, int nstate_baseline_physics>
+void PhysicsModel<dim,nstate,real,nstate_baseline_physics>
+::convective_numerical_split_flux_batch(const std::array<real,nstate> &conservative_soln1,
+                                        const std::array<std::vector<real>,nstate> &conservative_soln2,
+                                        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &conv_num_split_flux) const
+{
+    if constexpr(nstate==nstate_baseline_physics) {
+        physics_baseline->convective_numerical_split_flux_batch(conservative_soln1,conservative_soln2,conv_num_split_flux);
+    } else {
+        pcout << "Error: convective_numerical_split_flux_batch() not implemented for nstate!=nstate_baseline_physics." << std::endl;
+        pcout << "Aborting..." << std::endl;
+        std::abort();
+    }
+}
+
 template <int dim, int nstate, typename real, int nstate_baseline_physics>
 std::array<real,nstate> PhysicsModel<dim, nstate, real, nstate_baseline_physics>
 ::compute_entropy_variables (
@@ -193,12 +308,27 @@ std::array<real,nstate> PhysicsModel<dim, nstate, real, nstate_baseline_physics>
     if constexpr(nstate==nstate_baseline_physics) {
         entropy_var = physics_baseline->compute_entropy_variables(conservative_soln);
     } else {
-        // TO DO, make use of the physics_model object for nstate>nstate_baseline_physics
+        pcout << "Error: compute_entropy_variables() not implemented for nstate!=nstate_baseline_physics." << std::endl;
+        pcout << "Aborting..." << std::endl;
         std::abort();
     }
     return entropy_var;
 }
 
+template <int dim, int nstate, typename real, int nstate_baseline_physics>
+void PhysicsModel<dim, nstate, real, nstate_baseline_physics>
+::compute_entropy_variables_batch (
+    const std::array<std::vector<real>,nstate> &conservative_soln,
+    std::array<std::vector<real>,nstate> &entropy_var) const
+{
+    if constexpr(nstate==nstate_baseline_physics) {
+        physics_baseline->compute_entropy_variables_batch(conservative_soln, entropy_var);
+    } else {
+        // Loops over compute_entropy_variables() quadrature point by quadrature point.
+        PhysicsBase<dim,nstate,real>::compute_entropy_variables_batch(conservative_soln, entropy_var);
+    }
+}
+
 template <int dim, int nstate, typename real, int nstate_baseline_physics>
 std::array<real,nstate> PhysicsModel<dim, nstate, real, nstate_baseline_physics>
 ::compute_conservative_variables_from_entropy_variables (
@@ -208,7 +338,8 @@ std::array<real,nstate> PhysicsModel<dim, nstate, real, nstate_baseline_physics>
     if constexpr(nstate==nstate_baseline_physics) {
         conservative_soln = physics_baseline->compute_conservative_variables_from_entropy_variables(entropy_var);
     } else {
-        // TO DO, make use of the physics_model object for nstate>nstate_baseline_physics
+        pcout << "Error: compute_conservative_variables_from_entropy_variables() not implemented for nstate!=nstate_baseline_physics." << std::endl;
+        pcout << "Aborting..." << std::endl;
         std::abort();
     }
     return conservative_soln;
@@ -263,6 +394,17 @@ real PhysicsModel<dim,nstate,real,nstate_baseline_physics>
     return max_eig;
 }
 
+template <int dim, int nstate, typename real, int nstate_baseline_physics>
+real PhysicsModel<dim,nstate,real,nstate_baseline_physics>
+::max_convective_eigenvalue_batch (const std::array<std::vector<real>,nstate> &conservative_soln) const
+{
+    if constexpr(nstate==nstate_baseline_physics) {
+        return physics_baseline->max_convective_eigenvalue_batch(conservative_soln);
+    } else {
+        return PhysicsBase<dim,nstate,real>::max_convective_eigenvalue_batch(conservative_soln);
+    }
+}
+
 template <int dim, int nstate, typename real, int nstate_baseline_physics>
 real PhysicsModel<dim,nstate,real,nstate_baseline_physics>
 ::max_convective_normal_eigenvalue (
@@ -42,6 +42,28 @@ public:
         const std::array<dealii::Tensor<1,dim,real>,nstate> &solution_gradient,
         const dealii::types::global_dof_index cell_index) const;
 
+    /// Convective flux of a batch of points.
+    /** For nstate==nstate_baseline_physics, the baseline physics evaluates the whole batch
+     *  and the model flux is added point by point. Otherwise, loops over convective_flux().
+     */
+    void convective_flux_batch (
+        const std::array<std::vector<real>,nstate> &conservative_soln,
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &conv_flux) const override;
+
+    /// Dissipative flux of a batch of points, see convective_flux_batch().
+    void dissipative_flux_batch (
+        const std::array<std::vector<real>,nstate> &conservative_soln,
+        const std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &solution_gradient,
+        const dealii::types::global_dof_index cell_index,
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &diss_flux) const override;
+
+    /// Dissipative flux of a batch of points interleaved across cells, see convective_flux_batch().
+    void dissipative_flux_interleaved_batch (
+        const std::array<std::vector<real>,nstate> &conservative_soln,
+        const std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &solution_gradient,
+        const std::vector<dealii::types::global_dof_index> &cell_indices,
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &diss_flux) const override;
+
     /// Physical source term
     std::array<real,nstate> physical_source_term (
         const dealii::Point<dim,real> &pos,
@@ -64,10 +86,21 @@ public:
         const std::array<real,nstate> &conservative_soln1,
         const std::array<real,nstate> &conservative_soln2) const;
 
+    /// Convective Numerical Split Flux between one state and a batch of states
+    void convective_numerical_split_flux_batch (
+        const std::array<real,nstate> &conservative_soln1,
+        const std::array<std::vector<real>,nstate> &conservative_soln2,
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &conv_num_split_flux) const;
+
     /// Computes the entropy variables.
     std::array<real,nstate> compute_entropy_variables (
                 const std::array<real,nstate> &conservative_soln) const;
 
+    /// Computes the entropy variables of a batch of points.
+    void compute_entropy_variables_batch (
+                const std::array<std::vector<real>,nstate> &conservative_soln,
+                std::array<std::vector<real>,nstate> &entropy_var) const override;
+
     /// Computes the conservative variables from the entropy variables.
     std::array<real,nstate> compute_conservative_variables_from_entropy_variables (
                 const std::array<real,nstate> &entropy_var) const;
@@ -82,6 +115,9 @@ public:
     /// Maximum convective eigenvalue
     real max_convective_eigenvalue (const std::array<real,nstate> &soln) const;
 
+    /// Largest maximum convective eigenvalue of a batch of points.
+    real max_convective_eigenvalue_batch (const std::array<std::vector<real>,nstate> &soln) const override;
+
     /// Maximum convective normal eigenvalue (used in Lax-Friedrichs)
     real max_convective_normal_eigenvalue (
         const std::array<real,nstate> &soln,
@@ -45,7 +45,7 @@ void ROMTestLocation<dim, nstate>::compute_FOM_to_initial_ROM_error(){
     const bool compute_dRdW = true;
     flow_solver->dg->assemble_residual(compute_dRdW);
     dealii::TrilinosWrappers::SparseMatrix system_matrix_transpose = dealii::TrilinosWrappers::SparseMatrix();
-    system_matrix_transpose.copy_from(flow_solver->dg->system_matrix_transpose);
+    system_matrix_transpose.copy_from(flow_solver->dg->get_system_matrix_transpose());
 
     // Initialize with same parallel layout as dg->right_hand_side
     dealii::LinearAlgebra::distributed::Vector<double> adjoint(flow_solver->dg->right_hand_side);
@@ -86,7 +86,7 @@ void ROMTestLocation<dim, nstate>::compute_initial_rom_to_final_rom_error(std::s
     flow_solver->dg->assemble_residual(compute_dRdW);
 
     const Epetra_CrsMatrix epetra_pod_basis = pod_updated->getPODBasis()->trilinos_matrix();
-    const Epetra_CrsMatrix epetra_system_matrix_transpose = flow_solver->dg->system_matrix_transpose.trilinos_matrix();
+    const Epetra_CrsMatrix epetra_system_matrix_transpose = flow_solver->dg->get_system_matrix_transpose().trilinos_matrix();
 
     Epetra_CrsMatrix epetra_petrov_galerkin_basis(Epetra_DataAccess::Copy, epetra_system_matrix_transpose.DomainMap(), pod_updated->getPODBasis()->n());
     EpetraExt::MatrixMatrix::Multiply(epetra_system_matrix_transpose, true, epetra_pod_basis, false, epetra_petrov_galerkin_basis, true);
@@ -22,6 +22,27 @@ int TaylorGreenVortexEnergyCheck<dim, nstate>::run_test() const
     std::unique_ptr<FlowSolver::FlowSolver<dim,nstate>> flow_solver = FlowSolver::FlowSolverFactory<dim,nstate>::select_flow_case(this->all_parameters, parameter_handler);
     static_cast<void>(flow_solver->run());
 
+    // The residual assembled in batches of cells must match the one assembled cell by cell at the final time.
+    if (flow_solver->dg->use_cell_batched_residual) {
+        if (!flow_solver->dg->prepare_cell_batches()) {
+            pcout << "The mesh was not accepted for the cell-batched residual." << std::endl;
+            return 1;
+        }
+        flow_solver->dg->assemble_residual();
+        const dealii::LinearAlgebra::distributed::Vector<double> rhs_cell_batched(flow_solver->dg->right_hand_side);
+        flow_solver->dg->use_cell_batched_residual = false;
+        flow_solver->dg->assemble_residual();
+        flow_solver->dg->use_cell_batched_residual = true;
+        dealii::LinearAlgebra::distributed::Vector<double> rhs_difference(rhs_cell_batched);
+        rhs_difference -= flow_solver->dg->right_hand_side;
+        const double rhs_relative_difference = rhs_difference.linfty_norm() / flow_solver->dg->right_hand_side.linfty_norm();
+        pcout << "Relative difference between the cell-batched and cell-by-cell residuals: " << rhs_relative_difference << std::endl;
+        if (rhs_relative_difference > 1.0e-12) {
+            pcout << "The cell-batched residual does not match the cell-by-cell residual." << std::endl;
+            return 1;
+        }
+    }
+
     // Compute kinetic energy and theoretical dissipation rate
     std::unique_ptr<FlowSolver::PeriodicTurbulence<dim, nstate>> flow_solver_case = std::make_unique<FlowSolver::PeriodicTurbulence<dim,nstate>>(this->all_parameters);
     flow_solver_case->compute_and_update_integrated_quantities(*(flow_solver->dg));
@@ -30,6 +30,9 @@ Parameters::AllParameters TimeRefinementStudyReference<dim,nstate>::reinit_param
     //Change to RK because at small dt RRK is more costly but doesn't impact solution much
     using ODESolverEnum = Parameters::ODESolverParam::ODESolverEnum;
     parameters.ode_solver_param.ode_solver_type = ODESolverEnum::runge_kutta_solver;
+    // The stages are those of runge_kutta_method, which differ from those of the low-storage and IMEX methods
+    parameters.ode_solver_param.n_rk_stages = parameters.ode_solver_param.runge_kutta_n_rk_stages;
+    parameters.ode_solver_param.rk_order = parameters.ode_solver_param.runge_kutta_rk_order;
 
     pcout << "Using timestep size dt = " << dt << " for reference solution." << std::endl;
 
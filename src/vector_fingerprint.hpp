@@ -0,0 +1,82 @@
+#ifndef PHILIP_VECTOR_FINGERPRINT_HPP
+#define PHILIP_VECTOR_FINGERPRINT_HPP
+
+#include <cstdint>
+#include <cstring>
+
+#include <deal.II/base/mpi.h>
+
+namespace PHiLiP {
+
+/// Identifies the locally owned entries of a distributed vector without keeping a copy of them.
+/** Used to check whether a vector changed since some quantity was last computed from it, such as
+ *  the residual derivatives or the metric terms cache. The entries are hashed by their bit
+ *  patterns in a single pass, which neither allocates nor communicates. Two fingerprints are
+ *  only equal for different entries in case of a 64-bit hash collision.
+ *
+ *  The comparison is local to each processor. Since the caches are refilled collectively, the
+ *  result must be made consistent with up_to_date_on_all_processors() before acting on it.
+ */
+class VectorFingerprint
+{
+public:
+    /// Fingerprint of an empty vector, which matches no vector that has been computed from.
+    VectorFingerprint() = default;
+
+    /// Fingerprint of the locally owned entries of the vector.
+    template <typename VectorType>
+    explicit VectorFingerprint(const VectorType &vector)
+        : global_size(vector.size())
+        , is_set(true)
+    {
+        std::uint64_t index = 0;
+        for (auto entry = vector.begin(); entry != vector.end(); ++entry, ++index) {
+            const double value = *entry;
+            std::uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            hash = hash * 0x9E3779B97F4A7C15ull + mix(bits ^ mix(index));
+        }
+        n_local_entries = index;
+    }
+
+    /// Whether both fingerprints were taken from vectors with the same locally owned entries.
+    bool operator==(const VectorFingerprint &other) const
+    {
+        return is_set && other.is_set
+               && global_size == other.global_size
+               && n_local_entries == other.n_local_entries
+               && hash == other.hash;
+    }
+
+    /// Negation of operator==().
+    bool operator!=(const VectorFingerprint &other) const { return !(*this == other); }
+
+    /// Whether the local check holds on every processor.
+    /** A single reduction of one integer, to be done once for all the vectors a cache depends on.
+     */
+    static bool up_to_date_on_all_processors(const bool locally_up_to_date, const MPI_Comm &mpi_communicator)
+    {
+        return dealii::Utilities::MPI::min(locally_up_to_date ? 1 : 0, mpi_communicator) == 1;
+    }
+
+private:
+    /// Finalizer of the splitmix64 generator, such that nearby bit patterns give unrelated hashes.
+    static std::uint64_t mix(std::uint64_t x)
+    {
+        x ^= x >> 30;
+        x *= 0xBF58476D1CE4E5B9ull;
+        x ^= x >> 27;
+        x *= 0x94D049BB133111EBull;
+        x ^= x >> 31;
+        return x;
+    }
+
+    std::uint64_t global_size = 0; ///< Global size of the vector.
+    std::uint64_t n_local_entries = 0; ///< Number of locally owned entries that were hashed.
+    std::uint64_t hash = 0; ///< Hash of the locally owned entries.
+    bool is_set = false; ///< False for a default-constructed fingerprint.
+};
+
+} // PHiLiP namespace
+
+#endif
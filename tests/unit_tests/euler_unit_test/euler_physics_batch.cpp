@@ -0,0 +1,116 @@
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include <deal.II/base/parameter_handler.h>
+
+#include "parameters/all_parameters.h"
+#include "parameters/parameters.h"
+#include "physics/euler.h"
+#include "physics/navier_stokes.h"
+
+const double TOLERANCE = 1E-13;
+
+/// Relative difference used to compare the batched and point-wise physics.
+double relative_difference (const double point_value, const double batch_value)
+{
+    return std::abs(point_value - batch_value) / std::max(1.0, std::abs(point_value));
+}
+
+// Checks that the batched convective and dissipative fluxes, entropy variables and maximum
+// convective eigenvalue match the point-wise physics.
+int main (int argc, char * argv[])
+{
+    MPI_Init(&argc, &argv);
+    const int dim = PHILIP_DIM;
+    const int nstate = dim+2;
+
+    dealii::ParameterHandler parameter_handler;
+    PHiLiP::Parameters::AllParameters::declare_parameters (parameter_handler);
+    PHiLiP::Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+
+    const unsigned int n_points = 17;
+    std::array<std::vector<double>,nstate> soln_batch;
+    std::array<dealii::Tensor<1,dim,std::vector<double>>,nstate> soln_grad_batch;
+    std::array<std::vector<double>,nstate> entropy_var_batch;
+    std::array<dealii::Tensor<1,dim,std::vector<double>>,nstate> conv_flux_batch;
+    std::array<dealii::Tensor<1,dim,std::vector<double>>,nstate> diss_flux_batch;
+    for(int istate=0; istate<nstate; istate++){
+        soln_batch[istate].resize(n_points);
+        entropy_var_batch[istate].resize(n_points);
+        for(int idim=0; idim<dim; idim++){
+            soln_grad_batch[istate][idim].resize(n_points);
+            conv_flux_batch[istate][idim].resize(n_points);
+            diss_flux_batch[istate][idim].resize(n_points);
+        }
+    }
+    // Smooth physical states and gradients.
+    for(unsigned int ipoint=0; ipoint<n_points; ipoint++){
+        const double x = 0.1 + 0.37*ipoint;
+        soln_batch[0][ipoint] = 1.0 + 0.3*std::sin(x);
+        double vel_sqr = 0.0;
+        for(int idim=0; idim<dim; idim++){
+            const double vel = 0.5*std::cos(x + idim);
+            soln_batch[1+idim][ipoint] = soln_batch[0][ipoint]*vel;
+            vel_sqr += vel*vel;
+        }
+        const double pressure = 1.0 + 0.2*std::cos(2.0*x);
+        soln_batch[nstate-1][ipoint] = pressure/0.4 + 0.5*soln_batch[0][ipoint]*vel_sqr;
+        for(int istate=0; istate<nstate; istate++){
+            for(int idim=0; idim<dim; idim++){
+                soln_grad_batch[istate][idim][ipoint] = 0.1*std::sin(x + istate + 2.0*idim);
+            }
+        }
+    }
+
+    PHiLiP::Physics::Euler<dim,nstate,double> euler_physics(&all_parameters, 1.0, 1.4, 1.0, 0.0, 0.0);
+    PHiLiP::Physics::NavierStokes<dim,nstate,double> navier_stokes_physics(&all_parameters, 1.0, 1.4, 1.0, 0.0, 0.0, 0.72, 100.0, false, 0.0);
+
+    euler_physics.convective_flux_batch(soln_batch, conv_flux_batch);
+    euler_physics.compute_entropy_variables_batch(soln_batch, entropy_var_batch);
+    const double max_eig_batch = euler_physics.max_convective_eigenvalue_batch(soln_batch);
+    navier_stokes_physics.dissipative_flux_batch(soln_batch, soln_grad_batch, 0, diss_flux_batch);
+
+    double max_rel_diff_conv_flux = 0.0;
+    double max_rel_diff_entropy_var = 0.0;
+    double max_rel_diff_diss_flux = 0.0;
+    double max_eig = 0.0;
+    for(unsigned int ipoint=0; ipoint<n_points; ipoint++){
+        std::array<double,nstate> soln;
+        std::array<dealii::Tensor<1,dim,double>,nstate> soln_grad;
+        for(int istate=0; istate<nstate; istate++){
+            soln[istate] = soln_batch[istate][ipoint];
+            for(int idim=0; idim<dim; idim++){
+                soln_grad[istate][idim] = soln_grad_batch[istate][idim][ipoint];
+            }
+        }
+        const std::array<dealii::Tensor<1,dim,double>,nstate> conv_flux = euler_physics.convective_flux(soln);
+        const std::array<double,nstate> entropy_var = euler_physics.compute_entropy_variables(soln);
+        const std::array<dealii::Tensor<1,dim,double>,nstate> diss_flux = navier_stokes_physics.dissipative_flux(soln, soln_grad, 0);
+        max_eig = std::max(max_eig, euler_physics.max_convective_eigenvalue(soln));
+        for(int istate=0; istate<nstate; istate++){
+            max_rel_diff_entropy_var = std::max(max_rel_diff_entropy_var, relative_difference(entropy_var[istate], entropy_var_batch[istate][ipoint]));
+            for(int idim=0; idim<dim; idim++){
+                max_rel_diff_conv_flux = std::max(max_rel_diff_conv_flux, relative_difference(conv_flux[istate][idim], conv_flux_batch[istate][idim][ipoint]));
+                max_rel_diff_diss_flux = std::max(max_rel_diff_diss_flux, relative_difference(diss_flux[istate][idim], diss_flux_batch[istate][idim][ipoint]));
+            }
+        }
+    }
+    const double max_rel_diff_eig = relative_difference(max_eig, max_eig_batch);
+
+    std::cout << "Maximum relative difference between batched and point-wise physics:" << std::endl
+              << "    convective flux " << max_rel_diff_conv_flux << std::endl
+              << "    entropy variables " << max_rel_diff_entropy_var << std::endl
+              << "    maximum convective eigenvalue " << max_rel_diff_eig << std::endl
+              << "    dissipative flux " << max_rel_diff_diss_flux << std::endl;
+
+    int test_fail = 0;
+    if(max_rel_diff_conv_flux > TOLERANCE || max_rel_diff_entropy_var > TOLERANCE
+       || max_rel_diff_eig > TOLERANCE || max_rel_diff_diss_flux > TOLERANCE) {
+        std::cout << "Batched physics does not match the point-wise physics." << std::endl;
+        test_fail = 1;
+    }
+    MPI_Finalize();
+    return test_fail;
+}
@@ -0,0 +1,88 @@
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include <deal.II/base/parameter_handler.h>
+
+#include "parameters/all_parameters.h"
+#include "parameters/parameters.h"
+#include "physics/euler.h"
+
+const double TOLERANCE = 1E-13;
+
+// Checks that the batched two-point fluxes match the point-wise ones for every split form.
+int main (int argc, char * argv[])
+{
+    MPI_Init(&argc, &argv);
+    const int dim = PHILIP_DIM;
+    const int nstate = dim+2;
+
+    dealii::ParameterHandler parameter_handler;
+    PHiLiP::Parameters::AllParameters::declare_parameters (parameter_handler);
+    PHiLiP::Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+
+    using two_point_num_flux_enum = PHiLiP::Parameters::AllParameters::TwoPointNumericalFlux;
+    const std::array<two_point_num_flux_enum,4> two_point_fluxes = {{two_point_num_flux_enum::KG, two_point_num_flux_enum::IR,
+                                                                     two_point_num_flux_enum::CH, two_point_num_flux_enum::Ra}};
+
+    // Smooth states, the first point of the batch being close to the first state to use the series of the logarithmic mean.
+    const unsigned int n_points = 17;
+    auto conservative_state = [&](const double x) {
+        std::array<double,nstate> soln;
+        soln[0] = 1.0 + 0.3*std::sin(x);
+        double vel_sqr = 0.0;
+        for(int idim=0; idim<dim; idim++){
+            const double vel = 0.5*std::cos(x + idim);
+            soln[1+idim] = soln[0]*vel;
+            vel_sqr += vel*vel;
+        }
+        const double pressure = 1.0 + 0.2*std::cos(2.0*x);
+        soln[nstate-1] = pressure/0.4 + 0.5*soln[0]*vel_sqr;
+        return soln;
+    };
+    const std::array<double,nstate> conservative_soln1 = conservative_state(0.1);
+    std::array<std::vector<double>,nstate> conservative_soln2;
+    std::array<dealii::Tensor<1,dim,std::vector<double>>,nstate> batch_flux;
+    for(int istate=0; istate<nstate; istate++){
+        conservative_soln2[istate].resize(n_points);
+        for(int idim=0; idim<dim; idim++){
+            batch_flux[istate][idim].resize(n_points);
+        }
+    }
+    for(unsigned int ipoint=0; ipoint<n_points; ipoint++){
+        const std::array<double,nstate> soln = conservative_state(0.1 + (ipoint == 0 ? 1e-5 : 0.37*ipoint));
+        for(int istate=0; istate<nstate; istate++){
+            conservative_soln2[istate][ipoint] = soln[istate];
+        }
+    }
+
+    int test_fail = 0;
+    for(const two_point_num_flux_enum two_point_flux : two_point_fluxes){
+        PHiLiP::Physics::Euler<dim,nstate,double> euler_physics(&all_parameters, 1.0, 1.4, 1.0, 0.0, 0.0, nullptr, two_point_flux);
+        euler_physics.convective_numerical_split_flux_batch(conservative_soln1, conservative_soln2, batch_flux);
+
+        double max_rel_diff = 0.0;
+        for(unsigned int ipoint=0; ipoint<n_points; ipoint++){
+            std::array<double,nstate> soln2;
+            for(int istate=0; istate<nstate; istate++){
+                soln2[istate] = conservative_soln2[istate][ipoint];
+            }
+            const std::array<dealii::Tensor<1,dim,double>,nstate> flux = euler_physics.convective_numerical_split_flux(conservative_soln1, soln2);
+            for(int istate=0; istate<nstate; istate++){
+                for(int idim=0; idim<dim; idim++){
+                    const double rel_diff = std::abs(flux[istate][idim] - batch_flux[istate][idim][ipoint])
+                                          / std::max(1.0, std::abs(flux[istate][idim]));
+                    max_rel_diff = std::max(max_rel_diff, rel_diff);
+                }
+            }
+        }
+        std::cout << "Two-point flux " << two_point_flux << ": maximum relative difference between batched and point-wise fluxes " << max_rel_diff << std::endl;
+        if(max_rel_diff > TOLERANCE) {
+            std::cout << "Batched two-point flux does not match the point-wise flux." << std::endl;
+            test_fail = 1;
+        }
+    }
+    MPI_Finalize();
+    return test_fail;
+}
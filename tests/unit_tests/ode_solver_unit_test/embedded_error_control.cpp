@@ -0,0 +1,168 @@
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include "dg/dg_base.hpp"
+#include "dg/dg_factory.hpp"
+#include "ode_solver/ode_solver_factory.h"
+#include "parameters/all_parameters.h"
+#include "parameters/parameters.h"
+#include "physics/physics_factory.h"
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+const double FINAL_TIME = 0.2;
+
+/// Result of a time integration of the manufactured advection problem.
+struct TimeIntegration
+{
+    dealii::LinearAlgebra::distributed::Vector<double> solution; ///< Solution at FINAL_TIME.
+    unsigned int n_accepted_steps; ///< Number of accepted steps.
+    unsigned int n_rejected_steps; ///< Number of steps rejected by the embedded error controller.
+};
+
+/// Integrates the manufactured advection problem until FINAL_TIME, from half the manufactured solution.
+/** With a runge_kutta_method that has an embedded method, the time step starts from initial_time_step
+ *  and then follows the embedded error controller with the given tolerance. Otherwise, the time step
+ *  is constant.
+ */
+TimeIntegration integrate_advection (
+    const std::shared_ptr<Triangulation> grid,
+    const std::string runge_kutta_method,
+    const bool use_embedded_error_control,
+    const double initial_time_step,
+    const double tolerance)
+{
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+    const int nstate = 1;
+
+    dealii::ParameterHandler parameter_handler;
+    Parameters::AllParameters::declare_parameters (parameter_handler);
+    parameter_handler.set("pde_type", "advection");
+    parameter_handler.enter_subsection("manufactured solution convergence study");
+    {
+        parameter_handler.set("use_manufactured_source_term", true);
+        parameter_handler.set("manufactured_solution_type", "sine_solution");
+    }
+    parameter_handler.leave_subsection();
+    parameter_handler.enter_subsection("ODE solver");
+    {
+        parameter_handler.set("ode_solver_type", "runge_kutta");
+        parameter_handler.set("runge_kutta_method", runge_kutta_method);
+        parameter_handler.enter_subsection("embedded error control");
+        parameter_handler.set("absolute_tolerance", tolerance);
+        parameter_handler.set("relative_tolerance", tolerance);
+        parameter_handler.leave_subsection();
+    }
+    parameter_handler.leave_subsection();
+    parameter_handler.enter_subsection("flow_solver");
+    {
+        parameter_handler.set("adaptive_time_step", use_embedded_error_control);
+        parameter_handler.set("adaptive_time_step_policy", "embedded_error");
+    }
+    parameter_handler.leave_subsection();
+
+    Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+
+    const unsigned int poly_degree = 2;
+    std::shared_ptr < DGBase<dim, double> > dg = DGFactory<dim,double>::create_discontinuous_galerkin(&all_parameters, poly_degree, grid);
+    dg->allocate_system ();
+
+    std::shared_ptr <Physics::PhysicsBase<dim,nstate,double>> physics_double = Physics::PhysicsFactory<dim, nstate, double>::create_Physics(&all_parameters);
+    dealii::LinearAlgebra::distributed::Vector<double> solution_no_ghost;
+    solution_no_ghost.reinit(dg->locally_owned_dofs, MPI_COMM_WORLD);
+    dealii::VectorTools::interpolate(dg->dof_handler, *(physics_double->manufactured_solution_function), solution_no_ghost);
+    // The solution moves towards the discrete steady state.
+    solution_no_ghost *= 0.5;
+    dg->solution = solution_no_ghost;
+    dg->solution.update_ghost_values();
+
+    std::shared_ptr<ODE::ODESolverBase<dim, double>> ode_solver = ODE::ODESolverFactory<dim, double>::create_ODESolver(dg);
+    ode_solver->allocate_ode_system();
+
+    double time_step = initial_time_step;
+    while (ode_solver->current_time < FINAL_TIME - 1e-14) {
+        // The last step ends exactly at FINAL_TIME.
+        time_step = std::min(time_step, FINAL_TIME - ode_solver->current_time);
+        ode_solver->step_in_time(time_step, false);
+        if (use_embedded_error_control) time_step = ode_solver->error_controlled_time_step;
+    }
+
+    return {dg->solution, ode_solver->current_iteration, ode_solver->n_rejected_steps};
+}
+
+/// Root mean square of the entries of the difference between the solution and the reference.
+double rms_difference (
+    const dealii::LinearAlgebra::distributed::Vector<double> &solution,
+    const dealii::LinearAlgebra::distributed::Vector<double> &reference)
+{
+    dealii::LinearAlgebra::distributed::Vector<double> difference = solution;
+    difference -= reference;
+    return difference.l2_norm() / std::sqrt(difference.size());
+}
+
+/** This test checks the embedded_error adaptive time step policy with the Bogacki-Shampine 3(2)
+ *  and the Dormand-Prince 5(4) pairs, which are both first same as last.
+ *  The initial time step is far above the stability limit, such that the first step is rejected
+ *  until the error estimate meets the tolerance. The error with respect to a reference solution
+ *  with a small constant time step must then be within the tolerance times the number of steps,
+ *  and decrease with the tolerance.
+ */
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    const int dim = PHILIP_DIM;
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+#if PHILIP_DIM!=1
+        MPI_COMM_WORLD,
+#endif
+        typename dealii::Triangulation<dim>::MeshSmoothing(
+            dealii::Triangulation<dim>::smoothing_on_refinement |
+            dealii::Triangulation<dim>::smoothing_on_coarsening));
+    dealii::GridGenerator::hyper_cube(*grid, 0.0, 1.0, true);
+    grid->refine_global(4);
+
+    const double initial_time_step = 0.1;
+    const TimeIntegration reference = integrate_advection(grid, "rk4_ex", false, 1e-4, 1.0);
+
+    int test_error = 0;
+    for (const std::string method : {"bogacki_shampine3_ex", "dormand_prince5_ex"}) {
+        double previous_error = 0.0;
+        for (const double tolerance : {1e-4, 1e-8}) {
+            const TimeIntegration controlled = integrate_advection(grid, method, true, initial_time_step, tolerance);
+            const double error = rms_difference(controlled.solution, reference.solution);
+            pcout << method << " with tolerance " << tolerance << ": " << controlled.n_accepted_steps << " accepted steps, "
+                  << controlled.n_rejected_steps << " rejected steps, RMS error " << error << std::endl;
+
+            if (controlled.n_rejected_steps == 0) {
+                pcout << "The steps above the stability limit were not rejected." << std::endl;
+                test_error = 1;
+            }
+            // Each accepted step has an error estimate below the tolerance, on a solution of order one.
+            if (error > 2.0 * tolerance * controlled.n_accepted_steps) {
+                pcout << "The error exceeds the tolerance accumulated over the steps." << std::endl;
+                test_error = 1;
+            }
+            if (tolerance < 1e-4 && error >= previous_error) {
+                pcout << "The error does not decrease with the tolerance." << std::endl;
+                test_error = 1;
+            }
+            previous_error = error;
+        }
+    }
+    return test_error;
+}
@@ -0,0 +1,148 @@
+#include <string>
+#include <vector>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include "dg/dg_base.hpp"
+#include "dg/dg_factory.hpp"
+#include "ode_solver/ode_solver_factory.h"
+#include "ode_solver/runge_kutta_methods/rk_tableau_base.h"
+#include "parameters/all_parameters.h"
+#include "parameters/parameters.h"
+#include "physics/physics_factory.h"
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+const double TOLERANCE = 1E-13;
+const double TIME_STEP = 1E-3;
+const unsigned int N_STEPS = 10;
+
+/// Creates the discretization of the manufactured advection problem, at half the manufactured solution.
+std::shared_ptr < PHiLiP::DGBase<PHILIP_DIM, double> > create_advection_dg (
+    const std::shared_ptr<Triangulation> grid,
+    const PHiLiP::Parameters::AllParameters &all_parameters)
+{
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+    const int nstate = 1;
+
+    const unsigned int poly_degree = 3;
+    std::shared_ptr < DGBase<dim, double> > dg = DGFactory<dim,double>::create_discontinuous_galerkin(&all_parameters, poly_degree, grid);
+    dg->allocate_system ();
+
+    std::shared_ptr <Physics::PhysicsBase<dim,nstate,double>> physics_double = Physics::PhysicsFactory<dim, nstate, double>::create_Physics(&all_parameters);
+    dealii::LinearAlgebra::distributed::Vector<double> solution_no_ghost;
+    solution_no_ghost.reinit(dg->locally_owned_dofs, MPI_COMM_WORLD);
+    dealii::VectorTools::interpolate(dg->dof_handler, *(physics_double->manufactured_solution_function), solution_no_ghost);
+    solution_no_ghost *= 0.5;
+    dg->solution = solution_no_ghost;
+    dg->solution.update_ghost_values();
+
+    return dg;
+}
+
+/// Takes N_STEPS steps of the RK method with one vector operation per term of each stage and of the update.
+/** This is the form of the explicit RK steps before the stage formation and the update were fused.
+ */
+void advance_unfused (
+    std::shared_ptr < PHiLiP::DGBase<PHILIP_DIM, double> > dg,
+    std::shared_ptr < PHiLiP::ODE::RKTableauBase<PHILIP_DIM, double> > butcher_tableau,
+    const int n_rk_stages)
+{
+    dg->evaluate_mass_matrices(true);
+
+    std::vector<dealii::LinearAlgebra::distributed::Vector<double>> rk_stage(n_rk_stages);
+    for (int i = 0; i < n_rk_stages; ++i) rk_stage[i].reinit(dg->solution);
+    dealii::LinearAlgebra::distributed::Vector<double> solution_update;
+    solution_update.reinit(dg->right_hand_side);
+
+    double current_time = 0.0;
+    for (unsigned int istep = 0; istep < N_STEPS; ++istep) {
+        solution_update = dg->solution;
+        for (int i = 0; i < n_rk_stages; ++i) {
+            rk_stage[i] = 0.0;
+            for (int j = 0; j < i; ++j) {
+                if (butcher_tableau->get_a(i,j) != 0) rk_stage[i].add(butcher_tableau->get_a(i,j), rk_stage[j]);
+            }
+            rk_stage[i] *= TIME_STEP;
+            rk_stage[i].add(1.0, solution_update);
+            dg->solution = rk_stage[i];
+
+            dg->set_current_time(current_time + butcher_tableau->get_c(i)*TIME_STEP);
+            dg->assemble_residual_and_apply_inverse_mass_matrix(rk_stage[i]);
+        }
+        for (int i = 0; i < n_rk_stages; ++i) {
+            solution_update.add(TIME_STEP*butcher_tableau->get_b(i), rk_stage[i]);
+        }
+        dg->solution = solution_update;
+        current_time += TIME_STEP;
+    }
+}
+
+/** This test checks that the explicit RK steps, whose stages and update are formed in single-pass kernels,
+ *  match to round-off the steps formed with one vector operation per term, for methods with and without
+ *  zero coefficients, and with the first-same-as-last reuse of Dormand-Prince 5(4).
+ */
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+#if PHILIP_DIM!=1
+        MPI_COMM_WORLD,
+#endif
+        typename dealii::Triangulation<dim>::MeshSmoothing(
+            dealii::Triangulation<dim>::smoothing_on_refinement |
+            dealii::Triangulation<dim>::smoothing_on_coarsening));
+    dealii::GridGenerator::hyper_cube(*grid, 0.0, 1.0, true);
+    grid->refine_global(4);
+
+    int test_error = 0;
+    for (const std::string runge_kutta_method : {"rk4_ex", "ssprk3_ex", "heun2_ex", "dormand_prince5_ex"}) {
+        dealii::ParameterHandler parameter_handler;
+        Parameters::AllParameters::declare_parameters (parameter_handler);
+        parameter_handler.set("pde_type", "advection");
+        parameter_handler.enter_subsection("manufactured solution convergence study");
+        {
+            parameter_handler.set("use_manufactured_source_term", true);
+            parameter_handler.set("manufactured_solution_type", "sine_solution");
+        }
+        parameter_handler.leave_subsection();
+        parameter_handler.enter_subsection("ODE solver");
+        {
+            parameter_handler.set("ode_solver_type", "runge_kutta");
+            parameter_handler.set("runge_kutta_method", runge_kutta_method);
+        }
+        parameter_handler.leave_subsection();
+        Parameters::AllParameters all_parameters;
+        all_parameters.parse_parameters (parameter_handler);
+
+        std::shared_ptr < DGBase<dim, double> > dg_fused = create_advection_dg(grid, all_parameters);
+        std::shared_ptr<ODE::ODESolverBase<dim, double>> ode_solver = ODE::ODESolverFactory<dim, double>::create_ODESolver(dg_fused);
+        ode_solver->allocate_ode_system();
+        for (unsigned int istep = 0; istep < N_STEPS; ++istep) ode_solver->step_in_time(TIME_STEP, false);
+
+        std::shared_ptr < DGBase<dim, double> > dg_unfused = create_advection_dg(grid, all_parameters);
+        std::shared_ptr<ODE::RKTableauBase<dim, double>> butcher_tableau = ODE::ODESolverFactory<dim, double>::create_RKTableau(dg_unfused);
+        butcher_tableau->set_tableau();
+        advance_unfused(dg_unfused, butcher_tableau, all_parameters.ode_solver_param.n_rk_stages);
+
+        dealii::LinearAlgebra::distributed::Vector<double> difference = dg_fused->solution;
+        difference -= dg_unfused->solution;
+        const double relative_difference = difference.l2_norm() / dg_unfused->solution.l2_norm();
+        pcout << runge_kutta_method << ": relative difference between the fused and unfused steps = " << relative_difference << std::endl;
+        if (relative_difference > TOLERANCE) test_error = 1;
+    }
+    return test_error;
+}
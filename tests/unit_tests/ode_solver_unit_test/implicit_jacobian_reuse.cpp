@@ -0,0 +1,116 @@
+#include <deal.II/base/mpi.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include "dg/dg_base.hpp"
+#include "dg/dg_factory.hpp"
+#include "global_counter.hpp"
+#include "ode_solver/ode_solver_factory.h"
+#include "parameters/all_parameters.h"
+#include "parameters/parameters.h"
+#include "physics/physics_factory.h"
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+const double TOLERANCE = 1E-8;
+
+/// Solves the steady manufactured advection problem with the given Jacobian refresh interval.
+/** Returns the steady solution and the number of assemblies of dRdW.
+ */
+std::pair<dealii::LinearAlgebra::distributed::Vector<double>, unsigned int> solve_steady_advection (
+    const std::shared_ptr<Triangulation> grid,
+    const int jacobian_refresh_interval)
+{
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+    const int nstate = 1;
+
+    dealii::ParameterHandler parameter_handler;
+    Parameters::AllParameters::declare_parameters (parameter_handler);
+    parameter_handler.set("pde_type", "advection");
+    parameter_handler.enter_subsection("manufactured solution convergence study");
+    {
+        parameter_handler.set("use_manufactured_source_term", true);
+        parameter_handler.set("manufactured_solution_type", "sine_solution");
+    }
+    parameter_handler.leave_subsection();
+    parameter_handler.enter_subsection("ODE solver");
+    {
+        parameter_handler.set("ode_solver_type", "implicit");
+        parameter_handler.set("nonlinear_steady_residual_tolerance", 1e-13);
+        parameter_handler.set("initial_time_step", 10.0);
+        parameter_handler.enter_subsection("implicit jacobian reuse");
+        parameter_handler.set("jacobian_refresh_interval", (long int) jacobian_refresh_interval);
+        parameter_handler.leave_subsection();
+    }
+    parameter_handler.leave_subsection();
+    parameter_handler.enter_subsection("linear solver");
+    {
+        parameter_handler.enter_subsection("gmres options");
+        parameter_handler.set("linear_residual_tolerance", 1e-12);
+        parameter_handler.leave_subsection();
+    }
+    parameter_handler.leave_subsection();
+
+    Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+
+    const unsigned int poly_degree = 2;
+    std::shared_ptr < DGBase<dim, double> > dg = DGFactory<dim,double>::create_discontinuous_galerkin(&all_parameters, poly_degree, grid);
+    dg->allocate_system ();
+
+    std::shared_ptr <Physics::PhysicsBase<dim,nstate,double>> physics_double = Physics::PhysicsFactory<dim, nstate, double>::create_Physics(&all_parameters);
+    dealii::LinearAlgebra::distributed::Vector<double> solution_no_ghost;
+    solution_no_ghost.reinit(dg->locally_owned_dofs, MPI_COMM_WORLD);
+    dealii::VectorTools::interpolate(dg->dof_handler, *(physics_double->manufactured_solution_function), solution_no_ghost);
+    // Starts away from the discrete steady state.
+    solution_no_ghost *= 0.5;
+    dg->solution = solution_no_ghost;
+    dg->solution.update_ghost_values();
+
+    const unsigned int n_assemblies_before = dRdW_form;
+    std::shared_ptr<ODE::ODESolverBase<dim, double>> ode_solver = ODE::ODESolverFactory<dim, double>::create_ODESolver(dg);
+    ode_solver->steady_state();
+    const unsigned int n_assemblies = dRdW_form - n_assemblies_before;
+
+    return {dg->solution, n_assemblies};
+}
+
+/** This test checks that the implicit steady solver converges to the same steady state when it lags
+ *  dRdW and its preconditioner, while assembling dRdW fewer times.
+ */
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    const int dim = PHILIP_DIM;
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+#if PHILIP_DIM!=1
+        MPI_COMM_WORLD,
+#endif
+        typename dealii::Triangulation<dim>::MeshSmoothing(
+            dealii::Triangulation<dim>::smoothing_on_refinement |
+            dealii::Triangulation<dim>::smoothing_on_coarsening));
+    dealii::GridGenerator::hyper_cube(*grid, 0.0, 1.0, true);
+    grid->refine_global(4);
+
+    const auto reference = solve_steady_advection(grid, 1);
+    const auto lagged = solve_steady_advection(grid, 4);
+
+    dealii::LinearAlgebra::distributed::Vector<double> difference = lagged.first;
+    difference -= reference.first;
+    const double relative_difference = difference.l2_norm() / reference.first.l2_norm();
+    pcout << "dRdW assemblies: " << reference.second << " at every step, " << lagged.second << " with lagging." << std::endl;
+    pcout << "Relative difference between the steady solutions = " << relative_difference << std::endl;
+
+    if (relative_difference > TOLERANCE) return 1;
+    if (lagged.second >= reference.second) return 1;
+    return 0;
+}
@@ -0,0 +1,179 @@
+#include <deal.II/base/function_parser.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include "dg/dg_base.hpp"
+#include "dg/dg_factory.hpp"
+#include "ode_solver/ode_solver_factory.h"
+#include "ode_solver/JFNK_solver/JFNK_solver.h"
+#include "parameters/all_parameters.h"
+#include "parameters/parameters.h"
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+const double TOLERANCE = 1E-6;
+
+/// Sets the parameters of the periodic diffusion solved with DIRK2 and the given JFNK preconditioner.
+void set_diffusion_parameters (
+    dealii::ParameterHandler &parameter_handler,
+    const std::string &preconditioner)
+{
+    PHiLiP::Parameters::AllParameters::declare_parameters (parameter_handler);
+    parameter_handler.set("pde_type", "diffusion");
+    parameter_handler.set("use_periodic_bc", true);
+    parameter_handler.enter_subsection("ODE solver");
+    {
+        parameter_handler.set("ode_solver_type", "runge_kutta");
+        parameter_handler.set("runge_kutta_method", "dirk_2_im");
+        parameter_handler.set("initial_time_step", 1e-2);
+    }
+    parameter_handler.leave_subsection();
+    parameter_handler.enter_subsection("linear solver");
+    {
+        parameter_handler.enter_subsection("gmres options");
+        parameter_handler.set("linear_residual_tolerance", 1e-10);
+        parameter_handler.leave_subsection();
+        parameter_handler.enter_subsection("JFNK options");
+        parameter_handler.set("newton_residual", 1e-10);
+        parameter_handler.set("preconditioner", preconditioner);
+        // The lagged operators are reused for the stages of two time steps.
+        parameter_handler.set("preconditioner_refresh_interval", "4");
+        parameter_handler.leave_subsection();
+    }
+    parameter_handler.leave_subsection();
+}
+
+/// Creates the discretization of the diffusion with a sine wave as solution.
+std::shared_ptr < PHiLiP::DGBase<PHILIP_DIM, double> > create_diffusion_dg (
+    const std::shared_ptr<Triangulation> grid,
+    const PHiLiP::Parameters::AllParameters &all_parameters)
+{
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+
+    const unsigned int poly_degree = 2;
+    std::shared_ptr < DGBase<dim, double> > dg = DGFactory<dim,double>::create_discontinuous_galerkin(&all_parameters, poly_degree, grid);
+    dg->allocate_system (all_parameters.ode_solver_param.allocate_matrix_dRdW, false, false);
+
+    dealii::FunctionParser<dim> initial_condition;
+    std::map<std::string,double> constants;
+    constants["pi"] = dealii::numbers::PI;
+    initial_condition.initialize("x", "sin(pi*x)", constants);
+    dealii::LinearAlgebra::distributed::Vector<double> solution_no_ghost;
+    solution_no_ghost.reinit(dg->locally_owned_dofs, MPI_COMM_WORLD);
+    dealii::VectorTools::interpolate(dg->dof_handler, initial_condition, solution_no_ghost);
+    dg->solution = solution_no_ghost;
+
+    return dg;
+}
+
+/// Advances the periodic diffusion of a sine wave with DIRK2 and the given JFNK preconditioner.
+dealii::LinearAlgebra::distributed::Vector<double> advance_diffusion (
+    const std::shared_ptr<Triangulation> grid,
+    const std::string &preconditioner)
+{
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+
+    dealii::ParameterHandler parameter_handler;
+    set_diffusion_parameters(parameter_handler, preconditioner);
+    Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+
+    std::shared_ptr < DGBase<dim, double> > dg = create_diffusion_dg(grid, all_parameters);
+
+    std::shared_ptr<ODE::ODESolverBase<dim, double>> ode_solver = ODE::ODESolverFactory<dim, double>::create_ODESolver(dg);
+    const double final_time = 0.1;
+    ode_solver->advance_solution_time(final_time);
+
+    return dg->solution;
+}
+
+/// Number of GMRES iterations of the JFNK solves of implicit Euler steps of the diffusion with the given preconditioner.
+unsigned int count_gmres_iterations (
+    const std::shared_ptr<Triangulation> grid,
+    const std::string &preconditioner)
+{
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+
+    dealii::ParameterHandler parameter_handler;
+    set_diffusion_parameters(parameter_handler, preconditioner);
+    Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+
+    std::shared_ptr < DGBase<dim, double> > dg = create_diffusion_dg(grid, all_parameters);
+    dg->evaluate_mass_matrices(true);
+
+    ODE::JFNKSolver<dim, double, Triangulation> solver(dg);
+    dealii::LinearAlgebra::distributed::Vector<double> solution(dg->solution);
+    // Time steps for which the implicit systems are stiff.
+    for (const double dt : {1e-2, 5e-2}) {
+        solver.solve(dt, solution);
+        solution = solver.current_solution_estimate;
+    }
+    return solver.n_linear_iterations();
+}
+
+/** This test checks that the preconditioned JFNK solves of DIRK2 stages converge to the same
+ *  solution as the unpreconditioned ones, for every preconditioner of the JFNK options,
+ *  and that each preconditioner reduces the number of GMRES iterations of stiff implicit steps.
+ */
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    const int dim = PHILIP_DIM;
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+#if PHILIP_DIM!=1
+        MPI_COMM_WORLD,
+#endif
+        typename dealii::Triangulation<dim>::MeshSmoothing(
+            dealii::Triangulation<dim>::smoothing_on_refinement |
+            dealii::Triangulation<dim>::smoothing_on_coarsening));
+
+    const double left = -1.0;
+    const double right = 1.0;
+    const bool colorize = true;
+    dealii::GridGenerator::hyper_cube(*grid, left, right, colorize);
+    std::vector<dealii::GridTools::PeriodicFacePair<typename Triangulation::cell_iterator> > matched_pairs;
+    for (int d = 0; d < dim; ++d) {
+        dealii::GridTools::collect_periodic_faces(*grid, 2*d, 2*d+1, d, matched_pairs);
+    }
+    grid->add_periodicity(matched_pairs);
+    grid->refine_global(4);
+
+    const dealii::LinearAlgebra::distributed::Vector<double> reference_solution = advance_diffusion(grid, "none");
+    const double reference_norm = reference_solution.l2_norm();
+
+    const std::vector<std::string> preconditioners { "lagged_jacobian", "cell_block_jacobi", "coarse_degree" };
+    for (const std::string &preconditioner : preconditioners) {
+        dealii::LinearAlgebra::distributed::Vector<double> difference = advance_diffusion(grid, preconditioner);
+        difference -= reference_solution;
+        const double relative_difference = difference.l2_norm() / reference_norm;
+        pcout << "Preconditioner " << preconditioner << ": relative difference with the unpreconditioned solution = " << relative_difference << std::endl;
+        if (relative_difference > TOLERANCE) return 1;
+    }
+
+    const unsigned int unpreconditioned_iterations = count_gmres_iterations(grid, "none");
+    pcout << "No preconditioner: " << unpreconditioned_iterations << " GMRES iterations." << std::endl;
+    for (const std::string &preconditioner : preconditioners) {
+        const unsigned int preconditioned_iterations = count_gmres_iterations(grid, preconditioner);
+        pcout << "Preconditioner " << preconditioner << ": " << preconditioned_iterations << " GMRES iterations." << std::endl;
+        if (preconditioned_iterations >= unpreconditioned_iterations) {
+            pcout << "The preconditioner does not reduce the number of GMRES iterations." << std::endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,236 @@
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include "dg/dg_base.hpp"
+#include "dg/dg_factory.hpp"
+#include "ode_solver/ode_solver_factory.h"
+#include "parameters/all_parameters.h"
+#include "parameters/parameters.h"
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+const double FINAL_TIME = 0.4;
+const unsigned int POLY_DEGREE = 2;
+const double CONSERVATION_TOLERANCE = 1E-12;
+const double EXPECTED_ORDER = 2.0;
+const double ORDER_TOLERANCE = 0.2;
+
+/// Sine wave with a non-zero mean, advected through the periodic domain.
+class InitialCondition : public dealii::Function<PHILIP_DIM>
+{
+public:
+    /// Value of the initial condition at the point.
+    double value (const dealii::Point<PHILIP_DIM> &point, const unsigned int /*istate*/ = 0) const override
+    {
+        return 1.0 + 0.5*std::sin(dealii::numbers::PI*point[0]);
+    }
+};
+
+/// Result of a time integration of the periodic advection.
+struct TimeIntegration
+{
+    dealii::LinearAlgebra::distributed::Vector<double> solution; ///< Solution at FINAL_TIME.
+    double initial_integral; ///< Integral of the initial solution over the domain.
+    double final_integral; ///< Integral of the solution at FINAL_TIME over the domain.
+    int n_time_levels; ///< Number of time levels of DGBase::cell_time_level in the last step.
+};
+
+/// Integral of the DG solution over the domain.
+double integrate_solution (const PHiLiP::DGBase<PHILIP_DIM, double> &dg)
+{
+    const int dim = PHILIP_DIM;
+    const dealii::QGauss<dim> quadrature(dg.max_degree+1);
+    dealii::FEValues<dim,dim> fe_values(*(dg.high_order_grid->mapping_fe_field), dg.fe_collection[dg.max_degree], quadrature,
+                                        dealii::update_values | dealii::update_JxW_values);
+
+    double local_integral = 0.0;
+    std::vector<dealii::types::global_dof_index> dofs_indices (fe_values.dofs_per_cell);
+    for (auto cell = dg.dof_handler.begin_active(); cell!=dg.dof_handler.end(); ++cell) {
+        if (!cell->is_locally_owned()) continue;
+        fe_values.reinit (cell);
+        cell->get_dof_indices (dofs_indices);
+        for (unsigned int iquad=0; iquad<fe_values.n_quadrature_points; ++iquad) {
+            double soln_at_q = 0.0;
+            for (unsigned int idof=0; idof<fe_values.dofs_per_cell; ++idof) {
+                soln_at_q += dg.solution[dofs_indices[idof]] * fe_values.shape_value(idof, iquad);
+            }
+            local_integral += soln_at_q * fe_values.JxW(iquad);
+        }
+    }
+    return dealii::Utilities::MPI::sum(local_integral, MPI_COMM_WORLD);
+}
+
+/// Creates the strong form discretization of the periodic advection, with the given ODE solver parameters.
+std::shared_ptr < PHiLiP::DGBase<PHILIP_DIM, double> > create_advection_dg (
+    const std::shared_ptr<Triangulation> grid,
+    PHiLiP::Parameters::AllParameters &all_parameters,
+    const std::string ode_solver_type,
+    const double courant_number)
+{
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+
+    dealii::ParameterHandler parameter_handler;
+    Parameters::AllParameters::declare_parameters (parameter_handler);
+    parameter_handler.set("pde_type", "advection");
+    parameter_handler.set("use_periodic_bc", true);
+    parameter_handler.set("use_weak_form", false);
+    parameter_handler.enter_subsection("manufactured solution convergence study");
+    {
+        parameter_handler.set("advection_0", 1.0);
+    }
+    parameter_handler.leave_subsection();
+    parameter_handler.enter_subsection("ODE solver");
+    {
+        parameter_handler.set("ode_solver_type", ode_solver_type);
+        parameter_handler.set("runge_kutta_method", "ssprk3_ex");
+        parameter_handler.enter_subsection("local time stepping");
+        parameter_handler.set("maximum_time_levels", "2");
+        parameter_handler.set("courant_number", courant_number);
+        parameter_handler.leave_subsection();
+    }
+    parameter_handler.leave_subsection();
+    all_parameters.parse_parameters (parameter_handler);
+
+    std::shared_ptr < DGBase<dim, double> > dg = DGFactory<dim,double>::create_discontinuous_galerkin(&all_parameters, POLY_DEGREE, grid);
+    dg->allocate_system ();
+
+    dealii::LinearAlgebra::distributed::Vector<double> solution_no_ghost;
+    solution_no_ghost.reinit(dg->locally_owned_dofs, MPI_COMM_WORLD);
+    dealii::VectorTools::interpolate(dg->dof_handler, InitialCondition(), solution_no_ghost);
+    dg->solution = solution_no_ghost;
+    dg->solution.update_ghost_values();
+
+    return dg;
+}
+
+/// Integrates the periodic advection until FINAL_TIME with a constant time step.
+TimeIntegration integrate_advection (
+    const std::shared_ptr<Triangulation> grid,
+    const std::string ode_solver_type,
+    const double time_step,
+    const double courant_number)
+{
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+
+    Parameters::AllParameters all_parameters;
+    std::shared_ptr < DGBase<dim, double> > dg = create_advection_dg(grid, all_parameters, ode_solver_type, courant_number);
+    const double initial_integral = integrate_solution(*dg);
+
+    std::shared_ptr<ODE::ODESolverBase<dim, double>> ode_solver = ODE::ODESolverFactory<dim, double>::create_ODESolver(dg);
+    ode_solver->allocate_ode_system();
+    const unsigned int n_steps = std::lround(FINAL_TIME/time_step);
+    for (unsigned int istep = 0; istep < n_steps; ++istep) ode_solver->step_in_time(time_step, false);
+
+    int n_time_levels = 1;
+    if (!dg->cell_time_level.empty()) {
+        n_time_levels = 1 + *std::max_element(dg->cell_time_level.begin(), dg->cell_time_level.end());
+    }
+    return {dg->solution, initial_integral, integrate_solution(*dg), n_time_levels};
+}
+
+/// Root mean square of the entries of the difference between the solution and the reference.
+double rms_difference (
+    const dealii::LinearAlgebra::distributed::Vector<double> &solution,
+    const dealii::LinearAlgebra::distributed::Vector<double> &reference)
+{
+    dealii::LinearAlgebra::distributed::Vector<double> difference = solution;
+    difference -= reference;
+    return difference.l2_norm() / std::sqrt(difference.size());
+}
+
+/** This test checks the local time stepping solver on a periodic mesh whose left half is refined once,
+ *  such that the refined cells take twice as many substeps as the coarse ones. The faces between the two
+ *  levels include the periodic face, where the neighbor of the coarse cell has children.
+ *  The integral of the solution over the domain must be conserved to round-off, and the error with respect
+ *  to a reference solution with a small time step must converge at second order, the order of the Strang
+ *  splitting of the levels. The courant_number is scaled with the time step such that the same cells are
+ *  assigned to each level in every run.
+ */
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+#if PHILIP_DIM!=1
+        MPI_COMM_WORLD,
+#endif
+        typename dealii::Triangulation<dim>::MeshSmoothing(
+            dealii::Triangulation<dim>::smoothing_on_refinement |
+            dealii::Triangulation<dim>::smoothing_on_coarsening));
+    dealii::GridGenerator::hyper_cube(*grid, 0.0, 2.0, true);
+    std::vector<dealii::GridTools::PeriodicFacePair<typename Triangulation::cell_iterator> > matched_pairs;
+    dealii::GridTools::collect_periodic_faces(*grid, 0, 1, 0, matched_pairs);
+    grid->add_periodicity(matched_pairs);
+    grid->refine_global(4);
+    for (const auto &cell : grid->active_cell_iterators()) {
+        if (cell->center()[0] < 1.0) cell->set_refine_flag();
+    }
+    grid->execute_coarsening_and_refinement();
+
+    // The coarse cells are assigned to level 0 and the refined ones to level 1 for the time step
+    // initial_time_step when their substep is 0.8 times the courant_number times their max_dt_cell
+    const double initial_time_step = 2E-2;
+    double largest_max_dt_cell = 0.0;
+    {
+        Parameters::AllParameters all_parameters;
+        std::shared_ptr < DGBase<dim, double> > dg = create_advection_dg(grid, all_parameters, "runge_kutta", 1.0);
+        dg->assemble_residual();
+        largest_max_dt_cell = dealii::Utilities::MPI::max(dg->max_dt_cell.linfty_norm(), MPI_COMM_WORLD);
+    }
+    const double initial_courant_number = 0.5*initial_time_step / (0.8*largest_max_dt_cell);
+
+    const TimeIntegration reference = integrate_advection(grid, "runge_kutta", 1E-4, 1.0);
+
+    int test_error = 0;
+    double previous_error = 0.0;
+    for (const double time_step : {initial_time_step, 0.5*initial_time_step, 0.25*initial_time_step}) {
+        const double courant_number = initial_courant_number * time_step / initial_time_step;
+        const TimeIntegration local_time_stepping = integrate_advection(grid, "local_time_stepping", time_step, courant_number);
+
+        const double error = rms_difference(local_time_stepping.solution, reference.solution);
+        const double relative_integral_change = std::abs(local_time_stepping.final_integral - local_time_stepping.initial_integral)
+                                                / std::abs(local_time_stepping.initial_integral);
+        pcout << "Time step " << time_step << ": " << local_time_stepping.n_time_levels << " time level(s), RMS error " << error
+              << ", relative change of the integral of the solution " << relative_integral_change << std::endl;
+
+        if (local_time_stepping.n_time_levels != 2) {
+            pcout << "The cells are not split into two time levels." << std::endl;
+            test_error = 1;
+        }
+        if (relative_integral_change > CONSERVATION_TOLERANCE) {
+            pcout << "The local time stepping does not conserve the integral of the solution." << std::endl;
+            test_error = 1;
+        }
+        if (previous_error > 0.0) {
+            const double order = std::log(previous_error/error) / std::log(2.0);
+            pcout << "Order of the error in time: " << order << std::endl;
+            if (std::abs(order - EXPECTED_ORDER) > ORDER_TOLERANCE) {
+                pcout << "The local time stepping is not of order " << EXPECTED_ORDER << "." << std::endl;
+                test_error = 1;
+            }
+        }
+        previous_error = error;
+    }
+    return test_error;
+}
@@ -0,0 +1,228 @@
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include "dg/dg_base.hpp"
+#include "dg/dg_factory.hpp"
+#include "ode_solver/ode_solver_factory.h"
+#include "ode_solver/p_multigrid/p_multigrid.h"
+#include "parameters/all_parameters.h"
+#include "parameters/parameters.h"
+#include "physics/physics_factory.h"
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+const double TOLERANCE = 1E-8;
+
+/// Creates the unit hypercube refined n_refinements times.
+std::shared_ptr<Triangulation> create_grid (const unsigned int n_refinements)
+{
+    const int dim = PHILIP_DIM;
+    std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+#if PHILIP_DIM!=1
+        MPI_COMM_WORLD,
+#endif
+        typename dealii::Triangulation<dim>::MeshSmoothing(
+            dealii::Triangulation<dim>::smoothing_on_refinement |
+            dealii::Triangulation<dim>::smoothing_on_coarsening));
+    dealii::GridGenerator::hyper_cube(*grid, 0.0, 1.0, true);
+    grid->refine_global(n_refinements);
+    return grid;
+}
+
+/// Sets the parameters of the steady manufactured advection problem.
+void set_advection_parameters (
+    dealii::ParameterHandler &parameter_handler,
+    const std::string ode_solver_type,
+    const bool use_p_multigrid_preconditioner)
+{
+    PHiLiP::Parameters::AllParameters::declare_parameters (parameter_handler);
+    parameter_handler.set("pde_type", "advection");
+    parameter_handler.enter_subsection("manufactured solution convergence study");
+    {
+        parameter_handler.set("use_manufactured_source_term", true);
+        parameter_handler.set("manufactured_solution_type", "sine_solution");
+    }
+    parameter_handler.leave_subsection();
+    parameter_handler.enter_subsection("ODE solver");
+    {
+        parameter_handler.set("ode_solver_type", ode_solver_type);
+        parameter_handler.set("nonlinear_steady_residual_tolerance", 1e-13);
+        parameter_handler.set("initial_time_step", 10.0);
+    }
+    parameter_handler.leave_subsection();
+    parameter_handler.enter_subsection("p-multigrid");
+    {
+        parameter_handler.set("coarse_degree", (long int) 0);
+        parameter_handler.set("use_as_implicit_preconditioner", use_p_multigrid_preconditioner);
+    }
+    parameter_handler.leave_subsection();
+    parameter_handler.enter_subsection("linear solver");
+    {
+        parameter_handler.enter_subsection("gmres options");
+        parameter_handler.set("linear_residual_tolerance", 1e-12);
+        parameter_handler.leave_subsection();
+    }
+    parameter_handler.leave_subsection();
+}
+
+/// Creates the p=2 discretization of the advection problem, starting from half the manufactured solution.
+std::shared_ptr < PHiLiP::DGBase<PHILIP_DIM, double> > create_advection_dg (
+    const std::shared_ptr<Triangulation> grid,
+    const PHiLiP::Parameters::AllParameters &all_parameters)
+{
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+    const int nstate = 1;
+
+    const unsigned int poly_degree = 2;
+    std::shared_ptr < DGBase<dim, double> > dg = DGFactory<dim,double>::create_discontinuous_galerkin(&all_parameters, poly_degree, grid);
+    dg->allocate_system ();
+
+    std::shared_ptr <Physics::PhysicsBase<dim,nstate,double>> physics_double = Physics::PhysicsFactory<dim, nstate, double>::create_Physics(&all_parameters);
+    dealii::LinearAlgebra::distributed::Vector<double> solution_no_ghost;
+    solution_no_ghost.reinit(dg->locally_owned_dofs, MPI_COMM_WORLD);
+    dealii::VectorTools::interpolate(dg->dof_handler, *(physics_double->manufactured_solution_function), solution_no_ghost);
+    // Starts away from the discrete steady state.
+    solution_no_ghost *= 0.5;
+    dg->solution = solution_no_ghost;
+    dg->solution.update_ghost_values();
+
+    return dg;
+}
+
+/// Solves the steady manufactured advection problem with the given ODE solver.
+/** With use_p_multigrid_preconditioner, the implicit solves are preconditioned by p-multigrid.
+ */
+dealii::LinearAlgebra::distributed::Vector<double> solve_steady_advection (
+    const std::shared_ptr<Triangulation> grid,
+    const std::string ode_solver_type,
+    const bool use_p_multigrid_preconditioner)
+{
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+
+    dealii::ParameterHandler parameter_handler;
+    set_advection_parameters(parameter_handler, ode_solver_type, use_p_multigrid_preconditioner);
+    Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+
+    std::shared_ptr < DGBase<dim, double> > dg = create_advection_dg(grid, all_parameters);
+
+    std::shared_ptr<ODE::ODESolverBase<dim, double>> ode_solver = ODE::ODESolverFactory<dim, double>::create_ODESolver(dg);
+    ode_solver->steady_state();
+
+    return dg->solution;
+}
+
+/// Number of flexible GMRES iterations preconditioned by p-multigrid to solve one implicit step of the advection problem.
+/** Also returns in transfer_error the largest difference between a coarse vector and its
+ *  prolongation restricted back to the coarse degree, which should be round-off.
+ */
+unsigned int count_p_multigrid_iterations (
+    const std::shared_ptr<Triangulation> grid,
+    double &transfer_error)
+{
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+
+    dealii::ParameterHandler parameter_handler;
+    set_advection_parameters(parameter_handler, "implicit", true);
+    Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+
+    std::shared_ptr < DGBase<dim, double> > dg = create_advection_dg(grid, all_parameters);
+
+    // The projection onto the coarse degree is a left inverse of the interpolation.
+    ODE::PMultigridHierarchy<dim, double, Triangulation> hierarchy(dg);
+    transfer_error = 0.0;
+    for (unsigned int ilevel = 0; ilevel+1 < hierarchy.n_levels(); ++ilevel) {
+        dealii::LinearAlgebra::distributed::Vector<double> coarse_vector(hierarchy.levels[ilevel+1]->right_hand_side);
+        dealii::LinearAlgebra::distributed::Vector<double> restricted_vector(hierarchy.levels[ilevel+1]->right_hand_side);
+        dealii::LinearAlgebra::distributed::Vector<double> fine_vector(hierarchy.levels[ilevel]->right_hand_side);
+        for (const auto idof : hierarchy.levels[ilevel+1]->locally_owned_dofs) {
+            coarse_vector[idof] = std::sin(1.0 + 0.37*idof);
+        }
+        hierarchy.transfers[ilevel]->prolongate(coarse_vector, fine_vector);
+        hierarchy.transfers[ilevel]->restrict_solution(fine_vector, restricted_vector);
+        restricted_vector -= coarse_vector;
+        transfer_error = std::max(transfer_error, restricted_vector.linfty_norm());
+    }
+
+    // Implicit operator M/dt - dRdW of the initial solution.
+    const bool compute_dRdW = true;
+    dg->assemble_residual(compute_dRdW);
+    dg->evaluate_mass_matrices(false);
+    const double dt = all_parameters.ode_solver_param.initial_time_step;
+    dealii::TrilinosWrappers::SparseMatrix implicit_operator;
+    implicit_operator.copy_from(dg->system_matrix);
+    implicit_operator *= -1.0;
+    implicit_operator.add(1.0/dt, dg->global_mass_matrix);
+
+    ODE::PMultigridPreconditioner<dim, double, Triangulation> p_multigrid(dg);
+    const bool pseudotime = false;
+    p_multigrid.initialize(implicit_operator, dt, pseudotime);
+
+    dealii::LinearAlgebra::distributed::Vector<double> solution_update(dg->right_hand_side);
+    solution_update = 0.0;
+    dealii::SolverControl solver_control(1000, 1e-10 * dg->right_hand_side.l2_norm());
+    dealii::SolverFGMRES<dealii::LinearAlgebra::distributed::Vector<double>> solver_fgmres(solver_control);
+    solver_fgmres.solve(implicit_operator, solution_update, dg->right_hand_side, p_multigrid);
+
+    return solver_control.last_step();
+}
+
+/** This test checks that the p-multigrid steady solver, and the implicit steady solver preconditioned
+ *  by p-multigrid, converge to the steady state of the implicit steady solver.
+ *  It also checks that the number of GMRES iterations preconditioned by p-multigrid stays
+ *  roughly the same over successive refinements of the grid.
+ */
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    std::shared_ptr<Triangulation> grid = create_grid(4);
+
+    const auto reference = solve_steady_advection(grid, "implicit", false);
+    const auto multigrid = solve_steady_advection(grid, "p_multigrid", false);
+    const auto preconditioned = solve_steady_advection(grid, "implicit", true);
+
+    int test_error = 0;
+    for (const auto &solution : {multigrid, preconditioned}) {
+        dealii::LinearAlgebra::distributed::Vector<double> difference = solution;
+        difference -= reference;
+        const double relative_difference = difference.l2_norm() / reference.l2_norm();
+        pcout << "Relative difference with the implicit steady solution = " << relative_difference << std::endl;
+        if (relative_difference > TOLERANCE) test_error = 1;
+    }
+
+    std::vector<unsigned int> n_iterations;
+    for (unsigned int n_refinements = 3; n_refinements <= 5; ++n_refinements) {
+        double transfer_error = 0.0;
+        n_iterations.push_back(count_p_multigrid_iterations(create_grid(n_refinements), transfer_error));
+        pcout << "Grid refined " << n_refinements << " times: " << n_iterations.back()
+              << " GMRES iterations preconditioned by p-multigrid, transfer error = " << transfer_error << std::endl;
+        if (transfer_error > 1e-12) test_error = 1;
+    }
+    const unsigned int min_iterations = *std::min_element(n_iterations.begin(), n_iterations.end());
+    const unsigned int max_iterations = *std::max_element(n_iterations.begin(), n_iterations.end());
+    if (max_iterations > 2*min_iterations) {
+        pcout << "The number of iterations grows with the refinement of the grid." << std::endl;
+        test_error = 1;
+    }
+    return test_error;
+}
@@ -0,0 +1,156 @@
+#include <cmath>
+#include <string>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include "dg/dg_base.hpp"
+#include "dg/dg_factory.hpp"
+#include "ode_solver/ode_solver_factory.h"
+#include "ode_solver/parareal_driver.h"
+#include "parameters/all_parameters.h"
+#include "parameters/parameters.h"
+#include "physics/physics_factory.h"
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+const double FINAL_TIME = 0.4;
+const double FINE_TIME_STEP = 1E-3;
+const double COARSE_TIME_STEP = 5E-3;
+const int N_TIME_SLICES = 8;
+const double PARAREAL_TOLERANCE = 1E-10;
+const int EXPECTED_MAXIMUM_ITERATIONS = 3;
+const double SEQUENTIAL_TOLERANCE = 1E-8;
+
+/// Result of the Parareal iterations on the manufactured advection problem.
+struct PararealIterations
+{
+    int n_iterations; ///< Number of iterations returned by PararealDriver::advance().
+    double last_iteration_change; ///< Largest relative change of the slice end solutions at the last iteration.
+    double relative_difference; ///< Relative L2 difference with the sequential fine propagation at FINAL_TIME.
+};
+
+/// Advances the manufactured advection problem until FINAL_TIME with Parareal iterations and sequentially.
+/** The DG of each slice group is distributed over slice_group_communicator, and both propagators use
+ *  the classical RK4 method, the coarse one with a larger time step.
+ */
+PararealIterations iterate_advection (const MPI_Comm slice_group_communicator)
+{
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+    const int nstate = 1;
+
+    std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+#if PHILIP_DIM!=1
+        slice_group_communicator,
+#endif
+        typename dealii::Triangulation<dim>::MeshSmoothing(
+            dealii::Triangulation<dim>::smoothing_on_refinement |
+            dealii::Triangulation<dim>::smoothing_on_coarsening));
+    dealii::GridGenerator::hyper_cube(*grid, 0.0, 1.0, true);
+    grid->refine_global((dim == 1) ? 4 : 3);
+
+    dealii::ParameterHandler parameter_handler;
+    Parameters::AllParameters::declare_parameters (parameter_handler);
+    parameter_handler.set("pde_type", "advection");
+    parameter_handler.enter_subsection("manufactured solution convergence study");
+    {
+        parameter_handler.set("use_manufactured_source_term", true);
+        parameter_handler.set("manufactured_solution_type", "sine_solution");
+    }
+    parameter_handler.leave_subsection();
+    parameter_handler.enter_subsection("ODE solver");
+    {
+        parameter_handler.set("ode_solver_type", "runge_kutta");
+        parameter_handler.set("runge_kutta_method", "rk4_ex");
+    }
+    parameter_handler.leave_subsection();
+    Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+
+    const unsigned int poly_degree = 2;
+    std::shared_ptr < DGBase<dim, double> > dg = DGFactory<dim,double>::create_discontinuous_galerkin(&all_parameters, poly_degree, poly_degree, poly_degree+1, grid, slice_group_communicator);
+    dg->allocate_system ();
+
+    std::shared_ptr <Physics::PhysicsBase<dim,nstate,double>> physics_double = Physics::PhysicsFactory<dim, nstate, double>::create_Physics(&all_parameters);
+    dealii::LinearAlgebra::distributed::Vector<double> initial_solution;
+    initial_solution.reinit(dg->locally_owned_dofs, slice_group_communicator);
+    dealii::VectorTools::interpolate(dg->dof_handler, *(physics_double->manufactured_solution_function), initial_solution);
+    // The solution moves towards the discrete steady state.
+    initial_solution *= 0.5;
+    dg->solution = initial_solution;
+    dg->solution.update_ghost_values();
+
+    std::shared_ptr<ODE::ODESolverBase<dim, double>> fine_solver = ODE::ODESolverFactory<dim, double>::create_ODESolver(dg);
+    fine_solver->allocate_ode_system();
+    std::shared_ptr<ODE::ODESolverBase<dim, double>> coarse_solver = ODE::ODESolverFactory<dim, double>::create_ODESolver(dg);
+    coarse_solver->allocate_ode_system();
+
+    PararealIterations iterations;
+    {
+        ODE::PararealDriver<dim, double> parareal_driver(dg, fine_solver, coarse_solver, N_TIME_SLICES, N_TIME_SLICES, PARAREAL_TOLERANCE, MPI_COMM_WORLD);
+        iterations.n_iterations = parareal_driver.advance(0.0, FINAL_TIME, FINE_TIME_STEP, COARSE_TIME_STEP);
+        iterations.last_iteration_change = parareal_driver.last_iteration_change;
+    }
+    const dealii::LinearAlgebra::distributed::Vector<double> parareal_solution = dg->solution;
+
+    // Sequential fine propagation, with the same time steps as the fine propagations of the slices
+    dg->solution = initial_solution;
+    dg->solution.update_ghost_values();
+    fine_solver->current_time = 0.0;
+    const int n_steps = std::lround(FINAL_TIME/FINE_TIME_STEP);
+    for (int istep = 0; istep < n_steps; ++istep) fine_solver->step_in_time(FINE_TIME_STEP, false);
+
+    dealii::LinearAlgebra::distributed::Vector<double> difference = parareal_solution;
+    difference -= dg->solution;
+    iterations.relative_difference = difference.l2_norm() / dg->solution.l2_norm();
+    return iterations;
+}
+
+/** This test checks the Parareal iterations with RK4 as coarse and fine propagators on the manufactured advection
+ *  problem. The iterations must converge below the tolerance within the expected number of iterations, before
+ *  reaching the number of time slices, and the solution must then match the sequential fine propagation.
+ *  In 2D, the processes are split into two slice groups that propagate every other slice, each with its own DG
+ *  distributed over the communicator of the group.
+ */
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+    const int n_mpi = dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    // The 1D triangulation is not distributed, such that each process is a slice group
+    const int n_slice_groups = (dim == 1) ? n_mpi : ((n_mpi % 2 == 0) ? 2 : 1);
+    MPI_Comm slice_group_communicator = ODE::PararealDriver<dim, double>::create_slice_group_communicator(MPI_COMM_WORLD, n_slice_groups);
+    const PararealIterations iterations = iterate_advection(slice_group_communicator);
+    MPI_Comm_free(&slice_group_communicator);
+
+    pcout << n_slice_groups << " slice group(s): " << iterations.n_iterations << " Parareal iteration(s), last relative change "
+          << iterations.last_iteration_change << ", relative difference with the sequential fine propagation "
+          << iterations.relative_difference << std::endl;
+
+    int test_error = 0;
+    if (iterations.n_iterations > EXPECTED_MAXIMUM_ITERATIONS || iterations.n_iterations >= N_TIME_SLICES) {
+        pcout << "The Parareal iterations take more than " << EXPECTED_MAXIMUM_ITERATIONS << " iterations." << std::endl;
+        test_error = 1;
+    }
+    if (iterations.last_iteration_change >= PARAREAL_TOLERANCE) {
+        pcout << "The Parareal iterations do not converge below the tolerance " << PARAREAL_TOLERANCE << "." << std::endl;
+        test_error = 1;
+    }
+    if (iterations.relative_difference > SEQUENTIAL_TOLERANCE) {
+        pcout << "The Parareal solution does not match the sequential fine propagation." << std::endl;
+        test_error = 1;
+    }
+    return test_error;
+}
@@ -0,0 +1,112 @@
+#include <iomanip>
+#include <cmath>
+#include <limits>
+#include <iostream>
+
+#include <deal.II/base/parameter_handler.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include "dg/dg_base.hpp"
+#include "dg/dg_factory.hpp"
+#include "parameters/all_parameters.h"
+#include "parameters/parameters.h"
+#include "physics/initial_conditions/initial_condition_function.h"
+#include "physics/initial_conditions/set_initial_condition.h"
+
+// Checks that the strong-form residual assembled in batches of cells matches the
+// residual and time steps assembled cell by cell on a periodic Cartesian mesh.
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    using namespace PHiLiP;
+    std::cout << std::setprecision(std::numeric_limits<long double>::digits10 + 1) << std::scientific;
+    const int dim = PHILIP_DIM;
+    const int nstate = dim+2;
+    dealii::ParameterHandler parameter_handler;
+    PHiLiP::Parameters::AllParameters::declare_parameters (parameter_handler);
+    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+
+    PHiLiP::Parameters::AllParameters all_parameters_new;
+    all_parameters_new.parse_parameters (parameter_handler);
+    using FlowCaseEnum = Parameters::FlowSolverParam::FlowCaseType;
+    all_parameters_new.flow_solver_param.flow_case_type = FlowCaseEnum::taylor_green_vortex;
+    all_parameters_new.use_weak_form = false;
+    using ConvFlux_enum = Parameters::AllParameters::ConvectiveNumericalFlux;
+    all_parameters_new.conv_num_flux_type = ConvFlux_enum::roe;
+    using PDE_enum = Parameters::AllParameters::PartialDifferentialEquation;
+
+    int test_fail = 0;
+    for(unsigned int viscous=0; viscous<2; viscous++){
+        all_parameters_new.pde_type = (viscous == 1) ? PDE_enum::navier_stokes : PDE_enum::euler;
+
+        using Triangulation = dealii::parallel::distributed::Triangulation<dim>;
+        std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+            MPI_COMM_WORLD,
+            typename dealii::Triangulation<dim>::MeshSmoothing(
+                dealii::Triangulation<dim>::smoothing_on_refinement |
+                dealii::Triangulation<dim>::smoothing_on_coarsening));
+
+        const unsigned int n_refinements = 2;
+        const unsigned int poly_degree = 3;
+        const unsigned int grid_degree = 1;
+
+        double left = 0.0;
+        double right = 2 * dealii::numbers::PI;
+        const bool colorize = true;
+        dealii::GridGenerator::hyper_cube(*grid, left, right, colorize);
+        std::vector<dealii::GridTools::PeriodicFacePair<typename dealii::Triangulation<PHILIP_DIM>::cell_iterator> > matched_pairs;
+        dealii::GridTools::collect_periodic_faces(*grid,0,1,0,matched_pairs);
+        dealii::GridTools::collect_periodic_faces(*grid,2,3,1,matched_pairs);
+        if constexpr(PHILIP_DIM == 3)
+            dealii::GridTools::collect_periodic_faces(*grid,4,5,2,matched_pairs);
+        grid->add_periodicity(matched_pairs);
+        grid->refine_global(n_refinements);
+
+        std::shared_ptr < PHiLiP::DGBase<dim, double> > dg = PHiLiP::DGFactory<dim,double>::create_discontinuous_galerkin(&all_parameters_new, poly_degree, poly_degree, grid_degree, grid);
+        dg->allocate_system ();
+
+        std::shared_ptr<InitialConditionFunction<dim,nstate,double>> initial_condition_function
+            = InitialConditionFactory<dim,nstate,double>::create_InitialConditionFunction(&all_parameters_new);
+        SetInitialCondition<dim,nstate,double>::set_initial_condition(initial_condition_function, dg, &all_parameters_new);
+
+        dg->use_cell_batched_residual = false;
+        dg->assemble_residual();
+        dealii::LinearAlgebra::distributed::Vector<double> rhs_cell_by_cell(dg->right_hand_side);
+        const dealii::Vector<double> max_dt_cell_by_cell(dg->max_dt_cell);
+
+        if(!dg->prepare_cell_batches()){
+            pcout << "The periodic Cartesian mesh was not accepted for the cell-batched residual." << std::endl;
+            test_fail = 1;
+            continue;
+        }
+        dg->use_cell_batched_residual = true;
+        dg->assemble_residual();
+        dealii::LinearAlgebra::distributed::Vector<double> rhs_difference(dg->right_hand_side);
+        rhs_difference -= rhs_cell_by_cell;
+        const double rhs_relative_difference = rhs_difference.linfty_norm() / rhs_cell_by_cell.linfty_norm();
+        dealii::Vector<double> max_dt_difference(dg->max_dt_cell);
+        max_dt_difference -= max_dt_cell_by_cell;
+        const double max_dt_relative_difference = max_dt_difference.linfty_norm() / max_dt_cell_by_cell.linfty_norm();
+
+        pcout << (viscous ? "Navier-Stokes" : "Euler")
+              << ": relative residual difference " << rhs_relative_difference
+              << ", relative time step difference " << max_dt_relative_difference << std::endl;
+
+        if(rhs_relative_difference > 1e-12){
+            pcout << "The cell-batched residual does not match the cell-by-cell residual." << std::endl;
+            test_fail = 1;
+        }
+        if(max_dt_relative_difference > 1e-12){
+            pcout << "The cell-batched time steps do not match the cell-by-cell time steps." << std::endl;
+            test_fail = 1;
+        }
+    }
+
+    if(test_fail){
+        pcout << "Cell-batched residual test failed." << std::endl;
+    } else {
+        pcout << "The cell-batched residual matches the cell-by-cell residual." << std::endl;
+    }
+    return test_fail;
+}
@@ -0,0 +1,172 @@
+#include <iomanip>
+#include <cmath>
+#include <limits>
+#include <iostream>
+
+#include <deal.II/base/parameter_handler.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include "dg/dg_base.hpp"
+#include "dg/dg_factory.hpp"
+#include "parameters/all_parameters.h"
+#include "parameters/parameters.h"
+#include "physics/initial_conditions/initial_condition_function.h"
+#include "physics/initial_conditions/set_initial_condition.h"
+
+/// Largest relative difference between two sets of values.
+double relative_difference(const std::vector<double> &values, const std::vector<double> &reference)
+{
+    if(values.size() != reference.size()) return std::numeric_limits<double>::max();
+    double max_difference = 0.0;
+    for(unsigned int i=0; i<values.size(); ++i){
+        max_difference = std::max(max_difference, std::abs(values[i] - reference[i]) / std::max(1.0, std::abs(reference[i])));
+    }
+    return max_difference;
+}
+
+/// Largest relative difference between the metric terms stored in two caches.
+template <int dim>
+double relative_difference(PHiLiP::MetricTermsCache<dim,double> &cache, PHiLiP::MetricTermsCache<dim,double> &reference)
+{
+    if(cache.size() != reference.size()) return std::numeric_limits<double>::max();
+    double max_difference = 0.0;
+    for(unsigned int icell=0; icell<cache.size(); ++icell){
+        auto &terms = cache[icell];
+        auto &reference_terms = reference[icell];
+        if(terms.volume_is_cached != reference_terms.volume_is_cached) return std::numeric_limits<double>::max();
+        if(terms.volume_is_cached){
+            max_difference = std::max(max_difference, relative_difference(terms.det_Jac_vol, reference_terms.det_Jac_vol));
+            for(int idim=0; idim<dim; ++idim){
+                for(int jdim=0; jdim<dim; ++jdim){
+                    max_difference = std::max(max_difference, relative_difference(terms.metric_cofactor_vol[idim][jdim], reference_terms.metric_cofactor_vol[idim][jdim]));
+                }
+            }
+        }
+        for(unsigned int iface=0; iface<PHiLiP::MetricTermsCache<dim,double>::n_faces; ++iface){
+            if(terms.facet_is_cached[iface] != reference_terms.facet_is_cached[iface]) return std::numeric_limits<double>::max();
+            if(!terms.facet_is_cached[iface]) continue;
+            max_difference = std::max(max_difference, relative_difference(terms.det_Jac_surf[iface], reference_terms.det_Jac_surf[iface]));
+            for(int idim=0; idim<dim; ++idim){
+                for(int jdim=0; jdim<dim; ++jdim){
+                    max_difference = std::max(max_difference, relative_difference(terms.metric_cofactor_surf[iface][idim][jdim], reference_terms.metric_cofactor_surf[iface][idim][jdim]));
+                }
+            }
+        }
+    }
+    return max_difference;
+}
+
+// Checks that the strong-form metric terms cache is refilled after the grid nodes move:
+// the cached residual matches the residual with the metric terms computed on the fly,
+// and the cached terms match the ones of a cache filled from scratch on the moved grid.
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    using namespace PHiLiP;
+    std::cout << std::setprecision(std::numeric_limits<long double>::digits10 + 1) << std::scientific;
+    const int dim = PHILIP_DIM;
+    const int nstate = dim+2;
+    dealii::ParameterHandler parameter_handler;
+    PHiLiP::Parameters::AllParameters::declare_parameters (parameter_handler);
+    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+
+    PHiLiP::Parameters::AllParameters all_parameters_new;
+    all_parameters_new.parse_parameters (parameter_handler);
+    using FlowCaseEnum = Parameters::FlowSolverParam::FlowCaseType;
+    all_parameters_new.flow_solver_param.flow_case_type = FlowCaseEnum::taylor_green_vortex;
+    all_parameters_new.use_weak_form = false;
+    using ConvFlux_enum = Parameters::AllParameters::ConvectiveNumericalFlux;
+    all_parameters_new.conv_num_flux_type = ConvFlux_enum::roe;
+    using PDE_enum = Parameters::AllParameters::PartialDifferentialEquation;
+    all_parameters_new.pde_type = PDE_enum::navier_stokes;
+
+    PHiLiP::Parameters::AllParameters all_parameters_cached = all_parameters_new;
+    all_parameters_cached.use_metric_terms_cache = true;
+    PHiLiP::Parameters::AllParameters all_parameters_on_the_fly = all_parameters_new;
+    all_parameters_on_the_fly.use_metric_terms_cache = false;
+
+    using Triangulation = dealii::parallel::distributed::Triangulation<dim>;
+    std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+        MPI_COMM_WORLD,
+        typename dealii::Triangulation<dim>::MeshSmoothing(
+            dealii::Triangulation<dim>::smoothing_on_refinement |
+            dealii::Triangulation<dim>::smoothing_on_coarsening));
+
+    const unsigned int n_refinements = 2;
+    const unsigned int poly_degree = 3;
+    const unsigned int grid_degree = 2;
+
+    const double left = 0.0;
+    const double right = 2 * dealii::numbers::PI;
+    const bool colorize = true;
+    dealii::GridGenerator::hyper_cube(*grid, left, right, colorize);
+    std::vector<dealii::GridTools::PeriodicFacePair<typename dealii::Triangulation<PHILIP_DIM>::cell_iterator> > matched_pairs;
+    dealii::GridTools::collect_periodic_faces(*grid,0,1,0,matched_pairs);
+    dealii::GridTools::collect_periodic_faces(*grid,2,3,1,matched_pairs);
+    if constexpr(PHILIP_DIM == 3)
+        dealii::GridTools::collect_periodic_faces(*grid,4,5,2,matched_pairs);
+    grid->add_periodicity(matched_pairs);
+    grid->refine_global(n_refinements);
+
+    std::shared_ptr < PHiLiP::DGBase<dim, double> > dg_cached = PHiLiP::DGFactory<dim,double>::create_discontinuous_galerkin(&all_parameters_cached, poly_degree, poly_degree, grid_degree, grid);
+    dg_cached->allocate_system ();
+    std::shared_ptr < PHiLiP::DGBase<dim, double> > dg_on_the_fly = PHiLiP::DGFactory<dim,double>::create_discontinuous_galerkin(&all_parameters_on_the_fly, poly_degree, poly_degree, grid_degree, grid);
+    dg_on_the_fly->allocate_system ();
+    std::shared_ptr < PHiLiP::DGBase<dim, double> > dg_reference = PHiLiP::DGFactory<dim,double>::create_discontinuous_galerkin(&all_parameters_cached, poly_degree, poly_degree, grid_degree, grid);
+    dg_reference->allocate_system ();
+
+    std::shared_ptr<InitialConditionFunction<dim,nstate,double>> initial_condition_function
+        = InitialConditionFactory<dim,nstate,double>::create_InitialConditionFunction(&all_parameters_new);
+    SetInitialCondition<dim,nstate,double>::set_initial_condition(initial_condition_function, dg_cached, &all_parameters_new);
+    SetInitialCondition<dim,nstate,double>::set_initial_condition(initial_condition_function, dg_on_the_fly, &all_parameters_new);
+    SetInitialCondition<dim,nstate,double>::set_initial_condition(initial_condition_function, dg_reference, &all_parameters_new);
+
+    int test_fail = 0;
+    const auto compare_residuals = [&] (const std::string &stage) {
+        dg_cached->assemble_residual();
+        dg_on_the_fly->assemble_residual();
+        dealii::LinearAlgebra::distributed::Vector<double> rhs_difference(dg_cached->right_hand_side);
+        rhs_difference -= dg_on_the_fly->right_hand_side;
+        const double rhs_relative_difference = rhs_difference.linfty_norm() / dg_on_the_fly->right_hand_side.linfty_norm();
+        pcout << stage << ": relative difference between the cached and on-the-fly residuals " << rhs_relative_difference << std::endl;
+        if(rhs_relative_difference > 1e-12){
+            pcout << "The residual with cached metric terms does not match the on-the-fly residual." << std::endl;
+            test_fail = 1;
+        }
+    };
+
+    // Fills the cache, then uses it.
+    compare_residuals("Original grid, cache filled");
+    compare_residuals("Original grid, cache used");
+
+    // Moves the interior grid nodes with x -> x + 0.1 sin(x) in every direction.
+    // The periodic boundaries stay in place.
+    for(auto dg : {dg_cached, dg_on_the_fly, dg_reference}){
+        for(const auto inode : dg->high_order_grid->volume_nodes.locally_owned_elements()){
+            const double x = dg->high_order_grid->volume_nodes[inode];
+            dg->high_order_grid->volume_nodes[inode] = x + 0.1 * std::sin(x);
+        }
+        dg->high_order_grid->volume_nodes.update_ghost_values();
+    }
+
+    // The cache of dg_cached is refilled, then used.
+    compare_residuals("Moved grid, cache refilled");
+    compare_residuals("Moved grid, cache used");
+
+    // The cache of dg_reference has only ever been filled on the moved grid.
+    dg_reference->assemble_residual();
+    const double cache_relative_difference = relative_difference<dim>(dg_cached->high_order_grid->metric_terms_cache, dg_reference->high_order_grid->metric_terms_cache);
+    pcout << "Largest relative difference between the refilled and the fresh metric terms " << cache_relative_difference << std::endl;
+    if(cache_relative_difference > 1e-14){
+        pcout << "The refilled metric terms do not match the ones computed on the moved grid." << std::endl;
+        test_fail = 1;
+    }
+
+    if(test_fail){
+        pcout << "Metric terms cache test failed." << std::endl;
+    } else {
+        pcout << "The cached metric terms match the freshly computed ones after the grid moved." << std::endl;
+    }
+    return test_fail;
+}
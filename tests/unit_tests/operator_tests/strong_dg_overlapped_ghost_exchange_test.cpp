@@ -0,0 +1,106 @@
+#include <iomanip>
+#include <cmath>
+#include <limits>
+#include <iostream>
+
+#include <deal.II/base/parameter_handler.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include "dg/dg_base.hpp"
+#include "dg/dg_factory.hpp"
+#include "parameters/all_parameters.h"
+#include "parameters/parameters.h"
+#include "physics/initial_conditions/initial_condition_function.h"
+#include "physics/initial_conditions/set_initial_condition.h"
+
+// Checks that overlapping the ghost exchanges with the assembly of the interior cells, and the
+// compress of the right-hand side with the inverse mass matrix, gives the same explicit update.
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    using namespace PHiLiP;
+    std::cout << std::setprecision(std::numeric_limits<long double>::digits10 + 1) << std::scientific;
+    const int dim = PHILIP_DIM;
+    const int nstate = dim+2;
+    dealii::ParameterHandler parameter_handler;
+    PHiLiP::Parameters::AllParameters::declare_parameters (parameter_handler);
+    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+
+    PHiLiP::Parameters::AllParameters all_parameters_new;
+    all_parameters_new.parse_parameters (parameter_handler);
+    using FlowCaseEnum = Parameters::FlowSolverParam::FlowCaseType;
+    all_parameters_new.flow_solver_param.flow_case_type = FlowCaseEnum::taylor_green_vortex;
+    all_parameters_new.use_weak_form = false;
+    all_parameters_new.use_inverse_mass_on_the_fly = true;
+    using ConvFlux_enum = Parameters::AllParameters::ConvectiveNumericalFlux;
+    all_parameters_new.conv_num_flux_type = ConvFlux_enum::roe;
+    using PDE_enum = Parameters::AllParameters::PartialDifferentialEquation;
+
+    int test_fail = 0;
+    for(unsigned int viscous=0; viscous<2; viscous++){
+        all_parameters_new.pde_type = (viscous == 1) ? PDE_enum::navier_stokes : PDE_enum::euler;
+        all_parameters_new.overlap_ghost_exchange = true;
+
+        using Triangulation = dealii::parallel::distributed::Triangulation<dim>;
+        std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+            MPI_COMM_WORLD,
+            typename dealii::Triangulation<dim>::MeshSmoothing(
+                dealii::Triangulation<dim>::smoothing_on_refinement |
+                dealii::Triangulation<dim>::smoothing_on_coarsening));
+
+        const unsigned int n_refinements = 2;
+        const unsigned int poly_degree = 3;
+        const unsigned int grid_degree = 1;
+
+        double left = 0.0;
+        double right = 2 * dealii::numbers::PI;
+        const bool colorize = true;
+        dealii::GridGenerator::hyper_cube(*grid, left, right, colorize);
+        std::vector<dealii::GridTools::PeriodicFacePair<typename dealii::Triangulation<PHILIP_DIM>::cell_iterator> > matched_pairs;
+        dealii::GridTools::collect_periodic_faces(*grid,0,1,0,matched_pairs);
+        dealii::GridTools::collect_periodic_faces(*grid,2,3,1,matched_pairs);
+        if constexpr(PHILIP_DIM == 3)
+            dealii::GridTools::collect_periodic_faces(*grid,4,5,2,matched_pairs);
+        grid->add_periodicity(matched_pairs);
+        grid->refine_global(n_refinements);
+
+        std::shared_ptr < PHiLiP::DGBase<dim, double> > dg = PHiLiP::DGFactory<dim,double>::create_discontinuous_galerkin(&all_parameters_new, poly_degree, poly_degree, grid_degree, grid);
+        dg->allocate_system ();
+
+        std::shared_ptr<InitialConditionFunction<dim,nstate,double>> initial_condition_function
+            = InitialConditionFactory<dim,nstate,double>::create_InitialConditionFunction(&all_parameters_new);
+        SetInitialCondition<dim,nstate,double>::set_initial_condition(initial_condition_function, dg, &all_parameters_new);
+
+        dealii::LinearAlgebra::distributed::Vector<double> update_overlapped(dg->solution);
+        dg->assemble_residual_and_apply_inverse_mass_matrix(update_overlapped);
+        dealii::LinearAlgebra::distributed::Vector<double> rhs_overlapped(dg->right_hand_side);
+
+        all_parameters_new.overlap_ghost_exchange = false;
+        dealii::LinearAlgebra::distributed::Vector<double> update_blocking(dg->solution);
+        dg->assemble_residual_and_apply_inverse_mass_matrix(update_blocking);
+
+        dealii::LinearAlgebra::distributed::Vector<double> rhs_difference(dg->right_hand_side);
+        rhs_difference -= rhs_overlapped;
+        const double rhs_relative_difference = rhs_difference.linfty_norm() / dg->right_hand_side.linfty_norm();
+        dealii::LinearAlgebra::distributed::Vector<double> update_difference(update_blocking);
+        update_difference -= update_overlapped;
+        const double update_relative_difference = update_difference.linfty_norm() / update_blocking.linfty_norm();
+
+        pcout << (viscous ? "Navier-Stokes" : "Euler")
+              << ": relative residual difference " << rhs_relative_difference
+              << ", relative update difference " << update_relative_difference << std::endl;
+
+        if(rhs_relative_difference > 1e-14 || update_relative_difference > 1e-14){
+            pcout << "The overlapped ghost exchange changed the explicit update." << std::endl;
+            test_fail = 1;
+        }
+    }
+
+    if(test_fail){
+        pcout << "Overlapped ghost exchange test failed." << std::endl;
+    } else {
+        pcout << "The overlapped ghost exchange gives the same explicit update." << std::endl;
+    }
+    return test_fail;
+}
@@ -0,0 +1,173 @@
+#include <iomanip>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <iostream>
+#include <new>
+#include <vector>
+
+#include <deal.II/base/parameter_handler.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/hp/mapping_collection.h>
+
+#include "dg/dg_base.hpp"
+#include "dg/dg_factory.hpp"
+#include "parameters/all_parameters.h"
+#include "parameters/parameters.h"
+#include "physics/initial_conditions/initial_condition_function.h"
+#include "physics/initial_conditions/set_initial_condition.h"
+
+/// Whether operator new counts the heap allocations in n_heap_allocations.
+bool count_heap_allocations = false;
+/// Number of heap allocations made through operator new while count_heap_allocations is set.
+unsigned long n_heap_allocations = 0;
+
+/// Global operator new counting the heap allocations. The array and nothrow versions call it.
+void * operator new (std::size_t size)
+{
+    if (count_heap_allocations) ++n_heap_allocations;
+    if (void *pointer = std::malloc(size == 0 ? 1 : size)) return pointer;
+    throw std::bad_alloc();
+}
+
+/// Global operator delete matching operator new.
+void operator delete (void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+/// Sized global operator delete matching operator new.
+void operator delete (void *pointer, std::size_t /*size*/) noexcept
+{
+    std::free(pointer);
+}
+
+// Checks that once the residual has been assembled, assembling it again does not create or grow
+// any buffer of the scratch arenas, and gives the same residual. The per-cell buffers of
+// DGBase::assemble_cell_residual() are checked with the weak and strong forms, and the buffers
+// of the residual terms with the strong form.
+// With the strong form, the cell loop of the residual is also repeated while every heap allocation
+// made through operator new is counted, and none may be made. The metric terms are cached such that
+// they are not rebuilt for every cell. The deal.II vectors and matrices, which do not allocate through
+// operator new, are covered by the counter of the scratch arenas.
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    using namespace PHiLiP;
+    std::cout << std::setprecision(std::numeric_limits<long double>::digits10 + 1) << std::scientific;
+    const int dim = PHILIP_DIM;
+    const int nstate = dim+2;
+    dealii::ParameterHandler parameter_handler;
+    PHiLiP::Parameters::AllParameters::declare_parameters (parameter_handler);
+    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+
+    PHiLiP::Parameters::AllParameters all_parameters_new;
+    all_parameters_new.parse_parameters (parameter_handler);
+    using FlowCaseEnum = Parameters::FlowSolverParam::FlowCaseType;
+    all_parameters_new.flow_solver_param.flow_case_type = FlowCaseEnum::taylor_green_vortex;
+    using PDE_enum = Parameters::AllParameters::PartialDifferentialEquation;
+    all_parameters_new.pde_type = PDE_enum::navier_stokes;
+    using ConvFlux_enum = Parameters::AllParameters::ConvectiveNumericalFlux;
+
+    int test_fail = 0;
+    for(unsigned int form=0; form<3; form++){
+        const bool split_form = (form == 1);
+        all_parameters_new.use_weak_form = (form == 2);
+        all_parameters_new.use_split_form = split_form;
+        all_parameters_new.conv_num_flux_type = split_form ? ConvFlux_enum::two_point_flux : ConvFlux_enum::roe;
+        all_parameters_new.use_metric_terms_cache = (form != 2);
+        const std::string form_name = (form == 2) ? "Weak form" : (split_form ? "Strong split form" : "Strong form");
+
+        using Triangulation = dealii::parallel::distributed::Triangulation<dim>;
+        std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+            MPI_COMM_WORLD,
+            typename dealii::Triangulation<dim>::MeshSmoothing(
+                dealii::Triangulation<dim>::smoothing_on_refinement |
+                dealii::Triangulation<dim>::smoothing_on_coarsening));
+
+        const unsigned int n_refinements = 2;
+        const unsigned int poly_degree = 3;
+        const unsigned int grid_degree = 1;
+
+        double left = 0.0;
+        double right = 2 * dealii::numbers::PI;
+        const bool colorize = true;
+        dealii::GridGenerator::hyper_cube(*grid, left, right, colorize);
+        std::vector<dealii::GridTools::PeriodicFacePair<typename dealii::Triangulation<PHILIP_DIM>::cell_iterator> > matched_pairs;
+        dealii::GridTools::collect_periodic_faces(*grid,0,1,0,matched_pairs);
+        dealii::GridTools::collect_periodic_faces(*grid,2,3,1,matched_pairs);
+        if constexpr(PHILIP_DIM == 3)
+            dealii::GridTools::collect_periodic_faces(*grid,4,5,2,matched_pairs);
+        grid->add_periodicity(matched_pairs);
+        grid->refine_global(n_refinements);
+
+        std::shared_ptr < PHiLiP::DGBase<dim, double> > dg = PHiLiP::DGFactory<dim,double>::create_discontinuous_galerkin(&all_parameters_new, poly_degree, poly_degree, grid_degree, grid);
+        dg->allocate_system ();
+
+        std::shared_ptr<InitialConditionFunction<dim,nstate,double>> initial_condition_function
+            = InitialConditionFactory<dim,nstate,double>::create_InitialConditionFunction(&all_parameters_new);
+        SetInitialCondition<dim,nstate,double>::set_initial_condition(initial_condition_function, dg, &all_parameters_new);
+
+        // The first evaluation sizes the buffers.
+        dg->assemble_residual();
+        const unsigned int n_allocations_first = dg->n_scratch_arena_allocations();
+        dealii::LinearAlgebra::distributed::Vector<double> rhs_first(dg->right_hand_side);
+
+        // The second evaluation must reuse them.
+        dg->assemble_residual();
+        const unsigned int n_allocations_second = dg->n_scratch_arena_allocations();
+        dealii::LinearAlgebra::distributed::Vector<double> rhs_difference(dg->right_hand_side);
+        rhs_difference -= rhs_first;
+        const double rhs_difference_norm = rhs_difference.linfty_norm();
+
+        pcout << form_name
+              << ": scratch arena allocations after the first residual " << n_allocations_first
+              << ", after the second residual " << n_allocations_second
+              << ", residual difference " << rhs_difference_norm << std::endl;
+
+        if(form != 2){
+            // The locally owned cells are assembled by the same loop as assemble_residual(), once to build the
+            // operators of the new scratch data, and once more with the heap allocations counted.
+            const dealii::hp::MappingCollection<dim> mapping_collection(*(dg->high_order_grid->mapping_fe_field));
+            typename PHiLiP::DGBase<dim,double>::CellResidualScratchData scratch_data(*dg, mapping_collection, *(dg->scratch_arenas[0]));
+            std::vector<typename dealii::DoFHandler<dim>::active_cell_iterator> locally_owned_cells;
+            for (const auto &cell : dg->dof_handler.active_cell_iterators()) {
+                if (cell->is_locally_owned()) locally_owned_cells.push_back(cell);
+            }
+            dg->assemble_cell_residual_range(locally_owned_cells, 0, locally_owned_cells.size(), scratch_data, false, false, false);
+
+            n_heap_allocations = 0;
+            count_heap_allocations = true;
+            dg->assemble_cell_residual_range(locally_owned_cells, 0, locally_owned_cells.size(), scratch_data, false, false, false);
+            count_heap_allocations = false;
+            const unsigned long n_cell_loop_allocations = dealii::Utilities::MPI::max(n_heap_allocations, MPI_COMM_WORLD);
+
+            pcout << form_name << ": heap allocations of the cell loop " << n_cell_loop_allocations << std::endl;
+            if(n_cell_loop_allocations != 0){
+                pcout << "The cell loop of the residual allocated heap memory." << std::endl;
+                test_fail = 1;
+            }
+        }
+
+        if(n_allocations_first == 0){
+            pcout << "The residual did not use the scratch arena." << std::endl;
+            test_fail = 1;
+        }
+        if(n_allocations_second != n_allocations_first){
+            pcout << "The second residual evaluation allocated scratch memory." << std::endl;
+            test_fail = 1;
+        }
+        if(rhs_difference_norm > 1e-14){
+            pcout << "The second residual evaluation does not match the first one." << std::endl;
+            test_fail = 1;
+        }
+    }
+
+    if(test_fail){
+        pcout << "Scratch arena test failed." << std::endl;
+    } else {
+        pcout << "Steady-state residual evaluations do not allocate scratch memory." << std::endl;
+    }
+    return test_fail;
+}
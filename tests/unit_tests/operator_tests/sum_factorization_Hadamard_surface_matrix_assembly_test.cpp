@@ -86,6 +86,7 @@ int main (int argc, char * argv[])
         mass.build_1D_volume_operator(fe_system,quad1D);
         basis.build_1D_volume_operator(fe_system,quad1D);
         basis.build_1D_gradient_operator(fe_system,quad1D);
+        basis.build_surface_Hadamard_operators(quad1D);
         const std::vector<real> &weights = quad1D.get_weights();
 
         const unsigned int n_quad_pts_1D = quad1D.size();
@@ -142,6 +143,25 @@ int main (int argc, char * argv[])
                                                                      weights,
                                                                      basis_sparse,
                                                                      dim_not_zero);
+
+                //the operators stored per degree must match the ones assembled on the fly
+                if(ielement==0){
+                    for(unsigned int index=0; index<row_size; index++){
+                        if(basis.surf_Hadamard_rows_sparsity[iface][index] != Hadamard_rows_sparsity[index]
+                            || basis.surf_Hadamard_columns_sparsity[iface][index] != Hadamard_columns_sparsity[index]){
+                            pcout<<"stored surface sparsity pattern is wrong for face "<<iface<<std::endl;
+                            different = true;
+                        }
+                    }
+                    for(unsigned int irow=0; irow<n_face_quad_pts; irow++){
+                        for(unsigned int icol=0; icol<n_quad_pts_1D; icol++){
+                            if(abs(basis.surf_oper_Hadamard_sparse[iface][irow][icol] - basis_sparse[irow][icol]) > 1e-14){
+                                pcout<<"stored surface basis is wrong for face "<<iface<<std::endl;
+                                different = true;
+                            }
+                        }
+                    }
+                }
                  
                 dealii::FullMatrix<real> sol_1D(n_face_quad_pts, n_quad_pts_1D);//solution of A*u with sum-factorization
                 basis.Hadamard_product(basis_sparse, sol_hat_sparse,sol_1D);
@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <array>
+#include <iomanip>
+#include <cmath>
+#include <limits>
+#include <iostream>
+#include <vector>
+
+#include <deal.II/base/utilities.h>
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/lac/full_matrix.h>
+
+#include "operators/sum_factorization_kernels.h"
+
+/// Fills a matrix with reproducible values of order one.
+void fill_basis(dealii::FullMatrix<double> &basis, const unsigned int seed)
+{
+    for(unsigned int r=0; r<basis.m(); ++r){
+        for(unsigned int c=0; c<basis.n(); ++c){
+            basis(r,c) = std::sin(1.0 + seed + 0.7*r + 1.3*c);
+        }
+    }
+}
+
+/// Entry of the 1D basis in the orientation it is applied in.
+double applied_entry(const dealii::FullMatrix<double> &basis, const bool transpose, const unsigned int r, const unsigned int c)
+{
+    return transpose ? basis(c,r) : basis(r,c);
+}
+
+/// Applies the tensor-product operator as a dense Kronecker product, without sum factorization.
+template <int dim>
+void dense_tensor_product_mult(
+    const std::vector<double> &input,
+    std::vector<double> &output,
+    const std::array<const dealii::FullMatrix<double>*,3> &bases,
+    const bool transpose,
+    const bool adding,
+    const double factor,
+    const unsigned int n_lanes)
+{
+    std::array<unsigned int,3> n_rows = {{1,1,1}};
+    std::array<unsigned int,3> n_columns = {{1,1,1}};
+    for(int idim=0; idim<dim; ++idim){
+        n_rows[idim] = transpose ? bases[idim]->n() : bases[idim]->m();
+        n_columns[idim] = transpose ? bases[idim]->m() : bases[idim]->n();
+    }
+    for(unsigned int rz=0; rz<n_rows[2]; ++rz){
+    for(unsigned int ry=0; ry<n_rows[1]; ++ry){
+    for(unsigned int rx=0; rx<n_rows[0]; ++rx){
+        const unsigned int row = (rz*n_rows[1] + ry)*n_rows[0] + rx;
+        for(unsigned int ilane=0; ilane<n_lanes; ++ilane){
+            double sum = 0.0;
+            for(unsigned int cz=0; cz<n_columns[2]; ++cz){
+            for(unsigned int cy=0; cy<n_columns[1]; ++cy){
+            for(unsigned int cx=0; cx<n_columns[0]; ++cx){
+                const unsigned int column = (cz*n_columns[1] + cy)*n_columns[0] + cx;
+                double entry = applied_entry(*bases[0], transpose, rx, cx);
+                if(dim > 1) entry *= applied_entry(*bases[1], transpose, ry, cy);
+                if(dim > 2) entry *= applied_entry(*bases[2], transpose, rz, cz);
+                sum += entry * input[column*n_lanes + ilane];
+            }
+            }
+            }
+            double &out = output[row*n_lanes + ilane];
+            out = adding ? out + factor*sum : factor*sum;
+        }
+    }
+    }
+    }
+}
+
+// Regression test of the sum-factorization kernels against dense Kronecker products.
+// Covers the compile-time-sized square and facet bases, the runtime-sized square bases above
+// max_static_size_1D, rectangular bases, the transposed bases of the inner product,
+// the overwriting and adding modes, interleaved lanes and in-place application.
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    using namespace PHiLiP::OPERATOR;
+    std::cout << std::setprecision(std::numeric_limits<long double>::digits10 + 1) << std::scientific;
+    const int dim = PHILIP_DIM;
+    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+
+    // 1D sizes as (rows, columns) of the basis in every direction.
+    std::vector<std::array<unsigned int,2>> sizes;
+    for(unsigned int n=1; n<=SumFactorizationKernels::max_static_size_1D+2; ++n){
+        sizes.push_back({{n,n}});     // Volume bases.
+        sizes.push_back({{1,n}});     // Facet bases.
+        sizes.push_back({{n,1}});     // Transposed facet bases.
+        sizes.push_back({{n+1,n}});   // Over-integrated bases.
+    }
+
+    double max_difference = 0.0;
+    unsigned int n_cases = 0;
+    for(const auto &size : sizes){
+    for(const bool transpose : {false, true}){
+    for(const bool adding : {false, true}){
+    for(const unsigned int n_lanes : {1u, 4u}){
+        std::array<dealii::FullMatrix<double>,3> bases;
+        for(int idim=0; idim<3; ++idim){
+            bases[idim].reinit(size[0], size[1]);
+            fill_basis(bases[idim], idim);
+        }
+        const std::array<const dealii::FullMatrix<double>*,3> basis_pointers = {{&bases[0], &bases[1], &bases[2]}};
+
+        const unsigned int n_rows_1D = transpose ? size[1] : size[0];
+        const unsigned int n_columns_1D = transpose ? size[0] : size[1];
+        const unsigned int n_input = std::pow(n_columns_1D, dim) * n_lanes;
+        const unsigned int n_output = std::pow(n_rows_1D, dim) * n_lanes;
+
+        std::vector<double> input(n_input);
+        for(unsigned int i=0; i<n_input; ++i) input[i] = std::cos(0.3 + 0.11*i);
+        std::vector<double> output(n_output), reference(n_output);
+        for(unsigned int i=0; i<n_output; ++i) output[i] = reference[i] = std::sin(0.5 + 0.17*i);
+
+        const double factor = -0.75;
+        if(transpose){
+            SumFactorizationKernels::tensor_product_mult<dim,true,double>(
+                input.data(), output.data(), bases[0], bases[1], bases[2], adding, factor, n_lanes);
+        } else {
+            SumFactorizationKernels::tensor_product_mult<dim,false,double>(
+                input.data(), output.data(), bases[0], bases[1], bases[2], adding, factor, n_lanes);
+        }
+        dense_tensor_product_mult<dim>(input, reference, basis_pointers, transpose, adding, factor, n_lanes);
+
+        double reference_norm = 1.0;
+        for(unsigned int i=0; i<n_output; ++i) reference_norm = std::max(reference_norm, std::abs(reference[i]));
+        for(unsigned int i=0; i<n_output; ++i){
+            max_difference = std::max(max_difference, std::abs(output[i] - reference[i]) / reference_norm);
+        }
+        ++n_cases;
+
+        // In place, for square bases in more than one dimension.
+        if(dim > 1 && size[0] == size[1]){
+            std::vector<double> in_place(input);
+            if(transpose){
+                SumFactorizationKernels::tensor_product_mult<dim,true,double>(
+                    in_place.data(), in_place.data(), bases[0], bases[1], bases[2], false, factor, n_lanes);
+            } else {
+                SumFactorizationKernels::tensor_product_mult<dim,false,double>(
+                    in_place.data(), in_place.data(), bases[0], bases[1], bases[2], false, factor, n_lanes);
+            }
+            std::vector<double> in_place_reference(n_output);
+            dense_tensor_product_mult<dim>(input, in_place_reference, basis_pointers, transpose, false, factor, n_lanes);
+            for(unsigned int i=0; i<n_output; ++i){
+                max_difference = std::max(max_difference, std::abs(in_place[i] - in_place_reference[i]) / reference_norm);
+            }
+            ++n_cases;
+        }
+    }
+    }
+    }
+    }
+
+    pcout << "Largest relative difference between the sum-factorized and dense products over "
+          << n_cases << " cases: " << max_difference << std::endl;
+    if(max_difference > 1e-12){
+        pcout << "The sum-factorization kernels do not match the dense tensor products." << std::endl;
+        return 1;
+    }
+    pcout << "The sum-factorization kernels match the dense tensor products." << std::endl;
+    return 0;
+}
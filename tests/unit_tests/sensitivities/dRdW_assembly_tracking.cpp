@@ -0,0 +1,104 @@
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "dg/dg_factory.hpp"
+#include "global_counter.hpp"
+#include "parameters/parameters.h"
+#include "physics/physics_factory.h"
+
+using PDEType   = PHiLiP::Parameters::AllParameters::PartialDifferentialEquation;
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+/** This test checks that dRdW is only re-assembled when the solution, the grid nodes or the
+ *  mass matrix scaling changed since its last assembly, including when only a single
+ *  processor's entries changed.
+ */
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+    const int nstate = 1;
+
+    dealii::ParameterHandler parameter_handler;
+    Parameters::AllParameters::declare_parameters (parameter_handler);
+    Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+    all_parameters.pde_type = PDEType::advection;
+
+    std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+#if PHILIP_DIM!=1
+        MPI_COMM_WORLD,
+#endif
+        typename dealii::Triangulation<dim>::MeshSmoothing(
+            dealii::Triangulation<dim>::smoothing_on_refinement |
+            dealii::Triangulation<dim>::smoothing_on_coarsening));
+    dealii::GridGenerator::subdivided_hyper_cube(*grid, 4);
+    for (auto &cell : grid->active_cell_iterators()) {
+        for (unsigned int face=0; face<dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+            if (cell->face(face)->at_boundary()) cell->face(face)->set_boundary_id (1000);
+        }
+    }
+
+    const unsigned int poly_degree = 2;
+    std::shared_ptr < DGBase<PHILIP_DIM, double> > dg = DGFactory<PHILIP_DIM,double>::create_discontinuous_galerkin(&all_parameters, poly_degree, grid);
+    dg->allocate_system ();
+
+    std::shared_ptr <Physics::PhysicsBase<dim,nstate,double>> physics_double = Physics::PhysicsFactory<dim, nstate, double>::create_Physics(&all_parameters);
+    dealii::LinearAlgebra::distributed::Vector<double> solution_no_ghost;
+    solution_no_ghost.reinit(dg->locally_owned_dofs, MPI_COMM_WORLD);
+    dealii::VectorTools::interpolate(dg->dof_handler, *(physics_double->manufactured_solution_function), solution_no_ghost);
+    dg->solution = solution_no_ghost;
+    dg->solution.update_ghost_values();
+
+    int test_error = 0;
+    const auto check_assembly = [&] (const std::string &description, const unsigned int expected_n_assemblies, const double CFL_mass = 0.0) {
+        const unsigned int n_assemblies_before = dRdW_form;
+        dg->assemble_residual(true, false, false, CFL_mass);
+        const unsigned int n_assemblies = dRdW_form - n_assemblies_before;
+        pcout << description << ": dRdW assembled " << n_assemblies << " time(s), expected " << expected_n_assemblies << std::endl;
+        if (n_assemblies != expected_n_assemblies) test_error = 1;
+    };
+
+    check_assembly("First assembly", 1);
+    check_assembly("Unchanged solution and grid", 0);
+
+    // Only the processor owning the last degree of freedom sees the change.
+    const dealii::types::global_dof_index last_dof = dg->dof_handler.n_dofs() - 1;
+    double old_value = 0.0;
+    if (dg->locally_owned_dofs.is_element(last_dof)) {
+        old_value = dg->solution[last_dof];
+        dg->solution[last_dof] = old_value + 1e-3;
+    }
+    dg->solution.update_ghost_values();
+    check_assembly("Solution changed on one processor", 1);
+    check_assembly("Unchanged solution and grid", 0);
+
+    if (dg->locally_owned_dofs.is_element(last_dof)) dg->solution[last_dof] = old_value;
+    dg->solution.update_ghost_values();
+    check_assembly("Solution restored", 1);
+
+    const dealii::IndexSet &locally_owned_nodes = dg->high_order_grid->locally_owned_dofs_grid;
+    if (locally_owned_nodes.n_elements() > 0) {
+        const dealii::types::global_dof_index first_node = *locally_owned_nodes.begin();
+        dg->high_order_grid->volume_nodes[first_node] += 1e-8;
+    }
+    dg->high_order_grid->volume_nodes.update_ghost_values();
+    check_assembly("Grid nodes changed", 1);
+
+    check_assembly("Mass matrix scaling changed", 1, 1.0);
+    check_assembly("Unchanged solution, grid and mass matrix scaling", 0, 1.0);
+
+    if (test_error) pcout << "dRdW was not re-assembled exactly when its inputs changed." << std::endl;
+    return test_error;
+}
@@ -0,0 +1,133 @@
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "dg/dg_factory.hpp"
+#include "linear_solver/linear_solver.h"
+#include "parameters/parameters.h"
+#include "physics/physics_factory.h"
+
+using PDEType   = PHiLiP::Parameters::AllParameters::PartialDifferentialEquation;
+using LinearSolverParam = PHiLiP::Parameters::LinearSolverParam;
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+/** This test checks that dRdW assembled into the block_csr storage and its transpose apply like the Trilinos
+ *  system_matrix and its transpose, and that GMRES preconditioned by block-Jacobi and block-ILU(0) solves the implicit time step system with it.
+ */
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+    const int nstate = dim+2;
+
+    dealii::ParameterHandler parameter_handler;
+    Parameters::AllParameters::declare_parameters (parameter_handler);
+    Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+    all_parameters.pde_type = PDEType::euler;
+    all_parameters.linear_solver_param.linear_solver_type = LinearSolverParam::LinearSolverEnum::gmres;
+    all_parameters.linear_solver_param.linear_residual = 1e-10;
+
+    Parameters::AllParameters all_parameters_block = all_parameters;
+    all_parameters_block.linear_solver_param.jacobian_storage = LinearSolverParam::JacobianStorageEnum::block_csr;
+
+    std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+#if PHILIP_DIM!=1
+        MPI_COMM_WORLD,
+#endif
+        typename dealii::Triangulation<dim>::MeshSmoothing(
+            dealii::Triangulation<dim>::smoothing_on_refinement |
+            dealii::Triangulation<dim>::smoothing_on_coarsening));
+    dealii::GridGenerator::subdivided_hyper_cube(*grid, 4);
+    for (auto &cell : grid->active_cell_iterators()) {
+        for (unsigned int face=0; face<dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+            if (cell->face(face)->at_boundary()) cell->face(face)->set_boundary_id (1000);
+        }
+    }
+    // Hanging faces between the blocks.
+    grid->begin_active()->set_refine_flag();
+    grid->execute_coarsening_and_refinement();
+
+    const unsigned int poly_degree = 2;
+    std::shared_ptr < DGBase<PHILIP_DIM, double> > dg = DGFactory<PHILIP_DIM,double>::create_discontinuous_galerkin(&all_parameters, poly_degree, grid);
+    dg->allocate_system ();
+    std::shared_ptr < DGBase<PHILIP_DIM, double> > dg_block = DGFactory<PHILIP_DIM,double>::create_discontinuous_galerkin(&all_parameters_block, poly_degree, grid);
+    dg_block->allocate_system ();
+
+    std::shared_ptr <Physics::PhysicsBase<dim,nstate,double>> physics_double = Physics::PhysicsFactory<dim, nstate, double>::create_Physics(&all_parameters);
+    dealii::LinearAlgebra::distributed::Vector<double> solution_no_ghost;
+    solution_no_ghost.reinit(dg->locally_owned_dofs, MPI_COMM_WORLD);
+    dealii::VectorTools::interpolate(dg->dof_handler, *(physics_double->manufactured_solution_function), solution_no_ghost);
+    dg->solution = solution_no_ghost;
+    dg->solution.update_ghost_values();
+    dg_block->solution = solution_no_ghost;
+    dg_block->solution.update_ghost_values();
+
+    // Implicit time step system M/dt - dRdW, as formed by the implicit ODE solver.
+    const double inverse_dt = 10.0;
+    dg->assemble_residual(true, false, false);
+    dg->system_matrix *= -1.0;
+    dg->add_mass_matrices(inverse_dt);
+    dg_block->assemble_residual(true, false, false);
+    dg_block->block_system_matrix *= -1.0;
+    dg_block->add_mass_matrices(inverse_dt);
+
+    int test_error = 0;
+    if (dg_block->system_matrix.m() != 0) {
+        pcout << "The Trilinos system_matrix should not be allocated with the block_csr storage." << std::endl;
+        test_error = 1;
+    }
+
+    dealii::LinearAlgebra::distributed::Vector<double> x(dg->right_hand_side), y_trilinos(dg->right_hand_side), y_block(dg->right_hand_side);
+    for (const auto i : x.locally_owned_elements()) {
+        x[i] = std::sin(1.0 + 3.0 * i);
+    }
+    dg->system_matrix.vmult(y_trilinos, x);
+    dg_block->block_system_matrix.vmult(y_block, x);
+    y_block -= y_trilinos;
+    const double vmult_difference = y_block.l2_norm() / y_trilinos.l2_norm();
+    pcout << "Relative difference between the block_csr and Trilinos products " << vmult_difference << std::endl;
+    if (vmult_difference > 1e-12) test_error = 1;
+
+    // The transposes, as used by the adjoint solves.
+    dealii::LinearAlgebra::distributed::Vector<double> y_transpose_trilinos(dg->right_hand_side), y_transpose_block(dg->right_hand_side);
+    dg->get_system_matrix_transpose().vmult(y_transpose_trilinos, x);
+    dg_block->get_block_system_matrix_transpose().vmult(y_transpose_block, x);
+    y_transpose_block -= y_transpose_trilinos;
+    const double transpose_vmult_difference = y_transpose_block.l2_norm() / y_transpose_trilinos.l2_norm();
+    pcout << "Relative difference between the block_csr and Trilinos transposed products " << transpose_vmult_difference << std::endl;
+    if (transpose_vmult_difference > 1e-12) test_error = 1;
+
+    const double trilinos_MB = dealii::Utilities::MPI::sum(static_cast<double>(dg->system_matrix.memory_consumption()), MPI_COMM_WORLD) / 1.0e6;
+    const double block_MB = dealii::Utilities::MPI::sum(static_cast<double>(dg_block->block_system_matrix.memory_consumption()), MPI_COMM_WORLD) / 1.0e6;
+    pcout << "Trilinos storage " << trilinos_MB << " MB, block_csr storage " << block_MB << " MB." << std::endl;
+
+    for (const auto preconditioner : { LinearSolverParam::BlockPreconditionerEnum::block_jacobi,
+                                       LinearSolverParam::BlockPreconditionerEnum::block_ilu }) {
+        Parameters::LinearSolverParam linear_solver_param = all_parameters_block.linear_solver_param;
+        linear_solver_param.block_preconditioner = preconditioner;
+
+        dealii::LinearAlgebra::distributed::Vector<double> rhs(y_trilinos), solution(y_trilinos), residual(y_trilinos);
+        const std::pair<unsigned int, double> n_iterations_and_residual = solve_linear(dg_block->block_system_matrix, rhs, solution, linear_solver_param);
+
+        dg->system_matrix.vmult(residual, solution);
+        residual -= rhs;
+        const double relative_residual = residual.l2_norm() / rhs.l2_norm();
+        pcout << "Block preconditioner " << preconditioner << ": " << n_iterations_and_residual.first
+              << " iterations, relative residual with the Trilinos matrix " << relative_residual << std::endl;
+        if (relative_residual > 1e-8) test_error = 1;
+    }
+
+    if (test_error) pcout << "The block_csr storage of dRdW does not reproduce the Trilinos system_matrix." << std::endl;
+    return test_error;
+}
@@ -0,0 +1,201 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <deal.II/base/tensor.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/lac/sparsity_pattern.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "dg/dg_factory.hpp"
+#include "parameters/parameters.h"
+#include "physics/physics_factory.h"
+
+using PDEType   = PHiLiP::Parameters::AllParameters::PartialDifferentialEquation;
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+const double TOLERANCE = 1E-6;
+
+/** This test checks that dRdW of the strong form, assembled with automatic differentiation
+ *  of the residual terms, matches central finite differences of the complete residual.
+ *  With the auxiliary equations, this includes the coupling of the cells two faces apart.
+ */
+template<int dim, int nstate>
+int test (
+    const unsigned int poly_degree,
+    const std::shared_ptr<Triangulation> grid,
+    const PHiLiP::Parameters::AllParameters &all_parameters)
+{
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+    using namespace PHiLiP;
+    std::shared_ptr < DGBase<PHILIP_DIM, double> > dg = DGFactory<PHILIP_DIM,double>::create_discontinuous_galerkin(&all_parameters, poly_degree, grid);
+    dg->allocate_system ();
+
+    pcout << "Poly degree " << poly_degree << " ncells " << grid->n_global_active_cells() << " ndofs: " << dg->dof_handler.n_dofs() << std::endl;
+
+    using solutionVector = dealii::LinearAlgebra::distributed::Vector<double>;
+
+    std::shared_ptr <Physics::PhysicsBase<dim,nstate,double>> physics_double = Physics::PhysicsFactory<dim, nstate, double>::create_Physics(&all_parameters);
+    solutionVector solution_no_ghost;
+    solution_no_ghost.reinit(dg->locally_owned_dofs, MPI_COMM_WORLD);
+    dealii::VectorTools::interpolate(dg->dof_handler, *(physics_double->manufactured_solution_function), solution_no_ghost);
+    dg->solution = solution_no_ghost;
+    for (auto it = dg->solution.begin(); it != dg->solution.end(); ++it) {
+        // Away from the manufactured solution, such that the boundary conditions do not switch
+        // between inflow and outflow within the finite differences.
+        (*it) += 1.0;
+    }
+    dg->solution.update_ghost_values();
+
+    // The sparsity pattern of dRdW includes the cells two faces apart when the auxiliary equations are used.
+    dealii::TrilinosWrappers::SparseMatrix dRdW_fd;
+    dRdW_fd.reinit(dg->locally_owned_dofs, dg->locally_owned_dofs, dg->sparsity_pattern, MPI_COMM_WORLD);
+
+    pcout << "Evaluating dRdW with automatic differentiation..." << std::endl;
+    dg->assemble_residual(true, false, false);
+
+    pcout << "Evaluating FD of the complete residual..." << std::endl;
+    const double relative_step = std::cbrt(std::numeric_limits<double>::epsilon());
+    const unsigned int n_dofs = dg->dof_handler.n_dofs();
+    unsigned int n_missing_entries = 0;
+    for (unsigned int idof = 0; idof < n_dofs; ++idof) {
+        double old_dof = -99999;
+        double eps = 0.0;
+        if (dg->locally_owned_dofs.is_element(idof) ) {
+            old_dof = dg->solution[idof];
+            eps = relative_step * std::max(1.0, std::abs(old_dof));
+            dg->solution(idof) = old_dof+eps;
+        }
+        // The step is only known to the owner of the perturbed degree of freedom.
+        eps = dealii::Utilities::MPI::max(eps, MPI_COMM_WORLD);
+        dg->solution.update_ghost_values();
+        dg->assemble_residual(false, false, false);
+        solutionVector perturbed_residual_p = dg->right_hand_side;
+
+        if (dg->locally_owned_dofs.is_element(idof) ) {
+            dg->solution(idof) = old_dof-eps;
+        }
+        dg->solution.update_ghost_values();
+        dg->assemble_residual(false, false, false);
+        solutionVector perturbed_residual_m = dg->right_hand_side;
+
+        perturbed_residual_p -= perturbed_residual_m;
+        perturbed_residual_p /= (2.0*eps);
+
+        if (dg->locally_owned_dofs.is_element(idof) ) {
+            dg->solution(idof) = old_dof;
+        }
+        dg->solution.update_ghost_values();
+
+        for (const auto iresidual : dg->locally_owned_dofs) {
+            const double drdw_entry = perturbed_residual_p[iresidual];
+            if (std::abs(drdw_entry) >= 1e-12) {
+                // A derivative outside of the sparsity pattern of dRdW is a missing coupling.
+                if (!dg->sparsity_pattern.exists(iresidual, idof)) {
+                    ++n_missing_entries;
+                    continue;
+                }
+                dRdW_fd.add(iresidual,idof,drdw_entry);
+            }
+        }
+    }
+    dRdW_fd.compress(dealii::VectorOperation::add);
+
+    n_missing_entries = dealii::Utilities::MPI::sum(n_missing_entries, MPI_COMM_WORLD);
+    if (n_missing_entries > 0) {
+        pcout << n_missing_entries << " non-zero derivatives are outside of the sparsity pattern of dRdW." << std::endl;
+        return 1;
+    }
+
+    const double dRdW_linf_norm = dg->system_matrix.linfty_norm();
+    dRdW_fd.add(-1.0,dg->system_matrix);
+
+    const double diff_linf_norm = dRdW_fd.linfty_norm() / dRdW_linf_norm;
+    pcout << "(dRdW_FD - dRdW_AD) relative Linf-norm = " << diff_linf_norm << std::endl;
+
+    if (diff_linf_norm > TOLERANCE) return 1;
+    return 0;
+}
+
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+    int error = 0;
+
+    dealii::ParameterHandler parameter_handler;
+    Parameters::AllParameters::declare_parameters (parameter_handler);
+
+    Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+    all_parameters.use_weak_form = false;
+
+    // The split form is tested with the Euler equations.
+    std::vector<PDEType> pde_type {
+        PDEType::advection
+        , PDEType::diffusion
+        , PDEType::euler
+        , PDEType::euler
+        , PDEType::navier_stokes
+    };
+    std::vector<bool> use_split_form { false, false, false, true, false };
+    std::vector<std::string> pde_name {
+        " PDEType::advection "
+        , " PDEType::diffusion "
+        , " PDEType::euler "
+        , " PDEType::euler with split form "
+        , " PDEType::navier_stokes "
+    };
+
+    for (unsigned int ipde = 0; ipde < pde_type.size() && error == 0; ++ipde) {
+        for (unsigned int poly_degree=1; poly_degree<3; ++poly_degree) {
+            for (unsigned int igrid=2; igrid<4; ++igrid) {
+                pcout << "Using " << pde_name[ipde] << std::endl;
+                all_parameters.pde_type = pde_type[ipde];
+                all_parameters.use_split_form = use_split_form[ipde];
+                all_parameters.two_point_num_flux_type = Parameters::AllParameters::TwoPointNumericalFlux::KG;
+                std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+#if PHILIP_DIM!=1
+                    MPI_COMM_WORLD,
+#endif
+                    typename dealii::Triangulation<dim>::MeshSmoothing(
+                        dealii::Triangulation<dim>::smoothing_on_refinement |
+                        dealii::Triangulation<dim>::smoothing_on_coarsening));
+
+                dealii::GridGenerator::subdivided_hyper_cube(*grid, igrid);
+
+                const double random_factor = 0.2;
+                const bool keep_boundary = false;
+                if (random_factor > 0.0) dealii::GridTools::distort_random (random_factor, *grid, keep_boundary);
+                for (auto &cell : grid->active_cell_iterators()) {
+                    for (unsigned int face=0; face<dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+                        if (cell->face(face)->at_boundary()) cell->face(face)->set_boundary_id (1000);
+                    }
+                }
+
+                if ((pde_type[ipde]==PDEType::euler) || (pde_type[ipde]==PDEType::navier_stokes)) {
+                    error = test<dim,dim+2>(poly_degree, grid, all_parameters);
+                } else {
+                    error = test<dim,1>(poly_degree, grid, all_parameters);
+                }
+                if (error) return error;
+            }
+        }
+    }
+
+    return error;
+}
@@ -0,0 +1,92 @@
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include <Epetra_RowMatrixTransposer.h>
+
+#include "dg/dg_factory.hpp"
+#include "parameters/parameters.h"
+#include "physics/physics_factory.h"
+
+using PDEType   = PHiLiP::Parameters::AllParameters::PartialDifferentialEquation;
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+/** This test checks that the transpose of dRdW returned by DGBase::get_system_matrix_transpose(),
+ *  which is only updated in place after the first request, matches a freshly created transpose.
+ */
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+    const int nstate = dim+2;
+
+    dealii::ParameterHandler parameter_handler;
+    Parameters::AllParameters::declare_parameters (parameter_handler);
+    Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+    all_parameters.pde_type = PDEType::euler;
+
+    std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+#if PHILIP_DIM!=1
+        MPI_COMM_WORLD,
+#endif
+        typename dealii::Triangulation<dim>::MeshSmoothing(
+            dealii::Triangulation<dim>::smoothing_on_refinement |
+            dealii::Triangulation<dim>::smoothing_on_coarsening));
+    dealii::GridGenerator::subdivided_hyper_cube(*grid, 4);
+    for (auto &cell : grid->active_cell_iterators()) {
+        for (unsigned int face=0; face<dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+            if (cell->face(face)->at_boundary()) cell->face(face)->set_boundary_id (1000);
+        }
+    }
+
+    const unsigned int poly_degree = 2;
+    std::shared_ptr < DGBase<PHILIP_DIM, double> > dg = DGFactory<PHILIP_DIM,double>::create_discontinuous_galerkin(&all_parameters, poly_degree, grid);
+    dg->allocate_system ();
+
+    std::shared_ptr <Physics::PhysicsBase<dim,nstate,double>> physics_double = Physics::PhysicsFactory<dim, nstate, double>::create_Physics(&all_parameters);
+    dealii::LinearAlgebra::distributed::Vector<double> solution_no_ghost;
+    solution_no_ghost.reinit(dg->locally_owned_dofs, MPI_COMM_WORLD);
+    dealii::VectorTools::interpolate(dg->dof_handler, *(physics_double->manufactured_solution_function), solution_no_ghost);
+    dg->solution = solution_no_ghost;
+    dg->solution.update_ghost_values();
+
+    int test_error = 0;
+    for (unsigned int iassembly = 0; iassembly < 3; ++iassembly) {
+        // Each assembly is done at a different solution, such that the values of dRdW change.
+        for (auto it = dg->solution.begin(); it != dg->solution.end(); ++it) {
+            (*it) *= 1.0 + 0.01 * iassembly;
+        }
+        dg->solution.update_ghost_values();
+        dg->assemble_residual(true, false, false);
+
+        // The first request builds the transpose, the following ones update its values.
+        dealii::TrilinosWrappers::SparseMatrix difference;
+        difference.copy_from(dg->get_system_matrix_transpose());
+
+        Epetra_CrsMatrix *system_matrix_transpose_tril;
+        Epetra_RowMatrixTransposer epmt(const_cast<Epetra_CrsMatrix *>(&dg->system_matrix.trilinos_matrix()));
+        epmt.CreateTranspose(true, system_matrix_transpose_tril);
+        dealii::TrilinosWrappers::SparseMatrix expected_transpose;
+        expected_transpose.reinit(*system_matrix_transpose_tril, true);
+        delete system_matrix_transpose_tril;
+
+        difference.add(-1.0, expected_transpose);
+        const double relative_difference = difference.frobenius_norm() / expected_transpose.frobenius_norm();
+        pcout << "Assembly " << iassembly << ": relative difference with a new transpose " << relative_difference << std::endl;
+        if (relative_difference > 1e-14) test_error = 1;
+    }
+
+    if (test_error) pcout << "The transpose of dRdW updated in place does not match a new transpose." << std::endl;
+    return test_error;
+}
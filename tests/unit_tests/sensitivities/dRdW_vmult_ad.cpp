@@ -0,0 +1,96 @@
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "dg/dg_factory.hpp"
+#include "parameters/parameters.h"
+#include "physics/physics_factory.h"
+
+using PDEType   = PHiLiP::Parameters::AllParameters::PartialDifferentialEquation;
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+/** This test checks that the matrix-free dRdW products evaluated with forward AD directional derivatives
+ *  match the products of the assembled system_matrix, and leave the right-hand side untouched.
+ */
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+    const int nstate = dim+2;
+
+    dealii::ParameterHandler parameter_handler;
+    Parameters::AllParameters::declare_parameters (parameter_handler);
+    Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+    all_parameters.pde_type = PDEType::euler;
+
+    std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+#if PHILIP_DIM!=1
+        MPI_COMM_WORLD,
+#endif
+        typename dealii::Triangulation<dim>::MeshSmoothing(
+            dealii::Triangulation<dim>::smoothing_on_refinement |
+            dealii::Triangulation<dim>::smoothing_on_coarsening));
+    dealii::GridGenerator::subdivided_hyper_cube(*grid, 4);
+    for (auto &cell : grid->active_cell_iterators()) {
+        for (unsigned int face=0; face<dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+            if (cell->face(face)->at_boundary()) cell->face(face)->set_boundary_id (1000);
+        }
+    }
+    // Hanging faces such that the subface terms are differentiated too.
+    grid->begin_active()->set_refine_flag();
+    grid->execute_coarsening_and_refinement();
+
+    const unsigned int poly_degree = 2;
+    std::shared_ptr < DGBase<PHILIP_DIM, double> > dg = DGFactory<PHILIP_DIM,double>::create_discontinuous_galerkin(&all_parameters, poly_degree, grid);
+    dg->allocate_system ();
+
+    int test_error = 0;
+    if (!dg->supports_dRdW_vmult()) {
+        pcout << "The weak form should support the matrix-free dRdW products." << std::endl;
+        return 1;
+    }
+
+    std::shared_ptr <Physics::PhysicsBase<dim,nstate,double>> physics_double = Physics::PhysicsFactory<dim, nstate, double>::create_Physics(&all_parameters);
+    dealii::LinearAlgebra::distributed::Vector<double> solution_no_ghost;
+    solution_no_ghost.reinit(dg->locally_owned_dofs, MPI_COMM_WORLD);
+    dealii::VectorTools::interpolate(dg->dof_handler, *(physics_double->manufactured_solution_function), solution_no_ghost);
+    dg->solution = solution_no_ghost;
+    dg->solution.update_ghost_values();
+
+    dg->assemble_residual(true, false, false);
+    const dealii::LinearAlgebra::distributed::Vector<double> right_hand_side = dg->right_hand_side;
+
+    dealii::LinearAlgebra::distributed::Vector<double> x(dg->right_hand_side), y_assembled(dg->right_hand_side), y_ad(dg->right_hand_side);
+    for (const auto i : x.locally_owned_elements()) {
+        x[i] = std::sin(1.0 + 3.0 * i);
+    }
+    dg->system_matrix.vmult(y_assembled, x);
+    dg->dRdW_vmult(y_ad, x);
+
+    dealii::LinearAlgebra::distributed::Vector<double> difference(y_ad);
+    difference -= y_assembled;
+    const double vmult_difference = difference.l2_norm() / y_assembled.l2_norm();
+    pcout << "Relative difference between the matrix-free and assembled dRdW products " << vmult_difference << std::endl;
+    if (vmult_difference > 1e-12) test_error = 1;
+
+    difference = dg->right_hand_side;
+    difference -= right_hand_side;
+    const double residual_difference = difference.l2_norm() / right_hand_side.l2_norm();
+    // The residual evaluated along the products must not overwrite the right-hand side.
+    pcout << "Relative difference of the right-hand side after the products " << residual_difference << std::endl;
+    if (residual_difference > 1e-12) test_error = 1;
+
+    if (test_error) pcout << "The matrix-free dRdW products do not reproduce the assembled system_matrix." << std::endl;
+    return test_error;
+}
@@ -0,0 +1,111 @@
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "dg/dg_factory.hpp"
+#include "dg/weak_dg.hpp"
+#include "global_counter.hpp"
+#include "parameters/parameters.h"
+#include "physics/physics_factory.h"
+
+using PDEType   = PHiLiP::Parameters::AllParameters::PartialDifferentialEquation;
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+/** This test checks that the tape caches of the taped dRdW, dRdX and d2R do not create any new
+ *  Jacobian or Hessian once every cell type has been assembled, i.e. that the number of allocations
+ *  stays constant across repeated assemblies with a changed solution.
+ */
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+    const int nstate = dim+2;
+
+    dealii::ParameterHandler parameter_handler;
+    Parameters::AllParameters::declare_parameters (parameter_handler);
+    Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+    all_parameters.pde_type = PDEType::euler;
+    all_parameters.use_weak_form = true;
+
+    std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+#if PHILIP_DIM!=1
+        MPI_COMM_WORLD,
+#endif
+        typename dealii::Triangulation<dim>::MeshSmoothing(
+            dealii::Triangulation<dim>::smoothing_on_refinement |
+            dealii::Triangulation<dim>::smoothing_on_coarsening));
+    dealii::GridGenerator::subdivided_hyper_cube(*grid, 4);
+    for (auto &cell : grid->active_cell_iterators()) {
+        for (unsigned int face=0; face<dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+            if (cell->face(face)->at_boundary()) cell->face(face)->set_boundary_id (1000);
+        }
+    }
+    // Hanging faces, whose face terms couple cells with a different number of degrees of freedom.
+    grid->begin_active()->set_refine_flag();
+    grid->execute_coarsening_and_refinement();
+
+    const unsigned int poly_degree = 2;
+    std::shared_ptr < DGBase<PHILIP_DIM, double> > dg = DGFactory<PHILIP_DIM,double>::create_discontinuous_galerkin(&all_parameters, poly_degree, grid);
+    dg->allocate_system ();
+    std::shared_ptr < DGWeak<PHILIP_DIM, nstate, double> > dg_weak = std::dynamic_pointer_cast< DGWeak<PHILIP_DIM, nstate, double> >(dg);
+    if (!dg_weak) {
+        pcout << "The weak-form discretization was not created as a DGWeak." << std::endl;
+        return 1;
+    }
+
+    std::shared_ptr <Physics::PhysicsBase<dim,nstate,double>> physics_double = Physics::PhysicsFactory<dim, nstate, double>::create_Physics(&all_parameters);
+    dealii::LinearAlgebra::distributed::Vector<double> solution_no_ghost;
+    solution_no_ghost.reinit(dg->locally_owned_dofs, MPI_COMM_WORLD);
+    dealii::VectorTools::interpolate(dg->dof_handler, *(physics_double->manufactured_solution_function), solution_no_ghost);
+    dg->solution = solution_no_ghost;
+    dg->solution.update_ghost_values();
+
+    // Set dual to 1.0 so that every 2nd derivative of the residual is taped.
+    for (auto it = dg->dual.begin(); it != dg->dual.end(); ++it) {
+        *it = 1.0;
+    }
+    dg->dual.update_ghost_values();
+
+    int test_error = 0;
+    const unsigned int n_repeats = 3;
+    const auto check_allocations = [&] (const std::string &description, const bool compute_dRdW, const bool compute_dRdX, const bool compute_d2R) {
+        std::vector<unsigned int> n_allocations;
+        for (unsigned int irepeat = 0; irepeat < n_repeats; ++irepeat) {
+            // The derivatives are only re-assembled when the solution changed since their last assembly.
+            dg->solution *= 1.0 + 1e-3;
+            dg->solution.update_ghost_values();
+            const unsigned int n_dRdW_before = dRdW_form;
+            dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R);
+            if (compute_dRdW && dRdW_form == n_dRdW_before) {
+                pcout << description << ": dRdW was not re-assembled." << std::endl;
+                test_error = 1;
+            }
+            n_allocations.push_back(dg_weak->n_tape_cache_allocations());
+            pcout << description << ", assembly " << irepeat+1 << ": " << n_allocations.back() << " tape cache allocations" << std::endl;
+        }
+        for (unsigned int irepeat = 1; irepeat < n_repeats; ++irepeat) {
+            if (n_allocations[irepeat] != n_allocations[0]) {
+                pcout << description << ": the tape caches allocated new Jacobians or Hessians after the first assembly." << std::endl;
+                test_error = 1;
+            }
+        }
+    };
+
+    check_allocations("dRdW", true, false, false);
+    check_allocations("dRdX", false, true, false);
+    check_allocations("d2R", false, false, true);
+
+    if (test_error) pcout << "The tape cache allocations are not constant across repeated assemblies." << std::endl;
+    return test_error;
+}
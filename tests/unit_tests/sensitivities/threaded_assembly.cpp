@@ -0,0 +1,124 @@
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "dg/dg_factory.hpp"
+#include "parameters/parameters.h"
+#include "physics/physics_factory.h"
+
+using PDEType   = PHiLiP::Parameters::AllParameters::PartialDifferentialEquation;
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+/// Relative Frobenius norm of the difference between two matrices with the same sparsity pattern.
+double relative_matrix_difference (
+    const dealii::TrilinosWrappers::SparseMatrix &matrix,
+    const dealii::TrilinosWrappers::SparseMatrix &reference)
+{
+    dealii::TrilinosWrappers::SparseMatrix difference;
+    difference.copy_from(matrix);
+    difference.add(-1.0, reference);
+    return difference.frobenius_norm() / reference.frobenius_norm();
+}
+
+/** This test checks that the right_hand_side, dRdW and dRdX assembled by the threaded cell loop
+ *  match the ones assembled by the single-thread cell loop up to round-off, for the weak and strong forms.
+ *  The weak-form dRdW and dRdX, recorded on the global CoDiPack tape, always use a single thread.
+ */
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+    const int nstate = dim+2;
+
+    const unsigned int n_threads = 4;
+    // MPI_InitFinalize limits each process to a single thread.
+    dealii::MultithreadInfo::set_thread_limit(n_threads);
+
+    dealii::ParameterHandler parameter_handler;
+    Parameters::AllParameters::declare_parameters (parameter_handler);
+    Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+    all_parameters.pde_type = PDEType::euler;
+
+    int test_error = 0;
+    for (const bool use_weak_form : { true, false }) {
+        all_parameters.use_weak_form = use_weak_form;
+        Parameters::AllParameters all_parameters_serial = all_parameters;
+        all_parameters_serial.n_threads_per_process = 1;
+        Parameters::AllParameters all_parameters_threaded = all_parameters;
+        all_parameters_threaded.n_threads_per_process = n_threads;
+
+        std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+#if PHILIP_DIM!=1
+            MPI_COMM_WORLD,
+#endif
+            typename dealii::Triangulation<dim>::MeshSmoothing(
+                dealii::Triangulation<dim>::smoothing_on_refinement |
+                dealii::Triangulation<dim>::smoothing_on_coarsening));
+        dealii::GridGenerator::subdivided_hyper_cube(*grid, 8);
+        for (auto &cell : grid->active_cell_iterators()) {
+            for (unsigned int face=0; face<dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+                if (cell->face(face)->at_boundary()) cell->face(face)->set_boundary_id (1000);
+            }
+        }
+        // Hanging faces, for which the finer neighbors assemble the face terms.
+        if (use_weak_form) {
+            grid->begin_active()->set_refine_flag();
+            grid->execute_coarsening_and_refinement();
+        }
+
+        const unsigned int poly_degree = 2;
+        std::shared_ptr < DGBase<PHILIP_DIM, double> > dg_serial = DGFactory<PHILIP_DIM,double>::create_discontinuous_galerkin(&all_parameters_serial, poly_degree, grid);
+        dg_serial->allocate_system ();
+        std::shared_ptr < DGBase<PHILIP_DIM, double> > dg_threaded = DGFactory<PHILIP_DIM,double>::create_discontinuous_galerkin(&all_parameters_threaded, poly_degree, grid);
+        dg_threaded->allocate_system ();
+
+        std::shared_ptr <Physics::PhysicsBase<dim,nstate,double>> physics_double = Physics::PhysicsFactory<dim, nstate, double>::create_Physics(&all_parameters);
+        dealii::LinearAlgebra::distributed::Vector<double> solution_no_ghost;
+        solution_no_ghost.reinit(dg_serial->locally_owned_dofs, MPI_COMM_WORLD);
+        dealii::VectorTools::interpolate(dg_serial->dof_handler, *(physics_double->manufactured_solution_function), solution_no_ghost);
+        dg_serial->solution = solution_no_ghost;
+        dg_serial->solution.update_ghost_values();
+        dg_threaded->solution = solution_no_ghost;
+        dg_threaded->solution.update_ghost_values();
+
+        const std::string form = use_weak_form ? "Weak form: " : "Strong form: ";
+
+        dg_serial->assemble_residual();
+        dg_threaded->assemble_residual();
+        dealii::LinearAlgebra::distributed::Vector<double> rhs_difference(dg_threaded->right_hand_side);
+        rhs_difference -= dg_serial->right_hand_side;
+        const double rhs_relative_difference = rhs_difference.linfty_norm() / dg_serial->right_hand_side.linfty_norm();
+        pcout << form << "relative difference between the threaded and single-thread residuals " << rhs_relative_difference << std::endl;
+        if (rhs_relative_difference > 1e-13) test_error = 1;
+
+        dg_serial->assemble_residual(true, false, false);
+        dg_threaded->assemble_residual(true, false, false);
+        const double dRdW_relative_difference = relative_matrix_difference(dg_threaded->system_matrix, dg_serial->system_matrix);
+        pcout << form << "relative difference between the threaded and single-thread dRdW " << dRdW_relative_difference << std::endl;
+        if (dRdW_relative_difference > 1e-13) test_error = 1;
+
+        if (use_weak_form) {
+            dg_serial->assemble_residual(false, true, false);
+            dg_threaded->assemble_residual(false, true, false);
+            const double dRdX_relative_difference = relative_matrix_difference(dg_threaded->dRdXv, dg_serial->dRdXv);
+            pcout << form << "relative difference between the threaded and single-thread dRdX " << dRdX_relative_difference << std::endl;
+            if (dRdX_relative_difference > 1e-13) test_error = 1;
+        }
+    }
+
+    if (test_error) pcout << "The threaded assembly does not match the single-thread assembly." << std::endl;
+    return test_error;
+}